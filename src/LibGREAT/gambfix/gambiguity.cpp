@@ -13,6 +13,7 @@
 #include "gutils/gobs.h"
 #include "gmodels/gpar.h"
 #include <gproc/gfltmatrix.h>
+#include <algorithm>
 using namespace std;
 
 namespace great
@@ -67,6 +68,9 @@ namespace great
         _map_NL_decision = dynamic_cast<t_gsetamb *>(_gset)->get_amb_decision("NL");
         _ratio = dynamic_cast<t_gsetamb *>(_gset)->lambda_ratio();
         _boot = dynamic_cast<t_gsetamb *>(_gset)->bootstrapping();
+        _lambda_mode = dynamic_cast<t_gsetamb *>(_gset)->lambda_mode();
+        _lambda_ncan = dynamic_cast<t_gsetamb *>(_gset)->lambda_ncan();
+        _mlambda.ncan(_lambda_ncan);
         _frequency = dynamic_cast<t_gsetproc *>(_gset)->frequency();
         _full_fix_num = dynamic_cast<t_gsetamb *>(_gset)->full_fix_num();
 
@@ -115,8 +119,60 @@ namespace great
         return _amb_fixed;
     }
 
+    string ambmode2str(AMB_MODE mode)
+    {
+        switch (mode)
+        {
+        case AMB_MODE::EWL:
+            return "EWL";
+        case AMB_MODE::EWL24:
+            return "EWL24";
+        case AMB_MODE::EWL25:
+            return "EWL25";
+        case AMB_MODE::WL:
+            return "WL";
+        default:
+            return "NL";
+        }
+    }
+
+    AMB_MODE str2ambmode(const string &str)
+    {
+        if (str == "EWL")
+            return AMB_MODE::EWL;
+        if (str == "EWL24")
+            return AMB_MODE::EWL24;
+        if (str == "EWL25")
+            return AMB_MODE::EWL25;
+        if (str == "WL")
+            return AMB_MODE::WL;
+        return AMB_MODE::NL;
+    }
+
     int t_gambiguity::processBatch(const t_gtime &t, t_gflt *gflt, string mode)
     {
+        t_gamb_cmn amb_cmn(t, gflt);
+        amb_cmn.reset(str2ambmode(mode));
+        return _processStage(amb_cmn, gflt);
+    }
+
+    int t_gambiguity::processCascade(const t_gtime &t, t_gflt *gflt, const vector<AMB_MODE> &modes)
+    {
+        int irc = -1;
+        t_gamb_cmn amb_cmn(t, gflt);
+        for (auto it = modes.begin(); it != modes.end(); it++)
+        {
+            amb_cmn.reset(*it);
+            irc = _processStage(amb_cmn, gflt);
+        }
+        return irc;
+    }
+
+    int t_gambiguity::_processStage(t_gamb_cmn &amb_cmn, t_gflt *gflt)
+    {
+        t_gtime t = amb_cmn.now();
+        const AMB_MODE mode = amb_cmn.amb_mode();
+
         if (_gupd && _gupd->wl_epo_mode())
         { 
             _ewl_Upd_time = t;
@@ -138,38 +194,36 @@ namespace great
         _DD.clear();
         _total_amb_num = _fixed_amb_num = 0;
         _outRatio = 0.0;
-        t_gamb_cmn amb_cmn(t, gflt);
-        amb_cmn.set_mode(mode);
         _crt_time = amb_cmn.now();
 
         int parnum = amb_cmn.param().parNumber();
 
         int koder = 0;
-        if (mode == "EWL")
+        bool *is_first = nullptr;
+        switch (mode)
         {
-            _is_first = _is_first_ewl;
+        case AMB_MODE::EWL:
+            is_first = &_is_first_ewl;
             koder = 3;
-        }
-        else if (mode == "EWL24")
-        {
-            _is_first = _is_first_ewl24;
+            break;
+        case AMB_MODE::EWL24:
+            is_first = &_is_first_ewl24;
             koder = 4;
-        }
-        else if (mode == "EWL25")
-        {
-            _is_first = _is_first_ewl25;
+            break;
+        case AMB_MODE::EWL25:
+            is_first = &_is_first_ewl25;
             koder = 5;
-        }
-        else if (mode == "WL")
-        {
-            _is_first = _is_first_wl;
+            break;
+        case AMB_MODE::WL:
+            is_first = &_is_first_wl;
             koder = 2;
-        }
-        else if (mode == "NL")
-        {
-            _is_first = _is_first_nl;
+            break;
+        case AMB_MODE::NL:
+            is_first = &_is_first_nl;
             koder = 1;
+            break;
         }
+        _is_first = *is_first;
 
         // check if a new ambiguity is dependant of the already selected
         if (_is_first) 
@@ -180,16 +234,7 @@ namespace great
             _is_first = false;
         }
 
-        if (mode == "EWL")
-            _is_first_ewl = _is_first;
-        else if (mode == "EWL24")
-            _is_first_ewl24 = _is_first;
-        else if (mode == "EWL25")
-            _is_first_ewl25 = _is_first;
-        else if (mode == "WL")
-            _is_first_wl = _is_first;
-        else if (mode == "NL")
-            _is_first_nl = _is_first;
+        *is_first = _is_first;
 
         // define double difference ambiguities over one baseline (PPP sd amb.)
         int namb = _defineDDAmb(&amb_cmn);
@@ -200,7 +245,7 @@ namespace great
         // calulate widelane upd for iono_free
         if (_obstype == OBSCOMBIN::RAW_ALL || _obstype == OBSCOMBIN::RAW_MIX)
         {
-            if (mode != "NL" && !_calDDAmbWLALL(&amb_cmn, mode))
+            if (mode != AMB_MODE::NL && !_calDDAmbWLALL(&amb_cmn, mode))
                 return -1;
         }
         else if (_obstype == OBSCOMBIN::IONO_FREE)
@@ -215,7 +260,7 @@ namespace great
 
         // apply UPD correction
         // fix widelane and narrowlane ambiguities
-        if (mode == "NL")
+        if (mode == AMB_MODE::NL)
         {
             if (!_applyUpd(_crt_time))
                 return -1;
@@ -244,7 +289,7 @@ namespace great
         if (ndef < 0)
             return -1;
 
-        if (mode == "WL" || mode == "EWL")
+        if (mode == AMB_MODE::WL || mode == AMB_MODE::EWL)
         {
             for (auto itdd = _DD.begin(); itdd != _DD.end();)
             {
@@ -258,7 +303,7 @@ namespace great
         }
 
         // lambda search
-        if (_fix_mode != FIX_MODE::NO && mode == "NL") 
+        if (_fix_mode != FIX_MODE::NO && mode == AMB_MODE::NL) 
         {
             if (!_ambSolve(&amb_cmn, fixed_amb, mode))
                 return -1;
@@ -272,27 +317,25 @@ namespace great
 
         for (auto it_dd = _DD.begin(); it_dd != _DD.end(); it_dd++) 
         {
-            if (mode == "NL")
+            if (mode == AMB_MODE::NL)
             {
                 it_dd->iwl = _IWL[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])][it_dd->site];
                 it_dd->iewl = _IEWL[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])][it_dd->site];
                 it_dd->iewl24 = _IEWL24[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])];
                 it_dd->iewl25 = _IEWL25[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])];
             }
-            if (mode == "WL")
+            if (mode == AMB_MODE::WL)
                 _IWL[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])][it_dd->site] = it_dd->iwl;
-            if (mode == "EWL")
+            if (mode == AMB_MODE::EWL)
                 _IEWL[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])][it_dd->site] = it_dd->iewl;
-            if (mode == "EWL24")
+            if (mode == AMB_MODE::EWL24)
                 _IEWL24[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])] = it_dd->iewl24;
-            if (mode == "EWL25")
+            if (mode == AMB_MODE::EWL25)
                 _IEWL25[get<0>(it_dd->ddSats[0])][get<0>(it_dd->ddSats[1])] = it_dd->iewl25;
         }
 
-        t_gflt fltpreAMB(*gflt);
-
         // add constraint
-        if (mode == "NL")
+        if (mode == AMB_MODE::NL)
         {
             if (!_addFixConstraint(gflt))
                 return -1;
@@ -339,6 +382,64 @@ namespace great
         return _param;
     }
 
+    void t_gambiguity::checkpoint(t_gcheckpoint &ckp) const
+    {
+        ckp.section("ambiguity");
+        ckp.put(_crt_time);
+        ckp.put(_sat_refs);
+        ckp.put(_WL_flag);
+        ckp.put(_EWL_flag);
+        ckp.put(_EWL24_flag);
+        ckp.put(_EWL25_flag);
+        ckp.put(_IWL);
+        ckp.put(_IEWL);
+        ckp.put(_IEWL24);
+        ckp.put(_IEWL25);
+        ckp.put(_is_first);
+        ckp.put(_is_first_nl);
+        ckp.put(_is_first_wl);
+        ckp.put(_is_first_ewl);
+        ckp.put(_is_first_ewl24);
+        ckp.put(_is_first_ewl25);
+        ckp.put(_amb_fixed);
+        ckp.put(_ewl_Upd_time);
+        ckp.put(_ewl24_Upd_time);
+        ckp.put(_ewl25_Upd_time);
+        ckp.put(_wl_Upd_time);
+        ckp.put(_last_fix_time);
+        ckp.put(_fix_epo_num);
+        ckp.put(_lock_epo_num);
+    }
+
+    void t_gambiguity::restore(t_gcheckpoint &ckp)
+    {
+        ckp.section("ambiguity");
+        ckp.get(_crt_time);
+        ckp.get(_sat_refs);
+        ckp.get(_WL_flag);
+        ckp.get(_EWL_flag);
+        ckp.get(_EWL24_flag);
+        ckp.get(_EWL25_flag);
+        ckp.get(_IWL);
+        ckp.get(_IEWL);
+        ckp.get(_IEWL24);
+        ckp.get(_IEWL25);
+        ckp.get(_is_first);
+        ckp.get(_is_first_nl);
+        ckp.get(_is_first_wl);
+        ckp.get(_is_first_ewl);
+        ckp.get(_is_first_ewl24);
+        ckp.get(_is_first_ewl25);
+        ckp.get(_amb_fixed);
+        ckp.get(_ewl_Upd_time);
+        ckp.get(_ewl24_Upd_time);
+        ckp.get(_ewl25_Upd_time);
+        ckp.get(_wl_Upd_time);
+        ckp.get(_last_fix_time);
+        ckp.get(_fix_epo_num);
+        ckp.get(_lock_epo_num);
+    }
+
     void t_gambiguity::setSatRef(set<string> &satRef)
     {
         _sat_refs = satRef;
@@ -631,10 +732,10 @@ namespace great
             }
 
             _lock_epo_num[it_par->prn] = round((it_par->end - it_par->beg) / _interval) + 1;
-            if (_last_fix_time[amb_cmn->get_mode()].find(it_par->prn) == _last_fix_time[amb_cmn->get_mode()].end())
-                _last_fix_time[amb_cmn->get_mode()][it_par->prn] = FIRST_TIME;
-            if (_fix_epo_num[amb_cmn->get_mode()].find(it_par->prn) == _fix_epo_num[amb_cmn->get_mode()].end())
-                _fix_epo_num[amb_cmn->get_mode()][it_par->prn] = 0;
+            if (_last_fix_time[amb_cmn->amb_mode()].find(it_par->prn) == _last_fix_time[amb_cmn->amb_mode()].end())
+                _last_fix_time[amb_cmn->amb_mode()][it_par->prn] = FIRST_TIME;
+            if (_fix_epo_num[amb_cmn->amb_mode()].find(it_par->prn) == _fix_epo_num[amb_cmn->amb_mode()].end())
+                _fix_epo_num[amb_cmn->amb_mode()][it_par->prn] = 0;
         }
 
         if (params.size() < 2)
@@ -767,7 +868,7 @@ namespace great
         else
             return true;
     }
-    bool t_gambiguity::_calDDAmbWLALL(t_gamb_cmn *amb_cmn, string mode)
+    bool t_gambiguity::_calDDAmbWLALL(t_gamb_cmn *amb_cmn, AMB_MODE mode)
     {
 
         string sat11, sat12, sat21, sat22, ambtype1, ambtype2;
@@ -778,7 +879,7 @@ namespace great
             sat11 = get<0>(itdd->ddSats[0]);
             sat12 = get<0>(itdd->ddSats[1]);
 
-            if (mode == "WL")
+            if (mode == AMB_MODE::WL)
             {
                 if (sat11.substr(0, 1) != "R")
                 {
@@ -795,21 +896,21 @@ namespace great
                 ambtype1 = "AMB_L1";
                 ambtype2 = "AMB_L2";
             }
-            else if (mode == "EWL")
+            else if (mode == AMB_MODE::EWL)
             {
                 lambda_1 = _sys_wavelen[sat11.substr(0, 1)]["L2"];
                 lambda_2 = _sys_wavelen[sat11.substr(0, 1)]["L3"];
                 ambtype1 = "AMB_L2";
                 ambtype2 = "AMB_L3";
             }
-            else if (mode == "EWL24")
+            else if (mode == AMB_MODE::EWL24)
             {
                 lambda_1 = _sys_wavelen[sat11.substr(0, 1)]["L2"];
                 lambda_2 = _sys_wavelen[sat11.substr(0, 1)]["L4"];
                 ambtype1 = "AMB_L2";
                 ambtype2 = "AMB_L4";
             }
-            else if (mode == "EWL25")
+            else if (mode == AMB_MODE::EWL25)
             {
                 lambda_1 = _sys_wavelen[sat11.substr(0, 1)]["L2"];
                 lambda_2 = _sys_wavelen[sat11.substr(0, 1)]["L5"];
@@ -1142,7 +1243,7 @@ namespace great
         return true;
     }
 
-    bool t_gambiguity::_applyWLUpd(t_gtime t, string mode)
+    bool t_gambiguity::_applyWLUpd(t_gtime t, AMB_MODE mode)
     {
         string sat1, sat2;
         double upd_wl1, upd_wl2, upd_ewl1, upd_ewl2, sig;
@@ -1157,10 +1258,10 @@ namespace great
             if (_gupd) 
             {
                 // get Extrawidelane UPD
-                if (_frequency >= 3 && mode == "EWL")
+                if (_frequency >= 3 && mode == AMB_MODE::EWL)
                 {
                     if ((!_getSingleUpd("EWL", _ewl_Upd_time, sat1, upd_ewl1, sig)) || 
-                       (!_getSingleUpd("EWL", _ewl_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL"))
+                       (!_getSingleUpd("EWL", _ewl_Upd_time, sat2, upd_ewl2, sig) && mode == AMB_MODE::EWL))
                     {
                         if (_spdlog)
                             SPDLOG_LOGGER_DEBUG(_spdlog, "Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : EWL, Sat: " + sat1 + " " + sat2);
@@ -1168,10 +1269,10 @@ namespace great
                         continue;
                     }
                 }
-                else if (_frequency >= 4 && mode == "EWL24")
+                else if (_frequency >= 4 && mode == AMB_MODE::EWL24)
                 {
                     if (!_getSingleUpd("EWL24", _ewl24_Upd_time, sat1, upd_ewl1, sig) || 
-                       (!_getSingleUpd("EWL24", _ewl24_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL24"))
+                       (!_getSingleUpd("EWL24", _ewl24_Upd_time, sat2, upd_ewl2, sig) && mode == AMB_MODE::EWL24))
                     {
                         if (_spdlog)
                             SPDLOG_LOGGER_DEBUG(_spdlog, "Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : EWL24, Sat: " + sat1 + " " + sat2);
@@ -1179,10 +1280,10 @@ namespace great
                         continue;
                     }
                 }
-                else if (_frequency == 5 && mode == "EWL25")
+                else if (_frequency == 5 && mode == AMB_MODE::EWL25)
                 {
                     if (!_getSingleUpd("EWL25", _ewl25_Upd_time, sat1, upd_ewl1, sig) || 
-                    (!_getSingleUpd("EWL25", _ewl25_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL25"))
+                    (!_getSingleUpd("EWL25", _ewl25_Upd_time, sat2, upd_ewl2, sig) && mode == AMB_MODE::EWL25))
                     {
                         if (_spdlog)
                             SPDLOG_LOGGER_DEBUG(_spdlog, "Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : EWL25, Sat: " + sat1 + " " + sat2);
@@ -1208,7 +1309,7 @@ namespace great
                     itdd->factor = _sys_wavelen[sat2.substr(0, 1)]["L2"];
                 }
 
-                if (mode == "WL" && itdd->rwl != 0)
+                if (mode == AMB_MODE::WL && itdd->rwl != 0)
                 {
                     itdd->rwl += (-upd_wl1 + upd_wl2);
                     itdd->sd_rwl_cor = (-upd_wl1 + upd_wl2);
@@ -1217,7 +1318,7 @@ namespace great
 
                     continue;
                 }
-                else if (mode == "EWL" && itdd->rwl != 0)
+                else if (mode == AMB_MODE::EWL && itdd->rwl != 0)
                 {
                     itdd->rewl = itdd->rwl + (-upd_ewl1 + upd_ewl2);
                     itdd->sd_rewl_cor = (-upd_ewl1 + upd_ewl2);
@@ -1226,7 +1327,7 @@ namespace great
 
                     continue;
                 }
-                else if (mode == "EWL24" && itdd->rwl != 0)
+                else if (mode == AMB_MODE::EWL24 && itdd->rwl != 0)
                 {
                     itdd->rewl24 = itdd->rwl + (-upd_ewl1 + upd_ewl2);
                     itdd->sd_rewl24_cor = (-upd_ewl1 + upd_ewl2);
@@ -1235,7 +1336,7 @@ namespace great
 
                     continue;
                 }
-                else if (mode == "EWL25" && itdd->rwl != 0)
+                else if (mode == AMB_MODE::EWL25 && itdd->rwl != 0)
                 {
                     itdd->rewl25 = itdd->rwl + (-upd_ewl1 + upd_ewl2);
                     itdd->sd_rewl25_cor = (-upd_ewl1 + upd_ewl2);
@@ -1252,7 +1353,7 @@ namespace great
             }
             else
             { 
-                if (mode == "WL" && itdd->rwl != 0)
+                if (mode == AMB_MODE::WL && itdd->rwl != 0)
                 {
                     itdd->rwl += (-upd_wl1 + upd_wl2);
                     itdd->sd_rwl_cor = (-upd_wl1 + upd_wl2);
@@ -1374,7 +1475,7 @@ namespace great
                 itdd->isNlFixed = true;
             }
 
-            if (_fix_epo_num["NL"][sat1] > 20 && _fix_epo_num["NL"][sat2] > 20 && _lock_epo_num[sat1] > 200 && _lock_epo_num[sat2] > 200)
+            if (_fix_epo_num[AMB_MODE::NL][sat1] > 20 && _fix_epo_num[AMB_MODE::NL][sat2] > 20 && _lock_epo_num[sat1] > 200 && _lock_epo_num[sat2] > 200)
             {
                 if (abs(itdd->rnl - round(itdd->rnl)) < _map_NL_decision["maxdev"] * 1.1)
                 {
@@ -1420,7 +1521,7 @@ namespace great
         return true;
     }
 
-    bool t_gambiguity::_fixAmbWL(string mode)
+    bool t_gambiguity::_fixAmbWL(AMB_MODE mode)
     {
         string sat1, sat2;
 
@@ -1430,7 +1531,7 @@ namespace great
             sat1 = get<0>(itdd->ddSats[0]);
             sat2 = get<0>(itdd->ddSats[1]);
 
-            if (mode == "WL")
+            if (mode == AMB_MODE::WL)
             {
                 if (itdd->rwl == 0)
                     continue;
@@ -1453,7 +1554,7 @@ namespace great
                     }
                 }
             }
-            else if (mode == "EWL")
+            else if (mode == AMB_MODE::EWL)
             {
                 if (itdd->rewl == 0)
                     continue;
@@ -1477,7 +1578,7 @@ namespace great
                     }
                 }
             }
-            else if (mode == "EWL24")
+            else if (mode == AMB_MODE::EWL24)
             {
                 if (itdd->rewl24 == 0)
                     continue;
@@ -1492,7 +1593,7 @@ namespace great
                 }
             }
 
-            else if (mode == "EWL25")
+            else if (mode == AMB_MODE::EWL25)
             {
                 if (itdd->rewl25 == 0)
                     continue;
@@ -1594,33 +1695,61 @@ namespace great
         }
     }
 
+    int t_gambiguity::_gatherQx(const SymmetricMatrix &Qx, int nsat, vector<int> &pos, vector<double> &Qsub)
+    {
+        // ambiguities used by the DDs (sorted, unique)
+        vector<int> idx;
+        idx.reserve(_DD.size() * nsat);
+        for (auto itdd = _DD.begin(); itdd != _DD.end(); itdd++)
+            for (int i = 0; i < nsat; i++)
+                idx.push_back(get<1>(itdd->ddSats[i]));
+        sort(idx.begin(), idx.end());
+        idx.erase(unique(idx.begin(), idx.end()), idx.end());
+
+        pos.resize(_DD.size() * nsat);
+        for (unsigned int k = 0; k < _DD.size(); k++)
+            for (int i = 0; i < nsat; i++)
+                pos[k * nsat + i] = lower_bound(idx.begin(), idx.end(), get<1>(_DD[k].ddSats[i])) - idx.begin();
+
+        int n = idx.size();
+        Qsub.resize(n * n);
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j <= i; j++)
+            {
+                Qsub[i * n + j] = Qx(idx[i], idx[j]);
+                Qsub[j * n + i] = Qsub[i * n + j];
+            }
+        }
+        return n;
+    }
+
     bool t_gambiguity::_prepareCovariance(t_gamb_cmn *amb_cmn, SymmetricMatrix &covariance, vector<double> &value)
     {
-        int row = 0, col = 0;
+        int nDD = _DD.size();
         // set covariance-matrix
-        covariance.resize(_DD.size());
+        covariance.resize(nDD);
         covariance = 0;
-        for (auto itdd1 = _DD.begin(); itdd1 != _DD.end(); itdd1++)
+
+        // DD = D * SD with two +-1 items per row, covariance = D * Qsub * D^T
+        vector<int> pos;
+        vector<double> Qsub;
+        int n = _gatherQx(amb_cmn->Qx(), 2, pos, Qsub);
+
+        for (int row = 0; row < nDD; row++)
         {
             // Row of covariance-matrix
-            value.push_back(itdd1->rnl);
-            row = distance(_DD.begin(), itdd1) + 1;
+            value.push_back(_DD[row].rnl);
+            const double *q1 = &Qsub[pos[2 * row] * n];
+            const double *q2 = &Qsub[pos[2 * row + 1] * n];
 
-            for (auto itdd2 = itdd1; itdd2 != _DD.end(); itdd2++)
+            for (int col = row; col < nDD; col++)
             {
-
                 // Column of covariance-matrix
-                col = distance(_DD.begin(), itdd2) + 1;
+                int c1 = pos[2 * col], c2 = pos[2 * col + 1];
 
-                Matrix Q(2, 2);
-                // Covariance of ambiguity between four satellites
-                Q(1, 1) = amb_cmn->Qx()(get<1>(itdd1->ddSats[0]), get<1>(itdd2->ddSats[0]));
-                Q(1, 2) = amb_cmn->Qx()(get<1>(itdd1->ddSats[0]), get<1>(itdd2->ddSats[1]));
-                Q(2, 1) = amb_cmn->Qx()(get<1>(itdd1->ddSats[1]), get<1>(itdd2->ddSats[0]));
-                Q(2, 2) = amb_cmn->Qx()(get<1>(itdd1->ddSats[1]), get<1>(itdd2->ddSats[1]));
-
-                // Combinatorial transformation
-                covariance(row, col) = (Q(1, 1) - Q(2, 1) - Q(1, 2) + Q(2, 2)) / itdd1->factor / itdd2->factor; // unit [cycle]
+                // Combinatorial transformation of the covariance of ambiguity between four satellites
+                covariance(row + 1, col + 1) = (q1[c1] - q2[c1] - q1[c2] + q2[c2]) / _DD[row].factor / _DD[col].factor; // unit [cycle]
             }
         }
         // Unit weight
@@ -1635,21 +1764,27 @@ namespace great
             return true;
     }
 
-    bool t_gambiguity::_prepareCovarianceWL(t_gamb_cmn *amb_cmn, SymmetricMatrix &covariance, vector<double> &value, string mode)
+    bool t_gambiguity::_prepareCovarianceWL(t_gamb_cmn *amb_cmn, SymmetricMatrix &covariance, vector<double> &value, AMB_MODE mode)
     {
-        int row = 0, col = 0;
+        int nDD = _DD.size();
         double lambda_1 = 0.0, lambda_2 = 0.0;
-        ColumnVector op_dd(4);
+        double op_dd[4] = {0.0};
         // set covariance-matrix
-        covariance.resize(_DD.size());
+        covariance.resize(nDD);
         covariance = 0;
 
-        for (auto itdd1 = _DD.begin(); itdd1 != _DD.end(); itdd1++)
+        // ambiguities of both frequencies: sat1 f1, sat2 f1, sat1 f2, sat2 f2
+        vector<int> pos;
+        vector<double> Qsub;
+        int n = _gatherQx(amb_cmn->Qx(), 4, pos, Qsub);
+
+        for (int row = 0; row < nDD; row++)
         {
-            string sat = get<0>(itdd1->ddSats[0]);
-            if (mode == "WL")
+            const t_dd_ambiguity &dd1 = _DD[row];
+            string sat = get<0>(dd1.ddSats[0]);
+            if (mode == AMB_MODE::WL)
             {
-                if (itdd1->rwl == 0)
+                if (dd1.rwl == 0)
                     continue;
                 if (sat.substr(0, 1) != "R")
                 {
@@ -1662,11 +1797,11 @@ namespace great
                     lambda_2 = _sys_wavelen[sat]["L2"];
                 }
 
-                value.push_back(itdd1->rwl);
+                value.push_back(dd1.rwl);
             }
-            else if (mode == "EWL")
+            else if (mode == AMB_MODE::EWL)
             {
-                if (itdd1->rewl == 0)
+                if (dd1.rewl == 0)
                     continue;
                 if (sat.substr(0, 1) != "R")
                 {
@@ -1679,34 +1814,37 @@ namespace great
                     lambda_2 = _sys_wavelen[sat]["L3"];
                 }
 
-                value.push_back(itdd1->rewl);
+                value.push_back(dd1.rewl);
             }
+            op_dd[0] = 1 / (lambda_1 * lambda_1);
+            op_dd[1] = -1 / (lambda_1 * lambda_2);
+            op_dd[2] = -1 / (lambda_1 * lambda_2);
+            op_dd[3] = 1 / (lambda_2 * lambda_2);
 
             // Row of covariance-matrix
+            const int *r = &pos[4 * row];
+            const double *q0 = &Qsub[r[0] * n], *q1 = &Qsub[r[1] * n], *q2 = &Qsub[r[2] * n], *q3 = &Qsub[r[3] * n];
+            string prn = sat.substr(1);
 
-            row = distance(_DD.begin(), itdd1) + 1;
-
-            for (auto itdd2 = itdd1; itdd2 != _DD.end(); itdd2++)
+            for (int col = row; col < nDD; col++)
             {
-                if (get<0>(itdd1->ddSats[0]).substr(1) != get<0>(itdd2->ddSats[0]).substr(1))
+                if (prn != get<0>(_DD[col].ddSats[0]).substr(1))
                     continue;
                 // Column of covariance-matrix
-                col = distance(_DD.begin(), itdd2) + 1;
-                op_dd << 1 / (lambda_1 * lambda_1) << -1 / (lambda_1 * lambda_2) << -1 / (lambda_1 * lambda_2) << 1 / (lambda_2 * lambda_2);
-                Matrix Q(2, 2);
+                const int *c = &pos[4 * col];
 
                 // Covariance of ambiguity between four satellites
-                Q(1, 1) = amb_cmn->Qx()(get<1>(itdd1->ddSats[0]), get<1>(itdd2->ddSats[0])) * op_dd(1) + amb_cmn->Qx()(get<1>(itdd1->ddSats[0]), get<1>(itdd2->ddSats[2])) * op_dd(2) + amb_cmn->Qx()(get<1>(itdd1->ddSats[2]), get<1>(itdd2->ddSats[0])) * op_dd(3) + amb_cmn->Qx()(get<1>(itdd1->ddSats[2]), get<1>(itdd2->ddSats[2])) * op_dd(4);
-                Q(1, 2) = amb_cmn->Qx()(get<1>(itdd1->ddSats[0]), get<1>(itdd2->ddSats[1])) * op_dd(1) + amb_cmn->Qx()(get<1>(itdd1->ddSats[0]), get<1>(itdd2->ddSats[3])) * op_dd(2) + amb_cmn->Qx()(get<1>(itdd1->ddSats[2]), get<1>(itdd2->ddSats[1])) * op_dd(3) + amb_cmn->Qx()(get<1>(itdd1->ddSats[2]), get<1>(itdd2->ddSats[3])) * op_dd(4);
-                Q(2, 1) = amb_cmn->Qx()(get<1>(itdd1->ddSats[1]), get<1>(itdd2->ddSats[0])) * op_dd(1) + amb_cmn->Qx()(get<1>(itdd1->ddSats[1]), get<1>(itdd2->ddSats[2])) * op_dd(2) + amb_cmn->Qx()(get<1>(itdd1->ddSats[3]), get<1>(itdd2->ddSats[0])) * op_dd(3) + amb_cmn->Qx()(get<1>(itdd1->ddSats[3]), get<1>(itdd2->ddSats[2])) * op_dd(4);
-                Q(2, 2) = amb_cmn->Qx()(get<1>(itdd1->ddSats[1]), get<1>(itdd2->ddSats[1])) * op_dd(1) + amb_cmn->Qx()(get<1>(itdd1->ddSats[1]), get<1>(itdd2->ddSats[3])) * op_dd(2) + amb_cmn->Qx()(get<1>(itdd1->ddSats[3]), get<1>(itdd2->ddSats[1])) * op_dd(3) + amb_cmn->Qx()(get<1>(itdd1->ddSats[3]), get<1>(itdd2->ddSats[3])) * op_dd(4);
+                double Q11 = q0[c[0]] * op_dd[0] + q0[c[2]] * op_dd[1] + q2[c[0]] * op_dd[2] + q2[c[2]] * op_dd[3];
+                double Q12 = q0[c[1]] * op_dd[0] + q0[c[3]] * op_dd[1] + q2[c[1]] * op_dd[2] + q2[c[3]] * op_dd[3];
+                double Q21 = q1[c[0]] * op_dd[0] + q1[c[2]] * op_dd[1] + q3[c[0]] * op_dd[2] + q3[c[2]] * op_dd[3];
+                double Q22 = q1[c[1]] * op_dd[0] + q1[c[3]] * op_dd[1] + q3[c[1]] * op_dd[2] + q3[c[3]] * op_dd[3];
 
                 // Combinatorial transformation
-                covariance(row, col) = (Q(1, 1) - Q(2, 1) - Q(1, 2) + Q(2, 2)); // unit [cycle]
+                covariance(row + 1, col + 1) = (Q11 - Q21 - Q12 + Q22); // unit [cycle]
             }
         }
         // Unit weight
-        covariance = covariance * pow(amb_cmn->sigma0(), 2);
+        covariance *= pow(amb_cmn->sigma0(), 2);
 
         if (value.size() == 0 || covariance.size() == 0)
         {
@@ -1720,16 +1858,16 @@ namespace great
 
     double t_gambiguity::_lambdaSearch(const Matrix &anor, const vector<double> &fltpar, vector<int> &ibias, double *boot)
     {
-        const int maxcan = 2;
+        const int maxcan = _lambda_ncan;
         int namb = fltpar.size();
         int ncan = 0, ipos = 0;
         double ratio = 0.0;
         int i, j;
-        double disall[maxcan] = {0};
-        double *fbias = new double[namb]{0};
-        double *Q = new double[namb * namb]{0};
-        double *cands = new double[namb * maxcan]{0};
-        t_glambda *lambda = new t_glambda();
+        vector<double> disall(maxcan, 0.0);
+        vector<double> fbias(namb, 0.0);
+        vector<double> Q(namb * namb, 0.0);
+        vector<double> cands(namb * maxcan, 0.0);
+        t_glambda lambda;
 
         try
         {
@@ -1740,19 +1878,26 @@ namespace great
                 fbias[i] = fltpar[i] - ibias[i];
 
                 //col
-                for (j = 0; j < namb; j++)
+                for (j = 0; j <= i; j++)
                 {
                     Q[i * namb + j] = anor(i + 1, j + 1);
-                    if (i < j)
-                        Q[i * namb + j] = 0.0;
                 }
             }
 
-            for (i = 0; i < maxcan; i++)
+            if (_lambda_mode == LAMBDA_MODE::MLAMBDA)
             {
-                disall[i] = 0.0;
+                t_gmlambda_stat stat;
+                if (_mlambda.solve(namb, Q.data(), fbias.data(), cands.data(), disall.data(), &stat) < 0)
+                {
+                    ibias.clear();
+                    return 0.0;
+                }
+                *boot = stat.boot;
+            }
+            else
+            {
+                lambda.LAMBDA4(maxcan, namb, Q.data(), fbias.data(), &ncan, &ipos, cands.data(), disall.data(), boot);
             }
-            lambda->LAMBDA4(maxcan, namb, Q, fbias, &ncan, &ipos, cands, disall, boot);
 
             if (double_eq(disall[1], 0.0))
             {
@@ -1763,15 +1908,8 @@ namespace great
                 ratio = disall[1] / disall[0];
             }
 
-            if (!double_eq(ratio, 0.0) && _part_fix && lambda->pDia != NULL)
-            {
-                _mDia.ReSize(namb);
-                _mDia = 0;
-                for (i = 0; i < namb; i++)
-                {
-                    _mDia(i + 1) = lambda->pDia[i];
-                }
-            }
+            if (!double_eq(ratio, 0.0) && _part_fix)
+                _setDia(lambda, namb);
 
             if (ratio < _ratio || *boot < _boot)
                 ibias.clear();
@@ -1782,66 +1920,192 @@ namespace great
                     ibias[i] += round(cands[i * maxcan + 0]);
                 }
             }
-            delete[] fbias;
-            fbias = NULL;
-            delete[] Q;
-            Q = NULL;
-            delete[] cands;
-            cands = NULL;
-            delete lambda;
-            lambda = NULL;
 
             return ratio;
         }
         catch (...)
         {
+            ibias.clear();
+            return 0.0;
+        }
+    }
+
+    double t_gambiguity::_lambdaSearch(t_glambda &lambda, int ndrop, const vector<int> &order, const vector<double> &fltpar, vector<int> &ibias, double *boot)
+    {
+        const int maxcan = _lambda_ncan;
+        int namb = fltpar.size();
+        int nsub = namb - ndrop;
+        int ncan = 0, ipos = 0;
+        double ratio = 0.0;
+        int i;
+        vector<double> disall(maxcan, 0.0);
+
+        ibias.clear();
+        if (nsub <= 0)
+            return 0.0;
 
-            if (fbias != NULL)
+        vector<int> isub(nsub);
+        vector<double> fbias(nsub);
+        vector<double> cands(nsub * maxcan, 0.0);
+
+        try
+        {
+            for (i = 0; i < nsub; i++)
             {
-                delete[] fbias;
-                fbias = NULL;
+                isub[i] = round(fltpar[order[ndrop + i]]);
+                fbias[i] = fltpar[order[ndrop + i]] - isub[i];
             }
-            if (Q != NULL)
+
+            if (_lambda_mode == LAMBDA_MODE::MLAMBDA)
             {
-                delete[] Q;
-                Q = NULL;
+                t_gmlambda_stat stat;
+                if (_mlambda.search(ndrop, fbias.data(), cands.data(), disall.data(), &stat) < 0)
+                    return 0.0;
+                *boot = stat.boot;
             }
-            if (cands != NULL)
+            else
             {
-                delete[] cands;
-                cands = NULL;
+                lambda.PARsearch(ndrop, maxcan, fbias.data(), &ncan, &ipos, cands.data(), disall.data(), boot);
             }
-            if (lambda != NULL)
+
+            if (double_eq(disall[1], 0.0))
             {
-                delete lambda;
-                lambda = NULL;
+                ratio = disall[0];
+            }
+            else
+            {
+                ratio = disall[1] / disall[0];
             }
 
+            if (!double_eq(ratio, 0.0) && _part_fix)
+                _setDia(lambda, nsub);
+
+            if (ratio < _ratio || *boot < _boot)
+                return ratio;
+
+            // back to the order of fltpar, without the dropped DDs
+            vector<int> fixed(namb, 0);
+            vector<bool> dropped(namb, false);
+            for (i = 0; i < ndrop; i++)
+                dropped[order[i]] = true;
+            for (i = 0; i < nsub; i++)
+                fixed[order[ndrop + i]] = isub[i] + round(cands[i * maxcan + 0]);
+            for (i = 0; i < namb; i++)
+            {
+                if (!dropped[i])
+                    ibias.push_back(fixed[i]);
+            }
+
+            return ratio;
+        }
+        catch (...)
+        {
             ibias.clear();
             return 0.0;
         }
     }
 
-    bool t_gambiguity::_ambSolve(t_gamb_cmn *amb_cmn, vector<int> &fixed_amb, string mode)
+    void t_gambiguity::_setDia(const t_glambda &lambda, int namb)
+    {
+        if (_lambda_mode == LAMBDA_MODE::MLAMBDA)
+        {
+            const vector<double> &dia = _mlambda.diag();
+            _mDia.ReSize(namb);
+            for (int i = 0; i < namb; i++)
+                _mDia(i + 1) = dia[i];
+        }
+        else if (lambda.pDia != NULL)
+        {
+            _mDia.ReSize(namb);
+            for (int i = 0; i < namb; i++)
+                _mDia(i + 1) = lambda.pDia[i];
+        }
+    }
+
+    void t_gambiguity::_partOrder(const SymmetricMatrix &covariance, AMB_MODE mode, vector<int> &order)
+    {
+        vector<int> left;
+        for (int i = 0; i < covariance.nrows(); i++)
+            left.push_back(i);
+        order.clear();
+
+        int newamb = 0;
+        while (!left.empty())
+        {
+            double max_diag = 0.0;
+            unsigned int index = 0;
+
+            // newly fixed or tracked satellites first (first two removals)
+            if (newamb < 2)
+            {
+                for (unsigned int i = 0; i < left.size(); i++)
+                {
+                    auto itdd = _DD.begin() + left[i];
+                    if (_fix_epo_num[mode][get<0>(itdd->ddSats[0])] == 0 || _fix_epo_num[mode][get<0>(itdd->ddSats[1])] == 0 || _lock_epo_num[get<0>(itdd->ddSats[0])] < 5 || _lock_epo_num[get<0>(itdd->ddSats[1])] < 5)
+                    {
+                        if (covariance(left[i] + 1, left[i] + 1) > max_diag)
+                        {
+                            max_diag = covariance(left[i] + 1, left[i] + 1);
+                            index = i;
+                        }
+                    }
+                }
+                newamb++;
+            }
+
+            if (max_diag == 0.0)
+            {
+                for (unsigned int i = 0; i < left.size(); i++)
+                {
+                    if (covariance(left[i] + 1, left[i] + 1) > max_diag)
+                    {
+                        max_diag = covariance(left[i] + 1, left[i] + 1);
+                        index = i;
+                    }
+                }
+            }
+
+            // GLONASS DDs always first
+            max_diag = 0.0;
+            for (unsigned int i = 0; i < left.size(); i++)
+            {
+                auto itdd = _DD.begin() + left[i];
+                string sat1 = get<0>(itdd->ddSats[0]);
+                string sat2 = get<0>(itdd->ddSats[1]);
+                if (sat1.substr(0, 1) == "R" && sat2.substr(0, 1) == "R")
+                {
+                    if (covariance(left[i] + 1, left[i] + 1) > max_diag)
+                    {
+                        max_diag = covariance(left[i] + 1, left[i] + 1);
+                        index = i;
+                    }
+                }
+            }
+
+            order.push_back(left[index]);
+            left.erase(left.begin() + index);
+        }
+    }
+
+    bool t_gambiguity::_ambSolve(t_gamb_cmn *amb_cmn, vector<int> &fixed_amb, AMB_MODE mode)
     {
         SymmetricMatrix covariance;
         vector<double> value;
         double ratio = 0.0;
         double boot = 0.0;
-        int index;
         if (_DD.size() < _full_fix_num)
         {
             for (auto itdd = _DD.begin(); itdd != _DD.end(); itdd++)
             {
                 string sat1 = get<0>(itdd->ddSats[0]);
                 string sat2 = get<0>(itdd->ddSats[1]);
-                if (mode == "WL" && _WL_flag[sat1][sat2][itdd->site])
+                if (mode == AMB_MODE::WL && _WL_flag[sat1][sat2][itdd->site])
                     _IWL[sat1][sat2][itdd->site] = itdd->iwl;
-                if (mode == "EWL" && _EWL_flag[sat1][sat2][itdd->site])
+                if (mode == AMB_MODE::EWL && _EWL_flag[sat1][sat2][itdd->site])
                     _IEWL[sat1][sat2][itdd->site] = itdd->iewl;
-                if (mode == "EWL24" && _EWL24_flag[sat1][sat2])
+                if (mode == AMB_MODE::EWL24 && _EWL24_flag[sat1][sat2])
                     _IEWL24[sat1][sat2] = itdd->iewl24;
-                if (mode == "EWL25" && _EWL25_flag[sat1][sat2])
+                if (mode == AMB_MODE::EWL25 && _EWL25_flag[sat1][sat2])
                     _IEWL25[sat1][sat2] = itdd->iewl25;
                 continue;
             }
@@ -1851,7 +2115,7 @@ namespace great
         }
 
         // get covariance-matrix for SD- or DD-ambiguities
-        if (mode == "NL")
+        if (mode == AMB_MODE::NL)
         {
             if (!_prepareCovariance(amb_cmn, covariance, value))
                 return false;
@@ -1863,96 +2127,96 @@ namespace great
         }
 
         // resolve integer ambiguities using LAMBDA-method
-        ratio = _lambdaSearch(covariance, value, fixed_amb, &boot);
+        // partial fixing drops the DDs in an order known in advance, so the covariance is
+        // factorised once (in that order) and every subset reuses the factorisation
+        int namb = value.size();
+        int ndrop = 0;
+        vector<int> order;
+        t_glambda lambda;
+        bool reuse = false;
+        if (_part_fix)
+        {
+            _partOrder(covariance, mode, order);
+            vector<double> Q(namb * namb, 0.0);
+            for (int i = 0; i < namb; i++)
+                for (int j = 0; j <= i; j++)
+                    Q[i * namb + j] = covariance(order[i] + 1, order[j] + 1);
+            if (_lambda_mode == LAMBDA_MODE::MLAMBDA)
+                reuse = (_mlambda.factorize(namb, Q.data()) == 0);
+            else
+                reuse = (lambda.PARinit(namb, Q.data()) == 0);
+        }
+
+        // removes the dropped DDs, positions of fixed_amb refer to the remaining ones
+        auto erase_dropped = [&]() {
+            vector<int> dropped(order.begin(), order.begin() + ndrop);
+            sort(dropped.rbegin(), dropped.rend());
+            for (int idx : dropped)
+                _DD.erase(_DD.begin() + idx);
+        };
+
+        ratio = reuse ? _lambdaSearch(lambda, ndrop, order, value, fixed_amb, &boot)
+                      : _lambdaSearch(covariance, value, fixed_amb, &boot);
         if (ratio > 99.0)
             ratio = 99.0;
-        if (mode == "NL")
+        if (mode == AMB_MODE::NL)
         {
             _os_ratio << "RATIO" << fixed << setw(10) << setprecision(2) << ratio;
             _os_boot << "BOOTSTRAPPING" << fixed << setw(10) << setprecision(2) << boot;
         }
 
         // part amb. fix
-        int newamb = 0;
-        while ((ratio < _ratio || (boot < _boot && mode == "NL")) && _part_fix)
+        while ((ratio < _ratio || (boot < _boot && mode == AMB_MODE::NL)) && _part_fix)
         {
-            double max_diag = 0.0;
-            index = 1;
+            auto itdd_tmp = _DD.begin() + order[ndrop];
 
-            if (newamb < 2)
+            if (mode == AMB_MODE::WL)
             {
-                for (unsigned int i = 1; i <= value.size(); i++)
-                {
-                    auto itdd = _DD.begin() + i - 1;
-                    if (_fix_epo_num[mode][get<0>(itdd->ddSats[0])] == 0 || _fix_epo_num[mode][get<0>(itdd->ddSats[1])] == 0 || _lock_epo_num[get<0>(itdd->ddSats[0])] < 5 || _lock_epo_num[get<0>(itdd->ddSats[1])] < 5)
-                    {
-                        if (covariance(i, i) > max_diag)
-                        {
-                            max_diag = covariance(i, i);
-                            index = i;
-                        }
-                    }
-                }
-                newamb++;
+                _WL_flag[get<0>(itdd_tmp->ddSats[0])][get<0>(itdd_tmp->ddSats[1])][itdd_tmp->site] = false;
             }
-
-            if (max_diag == 0.0)
+            else if (mode == AMB_MODE::EWL)
             {
-                for (unsigned int i = 1; i <= value.size(); i++)
-                {
-                    if (covariance(i, i) > max_diag)
-                    {
-                        max_diag = covariance(i, i);
-                        index = i;
-                    }
-                }
+                _EWL_flag[get<0>(itdd_tmp->ddSats[0])][get<0>(itdd_tmp->ddSats[1])][itdd_tmp->site] = false;
             }
-            max_diag = 0.0;
-            for (unsigned int i = 1; i <= value.size(); i++)
+            ndrop++;
+
+            fixed_amb.clear();
+            if (namb - ndrop <= _part_fix_num || ndrop >= namb)
             {
-                auto itdd = _DD.begin() + i - 1;
-                string sat1, sat2;
-                sat1 = get<0>(itdd->ddSats[0]);
-                sat2 = get<0>(itdd->ddSats[1]);
-                if (sat1.substr(0, 1) == "R" && sat2.substr(0, 1) == "R")
-                {
-                    if (covariance(i, i) > max_diag)
-                    {
-                        max_diag = covariance(i, i);
-                        index = i;
-                    }
-                }
+                erase_dropped();
+                return false;
             }
-            
-            auto itdd_tmp = _DD.begin() + index - 1;
 
-            if (mode == "WL")
+            if (reuse)
             {
-                _WL_flag[get<0>(itdd_tmp->ddSats[0])][get<0>(itdd_tmp->ddSats[1])][itdd_tmp->site] = false;
+                ratio = _lambdaSearch(lambda, ndrop, order, value, fixed_amb, &boot);
             }
-            else if (mode == "EWL")
+            else
             {
-                _EWL_flag[get<0>(itdd_tmp->ddSats[0])][get<0>(itdd_tmp->ddSats[1])][itdd_tmp->site] = false;
+                // singular full matrix, search the remaining DDs from scratch
+                vector<int> left(order.begin() + ndrop, order.end());
+                sort(left.begin(), left.end());
+                SymmetricMatrix covsub(left.size());
+                vector<double> valsub;
+                for (unsigned int i = 0; i < left.size(); i++)
+                {
+                    valsub.push_back(value[left[i]]);
+                    for (unsigned int j = 0; j <= i; j++)
+                        covsub(i + 1, j + 1) = covariance(left[i] + 1, left[j] + 1);
+                }
+                ratio = _lambdaSearch(covsub, valsub, fixed_amb, &boot);
             }
-            Matrix_remRC(covariance, index, index);
-            value.erase(value.begin() + index - 1);
-            _DD.erase(_DD.begin() + index - 1);
-
-            fixed_amb.clear();
-            if (value.size() <= _part_fix_num)
-                return false;
-
-            ratio = _lambdaSearch(covariance, value, fixed_amb, &boot);
 
             if (ratio > 99.0)
                 ratio = 99.0;
-            if (mode == "NL")
+            if (mode == AMB_MODE::NL)
             {
                 _os_ratio << setw(10) << setprecision(2) << ratio;
                 _os_boot << setw(10) << setprecision(2) << boot;
             }
         }
-        if (mode == "NL" && ratio > _ratio && boot > _boot)
+        erase_dropped();
+        if (mode == AMB_MODE::NL && ratio > _ratio && boot > _boot)
         {
             _os_ratio << endl;
             _os_boot << endl;
@@ -1965,7 +2229,7 @@ namespace great
         amb_cmn->set_boot(boot);
 
         // if nl amb. fixed successfully , replace inl with fixed_nlamb
-        if (mode == "WL")
+        if (mode == AMB_MODE::WL)
         {
             if (fixed_amb.size() != 0)
             {
@@ -1986,7 +2250,7 @@ namespace great
                 return false;
             }
         }
-        else if (mode == "EWL")
+        else if (mode == AMB_MODE::EWL)
         {
             if (fixed_amb.size() != 0)
             {
@@ -2006,7 +2270,7 @@ namespace great
                 return false;
             }
         }
-        else if (mode == "NL")
+        else if (mode == AMB_MODE::NL)
         {
             if (fixed_amb.size() != 0)
             {
@@ -2028,7 +2292,7 @@ namespace great
         else
         {
             if (_spdlog)
-                SPDLOG_LOGGER_ERROR(_spdlog, "Error[t_gambiguity::_ambSolve] : Unknown Combination[NL/WL/EWL] : " + mode);
+                SPDLOG_LOGGER_ERROR(_spdlog, "Error[t_gambiguity::_ambSolve] : Unknown Combination[NL/WL/EWL] : " + ambmode2str(mode));
             return false;
         }
     }
@@ -2139,7 +2403,7 @@ namespace great
 
 
 
-    bool t_gambiguity::_addFixConstraintWL(t_gflt *gflt, string mode)
+    bool t_gambiguity::_addFixConstraintWL(t_gflt *gflt, AMB_MODE mode)
     {
         //////========================= Virtual observation equation ===========================================
         double dl = 0.0;
@@ -2156,10 +2420,7 @@ namespace great
         double Bb= 0.0;
         double Bc= 0.0;
         double Bd= 0.0;       // the Coefficient of B matrix
-        SymmetricMatrix _Qx_tmp;
-        t_gflt flttmp(*gflt);
-        _Qx_tmp = gflt->Qx();
-        if (mode == "EWL" || mode == "EWL24" || mode == "EWL25")
+        if (mode == AMB_MODE::EWL || mode == AMB_MODE::EWL24 || mode == AMB_MODE::EWL25)
             p0 = 1E4;
         for (auto itdd = _DD.begin(); itdd != _DD.end(); itdd++)
         {
@@ -2175,7 +2436,7 @@ namespace great
 
             if (sat1.substr(0, 1) != "R")
             {
-                if (mode == "WL")
+                if (mode == AMB_MODE::WL)
                 {
                     if (!itdd->isWlFixed || itdd->rwl == 0)
                         continue;
@@ -2183,7 +2444,7 @@ namespace great
                     lambda_2 = _sys_wavelen[sat1.substr(0, 1)]["L2"];
                     integer = (itdd->iwl - itdd->sd_rwl_cor);
                 }
-                else if (mode == "EWL")
+                else if (mode == AMB_MODE::EWL)
                 {
                     if (!itdd->isEwlFixed || itdd->rewl == 0)
                         continue;
@@ -2191,7 +2452,7 @@ namespace great
                     lambda_2 = _sys_wavelen[sat1.substr(0, 1)]["L3"];
                     integer = (itdd->iewl - itdd->sd_rewl_cor);
                 }
-                else if (mode == "EWL24")
+                else if (mode == AMB_MODE::EWL24)
                 {
                     if (!itdd->isEwl24Fixed || itdd->rewl24 == 0)
                         continue;
@@ -2199,7 +2460,7 @@ namespace great
                     lambda_2 = _sys_wavelen[sat1.substr(0, 1)]["L4"];
                     integer = (itdd->iewl24 - itdd->sd_rewl24_cor);
                 }
-                else if (mode == "EWL25")
+                else if (mode == AMB_MODE::EWL25)
                 {
                     if (!itdd->isEwl25Fixed || itdd->rewl25 == 0)
                         continue;
@@ -2214,7 +2475,7 @@ namespace great
             }
             else
             {
-                if (mode == "WL")
+                if (mode == AMB_MODE::WL)
                 {
                     if (!itdd->isWlFixed || itdd->rwl == 0)
                         continue;
@@ -2428,23 +2689,19 @@ namespace great
     }
 
     t_gamb_cmn::t_gamb_cmn()
+        : _flt(nullptr), _ratio(0.0), _boot(0.0), _amb_fixed(false), _amb_mode(AMB_MODE::NL)
     {
     }
-    t_gamb_cmn::t_gamb_cmn(const t_gtime &t, t_gflt *flt)
+    t_gamb_cmn::t_gamb_cmn(const t_gtime &t, const t_gflt *flt)
     {
 
         _now = t;
-        _param = flt->param();
-        _sigma0 = flt->sigma0();
-        _vtpv = flt->vtpv();
-        _Qx = flt->Qx();
-        _dx = flt->dx();
-        _stdx = flt->stdx();
-        _nobs_total = flt->nobs_total();
-        _npar_number = flt->npar_number();
+        _flt = flt;
         _amb_fixed = false;
         _active_amb.insert(make_pair("", 1));
         _ratio = 0.0;
+        _boot = 0.0;
+        _amb_mode = AMB_MODE::NL;
     }
 
     t_gamb_cmn::~t_gamb_cmn()
@@ -2492,12 +2749,25 @@ namespace great
 
     void t_gamb_cmn::set_mode(string mode)
     {
-        _mode = mode;
+        _amb_mode = str2ambmode(mode);
+    }
+
+    void t_gamb_cmn::reset(AMB_MODE mode)
+    {
+        _amb_mode = mode;
+        _amb_fixed = false;
+        _ratio = 0.0;
+        _boot = 0.0;
+    }
+
+    AMB_MODE t_gamb_cmn::amb_mode() const
+    {
+        return _amb_mode;
     }
 
     string t_gamb_cmn::get_mode()
     {
-        return _mode;
+        return ambmode2str(_amb_mode);
     }
 
     t_gtime t_gamb_cmn::now() const
@@ -2507,27 +2777,31 @@ namespace great
 
     double t_gamb_cmn::sigma0() const
     {
-        return _sigma0;
+        return _flt->sigma0();
     }
 
-    t_gallpar t_gamb_cmn::param() const
+    const t_gallpar &t_gamb_cmn::param() const
     {
-        return _param;
+        return _flt->param();
     }
 
-    ColumnVector t_gamb_cmn::dx() const
+    const ColumnVector &t_gamb_cmn::dx() const
     {
-        return _dx;
+        return _flt->dx();
     }
 
     ColumnVector t_gamb_cmn::stdx() const
     {
-        return _stdx;
+        const SymmetricMatrix &Qx = _flt->Qx();
+        ColumnVector stdx(Qx.Nrows());
+        for (int i = 1; i <= Qx.Nrows(); i++)
+            stdx(i) = sqrt(Qx(i, i)) * _flt->sigma0();
+        return stdx;
     }
 
-    SymmetricMatrix t_gamb_cmn::Qx() const
+    const SymmetricMatrix &t_gamb_cmn::Qx() const
     {
-        return _Qx;
+        return _flt->Qx();
     }
 
 }
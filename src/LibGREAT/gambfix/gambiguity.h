@@ -20,19 +20,40 @@
 #include "gset/gsetamb.h"
 #include "gset/gsetout.h"
 #include "gambfix/glambda.h"
+#include "gambfix/gmlambda.h"
 #include "gambfix/gbdeci.h"
 #include "gambfix/gambcommon.h"
 #include "gutils/gmatrixconv.h"
 #include "gproc/gflt.h"
 #include "gutils/gsys.h"
+#include "gutils/gcheckpoint.h"
 
 using namespace std;
 using namespace gnut;
 
 namespace great
 {
+    /** @brief stages of the cascaded ambiguity resolution. */
+    enum class AMB_MODE
+    {
+        EWL,   ///< extra-wide-lane L2/L3.
+        EWL24, ///< extra-wide-lane L2/L4.
+        EWL25, ///< extra-wide-lane L2/L5.
+        WL,    ///< wide-lane L1/L2.
+        NL     ///< narrow-lane.
+    };
+
+    /** @brief convert AMB_MODE to string (key of the per-mode fixing history). */
+    LibGREAT_LIBRARY_EXPORT string ambmode2str(AMB_MODE mode);
+
+    /** @brief convert string to AMB_MODE, NL for unknown strings. */
+    LibGREAT_LIBRARY_EXPORT AMB_MODE str2ambmode(const string &str);
+
     /**
     * @brief class for storing ambiguity resolution common value.
+    * @note the float solution is not copied, param/dx/Qx are read-only views of the filter.
+    *       The filter is only changed by the fixing constraints at the end of each stage,
+    *       so one object serves all stages of the cascade of an epoch.
     */
     class LibGREAT_LIBRARY_EXPORT t_gamb_cmn
     {
@@ -44,9 +65,9 @@ namespace great
         /**
          * @brief Construct a new t gamb cmn object
          * @param[in]  t         time
-         * @param[in]  flt       filter
+         * @param[in]  flt       filter (not owned, must outlive the object)
          */
-        explicit t_gamb_cmn(const t_gtime &t, t_gflt *flt);
+        explicit t_gamb_cmn(const t_gtime &t, const t_gflt *flt);
         /**
          * @brief Destroy the t gamb cmn object
          */
@@ -93,14 +114,24 @@ namespace great
         double get_boot();
         /**
          * @brief Set the mode
-         * @param[in]  mode      mode
+         * @param[in]  mode      mode (EWL/EWL24/EWL25/WL/NL)
          */
         void set_mode(string mode);
         /**
          * @brief Get the mode
-         * @return string mode
+         * @return string mode (EWL/EWL24/EWL25/WL/NL)
          */
         string get_mode();
+        /**
+         * @brief start a new stage of the cascade, resets ratio, boot and fixed state
+         * @param[in]  mode      mode of the stage
+         */
+        void reset(AMB_MODE mode);
+        /**
+         * @brief Get the mode of the stage
+         * @return AMB_MODE mode
+         */
+        AMB_MODE amb_mode() const;
         /**
          * @brief get now
          * @return t_gtime now
@@ -115,12 +146,12 @@ namespace great
          * @brief get parameter
          * @return t_gallpar parameter
          */
-        t_gallpar param() const;
+        const t_gallpar &param() const;
         /**
          * @brief get correction of parameter
          * @return ColumnVector correction of parameter
          */
-        ColumnVector dx() const;
+        const ColumnVector &dx() const;
         /**
          * @brief get Standard deviation
          * @return ColumnVector Standard deviation
@@ -130,22 +161,16 @@ namespace great
          * @brief get qx
          * @return SymmetricMatrix qx
          */
-        SymmetricMatrix Qx() const;
+        const SymmetricMatrix &Qx() const;
 
     private:
         t_gtime _now;                  ///< now time
-        int _nobs_total, _npar_number; ///< number of observation and parameter
-        double _sigma0;                ///< sigma0
-        double _vtpv;                  ///< vtpv
+        const t_gflt *_flt;            ///< float solution
         double _ratio;                 ///< ratio
         double _boot;                  ///< boot
-        t_gallpar _param;              ///< parameter
-        ColumnVector _dx;              ///< correction of parameter
-        ColumnVector _stdx;            ///< Standard deviation
-        SymmetricMatrix _Qx;           ///< qx
         map<string, int> _active_amb;  ///< acctive ambiguity
         bool _amb_fixed;               ///< whether fixed
-        string _mode;                  ///< mode
+        AMB_MODE _amb_mode;            ///< mode of the stage
     };
     /**
     * @brief class for fix ambiguities epoch-wisely.
@@ -174,6 +199,15 @@ namespace great
         */
         virtual int processBatch(const t_gtime &t, t_gflt *gflt, string mode);
 
+        /**
+        * @brief cascaded ambiguity resolution of one epoch, the stages share one view of the float solution.
+        * @param[in] t          current epoch.
+        * @param[in] gflt       parameters and Qx dx etc.
+        * @param[in] modes      stages in order, e.g. EWL, WL, NL.
+        * @return     result of the last stage, 1 - compute successfully, -1 - failure
+        */
+        virtual int processCascade(const t_gtime &t, t_gflt *gflt, const vector<AMB_MODE> &modes);
+
         bool amb_fixed();
         /**
         *@brief set upd file.
@@ -255,6 +289,18 @@ namespace great
         /** @brief set Active Amb. */
         void setActiveAmb(int max) { _max_active_amb_one_epo = max; }
 
+        /**
+        * @brief save the state carried between epochs (fixed WL/EWL integers, flags, lock counters)
+        * @param[in] ckp        checkpoint open for writing
+        */
+        void checkpoint(t_gcheckpoint &ckp) const;
+
+        /**
+        * @brief restore the state saved by checkpoint()
+        * @param[in] ckp        checkpoint open for reading
+        */
+        void restore(t_gcheckpoint &ckp);
+
     protected:
         CONSTRPAR _crd_est; ///< _crd_est
         OBSCOMBIN _obstype; ///< UDUC/IF ambiguity fixing
@@ -294,6 +340,9 @@ namespace great
         int _part_fix_num;                     ///< if value's size less than num, stop part fix
         double _ratio;                         ///< threshold in LAMBDA method
         double _boot;                          ///< threshold of bootstrapping rate in amb fix
+        LAMBDA_MODE _lambda_mode;              ///< integer search method
+        int _lambda_ncan;                      ///< number of candidates of the integer search
+        t_gmlambda _mlambda;                   ///< MLAMBDA search, workspace reused over epochs
         double _min_common_time;               ///< the Minimum common time of two observation arc
         double* _pdE = nullptr;                ///< pdE
         double* _pdC = nullptr;                ///< pdC
@@ -319,10 +368,10 @@ namespace great
         map<string, map<string,vector<FREQ_SEQ>>> _amb_freqs;     ///< amb freqs
         t_gtime _ewl_Upd_time, _ewl24_Upd_time, _ewl25_Upd_time;  ///< Upd time
         t_gtime _wl_Upd_time;                                     ///< Upd time
-        map<string, map<string, t_gtime>> _last_fix_time;         ///< mode sat time
-        map<string, map<string, int>> _fix_epo_num;               ///< fix epoch number
+        map<AMB_MODE, map<string, t_gtime>> _last_fix_time;       ///< mode sat time
+        map<AMB_MODE, map<string, int>> _fix_epo_num;             ///< fix epoch number
         map<string, int> _lock_epo_num;                           ///< satellite counts until cycle slip
-        map<string, t_DD_amb> _DD_previous;                       ///< DD previous
+        map<AMB_MODE, t_DD_amb> _DD_previous;                     ///< DD previous
         map<string, map<string, int>> _sats_index;                ///< sats index
         int _ctrl_last_fixepo_gap = 999999;                       ///< ctrl last fixepoch gap
         int _ctrl_min_fixed_num = 0;                              ///< ctrl min fixed number
@@ -333,7 +382,7 @@ namespace great
     protected:
         /**
         * @brief get UPD correction for sat
-        * @param[in] mode - UPD mode[optional choose: NL WL]
+        * @param[in] mode - UPD type of the product [EWL EWL24 EWL25 EWL_epoch WL NL], not an AMB_MODE (EWL_epoch has no stage)
         * @return     true - compute successfully , false - failure
         */
         bool _getSingleUpd(string mode, t_gtime t, string sat, double &value, double &sigma);
@@ -344,7 +393,7 @@ namespace great
         * @return     true - compute successfully , false - failure
         */
         bool _applyUpd(t_gtime t);
-        bool _applyWLUpd(t_gtime t, string mode);
+        bool _applyWLUpd(t_gtime t, AMB_MODE mode);
 
         /**
         * @brief check if a new ambiguity is dependant of the already selected set expressed by a set of orth. unit vector Ei.
@@ -361,6 +410,14 @@ namespace great
         */
         bool _checkAmbDepend(bool isFirst, int iNamb, int *iNdef, int iN_oneway, int *arriIpt2ow, int iMaxamb_ow, int iMaxamb_for_check);
 
+        /**
+        * @brief one stage of the cascaded ambiguity resolution.
+        * @param[in] amb_cmn    view of the float solution, reset to the stage.
+        * @param[in] gflt       filter, the fixing constraints are added to it.
+        * @return     1 - compute successfully , -1 - failure
+        */
+        int _processStage(t_gamb_cmn &amb_cmn, t_gflt *gflt);
+
         /**
         /**
         * @brief define double-difference ambiguities over one baseline.
@@ -374,7 +431,7 @@ namespace great
         * @return     true - compute successfully , false - failure
         */
         bool _calDDAmbWL();
-        bool _calDDAmbWLALL(t_gamb_cmn *amb_cmn, string mode);
+        bool _calDDAmbWLALL(t_gamb_cmn *amb_cmn, AMB_MODE mode);
 
         /**
         * @brief fix widelane and narrowlane ambiguities.
@@ -383,7 +440,7 @@ namespace great
         bool _fixAmbIF();
         bool _fixAmbUDUC();
         bool _fixAmbWL();
-        bool _fixAmbWL(string mode);
+        bool _fixAmbWL(AMB_MODE mode);
 
         /**
         * @brief select from (or reorder) a set of DD-ambiguities with their widelane and narrowlane ambiguities.
@@ -407,7 +464,17 @@ namespace great
         * @return     true - compute successfully , false - failure
         */
         bool _prepareCovariance(t_gamb_cmn *amb_cmn, SymmetricMatrix &covariance, vector<double> &value);
-        bool _prepareCovarianceWL(t_gamb_cmn *amb_cmn, SymmetricMatrix &covariance, vector<double> &value, string mode);
+        bool _prepareCovarianceWL(t_gamb_cmn *amb_cmn, SymmetricMatrix &covariance, vector<double> &value, AMB_MODE mode);
+
+        /**
+        * @brief gather the sub-block of Qx of the ambiguities used by the DDs.
+        * @param[in]  Qx     covariance of all parameters
+        * @param[in]  nsat   number of ddSats used per DD
+        * @param[out] pos    per DD nsat positions in the sub-block
+        * @param[out] Qsub   sub-block, row by row
+        * @return     dimension of the sub-block
+        */
+        int _gatherQx(const SymmetricMatrix &Qx, int nsat, vector<int> &pos, vector<double> &Qsub);
 
         /**
         * @brief resolve integer ambiguities using LAMBDA-method.
@@ -419,6 +486,37 @@ namespace great
         */
         double _lambdaSearch(const Matrix &anor, const vector<double> &fltpar, vector<int> &ibias, double *boot);
 
+        /**
+        * @brief resolve integer ambiguities of a partial-fixing subset using the factorisation of
+        *        lambda.PARinit (LAMBDA) or _mlambda.factorize (MLAMBDA).
+        * @param[in] lambda  LAMBDA factorised in drop order
+        * @param[in] ndrop   number of dropped ambiguities (first ndrop of order)
+        * @param[in] order   drop order (indices into fltpar)
+        * @param[in] fltpar  float ambiguities of all DDs
+        * @param[int] ibias  fixed solution of the remaining DDs (in the order of fltpar)
+        * @param[out] ibias
+        * @return      ratio value
+        */
+        double _lambdaSearch(t_glambda &lambda, int ndrop, const vector<int> &order, const vector<double> &fltpar, vector<int> &ibias, double *boot);
+
+        /**
+        * @brief keep the conditional variances of the last search in _mDia.
+        * @param[in] lambda  LAMBDA of the search (not used for MLAMBDA)
+        * @param[in] namb    number of searched ambiguities
+        */
+        void _setDia(const t_glambda &lambda, int namb);
+
+        /**
+        * @brief order in which partial fixing drops the DD ambiguities.
+        * @note  the variances of the remaining DDs do not change when one is removed, so the whole
+        *        sequence is known before the search (GLONASS first, then newly tracked ones, then by variance)
+        * @param[in]  covariance  covariance matrix of DD
+        * @param[in]  mode        NL/WL/EWL
+        * @param[out] order       indices into _DD, first to be dropped first
+        * @return     void
+        */
+        void _partOrder(const SymmetricMatrix &covariance, AMB_MODE mode, vector<int> &order);
+
         /**
         /**
         * @brief resolve integer ambiguities using LAMBDA-method [combination of _prepareCovariance+_lambdaSearch].
@@ -426,7 +524,7 @@ namespace great
         * @param[int] fixed_amb      fixed solution.
         * @return     true - compute successfully , false - failure
         */
-        bool _ambSolve(t_gamb_cmn *amb_cmn, vector<int> &fixed_amb, string mode);
+        bool _ambSolve(t_gamb_cmn *amb_cmn, vector<int> &fixed_amb, AMB_MODE mode);
 
         /**
         * @brief applied fixing constraints into Qx to get the fixed solutiond.
@@ -434,7 +532,7 @@ namespace great
         * @return     true - compute successfully , false - failure
         */
         bool _addFixConstraint(t_gflt *gflt);
-        bool _addFixConstraintWL(t_gflt *gflt, string mode);
+        bool _addFixConstraintWL(t_gflt *gflt, AMB_MODE mode);
 
         /**
         * @brief init ratio-file.
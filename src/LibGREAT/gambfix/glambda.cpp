@@ -452,6 +452,94 @@ namespace great
     {
         double *pdL = new double[iN * iN];
         double *pdD = new double[iN];
+        int i, j, iz;
+
+        iz = 0;
+        for (i = 1; i <= iN; i++)
+        {
+            for (j = 1; j <= iN; j++)
+            {
+                iz++;
+                pdL[(i - 1) * iN + j - 1] = pdQ[iz - 1];
+            }
+        }
+
+        /*make the L_1   D_1   L_1    decomposition of the variance - covariance matrix Q_hat{ a }*/
+        if (t_glambda::FMFAC6(pdL, pdD, iN, 1e-9) < 0)
+        {
+            delete[] pdL;
+            pdL = nullptr;
+            delete[] pdD;
+            pdD = nullptr;
+
+            throw("ERROR in FMFAC6: LD failed");
+        }
+
+        try
+        {
+            t_glambda::LAMBDAfac(iMaxCan, iN, pdL, pdD, pdA, piNcan, piPos, pdCands, pdDisall, boot);
+        }
+        catch (...)
+        {
+            delete[] pdL;
+            delete[] pdD;
+            throw;
+        }
+        delete[] pdL;
+        pdL = nullptr;
+        delete[] pdD;
+        pdD = nullptr;
+        return;
+    }
+
+    int t_glambda::PARinit(int iN, const double *pdQ)
+    {
+        _parN = 0;
+        _parL.assign(pdQ, pdQ + iN * iN);
+        _parD.assign(iN, 0.0);
+
+        // Q = L^T D L is factorised from the last ambiguity on, so the trailing block
+        // of L and D is the factorisation of the trailing block of Q
+        if (t_glambda::FMFAC6(_parL.data(), _parD.data(), iN, 1e-9) < 0)
+            return -1;
+
+        _parN = iN;
+        return 0;
+    }
+
+    void t_glambda::PARsearch(int iDrop, int iMaxCan, double *pdA, int *piNcan, int *piPos, double *pdCands, double *pdDisall, double *boot)
+    {
+        int iN = _parN - iDrop;
+        if (_parN == 0 || iDrop < 0 || iN < 2)
+        {
+            throw("ERROR in PARsearch: no factorisation for the subset");
+        }
+
+        double *pdL = new double[iN * iN];
+        double *pdD = new double[iN];
+        for (int i = 0; i < iN; i++)
+        {
+            memcpy(pdL + i * iN, _parL.data() + (i + iDrop) * _parN + iDrop, iN * sizeof(double));
+            pdD[i] = _parD[i + iDrop];
+        }
+
+        try
+        {
+            t_glambda::LAMBDAfac(iMaxCan, iN, pdL, pdD, pdA, piNcan, piPos, pdCands, pdDisall, boot);
+        }
+        catch (...)
+        {
+            delete[] pdL;
+            delete[] pdD;
+            throw;
+        }
+        delete[] pdL;
+        delete[] pdD;
+        return;
+    }
+
+    void t_glambda::LAMBDAfac(int iMaxCan, int iN, double *pdL, double *pdD, double *pdA, int *piNcan, int *piPos, double *pdCands, double *pdDisall, double *boot)
+    {
         double *pdZt = new double[iN * iN];
         double *pdV1 = new double[iN];
         double *pdV2 = new double[iN + 1];
@@ -460,7 +548,7 @@ namespace great
         double *pdV5 = new double[iN];
         double *pdV6 = new double[iN];
         double *pdAk = new double[iN];
-        int i, j, k, iz;
+        int i, j, k;
         double dH;
         double dEps;
         double dChi_1;
@@ -468,13 +556,10 @@ namespace great
         double dt;
 
         /* initialize Zt=unit matrix*/
-        iz = 0;
         for (i = 1; i <= iN; i++)
         {
             for (j = 1; j <= iN; j++)
             {
-                iz++;
-                pdL[(i - 1) * iN + j - 1] = pdQ[iz - 1];
                 pdZt[(i - 1) * iN + j - 1] = 0.0;
             }
             pdZt[(i - 1) * iN + i - 1] = 1e0;
@@ -498,35 +583,6 @@ namespace great
             pdA[i - 1] = pdV1[i - 1];
         }
 
-        /*make the L_1   D_1   L_1    decomposition of the variance - covariance matrix Q_hat{ a }*/
-        dEps = 1e-9;
-
-        if (t_glambda::FMFAC6(pdL, pdD, iN, dEps) < 0)
-        {
-            delete[] pdL;
-            pdL = nullptr;
-            delete[] pdD;
-            pdD = nullptr;
-            delete[] pdZt;
-            pdZt = nullptr;
-            delete[] pdV1;
-            pdV1 = nullptr;
-            delete[] pdV2;
-            pdV2 = nullptr;
-            delete[] pdV3;
-            pdV3 = nullptr;
-            delete[] pdV4;
-            pdV4 = nullptr;
-            delete[] pdV5;
-            pdV5 = nullptr;
-            delete[] pdV6;
-            pdV6 = nullptr;
-            delete[] pdAk;
-            pdAk = nullptr;
-
-            throw("ERROR in FMFAC6: LD failed");
-        }
-
         /*compute the Z - transformation based on L and D of Q,
         ambiguities are transformed according to \hat{ z } = Z^* \hat{ a }*/
         t_glambda::SRC1i(iN, pdL, pdD, pdA, pdZt);
@@ -543,8 +599,13 @@ namespace great
         the t_glambda - transformed L and D as they came from SRC1)*/
         t_glambda::INVLT2d(iN, pdL, pdL, pdV1);
 
-        if (pDia == NULL)
+        if (pDia == NULL || _nDia < iN)
+        {
+            if (pDia)
+                delete[] pDia;
             pDia = new double[iN];
+            _nDia = iN;
+        }
         //... and D_1
         for (i = 1; i <= iN; i++)
         {
@@ -564,10 +625,6 @@ namespace great
 
         if (*piNcan >= 10000)
         {
-            delete[] pdL;
-            pdL = nullptr;
-            delete[] pdD;
-            pdD = nullptr;
             delete[] pdZt;
             pdZt = nullptr;
             delete[] pdV1;
@@ -610,25 +667,30 @@ namespace great
             pdA[i - 1] = pdCands[(i - 1) * iMaxCan + *piPos - 1] + pdAk[i - 1];
         }
 
-        /*'sort' the vector of squared norms in increasing order
-        (if ipos equals 2, the best candidate is in the second place : so reverse disall)*/
-        if (*piPos == 2)
+        /*sort the vector of squared norms in increasing order, with more than two
+        candidates the best two are not necessarily in the first places*/
+        int iNsort = (*piNcan) < iMaxCan ? (*piNcan) : iMaxCan;
+        for (k = 1; k < iNsort; k++)
         {
-            dH = pdDisall[0];
-            pdDisall[0] = pdDisall[1];
-            pdDisall[1] = dH;
-
+            int iMin = k;
+            for (j = k + 1; j <= iNsort; j++)
+            {
+                if (pdDisall[j - 1] < pdDisall[iMin - 1])
+                    iMin = j;
+            }
+            if (iMin == k)
+                continue;
+            dH = pdDisall[k - 1];
+            pdDisall[k - 1] = pdDisall[iMin - 1];
+            pdDisall[iMin - 1] = dH;
             for (i = 1; i <= iN; i++)
             {
-                dH = pdCands[(i - 1) * iMaxCan];
-                pdCands[(i - 1) * iMaxCan] = pdCands[(i - 1) * iMaxCan + 1];
-                pdCands[(i - 1) * iMaxCan + 1] = dH;
+                dH = pdCands[(i - 1) * iMaxCan + k - 1];
+                pdCands[(i - 1) * iMaxCan + k - 1] = pdCands[(i - 1) * iMaxCan + iMin - 1];
+                pdCands[(i - 1) * iMaxCan + iMin - 1] = dH;
             }
         }
-        delete[] pdL;
-        pdL = nullptr;
-        delete[] pdD;
-        pdD = nullptr;
+        *piPos = 1;
         delete[] pdZt;
         pdZt = nullptr;
         delete[] pdV1;
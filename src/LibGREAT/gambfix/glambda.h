@@ -11,6 +11,7 @@
 #ifndef GLAMBDA_H
 #define GLAMBDA_H
 
+#include <vector>
 #include "gexport/ExportLibGREAT.h"
 using namespace std;
 
@@ -48,6 +49,44 @@ namespace great
         */
         void LAMBDA4(int iMaxCan, int iN, double *pdQ, double *pdA, int *piNcan, int *piPos, double *pdCands, double *pdDisall, double *boot);
 
+        /**
+        * @brief factorise Q once for partial ambiguity resolution with ordered subsets
+        * @note the ambiguities must be ordered so that the ones to be dropped first come first,
+        *       every subset searched by PARsearch is a trailing block of this factorisation
+        * @note the search space of a subset is the one of LAMBDA4 on the reduced matrix, but the
+        *       results are not bit-identical: the factorisation in drop order changes the Z decorrelation,
+        *       the bootstrapping success rate and the order of the candidates
+        * @param[in] iN     dimension of matrix
+        * @param[in] pdQ    covariance matrix (lower triangle, row by row)
+        * @return 0 if factorised, -1 if Q is singular
+        */
+        int PARinit(int iN, const double *pdQ);
+
+        /**
+        * @brief integer estimation of the last (iN - iDrop) ambiguities of PARinit, no new factorisation
+        * @param[in] iDrop    number of dropped (leading) ambiguities
+        * @param[in] iMaxCan  number of candidates
+        * @param[in] pdA      float ambiguities of the subset (length iN - iDrop)
+        * @param[in] piNcan
+        * @param[in] piPos
+        * @param[in] pdCands   2-dimensional array to store the candidates
+        * @param[in] pdDisall  according squared norms
+        * @param[in] boot      bootstrapping rate of the subset
+        * @return void
+        */
+        void PARsearch(int iDrop, int iMaxCan, double *pdA, int *piNcan, int *piPos, double *pdCands, double *pdDisall, double *boot);
+
+        /**
+        * @brief LAMBDA decorrelation and search starting from the L D L factorisation of Q
+        * @param[in] iMaxCan
+        * @param[in] iN        dimension of matrix
+        * @param[in] pdL       lower triangular matrix L of FMFAC6 (overwritten)
+        * @param[in] pdD       diagonal D of FMFAC6 (overwritten)
+        * @param[in] pdA, piNcan, piPos, pdCands, pdDisall, boot  see LAMBDA4
+        * @return void
+        */
+        void LAMBDAfac(int iMaxCan, int iN, double *pdL, double *pdD, double *pdA, int *piNcan, int *piPos, double *pdCands, double *pdDisall, double *boot);
+
         /**
         * @brief backtrack in the search tree, internal subroutine for FI71.
         * @param[in] iN      dimension of matrix
@@ -222,10 +261,16 @@ namespace great
         * @param[in]  sigma
         * @return res
         */
-        double pBootStrapping(const double &sig);
+        static double pBootStrapping(const double &sig);
 
     public:
         double *pDia = NULL;  ///< ptr
+
+    protected:
+        int _nDia = 0;            ///< size of pDia
+        int _parN = 0;            ///< dimension of the partial AR factorisation
+        vector<double> _parL;     ///< L of the partial AR factorisation
+        vector<double> _parD;     ///< D of the partial AR factorisation
     };
 
 }
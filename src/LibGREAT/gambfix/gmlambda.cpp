@@ -0,0 +1,293 @@
+/**
+ * @file         gmlambda.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        integer estimation with the modified LAMBDA method (MLAMBDA).
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#include "gambfix/gmlambda.h"
+#include "gambfix/glambda.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+namespace great
+{
+    static inline double _sgn(double x)
+    {
+        return x <= 0.0 ? -1.0 : 1.0;
+    }
+
+    t_gmlambda::t_gmlambda(int ncan)
+        : _ncan(2),
+          _n(0)
+    {
+        this->ncan(ncan);
+    }
+
+    t_gmlambda::~t_gmlambda()
+    {
+    }
+
+    void t_gmlambda::ncan(int n)
+    {
+        _ncan = max(n, 2);
+    }
+
+    int t_gmlambda::factorize(int n, const double *pdQ, double eps)
+    {
+        _n = 0;
+        if (n <= 0 || !pdQ)
+            return -1;
+
+        // Q = L' D L, from the last row up (the trailing blocks stay factorisations of the trailing blocks of Q)
+        if (_A.size() < size_t(n * n))
+            _A.resize(n * n);
+        double *A = _A.data();
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j <= i; j++)
+                A[i * n + j] = pdQ[i * n + j];
+
+        _L.assign(n * n, 0.0);
+        _D.assign(n, 0.0);
+        for (int i = n - 1; i >= 0; i--)
+        {
+            // relative to the diagonal of Q, as FMFAC6
+            if ((_D[i] = A[i * n + i]) <= pdQ[i * n + i] * eps)
+                return -1;
+            double a = sqrt(_D[i]);
+            for (int j = 0; j <= i; j++)
+                _L[i * n + j] = A[i * n + j] / a;
+            for (int j = 0; j <= i - 1; j++)
+                for (int k = 0; k <= j; k++)
+                    A[j * n + k] -= _L[i * n + k] * _L[i * n + j];
+            for (int j = 0; j <= i; j++)
+                _L[i * n + j] /= _L[i * n + i];
+        }
+        _n = n;
+        return 0;
+    }
+
+    int t_gmlambda::search(int ndrop, const double *pdA, double *pdF, double *pdS, t_gmlambda_stat *stat)
+    {
+        int n = _n - ndrop;
+        if (_n <= 0 || n <= 0 || ndrop < 0)
+            return -1;
+
+        // trailing block of the factorisation
+        _Lz.resize(n * n);
+        _Dz.resize(n);
+        for (int i = 0; i < n; i++)
+        {
+            _Dz[i] = _D[ndrop + i];
+            for (int j = 0; j < n; j++)
+                _Lz[i * n + j] = _L[(ndrop + i) * _n + ndrop + j];
+        }
+
+        _reduction(n);
+
+        // z = Z' a
+        _zs.assign(n, 0.0);
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < n; i++)
+                _zs[j] += _Z[i * n + j] * pdA[i];
+
+        if (_search(n, stat) < 0)
+            return -1;
+
+        // a = Z'^-1 z, integers
+        for (int i = 0; i < n; i++)
+        {
+            for (int k = 0; k < _ncan; k++)
+            {
+                double f = 0.0;
+                for (int j = 0; j < n; j++)
+                    f += _Zti[i * n + j] * _zn[j * _ncan + k];
+                pdF[i * _ncan + k] = floor(f + 0.5);
+            }
+        }
+        for (int k = 0; k < _ncan; k++)
+            pdS[k] = _dist[n + k];
+
+        if (stat)
+        {
+            stat->ratio = (pdS[0] > 0.0) ? pdS[1] / pdS[0] : 0.0;
+            stat->boot = 1.0;
+            for (int i = 0; i < n; i++)
+                stat->boot *= t_glambda::pBootStrapping(sqrt(_Dz[i]));
+        }
+        return 0;
+    }
+
+    int t_gmlambda::solve(int n, const double *pdQ, const double *pdA, double *pdF, double *pdS, t_gmlambda_stat *stat)
+    {
+        if (factorize(n, pdQ) < 0)
+            return -1;
+        return search(0, pdA, pdF, pdS, stat);
+    }
+
+    void t_gmlambda::_gauss(int n, int i, int j)
+    {
+        double mu = floor(_Lz[i * n + j] + 0.5);
+        if (mu == 0.0)
+            return;
+        for (int k = i; k < n; k++)
+            _Lz[k * n + j] -= mu * _Lz[k * n + i];
+        for (int k = 0; k < n; k++)
+        {
+            _Z[k * n + j] -= mu * _Z[k * n + i];
+            _Zti[k * n + i] += mu * _Zti[k * n + j];
+        }
+    }
+
+    void t_gmlambda::_perm(int n, int j, double del)
+    {
+        double eta = _Dz[j] / del;
+        double lam = _Dz[j + 1] * _Lz[(j + 1) * n + j] / del;
+        _Dz[j] = eta * _Dz[j + 1];
+        _Dz[j + 1] = del;
+        for (int k = 0; k <= j - 1; k++)
+        {
+            double a0 = _Lz[j * n + k];
+            double a1 = _Lz[(j + 1) * n + k];
+            _Lz[j * n + k] = -_Lz[(j + 1) * n + j] * a0 + a1;
+            _Lz[(j + 1) * n + k] = eta * a0 + lam * a1;
+        }
+        _Lz[(j + 1) * n + j] = lam;
+        for (int k = j + 2; k < n; k++)
+            swap(_Lz[k * n + j], _Lz[k * n + j + 1]);
+        for (int k = 0; k < n; k++)
+        {
+            swap(_Z[k * n + j], _Z[k * n + j + 1]);
+            swap(_Zti[k * n + j], _Zti[k * n + j + 1]);
+        }
+    }
+
+    void t_gmlambda::_reduction(int n)
+    {
+        _Z.assign(n * n, 0.0);
+        _Zti.assign(n * n, 0.0);
+        for (int i = 0; i < n; i++)
+            _Z[i * n + i] = _Zti[i * n + i] = 1.0;
+
+        int j = n - 2, k = n - 2;
+        while (j >= 0)
+        {
+            if (j <= k)
+                for (int i = j + 1; i < n; i++)
+                    _gauss(n, i, j);
+            double del = _Dz[j] + _Lz[(j + 1) * n + j] * _Lz[(j + 1) * n + j] * _Dz[j + 1];
+            if (del + 1E-6 < _Dz[j + 1])
+            {
+                _perm(n, j, del);
+                k = j;
+                j = n - 2;
+            }
+            else
+                j--;
+        }
+    }
+
+    int t_gmlambda::_search(int n, t_gmlambda_stat *stat)
+    {
+        // _dist: n partial distances followed by the ncan squared norms of the candidates
+        _zb.assign(n, 0.0);
+        _z.assign(n, 0.0);
+        _step.assign(n, 0.0);
+        _dist.assign(n + _ncan, 0.0);
+        _S.assign(n * n, 0.0);
+        _zn.assign(n * _ncan, 0.0);
+        double *s = &_dist[n];
+
+        int nn = 0, imax = 0, k = n - 1;
+        long nodes = 0;
+        double maxdist = 1E99, y;
+
+        _zb[k] = _zs[k];
+        _z[k] = floor(_zb[k] + 0.5);
+        y = _zb[k] - _z[k];
+        _step[k] = _sgn(y);
+        for (; nodes < MLAMBDA_MAXNODES; nodes++)
+        {
+            double newdist = _dist[k] + y * y / _Dz[k];
+            if (newdist < maxdist)
+            {
+                if (k != 0)
+                {
+                    // down one level
+                    _dist[--k] = newdist;
+                    for (int i = 0; i <= k; i++)
+                        _S[k * n + i] = _S[(k + 1) * n + i] + (_z[k + 1] - _zb[k + 1]) * _Lz[(k + 1) * n + i];
+                    _zb[k] = _zs[k] + _S[k * n + k];
+                    _z[k] = floor(_zb[k] + 0.5);
+                    y = _zb[k] - _z[k];
+                    _step[k] = _sgn(y);
+                }
+                else
+                {
+                    // candidate found, the ellipsoid shrinks once ncan candidates are stored
+                    if (nn < _ncan)
+                    {
+                        if (nn == 0 || newdist > s[imax])
+                            imax = nn;
+                        for (int i = 0; i < n; i++)
+                            _zn[i * _ncan + nn] = _z[i];
+                        s[nn++] = newdist;
+                    }
+                    else
+                    {
+                        if (newdist < s[imax])
+                        {
+                            for (int i = 0; i < n; i++)
+                                _zn[i * _ncan + imax] = _z[i];
+                            s[imax] = newdist;
+                            for (int i = imax = 0; i < _ncan; i++)
+                                if (s[imax] < s[i])
+                                    imax = i;
+                        }
+                        maxdist = s[imax];
+                    }
+                    _z[0] += _step[0];
+                    y = _zb[0] - _z[0];
+                    _step[0] = -_step[0] - _sgn(_step[0]);
+                }
+            }
+            else
+            {
+                // up one level
+                if (k == n - 1)
+                    break;
+                k++;
+                _z[k] += _step[k];
+                y = _zb[k] - _z[k];
+                _step[k] = -_step[k] - _sgn(_step[k]);
+            }
+        }
+
+        if (stat)
+        {
+            stat->nodes = nodes;
+            stat->ncan = nn;
+        }
+        if (nodes >= MLAMBDA_MAXNODES || nn < _ncan)
+            return -1;
+
+        // candidates by ascending norm
+        for (int i = 0; i < _ncan - 1; i++)
+        {
+            for (int j = i + 1; j < _ncan; j++)
+            {
+                if (s[i] <= s[j])
+                    continue;
+                swap(s[i], s[j]);
+                for (int l = 0; l < n; l++)
+                    swap(_zn[l * _ncan + i], _zn[l * _ncan + j]);
+            }
+        }
+        return 0;
+    }
+}
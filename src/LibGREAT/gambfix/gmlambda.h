@@ -0,0 +1,126 @@
+/**
+ * @file         gmlambda.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        integer estimation with the modified LAMBDA method (MLAMBDA).
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   X.-W. Chang, X. Yang, T. Zhou, MLAMBDA: a modified LAMBDA method for integer
+ *   least-squares estimation, J. Geod. 79 (2005).
+ *
+ *   Q = L' D L           L unit lower triangular, factorised from the last row up
+ *   reduction            integer Gauss transforms and symmetric pivoting (Z unimodular)
+ *   search               depth first, the ellipsoid shrinks with every candidate
+ *
+ *   The factorisation of a trailing block of Q is the trailing block of the
+ *   factorisation, so subsets for partial fixing are searched without a new one.
+ *   The search space is the one of a new factorisation of the subset, the
+ *   decorrelation, bootstrapping rate and candidate order are not bit-identical.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#ifndef GMLAMBDA_H
+#define GMLAMBDA_H
+
+#include <vector>
+#include "gexport/ExportLibGREAT.h"
+using namespace std;
+
+#define MLAMBDA_MAXNODES 1000000 ///< maximum number of visited nodes in the search tree
+
+namespace great
+{
+    /** @brief statistics of one MLAMBDA search. */
+    struct LibGREAT_LIBRARY_EXPORT t_gmlambda_stat
+    {
+        double ratio = 0.0; ///< ratio of the second best to the best squared norm
+        double boot = 0.0;  ///< bootstrapping success rate of the decorrelated ambiguities
+        int ncan = 0;       ///< number of candidates found
+        long nodes = 0;     ///< number of visited nodes in the search tree
+    };
+
+    /**
+    * @brief class for MLAMBDA search, the object is the workspace and is reused between calls.
+    */
+    class LibGREAT_LIBRARY_EXPORT t_gmlambda
+    {
+    public:
+        /**
+        * @brief constructor.
+        * @param[in] ncan     number of candidates (at least 2)
+        */
+        explicit t_gmlambda(int ncan = 2);
+
+        /** @brief default destructor. */
+        virtual ~t_gmlambda();
+
+        /** @brief set/get number of candidates. */
+        void ncan(int n);
+        int ncan() const { return _ncan; }
+
+        /**
+        * @brief factorise Q = L' D L, kept for search()
+        * @param[in] n      dimension of matrix
+        * @param[in] pdQ    covariance matrix n x n, only the lower triangle (row by row) is used
+        * @param[in] eps    singularity tolerance relative to the diagonal of Q (as FMFAC6)
+        * @return 0 if factorised, -1 if Q is not positive definite
+        */
+        int factorize(int n, const double *pdQ, double eps = 1e-9);
+
+        /**
+        * @brief integer least-squares of the last (n - ndrop) ambiguities of factorize()
+        * @param[in]  ndrop   number of dropped (leading) ambiguities
+        * @param[in]  pdA     float ambiguities (length n - ndrop)
+        * @param[out] pdF     candidates, (n - ndrop) x ncan, row by row (pdF[i * ncan + k])
+        * @param[out] pdS     squared norms of the candidates, ascending (length ncan)
+        * @param[out] stat    statistics, may be NULL
+        * @return 0 if found, -1 on failure (not factorised or search aborted)
+        */
+        int search(int ndrop, const double *pdA, double *pdF, double *pdS, t_gmlambda_stat *stat = nullptr);
+
+        /**
+        * @brief factorize() and search() of all ambiguities
+        * @return 0 if found, -1 on failure
+        */
+        int solve(int n, const double *pdQ, const double *pdA, double *pdF, double *pdS, t_gmlambda_stat *stat = nullptr);
+
+        /** @brief conditional variances of the decorrelated ambiguities of the last search. */
+        const vector<double> &diag() const { return _Dz; }
+
+    protected:
+        /** @brief integer Gauss transform of column j by row i. */
+        void _gauss(int n, int i, int j);
+
+        /** @brief symmetric permutation of j and j + 1. */
+        void _perm(int n, int j, double del);
+
+        /** @brief decorrelation of _Lz, _Dz, builds _Z and _Zti. */
+        void _reduction(int n);
+
+        /** @brief depth first search of _ncan candidates of _zs, -1 if too many nodes. */
+        int _search(int n, t_gmlambda_stat *stat);
+
+        int _ncan;              ///< number of candidates
+        int _n;                 ///< dimension of the factorisation
+        vector<double> _L;      ///< L of Q, row by row
+        vector<double> _D;      ///< D of Q
+        vector<double> _A;      ///< workspace of factorize(), grows to the largest problem
+
+        // workspace of the search, grows to the largest problem
+        vector<double> _Lz;     ///< decorrelated L
+        vector<double> _Dz;     ///< decorrelated D
+        vector<double> _Z;      ///< z = Z' a
+        vector<double> _Zti;    ///< a = Z'^-1 z
+        vector<double> _zs;     ///< decorrelated float ambiguities
+        vector<double> _zb;     ///< conditioned float ambiguities
+        vector<double> _z;      ///< current integer vector
+        vector<double> _dist;   ///< partial squared distances
+        vector<double> _step;   ///< zig-zag steps
+        vector<double> _S;      ///< conditioning terms
+        vector<double> _zn;     ///< candidates (decorrelated)
+    };
+}
+
+#endif
@@ -175,6 +175,7 @@ namespace great
         {
             if (_spdlog)
                 SPDLOG_LOGGER_ERROR(_spdlog, "ERROR : t_dvpteph405::decode_data throw exception");
+            _mutex.unlock();
             return -1;
         }
     }
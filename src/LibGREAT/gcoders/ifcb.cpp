@@ -107,6 +107,7 @@ namespace great
         {
             if (_spdlog)
                 SPDLOG_LOGGER_ERROR(_spdlog, "t_ifcb::decode_data throw exception");
+            _mutex.unlock();
             return -1;
         }
         _mutex.unlock();
@@ -0,0 +1,215 @@
+/**
+ * @file         imubin.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        memory mapped binary imu file
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#if defined _WIN32 || defined _WIN64
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include "gcoders/imubin.h"
+
+using namespace Eigen;
+
+namespace great
+{
+    t_imubin::t_imubin(t_spdlog spdlog)
+        : _spdlog(spdlog),
+          _rec(nullptr),
+          _nrec(0),
+          _ts(0.0),
+          _map(nullptr),
+          _len(0)
+#if defined _WIN32 || defined _WIN64
+          ,
+          _hfile(nullptr),
+          _hmap(nullptr)
+#else
+          ,
+          _fd(-1)
+#endif
+    {
+    }
+
+    t_imubin::~t_imubin()
+    {
+        close();
+    }
+
+    bool t_imubin::open(const string& path)
+    {
+        close();
+
+        string name = path.substr(0, 7) == "file://" ? path.substr(7) : path;
+
+#if defined _WIN32 || defined _WIN64
+        HANDLE hfile = CreateFileA(name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (hfile == INVALID_HANDLE_VALUE)
+        {
+            if (_spdlog) SPDLOG_LOGGER_ERROR(_spdlog, "imubin: cannot open " + name);
+            return false;
+        }
+        LARGE_INTEGER fsize;
+        GetFileSizeEx(hfile, &fsize);
+        _len = (size_t)fsize.QuadPart;
+        _hfile = hfile;
+        if (_len >= sizeof(t_imubin_head))
+        {
+            _hmap = CreateFileMappingA(hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (_hmap) _map = MapViewOfFile((HANDLE)_hmap, FILE_MAP_READ, 0, 0, 0);
+        }
+#else
+        _fd = ::open(name.c_str(), O_RDONLY);
+        if (_fd < 0)
+        {
+            if (_spdlog) SPDLOG_LOGGER_ERROR(_spdlog, "imubin: cannot open " + name);
+            return false;
+        }
+        struct stat st;
+        if (fstat(_fd, &st) == 0) _len = (size_t)st.st_size;
+        if (_len >= sizeof(t_imubin_head))
+        {
+            void* map = mmap(nullptr, _len, PROT_READ, MAP_PRIVATE, _fd, 0);
+            if (map != MAP_FAILED)
+            {
+                _map = map;
+                madvise(_map, _len, MADV_SEQUENTIAL);
+            }
+        }
+#endif
+
+        if (!_map)
+        {
+            if (_spdlog) SPDLOG_LOGGER_ERROR(_spdlog, "imubin: cannot map " + name);
+            close();
+            return false;
+        }
+
+        t_imubin_head head;
+        memcpy(&head, _map, sizeof(head));
+        if (memcmp(head.magic, IMUBIN_MAGIC, 8) != 0 || head.version != IMUBIN_VERSION || head.recsize != sizeof(t_imubin_rec) ||
+            sizeof(t_imubin_head) + head.nrec * sizeof(t_imubin_rec) > _len)
+        {
+            if (_spdlog) SPDLOG_LOGGER_ERROR(_spdlog, "imubin: invalid header or truncated file " + name);
+            close();
+            return false;
+        }
+
+        _rec = reinterpret_cast<const t_imubin_rec*>(static_cast<const char*>(_map) + sizeof(t_imubin_head));
+        _nrec = (size_t)head.nrec;
+        _ts = head.ts;
+        return true;
+    }
+
+    void t_imubin::close()
+    {
+#if defined _WIN32 || defined _WIN64
+        if (_map) UnmapViewOfFile(_map);
+        if (_hmap) CloseHandle((HANDLE)_hmap);
+        if (_hfile) CloseHandle((HANDLE)_hfile);
+        _hmap = _hfile = nullptr;
+#else
+        if (_map) munmap(_map, _len);
+        if (_fd >= 0) ::close(_fd);
+        _fd = -1;
+#endif
+        _map = nullptr;
+        _rec = nullptr;
+        _nrec = 0;
+        _len = 0;
+    }
+
+    size_t t_imubin::lower_bound(double t) const
+    {
+        const t_imubin_rec* it = std::lower_bound(_rec, _rec + _nrec, t,
+                                                  [](const t_imubin_rec& rec, double val) { return rec.t < val; });
+        return (size_t)(it - _rec);
+    }
+
+    long t_imubin::read(t_gimudata* imu, double beg, double end)
+    {
+        if (!_rec || !imu)
+            return -1;
+
+        imu->set_ts(_ts);
+
+        long n = 0;
+        for (size_t i = lower_bound(beg); i < _nrec; i++)
+        {
+            const t_imubin_rec& rec = _rec[i];
+            if (imu->add_IMU(rec.t, Vector3d(rec.wm[0], rec.wm[1], rec.wm[2]), Vector3d(rec.vm[0], rec.vm[1], rec.vm[2])) < 0)
+                break;
+            n++;
+            // the first record after the end is kept (as in t_imufile)
+            if (rec.t > end)
+                break;
+        }
+        return n;
+    }
+
+    long t_imubin::write(const string& path, t_gimudata* imu, t_spdlog spdlog)
+    {
+        if (!imu)
+            return -1;
+
+        string name = path.substr(0, 7) == "file://" ? path.substr(7) : path;
+        FILE* fp = fopen(name.c_str(), "wb");
+        if (!fp)
+        {
+            if (spdlog) SPDLOG_LOGGER_ERROR(spdlog, "imubin: cannot create " + name);
+            return -1;
+        }
+
+        t_imubin_head head;
+        memset(&head, 0, sizeof(head));
+        memcpy(head.magic, IMUBIN_MAGIC, 8);
+        head.version = IMUBIN_VERSION;
+        head.recsize = sizeof(t_imubin_rec);
+        head.ts = imu->ts();
+        fwrite(&head, sizeof(head), 1, fp);
+
+        vector<Vector3d> wm, vm;
+        double t = 0.0, ts = 0.0;
+        while (imu->load(wm, vm, t, ts, 1))
+        {
+            t_imubin_rec rec;
+            rec.t = t;
+            for (int j = 0; j < 3; j++)
+            {
+                rec.wm[j] = wm[0](j);
+                rec.vm[j] = vm[0](j);
+            }
+            fwrite(&rec, sizeof(rec), 1, fp);
+            head.nrec++;
+        }
+
+        // number of records is known at the end
+        fseek(fp, 0, SEEK_SET);
+        fwrite(&head, sizeof(head), 1, fp);
+        bool ok = !ferror(fp);
+        fclose(fp);
+
+        if (!ok)
+        {
+            if (spdlog) SPDLOG_LOGGER_ERROR(spdlog, "imubin: write failed " + name);
+            return -1;
+        }
+        return (long)head.nrec;
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file         imubin.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        memory mapped binary imu file
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   Binary imu file, little endian, records already converted to the processing
+ *   convention (rfu axes, angular increment [rad], velocity increment [m/s]):
+ *   ===================================================================================
+ *     header (32 bytes)  char[8] "GIMUBIN1", uint32 version, uint32 record size,
+ *                        double  ts [s], uint64 number of records
+ *     record (56 bytes)  double  t [sow], wm[3], vm[3]
+ *   ===================================================================================
+ *   The file is mapped read-only, records are sorted in time so the start of the
+ *   processing is found by bisection and no text parsing is needed at all.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef IMUBIN_H
+#define IMUBIN_H
+
+#include <string>
+#include <cstdint>
+#include "gexport/ExportLibGREAT.h"
+#include "gdata/gimudata.h"
+
+using namespace std;
+using namespace gnut;
+
+#define IMUBIN_MAGIC "GIMUBIN1"
+#define IMUBIN_VERSION 1
+
+namespace great
+{
+    /** @brief header of binary imu file. */
+    struct t_imubin_head
+    {
+        char magic[8];      ///< IMUBIN_MAGIC
+        uint32_t version;   ///< IMUBIN_VERSION
+        uint32_t recsize;   ///< sizeof(t_imubin_rec)
+        double ts;          ///< sampling interval [s]
+        uint64_t nrec;      ///< number of records
+    };
+
+    /** @brief record of binary imu file. */
+    struct t_imubin_rec
+    {
+        double t;           ///< time [sow]
+        double wm[3];       ///< angular increment [rad], rfu
+        double vm[3];       ///< velocity increment [m/s], rfu
+    };
+
+    /**
+    * @class t_imubin
+    * @brief t_imubin Class for reading (memory mapped) and writing the binary imu file
+    */
+    class LibGREAT_LIBRARY_EXPORT t_imubin
+    {
+    public:
+        /**
+        * @brief constructor.
+        * @param[in]  spdlog   logger
+        */
+        explicit t_imubin(t_spdlog spdlog = nullptr);
+
+        /** @brief destructor, unmaps the file. */
+        virtual ~t_imubin();
+
+        /**
+        * @brief map the file read-only and check the header
+        * @param[in]  path     file path (file:// prefix allowed)
+        * @return true if mapped
+        */
+        bool open(const string& path);
+
+        /** @brief unmap the file. */
+        void close();
+
+        /** @brief whether a file is mapped. */
+        bool is_open() const { return _rec != nullptr; }
+
+        /** @brief number of records. */
+        size_t size() const { return _nrec; }
+
+        /** @brief sampling interval [s]. */
+        double ts() const { return _ts; }
+
+        /** @brief records (mapped memory, valid until close()). */
+        const t_imubin_rec* data() const { return _rec; }
+
+        /** @brief index of the first record with time >= t. */
+        size_t lower_bound(double t) const;
+
+        /**
+        * @brief add records within <beg, end> to imu data
+        * @note blocks in add_IMU when the data are streamed, stops when the consumer aborted
+        * @param[in]  imu      imu data
+        * @param[in]  beg      begin [sow]
+        * @param[in]  end      end [sow]
+        * @return number of added records, -1 if not opened
+        */
+        long read(t_gimudata* imu, double beg, double end);
+
+        /**
+        * @brief write the forward imu data to binary file
+        * @note the data are consumed (as in t_imufile::encode_data)
+        * @param[in]  path     file path
+        * @param[in]  imu      imu data
+        * @param[in]  spdlog   logger
+        * @return number of written records, -1 on failure
+        */
+        static long write(const string& path, t_gimudata* imu, t_spdlog spdlog = nullptr);
+
+    protected:
+        t_spdlog _spdlog;               ///< logger
+        const t_imubin_rec* _rec;       ///< first record in mapped memory
+        size_t _nrec;                   ///< number of records
+        double _ts;                     ///< sampling interval [s]
+        void* _map;                     ///< mapped memory
+        size_t _len;                    ///< mapped length
+#if defined _WIN32 || defined _WIN64
+        void* _hfile;                   ///< file handle
+        void* _hmap;                    ///< mapping handle
+#else
+        int _fd;                        ///< file descriptor
+#endif
+    };
+}
+
+#endif
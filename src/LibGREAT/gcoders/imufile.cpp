@@ -27,6 +27,17 @@ _order("garfu")
     _AcceUnit = dynamic_cast<t_gsetins*>(s)->AcceUnit();
     _MagUnit = dynamic_cast<t_gsetins*>(s)->MagUnit();
     _order = dynamic_cast<t_gsetins*>(s)->order();
+    _start = dynamic_cast<t_gsetins*>(s)->start();
+    _end = dynamic_cast<t_gsetins*>(s)->end();
+
+    // axes of the record -> right, forward, up
+    string frame = _order.size() >= 3 ? _order.substr(_order.size() - 3, 3) : "";
+    _rot = Matrix3d::Identity();
+    if (frame == "flu")      _rot << 0, -1, 0, 1, 0, 0, 0, 0, 1;  // forward -> left -> up
+    else if (frame == "frd") _rot << 0, 1, 0, 1, 0, 0, 0, 0, -1;  // forward -> right -> down
+    else if (frame == "rbd") _rot << 1, 0, 0, 0, -1, 0, 0, 0, -1; // right -> behind -> down
+    else if (frame == "lbu") _rot << -1, 0, 0, 0, -1, 0, 0, 0, 1; // left -> behind -> up
+    else if (frame == "bru") _rot << 0, 1, 0, -1, 0, 0, 0, 0, 1;  // behind -> right -> up
 }
 
 int great::t_imufile::decode_head(char* buff, int sz, vector<string>& errmsg)
@@ -65,18 +76,33 @@ int great::t_imufile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 		{
 			if (line[i] == ',' || line[i] == '*' || line[i] == ';')line[i] = ' ';
 		}
-		double t, gx, gy, gz, ax, ay, az, mx, my, mz;
-		Vector3d g_tmp, a_tmp, m_tmp;
-		Vector3d wtmp, vtmp, mtmp;
-		stringstream ss(line);
-		if (_order[0] == 'g' && _order[1] == 'a') // g->a
+		double t = 0.0, gx, gy, gz, ax, ay, az;
+		Vector3d g_tmp, a_tmp;
+		Vector3d wtmp, vtmp;
+		bool fail = false;
+		if ((_order[0] == 'g' && _order[1] == 'a') || (_order[0] == 'a' && _order[1] == 'g'))
 		{
-			ss >> t >> gx >> gy >> gz >> ax >> ay >> az;
-			g_tmp = Vector3d(gx, gy, gz); a_tmp = Vector3d(ax, ay, az);
-		}
-		else if (_order[0] == 'a' && _order[1] == 'g') // a->g
-		{
-			ss >> t >> ax >> ay >> az >> gx >> gy >> gz;
+			// plain strtod, the line is split in place (no stream per record)
+			double val[7];
+			const char* beg = line.c_str();
+			char* stop = nullptr;
+			int nval = 0;
+			for (; nval < 7; nval++)
+			{
+				val[nval] = strtod(beg, &stop);
+				if (stop == beg) break;
+				beg = stop;
+			}
+			fail = (nval < 7);
+			t = val[0];
+			if (_order[0] == 'g') // g->a
+			{
+				gx = val[1]; gy = val[2]; gz = val[3]; ax = val[4]; ay = val[5]; az = val[6];
+			}
+			else                  // a->g
+			{
+				ax = val[1]; ay = val[2]; az = val[3]; gx = val[4]; gy = val[5]; gz = val[6];
+			}
 			g_tmp = Vector3d(gx, gy, gz); a_tmp = Vector3d(ax, ay, az);
 		}
 		else if (_order == "starneto")
@@ -87,7 +113,6 @@ int great::t_imufile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 				ax = v[3]; ay = v[4]; az = v[5];
 				gx = v[0]; gy = v[1]; gz = v[2];
 				g_tmp = Vector3d(gx, gy, gz); a_tmp = Vector3d(ax, ay, az);
-				wtmp = g_tmp; vtmp = a_tmp;
 			}
 			else
 			{
@@ -102,36 +127,16 @@ int great::t_imufile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 			if (_spdlog) SPDLOG_LOGGER_ERROR(_spdlog, "The imu data format is not exist!");
 		}
 
-		if (_order.substr(_order.size() - 3, 3) == "rfu")  // right -> forward -> up
-		{
-			wtmp = g_tmp; vtmp = a_tmp;
-		}
-		else if (_order.substr(_order.size() - 3, 3) == "flu") // forward -> left -> up
-		{
-			Matrix3d Rotation; Rotation << 0, -1, 0, 1, 0, 0, 0, 0, 1;
-			wtmp = Rotation * g_tmp; vtmp = Rotation * a_tmp;
-		}
-		else if (_order.substr(_order.size() - 3, 3) == "frd") // forward -> right -> down
-		{
-			Matrix3d Rotation; Rotation << 0, 1, 0, 1, 0, 0, 0, 0, -1;
-			wtmp = Rotation * g_tmp; vtmp = Rotation * a_tmp;
-		}
-		else if (_order.substr(_order.size() - 3, 3) == "rbd") // right -> behind -> down
-		{
-			Matrix3d Rotation; Rotation << 1, 0, 0, 0, -1, 0, 0, 0, -1;
-			wtmp = Rotation * g_tmp; vtmp = Rotation * a_tmp;
-		}
-		else if (_order.substr(_order.size() - 3, 3) == "lbu") // left -> behind -> up
-		{
-			Matrix3d Rotation; Rotation << -1, 0, 0, 0, -1, 0, 0, 0, 1;
-			wtmp = Rotation * g_tmp; vtmp = Rotation * a_tmp;
-		}
-		else if (_order.substr(_order.size() - 3, 3) == "bru") // behind -> right -> up
+		if (fail)
 		{
-			Matrix3d Rotation; Rotation << 0, 1, 0, -1, 0, 0, 0, 0, 1;
-			wtmp = Rotation * g_tmp; vtmp = Rotation * a_tmp;
+			if (_spdlog)
+				SPDLOG_LOGGER_DEBUG(_spdlog, "imufile", "warning: incorrect IMU data record: " + line);
+			t_gcoder::_consume(tmpsize);
+			_mutex.unlock(); return -1;
 		}
 
+		wtmp = _rot * g_tmp; vtmp = _rot * a_tmp;
+
 		switch (_GyroUnit)
 		{
 		case RAD:
@@ -159,12 +164,12 @@ int great::t_imufile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 			break;
 		}
 
-		if (t < dynamic_cast<t_gsetins*>(_set)->start())
+		if (t < _start)
 		{
 			t_gcoder::_consume(tmpsize);
 			continue;
 		}
-		if (t > dynamic_cast<t_gsetins*>(_set)->end())
+		if (t > _end)
 			_complete = true;
 
 		_tt = t;
@@ -175,21 +180,11 @@ int great::t_imufile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 			((t_gimudata*)it->second)->set_ts(_ts);
 			if (it->second->id_type() == t_gdata::IMUDATA)
 			{
-				///modified by wh  read mag data
-				if (_order[2] == 'm')
-					((t_gimudata*)it->second)->add_IMU(t, wtmp, vtmp, mtmp);
-				else
-					((t_gimudata*)it->second)->add_IMU(t, wtmp, vtmp);
+				// no supported order carries magnetometer columns, only gyro and accelerometer are stored
+				((t_gimudata*)it->second)->add_IMU(t, wtmp, vtmp);
 			}
 			++it;
 		}
-		if (ss.fail())
-		{
-			if (_spdlog)
-				SPDLOG_LOGGER_DEBUG(_spdlog, "imufile", "warning: incorrect IMU data record: " + ss.str());
-			t_gcoder::_consume(tmpsize);
-			_mutex.unlock(); return -1;
-		}
 		t_gcoder::_consume(tmpsize);
 		cnt++;
 	}
@@ -199,26 +194,32 @@ int great::t_imufile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 
 int great::t_imufile::decode_starneto(const string & line, double & t, vector<double>& v)
 {
-    try
+    // 11 fields separated by single blanks, numbers converted in place
+    const char* field[11];
+    int nfield = 0;
+    field[nfield++] = line.c_str();
+    for (size_t i = 0; i < line.size(); i++)
     {
-        vector<string> ret;
-        split(line, " ", ret);
-        if (ret.size() != 11)  return -1;  
-
-        t = stod(ret[2]);
-
-        for (int i = 3; i <= 5; i++)
-        {
-            v.push_back(stod(ret[i]) * t_gglv::deg * _ts);
-        }
-        for (int i = 6; i <= 8; i++)
-            v.push_back(stod(ret[i]) * STARNETO_G * _ts); 
-        return 1;
+        if (line[i] != ' ') continue;
+        if (nfield == 11) return -1;
+        field[nfield++] = line.c_str() + i + 1;
     }
-    catch (...)
+    if (nfield != 11)  return -1;
+
+    double val[7];
+    for (int i = 2; i <= 8; i++)
     {
-        return -1;
+        char* stop = nullptr;
+        val[i - 2] = strtod(field[i], &stop);
+        if (stop == field[i] || *field[i] == ' ') return -1;
     }
+
+    t = val[0];
+    for (int i = 1; i <= 3; i++)
+        v.push_back(val[i] * t_gglv::deg * _ts);
+    for (int i = 4; i <= 6; i++)
+        v.push_back(val[i] * STARNETO_G * _ts);
+    return 1;
 }
 
 int great::t_imufile::decode_starneto(const char* block, int sz, vector<pair<double, vector<double>>>& v)
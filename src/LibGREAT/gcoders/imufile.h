@@ -173,6 +173,9 @@ namespace great
         UNIT_TYPE _GyroUnit;   ///< Gyro data Unit
         UNIT_TYPE _AcceUnit;   ///< Acce data Unit
         UNIT_TYPE _MagUnit;    ///< Mag data Unit
+        double _start;         ///< processing start [sow]
+        double _end;           ///< processing end [sow]
+        Eigen::Matrix3d _rot;  ///< rotation of the record axes to rfu
     };
 }
 
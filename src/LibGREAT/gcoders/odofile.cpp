@@ -46,29 +46,51 @@ int great::t_odofile::decode_data(char* buff, int sz, int& cnt, vector<string>&
 			if (line[i] == ',' || line[i] == '*' || line[i] == ';')line[i] = ' ';
 		}
 
-		stringstream ss(line);
-		string tmp1;
-		double tmp2;
-		double _tt, val;
+		// whitespace separated fields, numbers converted in place (no stream per record)
+		vector<const char*> field;
+		for (size_t i = 0; i < line.size(); i++)
+		{
+			if (!isspace((unsigned char)line[i]) && (i == 0 || isspace((unsigned char)line[i - 1])))
+				field.push_back(line.c_str() + i);
+		}
+		bool fail = false;
+		auto num = [&](size_t i) -> double {
+			char* stop = nullptr;
+			if (i >= field.size()) { fail = true; return 0.0; }
+			double d = strtod(field[i], &stop);
+			if (stop == field[i]) fail = true;
+			return d;
+		};
+
+		double _tt = 0.0, val = 0.0;
 		int flag;
 
 		if (_format == "Raw")
 		{
-			ss >> tmp1 >> tmp2 >> _tt;
-			for (int i = 4; i <= 10; i++) ss >> tmp2;
-			ss >> val >> tmp2 >> flag;
-			//fprintf(_f_out, "%15.5lf %15.5lf %15.5lf %d\n", _tt, val, tmp2, flag);
+			_tt = num(2);
+			val = num(10);
+			flag = (int)num(12);
 			val = val * _info *(flag == 0 ? _sign : -_sign) / _ts;
 		}
 		else if (_format == "Pulse")
 		{
-			ss >> _tt >> val >> tmp2 >> flag;
+			_tt = num(0);
+			val = num(1);
+			flag = (int)num(3);
 			val = val * _info *(flag == 0 ? _sign : -_sign) / _ts;
-			//fprintf(_f_out, "%15.5lf%15.6lf\n", _tt, val);
 		}
 		else if (_format == "Velocity")
 		{
-			ss >> _tt >> val;
+			_tt = num(0);
+			val = num(1);
+		}
+
+		if (fail)
+		{
+			if (_spdlog)
+				SPDLOG_LOGGER_DEBUG(_spdlog, "odofile", "warning: incorrect ODO data record: " + line);
+			t_gcoder::_consume(tmpsize);
+			_mutex.unlock(); return -1;
 		}
 
         map<string, t_gdata*>::iterator it = _data.begin();
@@ -80,13 +102,6 @@ int great::t_odofile::decode_data(char* buff, int sz, int& cnt, vector<string>&
             }
             ++it;
         }
-        if (ss.fail())
-        {
-            if (_spdlog)
-                SPDLOG_LOGGER_DEBUG(_spdlog, "odofile", "warning: incorrect ODO data record: " + ss.str());
-            t_gcoder::_consume(tmpsize);
-            _mutex.unlock(); return -1;
-        }
         t_gcoder::_consume(tmpsize);
         cnt++;
     }
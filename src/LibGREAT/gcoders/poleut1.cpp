@@ -113,6 +113,7 @@ namespace great
         {
             if (_spdlog)
                 SPDLOG_LOGGER_ERROR(_spdlog, "ERROR : t_poleut1::decode_head throw exception");
+            _mutex.unlock();
             return -1;
         }
     }
@@ -171,6 +172,7 @@ namespace great
         {
             if (_spdlog)
                 SPDLOG_LOGGER_ERROR(_spdlog, "ERROR : t_poleut1::decode_data throw exception");
+            _mutex.unlock();
             return -1;
         }
     }
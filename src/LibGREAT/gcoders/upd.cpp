@@ -109,6 +109,7 @@ namespace great
         {
             if (_spdlog)
                 SPDLOG_LOGGER_ERROR(_spdlog, "ERROR: unknown mistake");
+            _mutex.unlock();
             return -1;
         }
         _mutex.unlock();
@@ -193,6 +194,7 @@ namespace great
         {
             if (_spdlog)
                 SPDLOG_LOGGER_ERROR(_spdlog, "ERROR: unknown mistake");
+            _mutex.unlock();
             return -1;
         }
         _mutex.unlock();
@@ -11,6 +11,8 @@
 
 #include "gimudata.h"
 #include "gmodels/ginterp.h"
+#include <limits>
+#include <algorithm>
 using namespace Eigen;
 
 great::t_gimudata::t_gimudata():t_gdata()
@@ -26,33 +28,78 @@ great::t_gimudata::t_gimudata(t_spdlog spdlog) : t_gdata(spdlog)
 }
 int great::t_gimudata::add_IMU(const double& t, const Vector3d& wm, const Vector3d& vm)
 {
+    dataIMU tmp = { t,wm,vm };
+    return _add(tmp);
+}
 
-#ifdef BMUTEX   
-    boost::mutex::scoped_lock lock(_mutex);
-#endif
-    _gmutex.lock();
+int great::t_gimudata::add_IMU(const double& t, const Vector3d& wm, const Vector3d& vm, const Vector3d& mm)
+{
+    dataIMU tmp = { t,wm,vm,mm };
+    return _add(tmp);
+}
 
-    dataIMU tmp = { t,wm,vm };
-    _imu_forward.push_back(tmp);
-    if (_backward)_imu_back.push_back(tmp);
+int great::t_gimudata::_add(const dataIMU& data)
+{
+    unique_lock<mutex> lck(_stream_mtx);
+
+    // streaming: the producer parses ahead at most _capacity samples,
+    // real-time: the producer waits while the filter is behind the retention window
+    // (the samples not consumed yet are never dropped, no gaps in the mechanisation)
+    if (_capacity > 0)
+        _stream_cv.wait(lck, [this] { return _aborted || _imu_forward.size() < _capacity; });
+    else if (_behind())
+        _stream_cv.wait(lck, [this] { return _aborted || !_behind(); });
+    if (_aborted)
+        return -1;
 
-    _gmutex.unlock();
+    _imu_forward.push_back(data);
+    if (_backward)_imu_back.push_back(data);
+
+    lck.unlock();
+    if (_notify()) _stream_cv.notify_all();
     return 0;
 }
 
-int great::t_gimudata::add_IMU(const double& t, const Vector3d& wm, const Vector3d& vm, const Vector3d& mm)
+void great::t_gimudata::_wait(unique_lock<mutex>& lck, size_t n)
 {
+    if (_capacity == 0)
+        return;
+    _stream_cv.wait(lck, [this, n] { return _finished || _aborted || _imu_forward.size() >= n; });
+}
 
-#ifdef BMUTEX   
-    boost::mutex::scoped_lock lock(_mutex);
-#endif
-    _gmutex.lock();
+void great::t_gimudata::streaming(int capacity)
+{
+    lock_guard<mutex> lck(_stream_mtx);
+    // erase_bef needs two samples buffered
+    _capacity = capacity > 0 ? max<size_t>(capacity, 2) : 0;
+    _finished = (_capacity == 0);
+    _aborted = false;
+}
 
-    dataIMU tmp = { t,wm,vm,mm };
-    _imu_forward.push_back(tmp);
-    if (_backward)_imu_back.push_back(tmp);
-    _gmutex.unlock();
-    return 0;
+void great::t_gimudata::finish()
+{
+    {
+        lock_guard<mutex> lck(_stream_mtx);
+        _finished = true;
+    }
+    _stream_cv.notify_all();
+}
+
+void great::t_gimudata::abort()
+{
+    {
+        lock_guard<mutex> lck(_stream_mtx);
+        _aborted = true;
+    }
+    _stream_cv.notify_all();
+}
+
+bool great::t_gimudata::_behind() const
+{
+    // preloading (nothing consumed yet) or backward data needed later
+    if (_retention <= 0.0 || first == 1 || _backward || _imu_forward.empty())
+        return false;
+    return _imu_forward.back().t - _imu_forward.front().t > _retention;
 }
 
 void great::t_gimudata::set_ts(double ts)
@@ -63,15 +110,18 @@ void great::t_gimudata::set_ts(double ts)
 bool great::t_gimudata::load(vector<Eigen::Vector3d>& wm, vector<Eigen::Vector3d>& vm, double & t, double & ts, int nSamples,bool _beg_end)
 {
 
-#ifdef BMUTEX
-    boost::mutex::scoped_lock lock(_mutex);
-#endif
-    _gmutex.lock();
+    unique_lock<mutex> lck(_stream_mtx);
     wm.clear(); vm.clear();
 
+    if (_beg_end && _capacity > 0 && _capacity <= (size_t)nSamples)
+    {
+        // the buffer must hold one load, otherwise the producer and the consumer wait for each other
+        _capacity = nSamples + 1;
+        _stream_cv.notify_all();
+    }
+    if (_beg_end) _wait(lck, nSamples);
     if ((_beg_end&&_imu_forward.size() < nSamples) || (!_beg_end&&_imu_back.size() < nSamples)) {
         t = 0; 
-        _gmutex.unlock(); 
         return false;
     }
     double _pre_time = t;
@@ -104,7 +154,8 @@ bool great::t_gimudata::load(vector<Eigen::Vector3d>& wm, vector<Eigen::Vector3d
     }
     else ts = fabs(t - _pre_time);
 
-    _gmutex.unlock();
+    lck.unlock();
+    if (_notify()) _stream_cv.notify_all();
     return true;
 }
 
@@ -112,18 +163,34 @@ t_gtime great::t_gimudata::erase_bef(t_gtime t, bool _beg_end)
 {
 	double t_ins;
 	double t_gnss = t.sow() + t.dsec();
+	unique_lock<mutex> lck(_stream_mtx);
+	_wait(lck, 1);
+	if (_imu_forward.empty()) return t;
 	t_ins = _imu_forward.front().t;
 	while (t_ins < t_gnss)
 	{
+		if (_imu_forward.size() <= 1)
+		{
+			// streaming: let the producer refill the buffer
+			if (_capacity > 0) _stream_cv.notify_all();
+			_wait(lck, 2);
+			if (_imu_forward.size() <= 1) break;
+		}
 		_imu_forward.pop_front();
 		t_ins = _imu_forward.front().t;
 	}
+	// the backward pass ends at the processing start as well
+	while (_imu_back.size() > 1 && _imu_back.front().t < t_gnss)
+		_imu_back.pop_front();
+	lck.unlock();
+	if (_notify()) _stream_cv.notify_all();
 	return t_gtime(t.gwk(), t_ins);
 }
 
 
 int great::t_gimudata::size(bool _beg_end)
 {
+    lock_guard<mutex> lck(_stream_mtx);
     if(_beg_end) return _imu_forward.size();
     else return _imu_back.size();
 }
@@ -133,7 +200,8 @@ bool great::t_gimudata::available(const t_gtime & now, bool _beg_end)
     try {
         double t = now.sow() + now.dsec();
 
-        while (_imu_forward.size() < 5) t_gtime::gmsleep(500);
+        unique_lock<mutex> lck(_stream_mtx);
+        _wait(lck, 5);
         if ((_imu_forward.size() > 0 && _beg_end && t < _imu_forward.back().t) || (_imu_back.size() > 0 && !_beg_end && t > _imu_back.front().t))
             return true;
         else
@@ -148,8 +216,10 @@ bool great::t_gimudata::available(const t_gtime & now, bool _beg_end)
 
 double great::t_gimudata::beg_obs(bool _beg_end)
 {
+    unique_lock<mutex> lck(_stream_mtx);
     if (_beg_end)
     {
+        _wait(lck, 1);
         if (_imu_forward.size() == 0)return 0;
         return _imu_forward.front().t;
     }
@@ -162,8 +232,11 @@ double great::t_gimudata::beg_obs(bool _beg_end)
 
 double great::t_gimudata::end_obs(bool _beg_end)
 {
+    lock_guard<mutex> lck(_stream_mtx);
     if (_beg_end)
     {
+        // streaming: the end is not known before the producer finished
+        if (_capacity > 0 && !_finished) return numeric_limits<double>::max();
         if (_imu_forward.size() == 0)return 0;
         return _imu_forward.back().t;
     }
@@ -177,6 +250,11 @@ double great::t_gimudata::end_obs(bool _beg_end)
 int great::t_gimudata::interpolate(const double& intv)
 {
 	if (intv > 0.1)return -1;
+	if (_capacity > 0)
+	{
+		if (_spdlog) SPDLOG_LOGGER_WARN(_spdlog, "imu resampling is not supported for streamed data, skipped");
+		return -1;
+	}
 
 	deque<dataIMU> resampled_imu;
 	double target_t = int(_imu_forward[0].t) + 1.0;
@@ -14,6 +14,8 @@
 
 #include <queue>
 #include <stack>
+#include <mutex>
+#include <condition_variable>
 #include "gdata/gdata.h"
 #include "gins/gutility.h"
 #include "gexport/ExportLibGREAT.h"
@@ -63,6 +65,41 @@ namespace great
         */
         void set_ts(double ts);
 
+        /**
+        * @brief get imu data interval
+        * @return double
+        */
+        double ts() const { return _ts; }
+
+        /**
+        * @brief enable streaming of the imu data from a producer thread
+        * @note add_IMU blocks while 'capacity' samples are buffered, load/erase_bef/beg_obs wait
+        *       for the producer instead of failing. Forward processing only (no backward data,
+        *       no resampling), the producer must call finish() at the end of the data.
+        *       The capacity is raised to hold at least one load (nSamples + 1).
+        * @param[in] 'capacity' is the maximum number of buffered samples (0 = preload)
+        * @return void
+        */
+        void streaming(int capacity);
+
+        /**
+        * @brief whether the data are streamed
+        * @return bool
+        */
+        bool streaming() const { return _capacity > 0; }
+
+        /**
+        * @brief producer reached the end of the data
+        * @return void
+        */
+        void finish();
+
+        /**
+        * @brief consumer stopped, release a blocked producer (further samples are discarded)
+        * @return void
+        */
+        void abort();
+
         /**
         * @brief set backward mechanical arrangement
         * @param[in] 'b' is bool represents whether to perform backward mechanical arrangement
@@ -70,6 +107,16 @@ namespace great
         */
         void set_backward(bool b) { _backward = b; }
 
+        /**
+        * @brief set retention window of not yet consumed data in real-time runs
+        * @note only applied once the processing started to load data: add_IMU waits while
+        *       the buffered samples span more than the window, 0 = keep all. Consumed samples
+        *       are released by load/erase_bef.
+        * @param[in] 'sec' is the window [s]
+        * @return void
+        */
+        void retention(double sec) { _retention = sec; }
+
         /**
         * @brief load data into wm and vm and t accroding to subsamples 
         * @param[in] 't' is last time
@@ -141,6 +188,24 @@ namespace great
         deque<dataIMU> _imu_forward;         /// imu date stored for backward processing
         int first, end;                 /// imu starting and ending time 
         bool _backward = false;
+        double _retention = 0.0;        /// retention window [s] (0 = keep all)
+
+        size_t _capacity = 0;           /// streaming buffer size (0 = preload)
+        bool _finished = true;          /// producer finished
+        bool _aborted = false;          /// consumer finished
+        mutex _stream_mtx;              /// streaming buffer mutex
+        condition_variable _stream_cv;  /// streaming buffer notification
+
+        /** @brief processing behind the retention window, the producer waits (locked by caller). */
+        bool _behind() const;
+        /** @brief a producer may wait for free space. */
+        bool _notify() const { return _capacity > 0 || _retention > 0.0; }
+
+        /** @brief add one sample, waits for free space when streaming. */
+        int _add(const dataIMU& data);
+
+        /** @brief wait until 'n' forward samples are buffered or the producer finished (locked by caller). */
+        void _wait(unique_lock<mutex>& lck, size_t n);
     };
 
 }
@@ -24,7 +24,13 @@ int great::t_gododata::add_odo(const double & t, const double & val)
     //for (auto i = 1; i <= 10; i++) {
         //if (double_eq(it + i / 10.0 - t, 0.0)) {
     //if (double_eq(t - it, 0.5) || double_eq(t - it, 0)) {
+            unique_lock<mutex> lck(_stream_mtx);
+            if (_capacity > 0)
+                _stream_cv.wait(lck, [this] { return _aborted || _mapodo.size() < _capacity; });
+            if (_aborted) return -1;
             _mapodo.insert(make_pair(t, val));
+            lck.unlock();
+            if (_capacity > 0) _stream_cv.notify_all();
             return 1;
     //    }
     //}
@@ -35,6 +41,8 @@ bool great::t_gododata::load(const t_gtime & crt, double & val,double dt)
 {
     double t = crt.sow() + crt.dsec();
 
+    unique_lock<mutex> lck(_stream_mtx);
+    _wait(lck, t + dt);
     map<double, double>::iterator it= _mapodo.lower_bound(t);
 
     if (it != _mapodo.end() && fabs(t - it->first) <= dt)
@@ -52,6 +60,18 @@ bool great::t_gododata::avaliable(const t_gtime & crt,double dt)
 {
     // std::cout << "[available] this=" << this << " mapodo.addr=" << &_mapodo << "\n";
     double t = crt.sow() + crt.dsec();
+    unique_lock<mutex> lck(_stream_mtx);
+    if (_capacity > 0)
+    {
+        // release samples already passed, so that a full buffer cannot stall the producer
+        auto itOLD = _mapodo.lower_bound(t - dt);
+        if (itOLD != _mapodo.begin())
+        {
+            _mapodo.erase(_mapodo.begin(), itOLD);
+            _stream_cv.notify_all();
+        }
+        _wait(lck, t + dt);
+    }
     //map<double, double>::iterator it = _mapodo.lower_bound(t);
     //if (it != _mapodo.end() && fabs(t - it->first) <= dt)
     //    return true;
@@ -69,14 +89,50 @@ bool great::t_gododata::avaliable(const t_gtime & crt,double dt)
 	return false;
 }
 
+void great::t_gododata::streaming(int capacity)
+{
+    lock_guard<mutex> lck(_stream_mtx);
+    _capacity = capacity > 0 ? capacity : 0;
+    _finished = (_capacity == 0);
+    _aborted = false;
+}
+
+void great::t_gododata::finish()
+{
+    {
+        lock_guard<mutex> lck(_stream_mtx);
+        _finished = true;
+    }
+    _stream_cv.notify_all();
+}
+
+void great::t_gododata::abort()
+{
+    {
+        lock_guard<mutex> lck(_stream_mtx);
+        _aborted = true;
+    }
+    _stream_cv.notify_all();
+}
+
+void great::t_gododata::_wait(unique_lock<mutex>& lck, double t)
+{
+    if (_capacity == 0)
+        return;
+    _stream_cv.wait(lck, [this, t] {
+        return _finished || _aborted || (!_mapodo.empty() && _mapodo.rbegin()->first > t) || _mapodo.size() >= _capacity; });
+}
+
 double great::t_gododata::beg_obs()
 {
+    lock_guard<mutex> lck(_stream_mtx);
     if (_mapodo.size() == 0)return 0;
     return _mapodo.begin()->first;
 }
 
 double great::t_gododata::end_obs()
 {
+    lock_guard<mutex> lck(_stream_mtx);
     if (_mapodo.size() == 0)return 0;
     return _mapodo.rbegin()->first;
 }
@@ -12,6 +12,8 @@
 #ifndef GODODATA_H
 #define GODODATA_H
 
+#include <mutex>
+#include <condition_variable>
 #include "gdata/gdata.h"
 #include "gins/gutility.h"
 #include "gexport/ExportLibGREAT.h"
@@ -69,6 +71,20 @@ namespace great
         */
         bool avaliable(const t_gtime& t, double dt);
 
+        /**
+        * @brief enable streaming of the odometer data from a producer thread
+        * @note add_odo blocks while 'capacity' samples are buffered, load/avaliable wait until
+        *       the producer passed the requested epoch or called finish()
+        * @param[in] capacity   maximum number of buffered samples (0 = preload)
+        */
+        void streaming(int capacity);
+
+        /** @brief producer reached the end of the data. */
+        void finish();
+
+        /** @brief consumer stopped, release a blocked producer (further samples are discarded). */
+        void abort();
+
         /**
         * @brief get the begin time of imu data
         * @param[in] '_beg_end' is the direction
@@ -89,6 +105,15 @@ namespace great
         //to judge whether the tire is sliding or the road is bumpy
         double _last_v;
         double _last_dv;
+
+        size_t _capacity = 0;           ///< streaming buffer size (0 = preload)
+        bool _finished = true;          ///< producer finished
+        bool _aborted = false;          ///< consumer finished
+        mutex _stream_mtx;              ///< streaming buffer mutex
+        condition_variable _stream_cv;  ///< streaming buffer notification
+
+        /** @brief wait until the producer passed t (locked by caller). */
+        void _wait(unique_lock<mutex>& lck, double t);
     };
 
 
@@ -14,6 +14,7 @@
 #include <iomanip>
 #include "gset/gsetout.h"
 #include "gset/gsetins.h"
+#include "gutils/gcheckpoint.h"
 #include <Eigen/src/Core/util/DisableStupidWarnings.h>
 using namespace great;
 using namespace Eigen;
@@ -153,3 +154,23 @@ void t_gimu::Update(const vector<Vector3d>& wm, const vector<Vector3d>& vm, cons
 
 
 
+
+void t_gimu::checkpoint(t_gcheckpoint& ckp) const
+{
+    ckp.put(phim);
+    ckp.put(dvbm);
+    ckp.put(wm_1);
+    ckp.put(vm_1);
+    ckp.put(pf1);
+    ckp.put(pf2);
+}
+
+void t_gimu::restore(t_gcheckpoint& ckp)
+{
+    ckp.get(phim);
+    ckp.get(dvbm);
+    ckp.get(wm_1);
+    ckp.get(vm_1);
+    ckp.get(pf1);
+    ckp.get(pf2);
+}
@@ -17,6 +17,7 @@
 
 namespace great
 {
+    class t_gcheckpoint;
 
     /**
     * @class t_gimu
@@ -78,6 +79,18 @@ namespace great
         */
         void Update(const vector<Eigen::Vector3d>& wm, const vector<Eigen::Vector3d>& vm,const t_scheme& scm);
 
+        /**
+        * @brief save the compensation state (increments and flags of the last update)
+        * @param[in] ckp            checkpoint open for writing
+        */
+        void checkpoint(t_gcheckpoint& ckp) const;
+
+        /**
+        * @brief restore the state saved by checkpoint()
+        * @param[in] ckp            checkpoint open for reading
+        */
+        void restore(t_gcheckpoint& ckp);
+
         
         Eigen::Vector3d phim, dvbm;        /// increment because of poly or cone.
 
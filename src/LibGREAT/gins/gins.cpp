@@ -15,6 +15,7 @@
 #include "gset/gsetout.h"
 #include "gset/gsetins.h"
 #include "gset/gsetign.h"
+#include "gutils/gprofiler.h"
 #include <Eigen/src/Core/util/DisableStupidWarnings.h>
 using namespace Eigen;
 using namespace std;
@@ -76,6 +77,7 @@ Vector3d t_gsins::align_coarse(const Vector3d& wmm,const Vector3d& vmm)
 
 void t_gsins::Update(const vector<Vector3d>& wm, const vector<Vector3d>& vm, const t_scheme& scm)
 {
+    GPROF_SCOPE(PROF_INSMECH);
     nts = scm.ts;
     t = scm.t;
     nts = abs(nts);
@@ -169,7 +171,7 @@ void great::t_gsins::prt_header(ostringstream& os, bool imu_scale, bool use_odo)
 	os << endl;
 }
 
-void great::t_gsins::prt_sins(ostringstream& os)
+void great::t_gsins::prt_sins(t_gfmtline& line)
 {
     // format
     Vector3d pos_out = pos_ecef;
@@ -181,27 +183,12 @@ void great::t_gsins::prt_sins(ostringstream& os)
     // for other format
 
     // output
-	os << fixed << setprecision(6) << setw(18) << t;
-	os << fixed << setprecision(3) <<
-		setw(18) << pos_out(0) <<
-		setw(18) << pos_out(1) <<
-		setw(18) << pos_out(2);
-	os << fixed << setprecision(3) <<
-		setw(10) << vel_out(0) <<
-		setw(10) << vel_out(1) <<
-		setw(10) << vel_out(2);
-	os << fixed << setprecision(4) <<
-		setw(10) << att_out(0) <<
-		setw(10) << att_out(1) <<
-		setw(10) << att_out(2);
-	os << fixed << setprecision(4) <<
-		setw(12) << eb_out(0) <<
-		setw(12) << eb_out(1) <<
-		setw(12) << eb_out(2);
-	os << fixed << setprecision(4) <<
-		setw(12) << db_out(0) <<
-		setw(12) << db_out(1) <<
-		setw(12) << db_out(2);
+    line.fix(t, 18, 6);
+    line.fix(pos_out(0), 18, 3).fix(pos_out(1), 18, 3).fix(pos_out(2), 18, 3);
+    line.fix(vel_out(0), 10, 3).fix(vel_out(1), 10, 3).fix(vel_out(2), 10, 3);
+    line.fix(att_out(0), 10, 4).fix(att_out(1), 10, 4).fix(att_out(2), 10, 4);
+    line.fix(eb_out(0), 12, 4).fix(eb_out(1), 12, 4).fix(eb_out(2), 12, 4);
+    line.fix(db_out(0), 12, 4).fix(db_out(1), 12, 4).fix(db_out(2), 12, 4);
 }
 
 void great::t_gsins::debug_ins_info()
@@ -610,13 +597,14 @@ void great::t_gsinskf::feedback()
 
 void great::t_gsinskf::write()
 {
+    GPROF_SCOPE(PROF_OUTPUT);
+    t_gfmtline line(_fins_bin);
     ostringstream os;
     _prt_ins_kml();
-    sins.prt_sins(os);
+    sins.prt_sins(line);
     sins.prt_header(os, _shm._imu_scale, _shm._odo);
-    _fins->write(os.str().c_str(), os.str().size());
-    os.str("");
-
+    line.lit(os.str());
+    _fins->write(line.data().c_str(), line.size());
 }
 
 void great::t_gsinskf::set_out()
@@ -627,17 +615,22 @@ void great::t_gsinskf::set_out()
     {
         tmp = _name +"result.ins";
     }
-    _fins = new t_giof;
+    _fins = new t_giofasync;
     _fins->tsys(t_gtime::GPS);
     if (_name != "") {
         substitute(tmp, "$(rec)", _name, false);
     }
     _fins->mask(tmp);
     _fins->append(dynamic_cast<t_gsetout*>(_setkf)->append());
+    _fins_bin = dynamic_cast<t_gsetout*>(_setkf)->binary("ins");
 
     ostringstream os;
     sins.prt_header(os, _shm._imu_scale, _shm._odo);
-    _fins->write(os.str().c_str(), os.str().size());
+    string magic = t_gfmtline::magic();
+    if (_fins_bin) _fins->write(magic.c_str(), magic.size());
+    t_gfmtline line(_fins_bin);
+    line.lit(os.str());
+    _fins->write(line.data().c_str(), line.size());
 }
 
 bool great::t_gsinskf::_ins_init()
@@ -744,6 +737,7 @@ int great::t_gsinskf::_ODO_Update()
     // get velocity
     double vf = 0;
     if (!_ododata->load(_ins_crt, vf, _shm.delay_odo)) return -1;
+    _odo_vf = vf;
     set_meas_ODO(vf, crt);
     int irc = _meas_update();
     return irc;
@@ -763,6 +757,7 @@ void great::t_gsinskf::time_update(double kfts, double inflation)
 int great::t_gsinskf::_meas_update()
 {
     if (Flag == NO_MEAS)  return -1;
+    GPROF_SCOPE(PROF_FILTER);
     Eigen::VectorXd Pxz = Eigen::VectorXd::Zero(Pk.rows()),
         Kk = Eigen::VectorXd::Zero(Pk.rows()), Hi = Xk = Eigen::VectorXd::Zero(Pk.rows());
     this->_set_meas();
@@ -785,8 +780,7 @@ int great::t_gsinskf::_meas_update()
 
     t_gbase::symmetry(Pk);
     //set_meas_flag(0);
-    if (_spdlogkf)
-        SPDLOG_LOGGER_INFO(_spdlogkf, "gintegration: " + _ins_crt.str_ymdhms("LC " + meas2str(Flag) + "/INS filter updating Succeed at epoch: "));
+    GLOGGER_INFO(_spdlogkf, "gintegration: LC {}/INS filter updating Succeed at epoch: {}", meas2str(Flag), _ins_crt.str_ymdhms());
 
     return 1;
 }
@@ -901,8 +895,7 @@ int great::t_gsinskf::outlier_detect()
         if (v_norm[i] > max_set)
         {
             cout <<  v_norm[i] <<" " << endl;
-            SPDLOG_LOGGER_INFO(_spdlogkf, "gintegration: " +
-                _ins_crt.str_ymdhms("LC " + meas2str(Flag) + "/INS filter updating Failed (v: " + to_string(v_norm[i]) + ") at epoch : "));
+            GLOGGER_INFO(_spdlogkf, "gintegration: LC {}/INS filter updating Failed (v: {:f}) at epoch : {}", meas2str(Flag), v_norm[i], _ins_crt.str_ymdhms());
             return 1;
         }
     }
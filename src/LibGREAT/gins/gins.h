@@ -25,6 +25,8 @@
 #include "gutils/gmutex.h"
 #include "gall/gallpar.h"
 #include "gio/gxml.h"
+#include "gio/giofasync.h"
+#include "gutils/gfmtline.h"
 using namespace gnut;
 
 namespace great
@@ -95,10 +97,10 @@ namespace great
             db is exported to (dbx,dby,dbz)[mg]
           @endverbatim
         *
-        * @param[in] os   out os
+        * @param[out] line   output line
         *
         */
-        void prt_sins(ostringstream& os);
+        void prt_sins(t_gfmtline& line);
 
         void debug_ins_info();
 
@@ -340,6 +342,7 @@ namespace great
         double _resample_intv;
 
         double _odoscale;       //bool _use_odo;
+        double _odo_vf = 0.0;   // odometer velocity of the last ODO update
 
         string _name = "";
         Eigen::Vector3d _first_pos, _pre_pos;
@@ -354,6 +357,7 @@ namespace great
         t_scheme _shm;                // processing scheme (important!)
         gnut::t_gsetbase* _setkf;    // set
         gnut::t_giof* _fins;        // ins t_giof
+        bool _fins_bin = false;     // ins file with binary records
         t_spdlog _spdlogkf;
 
         set<MEAS_TYPE> _Meas_Type;
@@ -12,6 +12,7 @@
 #include "gutility.h"
 #include "gset/gsetins.h"
 #include "gset/gsetign.h"
+#include "gutils/gmatrixconv.h"
 using namespace great;
 
 int great::sign(double d)
@@ -48,83 +49,45 @@ Eigen::Vector3d great::XYZ2ENU(const Eigen::Vector3d& xyz, const Eigen::Vector3d
 
 Eigen::MatrixXd great::NewMat2Eigen(const Matrix& newmat)
 {
-	int m = newmat.Nrows(), n = newmat.Ncols();
-	Eigen::MatrixXd res(m, n);
-	for (int i = 0; i < m; i++)
-	{
-		for (int j = 0; j < n; j++)
-		{
-			res(i, j) = newmat(i + 1, j + 1);
-		}
-	}
+	Eigen::MatrixXd res;
+	gnut::Matrix2Eigen(newmat, res);
 	return res;
 }
 
 Matrix great::Eigen2newMat(const Eigen::MatrixXd& eigen)
 {
 	int m = eigen.rows(), n = eigen.cols();
-	Matrix res;
-	res.ReSize(m, n);
-	res = 0.0;
-	for (int i = 0; i < m; i++)
-	{
-		for (int j = 0; j < n; j++)
-		{
-			res(i + 1, j + 1) = eigen(i, j);
-		}
-	}
+	Matrix res(m, n);
+	if (m > 0 && n > 0)
+		Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(res.Store(), m, n) = eigen;
 	return res;
 }
 
 SymmetricMatrix great::Eigen2BaseMatrix(const Eigen::MatrixXd& eigen)
 {
-	int m = eigen.rows(), n = eigen.cols();
-	SymmetricMatrix res(m);
-	for (int i = 0; i < m; i++)
-	{
-		for (int j = 0; j < n; j++)
-		{
-			res(i + 1, j + 1) = eigen(i, j);
-		}
-	}
+	SymmetricMatrix res;
+	gnut::Eigen2Matrix(eigen, res);
 	return res;
 }
 
 Eigen::MatrixXd great::BaseMatrix2Eigen(const SymmetricMatrix& newmat)
 {
-	int m = newmat.Nrows(), n = newmat.Ncols();
-	Eigen::MatrixXd res(m, n);
-	for (int i = 0; i < m; i++)
-	{
-		for (int j = 0; j < n; j++)
-		{
-			res(i, j) = newmat(i + 1, j + 1);
-		}
-	}
+	Eigen::MatrixXd res;
+	gnut::Matrix2Eigen(newmat, res);
 	return res;
 }
 
 Eigen::VectorXd great::Columns2VectorXd(const ColumnVector& newmat)
 {
-	int m = newmat.Nrows();
-	Eigen::VectorXd res(m);
-	for (int i = 0; i < m; i++)
-	{
-		res(i) = newmat(i + 1);
-	}
+	Eigen::VectorXd res;
+	gnut::Vector2Eigen(newmat, res);
 	return res;
 }
 
 ColumnVector great::VectorXd2Columns(const Eigen::VectorXd& eigen)
 {
-	int m = eigen.size();
 	ColumnVector res;
-	res.ReSize(m);
-	res = 0.0;
-	for (int i = 0; i < m; i++)
-	{
-		res(i + 1) = eigen(i);
-	}
+	gnut::Eigen2Vector(eigen, res);
 	return res;
 }
 
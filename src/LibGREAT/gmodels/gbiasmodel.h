@@ -23,6 +23,8 @@ using namespace gnut;
 
 namespace great
 {
+    class t_gcheckpoint;
+
     /**
     *@brief t_gbiasmodel Class for bias model
     */
@@ -85,6 +87,32 @@ namespace great
         */
 		virtual bool get_omc_obs_ALL(const t_gtime& crt_epo, t_gsatdata& obsdata, t_gallpar& pars, t_gobs& gobs, double& omc);
 
+        /** @brief save the state carried between epochs (e.g. phase wind-up), nothing by default
+        *
+        *param[in] ckp           checkpoint open for writing
+        */
+        virtual void checkpoint(t_gcheckpoint &ckp) const {};
+
+        /** @brief restore the state saved by checkpoint()
+        *
+        *param[in] ckp           checkpoint open for reading
+        */
+        virtual void restore(t_gcheckpoint &ckp) {};
+
+        /** @brief copy of the model for one thread evaluating satellites concurrently
+        *
+        * The copy has its own scratch state and shares the state carried between epochs.
+        *return nullptr if the model can only be evaluated sequentially
+        */
+        virtual shared_ptr<t_gbiasmodel> worker() { return nullptr; };
+
+        /** @brief create the state slots of a satellite before it is evaluated on a worker
+        *
+        *param[in] rec           receiver name
+        *param[in] sat           satellite name
+        */
+        virtual void prepare_sat(const string &rec, const string &sat) {};
+
         t_gtriple _trs_rec_crd; ///< coordinates of reciever in terrestrial reference system
         t_gtriple _crs_rec_crd; ///< coordinates of reciever in coordinate reference system
         t_gtriple _trs_sat_crd; ///< coordinates of satellite in terrestrial reference system
@@ -122,6 +122,11 @@ namespace great
         return _freq_index;
     }
 
+    shared_ptr<t_gcombmodel> t_gcombmodel::worker() const
+    {
+        return nullptr;
+    }
+
     t_gcombIF::t_gcombIF(t_gsetbase *setting, shared_ptr<t_gbiasmodel> bias_model, t_gallproc *data) : t_gcombmodel(setting, std::move(bias_model), data)
     {
         _clk_type_index[make_pair(FREQ_3, GPS)] = par_type::CLK13_G;
@@ -162,6 +167,16 @@ namespace great
 
     t_gcombIF::~t_gcombIF() = default;
 
+    shared_ptr<t_gcombmodel> t_gcombIF::worker() const
+    {
+        shared_ptr<t_gbiasmodel> bias = _bias_model->worker();
+        if (!bias)
+            return nullptr;
+        shared_ptr<t_gcombIF> model = make_shared<t_gcombIF>(*this);
+        model->_bias_model = bias;
+        return model;
+    }
+
     bool t_gcombIF::cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gbaseEquation &result)
     {
         // ========================================================================================================================================
@@ -278,7 +293,7 @@ namespace great
         if (dynamic_cast<t_gfltEquationMatrix *>(&result))
         {
             auto *lsq_result = dynamic_cast<t_gfltEquationMatrix *>(&result);
-            lsq_result->add_equ(equ_IF);
+            lsq_result->add_equ(std::move(equ_IF));
         }
         else
         {
@@ -323,9 +338,10 @@ namespace great
             return false;
         }
 
-        //update_value
+        //update_value (written once per epoch, the other satellites only read it)
         int idx_clk12 = params.getParam(site, par_type::CLK, "");
-        params[idx].value(params[idx_clk12].value());
+        if (params[idx].value() != params[idx_clk12].value())
+            params[idx].value(params[idx_clk12].value());
         coef_IF.emplace_back(idx + 1, 1.0 - obsdata.drate());
         return true;
     }
@@ -350,6 +366,16 @@ namespace great
 
     t_gcombALL::~t_gcombALL() = default;
 
+    shared_ptr<t_gcombmodel> t_gcombALL::worker() const
+    {
+        shared_ptr<t_gbiasmodel> bias = _bias_model->worker();
+        if (!bias)
+            return nullptr;
+        shared_ptr<t_gcombALL> model = make_shared<t_gcombALL>(*this);
+        model->_bias_model = bias;
+        return model;
+    }
+
     bool t_gcombALL::cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gbaseEquation &result)
     {
         if (_gallbias!=nullptr)
@@ -361,6 +387,7 @@ namespace great
         string grec = obsdata.site();
         string gsat = obsdata.sat();
         GSYS gsys = obsdata.gsys();
+        size_t nequ_beg = result.l.size();
 
         if (crt_bands.empty())
         {
@@ -466,14 +493,15 @@ namespace great
             if (dynamic_cast<t_gfltEquationMatrix *>(&result))
             {
                 auto *lsq_reuslt = dynamic_cast<t_gfltEquationMatrix *>(&result);
-                lsq_reuslt->add_equ(equ_ALL);
+                lsq_reuslt->add_equ(std::move(equ_ALL));
             }
             else
             {
                 result = result + equ_ALL;
             }
         }
-        if (!result.l.size())
+        // no equation of this satellite (equations of the previous satellites may be in result)
+        if (result.l.size() == nequ_beg)
             return false; 
         return true;
     }
@@ -498,6 +526,12 @@ namespace great
 
     t_gcombDD::~t_gcombDD() = default;
 
+    shared_ptr<t_gcombmodel> t_gcombDD::worker() const
+    {
+        // every satellite works on a copy of all parameters and writes it back
+        return nullptr;
+    }
+
     void t_gcombDD::set_observ(OBSCOMBIN observ)
     {
         _observ = observ;
@@ -731,7 +765,7 @@ namespace great
             if (dynamic_cast<t_gfltEquationMatrix *>(&result))
             {
                 auto *lsq_result = dynamic_cast<t_gfltEquationMatrix *>(&result);
-                lsq_result->add_equ(equ_IF);
+                lsq_result->add_equ(std::move(equ_IF));
             }
             else
             {
@@ -888,7 +922,7 @@ namespace great
             if (dynamic_cast<t_gfltEquationMatrix *>(&result))
             {
                 auto *lsq_reuslt = dynamic_cast<t_gfltEquationMatrix *>(&result);
-                lsq_reuslt->add_equ(equ_ALL);
+                lsq_reuslt->add_equ(std::move(equ_ALL));
             }
             else
             {
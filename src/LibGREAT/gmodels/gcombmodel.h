@@ -56,6 +56,16 @@ namespace great
         /** @brief get index of frequency */
         map<GSYS, map<GOBSBAND, FREQ_SEQ>> get_freq_index();
 
+        /** @brief get model of bias */
+        shared_ptr<t_gbiasmodel> bias_model() const { return _bias_model; }
+
+        /** @brief copy for one thread of the per-satellite evaluation in t_gpvtflt::_cmp_equ
+        *
+        * The copy has its own bias model (t_gbiasmodel::worker()).
+        * return nullptr if the satellites have to be combined sequentially
+        */
+        virtual shared_ptr<t_gcombmodel> worker() const;
+
     protected:
 
 
@@ -101,6 +111,9 @@ namespace great
         bool cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gbaseEquation &result) override;
         bool cmb_equ_IF(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, GOBSBAND b1, GOBSBAND b2, t_gbaseEquation &result);
 
+        /** @brief override worker copy */
+        shared_ptr<t_gcombmodel> worker() const override;
+
     private:
         /** @brief add IF multi rec clk.
         *
@@ -127,6 +140,9 @@ namespace great
         /** @brief override Combine equation */
         bool cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gbaseEquation &result) override;
 
+        /** @brief override worker copy */
+        shared_ptr<t_gcombmodel> worker() const override;
+
     private:
         map<FREQ_SEQ, par_type> ambtype_list;
     };
@@ -144,6 +160,9 @@ namespace great
         /** @brief override Combine equation */
         bool cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gbaseEquation &result) override;
 
+        /** @brief no worker copy, every satellite copies and writes back all parameters */
+        shared_ptr<t_gcombmodel> worker() const override;
+
         /** @brief set observation.
         *
         *param[in]    observ  observation
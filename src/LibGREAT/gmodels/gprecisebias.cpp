@@ -14,6 +14,7 @@
 #include "gmodels/ggmf.h"
 #include "gmodels/gtideIERS.h"
 #include "gall/gallprec.h"
+#include "gutils/gcheckpoint.h"
 
 #ifndef OMGE_DOT
 #define OMGE_DOT 7.2921151467e-5 ///< WGS 84 value of the earth's rotation rate [rad/sec]
@@ -23,6 +24,8 @@ namespace great
 {
     t_gprecisebias::t_gprecisebias(t_gallproc *data, t_gsetbase *setting) : t_gbiasmodel(setting)
     {
+        _data = data;
+        _sat_state = make_shared<t_gsatstate>();
         _gall_nav = dynamic_cast<t_gallnav *>((*data)[t_gdata::GRP_EPHEM]);
         _gallobj = dynamic_cast<t_gallobj *>((*data)[t_gdata::ALLOBJ]);
         _gdata_erp = dynamic_cast<t_gpoleut1 *>((*data)[t_gdata::ALLPOLEUT1]);
@@ -46,6 +49,8 @@ namespace great
 
     t_gprecisebias::t_gprecisebias(t_gallproc *data, t_spdlog spdlog, t_gsetbase *setting) : t_gbiasmodel(spdlog, setting)
     {
+        _data = data;
+        _sat_state = make_shared<t_gsatstate>();
         _gall_nav = dynamic_cast<t_gallnav *>((*data)[t_gdata::GRP_EPHEM]);
         _gallobj = dynamic_cast<t_gallobj *>((*data)[t_gdata::ALLOBJ]);
         _gdata_erp = dynamic_cast<t_gpoleut1 *>((*data)[t_gdata::ALLPOLEUT1]);
@@ -89,6 +94,66 @@ namespace great
         return _rec_clk[obj];
     }
 
+    void t_gprecisebias::checkpoint(t_gcheckpoint &ckp) const
+    {
+        // only the last wind-up of an arc is needed to continue it
+        map<string, map<string, pair<t_gtime, double>>> windup;
+        for (const auto &rec : _sat_state->phase_windup)
+            for (const auto &sat : rec.second)
+                if (!sat.second.empty())
+                    windup[rec.first][sat.first] = *sat.second.rbegin();
+
+        ckp.section("precisebias");
+        ckp.put(windup);
+        ckp.put(_obj_clk);
+        ckp.put(_rec_clk);
+    }
+
+    void t_gprecisebias::restore(t_gcheckpoint &ckp)
+    {
+        map<string, map<string, pair<t_gtime, double>>> windup;
+        ckp.section("precisebias");
+        ckp.get(windup);
+        ckp.get(_obj_clk);
+        ckp.get(_rec_clk);
+        if (!ckp.good())
+            return;
+
+        _sat_state->phase_windup.clear();
+        for (const auto &rec : windup)
+            for (const auto &sat : rec.second)
+                _sat_state->phase_windup[rec.first][sat.first][sat.second.first] = sat.second.second;
+    }
+
+    void t_gprecisebias::prepare_sat(const string &rec, const string &sat)
+    {
+        _sat_state->gen++;
+        _windup_arc(rec, sat);
+        _attitude_model(sat);
+    }
+
+    map<t_gtime, double> &t_gprecisebias::_windup_arc(const string &rec, const string &sat)
+    {
+        // find() first: a worker only reads the maps, the slots were created by prepare_sat()
+        auto &all = _sat_state->phase_windup;
+        auto itrec = all.find(rec);
+        if (itrec == all.end())
+            itrec = all.emplace(rec, map<string, map<t_gtime, double>>()).first;
+        auto itsat = itrec->second.find(sat);
+        if (itsat == itrec->second.end())
+            itsat = itrec->second.emplace(sat, map<t_gtime, double>()).first;
+        return itsat->second;
+    }
+
+    t_gattitude_model &t_gprecisebias::_attitude_model(const string &sat)
+    {
+        auto &all = _sat_state->attitude;
+        auto it = all.find(sat);
+        if (it == all.end())
+            it = all.emplace(sat, t_gattitude_model()).first;
+        return it->second;
+    }
+
     double t_gprecisebias::tropoDelay(t_gtime &epoch, string &rec, t_gallpar &param, t_gtriple site_ell, t_gsatdata &satdata)
     {
 
@@ -127,14 +192,18 @@ namespace great
 
             if (i >= 0)
             {
+                // the receiver parameters are shared by all satellites of the epoch: written only
+                // when they change, so that concurrent satellites (same receiver position) only read them
                 zwd = param[i].value();
                 if (param[i].apriori() > 1E-4 && (zwd == 0.0 || epoch == param[i].beg))
                 {
                     zwd = _tropoModel->getZWD(ell, epoch);
-                    param[i].value(zwd);
+                    if (param[i].value() != zwd)
+                        param[i].value(zwd);
                 }
                 zhd = _tropoModel->getZHD(ell, epoch);
-                param[i].zhd = zhd;
+                if (param[i].zhd != zhd)
+                    param[i].zhd = zhd;
             }
             else
             {
@@ -488,21 +557,20 @@ namespace great
 
             // First time - initialize to zero
             // -------------------------------
-            if (_phase_windup.find(_crt_rec) == _phase_windup.end() ||
-                _phase_windup[_crt_rec].find(prn) == _phase_windup[_crt_rec].end() ||
-                _phase_windup[_crt_rec][prn].size() == 0)
+            map<t_gtime, double> &arc = _windup_arc(_crt_rec, prn);
+            if (arc.size() == 0)
             {
-                _phase_windup[_crt_rec][prn][epoch] = 0.0;
+                arc[epoch] = 0.0;
             }
 
             // Compute the correction for new time
             // -----------------------------------
-            if (_phase_windup[_crt_rec][prn].find(epoch) == _phase_windup[_crt_rec][prn].end() ||
-                _phase_windup[_crt_rec][prn].size() == 1)
+            if (arc.find(epoch) == arc.end() ||
+                arc.size() == 1)
             {
 
                 // the last epoch
-                double dphi0 = _phase_windup[_crt_rec][prn].rbegin()->second;
+                double dphi0 = arc.rbegin()->second;
                 Eigen::Vector3d rho = rRec - rSat; 
                 rho /= rho.norm();
 
@@ -520,12 +588,13 @@ namespace great
                         antype = sat_pcv->anten();
                 }
 
+                t_gattitude_model &att = _attitude_model(prn);
                 if (_attitudes == ATTITUDES::YAW_NOMI)
-                    _gattitude_model.attitude(satdata, "", i, j, k); //nominal modeling
+                    att.attitude(satdata, "", i, j, k); //nominal modeling
                 else if (_attitudes == ATTITUDES::YAW_RTCM)
-                    _gattitude_model.attitude(satdata, satdata.yaw(), i, j, k); //value from RTCM used
+                    att.attitude(satdata, satdata.yaw(), i, j, k); //value from RTCM used
                 else
-                    _gattitude_model.attitude(satdata, antype, i, j, k); //default
+                    att.attitude(satdata, antype, i, j, k); //default
 
                 if (antype.find("BLOCK IIR") != string::npos)
                 {
@@ -573,11 +642,11 @@ namespace great
                 if (rho.dot(dipSat.cross(dipRec)) < 0.0)
                     dphi = -dphi;
 
-                _phase_windup[_crt_rec][prn][epoch] = floor(dphi0 - dphi + 0.5) + dphi;
+                arc[epoch] = floor(dphi0 - dphi + 0.5) + dphi;
             }
 
-            satdata.addwind(_phase_windup[_crt_rec][prn][epoch]);
-            return _phase_windup[_crt_rec][prn][epoch] * wavelength;
+            satdata.addwind(arc[epoch]);
+            return arc[epoch] * wavelength;
         }
     }
 
@@ -618,12 +687,13 @@ namespace great
                 string antenna = sat_pcv->anten();
                 t_gtriple dx(0, 0, 0);
                 Eigen::Vector3d i, j, k;
+                t_gattitude_model &att = _attitude_model(satdata.sat());
                 if (_attitudes == ATTITUDES::YAW_NOMI)
-                    _gattitude_model.attitude(satdata, "", i, j, k); //nominal modeling
+                    att.attitude(satdata, "", i, j, k); //nominal modeling
                 else if (_attitudes == ATTITUDES::YAW_RTCM)
-                    _gattitude_model.attitude(satdata, satdata.yaw(), i, j, k); //value from RTCM used
+                    att.attitude(satdata, satdata.yaw(), i, j, k); //value from RTCM used
                 else
-                    _gattitude_model.attitude(satdata, antenna, i, j, k); //default
+                    att.attitude(satdata, antenna, i, j, k); //default
                 dx[0] = pco[0] * i(0) + pco[1] * j(0) + pco[2] * k(0);
                 dx[1] = pco[0] * i(1) + pco[1] * j(1) + pco[2] * k(1);
                 dx[2] = pco[0] * i(2) + pco[1] * j(2) + pco[2] * k(2);
@@ -677,12 +747,13 @@ namespace great
             string antenna = (sat_pcv)->anten();
             t_gtriple dx(0, 0, 0);
             Eigen::Vector3d i, j, k;
+            t_gattitude_model &att = _attitude_model(obsdata.sat());
             if (_attitudes == ATTITUDES::YAW_NOMI)
-                _gattitude_model.attitude(obsdata, "", i, j, k); 
+                att.attitude(obsdata, "", i, j, k); 
             else if (_attitudes == ATTITUDES::YAW_RTCM)
-                _gattitude_model.attitude(obsdata, obsdata.yaw(), i, j, k); 
+                att.attitude(obsdata, obsdata.yaw(), i, j, k); 
             else
-                _gattitude_model.attitude(obsdata, antenna, i, j, k); 
+                att.attitude(obsdata, antenna, i, j, k); 
             rotmatrix.Column(1) << i.data();
             rotmatrix.Column(2) << j.data();
             rotmatrix.Column(3) << k.data();
@@ -789,6 +860,20 @@ namespace great
             return false;
         }
 
+        // same receiver, epoch and crd as the previous satellite: tides and rotation are not computed again
+        if (_rec_cache.valid && _rec_cache.rec == _crt_rec && _rec_cache.epo == rec_epo && _rec_cache.xyz == trs_rec_xyz)
+        {
+            _update_rot_matrix(rec_epo);
+            _trs_rec_crd = _rec_cache.trs_crd;
+            _crs_rec_crd = _rec_cache.crs_crd;
+            _crs_rec_vel = _rec_cache.crs_vel;
+            return true;
+        }
+        _rec_cache.valid = false;
+        _rec_cache.rec = _crt_rec;
+        _rec_cache.epo = rec_epo;
+        _rec_cache.xyz = trs_rec_xyz;
+
         bool tide_valid = _apply_rec_tides(rec_epo, trs_rec_xyz);
         if (!tide_valid)
         {
@@ -812,6 +897,11 @@ namespace great
         Matrix dtrs2crs = _trs2crs_2000->getMatDu() * OMGE_DOT;
         ColumnVector trs_rec_vel = dtrs2crs * trs_rec_xyz.crd_cvect();
         _crs_rec_vel = t_gtriple(trs_rec_vel);
+
+        _rec_cache.trs_crd = _trs_rec_crd;
+        _rec_cache.crs_crd = _crs_rec_crd;
+        _rec_cache.crs_vel = _crs_rec_vel;
+        _rec_cache.valid = true;
         return true;
     }
 
@@ -59,6 +59,28 @@ namespace great
         */
         double get_rec_clk(const string &obj) override;
 
+        /** @brief save phase wind-up (last value of every receiver/satellite) and clocks
+        *
+        *@param[in] ckp         checkpoint open for writing
+        */
+        void checkpoint(t_gcheckpoint &ckp) const override;
+
+        /** @brief restore the state saved by checkpoint()
+        *
+        *@param[in] ckp         checkpoint open for reading
+        */
+        void restore(t_gcheckpoint &ckp) override;
+
+        /** @brief create the wind-up and attitude slots of a satellite
+        *
+        * The prepared observation of the last satellite is not reused after the call, a
+        * worker may get the same satellite again after the parameters were updated.
+        *
+        *@param[in] rec         receiver name
+        *@param[in] sat         satellite name
+        */
+        void prepare_sat(const string &rec, const string &sat) override;
+
         /**
         * @brief get tropoDelay
         * @param[in] epoch         current epoch
@@ -225,6 +247,21 @@ namespace great
         */
         Matrix _RotMatrix_Ant(t_gsatdata &obsdata, const t_gtime &receive_epoch, const t_gtime &transmit_epoch, shared_ptr<t_gobj> obj, bool isCRS);
 
+        /**
+        * @brief wind-up history of a receiver/satellite arc, created if missing
+        * @param[in] rec receiver name
+        * @param[in] sat satellite name
+        * @return wind-up [cycles] per epoch
+        */
+        map<t_gtime, double> &_windup_arc(const string &rec, const string &sat);
+
+        /**
+        * @brief attitude model of a satellite, created if missing
+        * @param[in] sat satellite name
+        * @return attitude model keeping the yaw history of the satellite
+        */
+        t_gattitude_model &_attitude_model(const string &sat);
+
     protected:
         t_gtime _crt_epo;            ///< epoch
         t_gsatdata _crt_obs;         ///< obs
@@ -236,7 +273,6 @@ namespace great
 
         CONSTRPAR _crd_est = CONSTRPAR::FIX;  ///< CONSTRPAR
         ATTITUDES _attitudes;                 ///< ATTITUDES
-        t_gattitude_model _gattitude_model;   ///< gattitude model
 
         bool _trop_est = true;      ///< estimate tropo or not
         bool _is_flt = false;       ///< flt or lsq
@@ -259,13 +295,34 @@ namespace great
         Matrix _rot_scf2crs; ///< record scf2crs matrix
         Matrix _rot_scf2trs; ///< record scf2trs matrix
 
-        map<string, map<string, map<t_gtime, double>>> _phase_windup; ///< recording for calculating windup
+        /** @brief state carried between epochs, one slot per satellite, shared with the workers */
+        struct t_gsatstate
+        {
+            map<string, map<string, map<t_gtime, double>>> phase_windup; ///< recording for calculating windup
+            map<string, t_gattitude_model> attitude;                      ///< attitude model of every satellite
+            long gen = 0;                                                 ///< incremented by prepare_sat()
+        };
+        shared_ptr<t_gsatstate> _sat_state;            ///< wind-up and attitude
+        t_gallproc *_data = nullptr;                   ///< all data, for the workers
 
         t_gifcb *_gifcb = nullptr;                     ///< ifcb
         map<string, pair<t_gtime, double>> _obj_clk;   ///< obj clk
         map<string, double> _rec_clk;                  ///< rec clk
         bool _isCalSatPCO = true;                      ///< is Cal Sat PCO
         tuple<string, string, t_gtime> _rec_sat_before;///< rec sat before
+        long _rec_sat_gen = 0;                         ///< _sat_state->gen of _rec_sat_before
+
+        /** @brief receiver position of the last _apply_rec, shared by all satellites of the epoch. */
+        struct t_grec_cache
+        {
+            bool valid = false;   ///< filled
+            string rec;           ///< receiver
+            t_gtime epo;          ///< receive epoch
+            t_gtriple xyz;        ///< input crd (before tides)
+            t_gtriple trs_crd;    ///< _trs_rec_crd
+            t_gtriple crs_crd;    ///< _crs_rec_crd
+            t_gtriple crs_vel;    ///< _crs_rec_vel
+        } _rec_cache;             ///< receiver cache
     };
 }
 
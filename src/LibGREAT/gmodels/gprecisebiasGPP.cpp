@@ -13,6 +13,7 @@
 #include "spdlog/spdlog.h"
 #include "gset/gsetgen.h"
 #include "gall/gallprec.h"
+#include "gutils/gprofiler.h"
 
 namespace great
 {
@@ -32,8 +33,21 @@ namespace great
     {
     }
 
+    shared_ptr<t_gbiasmodel> t_gprecisebiasGPP::worker()
+    {
+        shared_ptr<t_gprecisebiasGPP> model;
+        if (_spdlog)
+            model = make_shared<t_gprecisebiasGPP>(_data, _spdlog, _gset);
+        else
+            model = make_shared<t_gprecisebiasGPP>(_data, _gset);
+        model->_sat_state = _sat_state;
+        return model;
+    }
+
     bool t_gprecisebiasGPP::cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gobs &gobs, t_gbaseEquation &result)
     {
+        GPROF_SCOPE(PROF_MODEL);
+
         // check obs_type valid
         double Obs_value = obsdata.getobs(gobs.gobs());
         if (double_eq(Obs_value, 0.0))
@@ -44,7 +58,7 @@ namespace great
         }
 
         tuple<string, string, t_gtime>* flag = &_rec_sat_before;
-        if (make_tuple(obsdata.site(), obsdata.sat(), epoch) != *flag)
+        if (make_tuple(obsdata.site(), obsdata.sat(), epoch) != *flag || _rec_sat_gen != _sat_state->gen)
         {
             bool update_valid = t_gprecisebiasGPP::_update_obs_info_GPP(epoch, _gall_nav, _gallobj, obsdata, params);
             if (!update_valid)
@@ -63,6 +77,7 @@ namespace great
                 return false;
             }
             *flag = make_tuple(obsdata.site(), obsdata.sat(), epoch);
+            _rec_sat_gen = _sat_state->gen;
         }
 
         // combine equ
@@ -421,8 +436,8 @@ namespace great
         {
             clk = pars[idx_clk].value() / CLIGHT;
         }
-        //-- update clk par
-        if (idx_clk >= 0)
+        //-- update clk par from the clk file (unchanged if taken from the par, read by all satellites)
+        else if (idx_clk >= 0 && pars[idx_clk].value() != clk * CLIGHT)
         {
             pars[idx_clk].value(clk * CLIGHT);
         }
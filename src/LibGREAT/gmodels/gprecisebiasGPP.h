@@ -54,6 +54,15 @@ namespace great
         */
         bool cmb_equ(t_gtime &epoch, t_gallpar &params, t_gsatdata &obsdata, t_gobs &gobs, t_gbaseEquation &result) override;
 
+        /**
+        * @brief model for one thread of the per-satellite evaluation
+        *
+        * A new model built from the same data and settings (own tides, rotation
+        * matrices and scratch state), the wind-up and attitude slots are shared.
+        * @return     shared_ptr<t_gbiasmodel>  the worker model
+        */
+        shared_ptr<t_gbiasmodel> worker() override;
+
         /**
         * @brief prepare observation for GPP.
         *
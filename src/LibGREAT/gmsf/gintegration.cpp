@@ -14,6 +14,7 @@
 #include "gproc/gpreproc.h"
 #include "gutils/gtimesync.h"
 #include "gins/gins.h"
+#include "gutils/gprofiler.h"
 #include <iostream>
 using namespace great;
 using namespace std;
@@ -43,6 +44,10 @@ great::t_gintegration::t_gintegration(string site, string site_base, t_gsetbase*
     _imudata = nullptr;
     _initial_merge = false;
     _publisher.Initialize();
+    _fltmode = dynamic_cast<t_gsetign*>(gset)->fltmode();
+    map<double, int> outages = dynamic_cast<t_gsetign*>(gset)->sim_gnss_outages();
+    _outage_threads = dynamic_cast<t_gsetign*>(gset)->sim_outage_threads();
+    if (!outages.empty()) _outage = make_shared<t_goutagesim>(outages, _outage_threads);
 }
 
 int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end, bool beg_end)
@@ -59,6 +64,11 @@ int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end
         return -1;
     }
 
+    // checkpoints are taken by the integration loop, not by the GNSS-only alignment
+    string ckp_file = _ckp_file, ckp_restore = _ckp_restore;
+    _ckp_file.clear();
+    _ckp_restore.clear();
+
     t_gpvtflt::InitProc(beg, end);
 
     if (!this->_init()) {
@@ -67,8 +77,23 @@ int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end
     }
     _gobs->setepoches(_site);
 
+    // there is no backward mechanization: FBS and BACKWARD are derived from the RTS pass
+    if (_fltmode == RTS || _fltmode == FBS || _fltmode == BACKWARD)
+    {
+        _smoother = make_shared<t_gsmoother>(nq, SMT_NAV, SMT_EXTRA, _ign_type == IGN_TYPE::TCI);
+        _smt_phi = Eigen::MatrixXd::Identity(nq, nq);
+        _smt_dx = Eigen::VectorXd::Zero(nq);
+        _smt_fixed = false;
+    }
+
+	if (!ckp_restore.empty())
+	{
+		if (restore(ckp_restore) < 0) return -1;
+		// IMU samples up to the checkpoint are already in the state
+		_imudata->erase_bef(t_gtime(_gnss_crt.gwk(), _shm.t + 0.5 * _shm.ts));
+	}
 	// time align
-	if (_ins_beg < _gnss_beg) {
+	else if (_ins_beg < _gnss_beg) {
 		_ins_crt = _imudata->erase_bef(_gnss_beg);
 	}
 	else
@@ -81,6 +106,7 @@ int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end
 		}
 	}
 
+    t_gprofiler::site(_site);
     std::cerr << endl << _site << ": Start MSF Processing:" << _ins_crt.str_ymdhms() << "  " << _end_time.str_ymdhms() << endl;
     cout << "EPOCH " << _ins_crt.str_ymdhms() << endl;
     t_gposdata::data_pos posdata;
@@ -116,6 +142,11 @@ int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end
             sins.Update(_wm, _vm, _shm);
             time_update(sins.nts);
             kftk = sins.t;
+            if (_smoother)
+            {
+                _smt_phi = (Eigen::MatrixXd::Identity(nq, nq) + Ft * sins.nts) * _smt_phi;
+                _smt_Pprior = Pk.topLeftCorner(nq, nq);
+            }
 
             int imeas = _getMeas(), irc = 0;
 
@@ -151,14 +182,25 @@ int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end
                 
                 double percent = _ins_crt.diff(_ins_beg) / _ins_end.diff(_ins_beg) * 100.0;
                 cerr << "\r" << _ins_crt.str_ymdhms("Processing Epoch: ") << " Meas = " << meas2str(*_Meas_Type.begin()) << fixed << setprecision(1) << setw(6) << percent << "%";
-                if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _site + ": ( " + outinfo + ")" +
-                    _ins_crt.str_ymdhms(" integrated navigation processing epoch: "));
+                GLOGGER_INFO(_spdlog, "gintegration:  {}: ( {}) integrated navigation processing epoch: {}", _site, outinfo, _ins_crt.str_ymdhms());
             }
 
-            if ((_ign_type == IGN_TYPE::LCI || (_ign_type == IGN_TYPE::TCI && !_amb_state))
-                && fabs(kftk - int(kftk)) < _shm.delay) {
+            bool out = (_ign_type == IGN_TYPE::LCI || (_ign_type == IGN_TYPE::TCI && !_amb_state))
+                && fabs(kftk - int(kftk)) < _shm.delay;
+            if (out) {
                 t_gintegration::_write();
             }
+            if (_smoother && (out || _Meas_Type.size()))
+                _smt_add(out || (_ign_type == IGN_TYPE::TCI && _amb_state));
+            if (_outage)
+                _outage->add(*this, _wm, _vm, _shm, _Meas_Type, _odo_vf);
+
+            if (!ckp_file.empty() && _ckp_intv > 0.0 && _Meas_Type.size() &&
+                (_ckp_last == FIRST_TIME || fabs(_ins_crt.diff(_ckp_last)) > _ckp_intv - 1e-3))
+            {
+                checkpoint(ckp_file);
+                _ckp_last = _ins_crt;
+            }
         }
         while (_ins_crt.diff(_gnss_crt) > _sampling)
         {
@@ -167,9 +209,223 @@ int great::t_gintegration::processBatchFB(const t_gtime& beg, const t_gtime& end
         }
     }
 
+    if (!ckp_file.empty() && _aligned && _ckp_last != _ins_crt) checkpoint(ckp_file);
+
+    if (_smoother) _smt_run();
+    if (_outage) _outage_run();
+
     return 0;
 }
 
+void great::t_gintegration::_smt_add(bool out)
+{
+    double nav[SMT_NAV], extra[SMT_EXTRA];
+    _sins2nav(nav);
+    extra[0] = _Meas_Type.size() ? static_cast<double>(*_Meas_Type.begin()) : -1.0;
+    extra[1] = static_cast<double>(_param.amb_prns().size());
+    extra[2] = _dop.pdop();
+    extra[3] = _amb_state ? 1.0 : 0.0;
+    extra[4] = _amb_state ? _ambfix->get_ratio() : 0.0;
+    if (_smt_Pprior.rows() != nq) _smt_Pprior = Pk.topLeftCorner(nq, nq);
+
+    // the filter goes on with the float state, the fixed one is kept relative to the node
+    Eigen::VectorXd dxf;
+    if (_smt_fixed) dxf = _smt_dxf - _smt_dx;
+    _smt_fixed = false;
+
+    if (!_smoother->add(kftk, out, nav, extra, _smt_Pprior, Pk, _smt_phi, _smt_dx,
+                        dxf.size() ? &dxf : nullptr, dxf.size() ? &_smt_Pf : nullptr))
+    {
+        if (_spdlog) SPDLOG_LOGGER_ERROR(_spdlog, string("gintegration:  ") + "smoother state log failed, smoothing disabled");
+        _smoother.reset();
+        return;
+    }
+    _smt_phi.setIdentity();
+    _smt_dx.setZero();
+}
+
+void great::t_gintegration::_smt_run()
+{
+    bool backward = (_fltmode == BACKWARD);
+    string tmp = dynamic_cast<t_gsetout*>(_setkf)->outputs("smt");
+    if (tmp.empty()) tmp = t_gsinskf::_name + (backward ? "result_bwd.ins" : "result_smt.ins");
+    if (t_gsinskf::_name != "") substitute(tmp, "$(rec)", t_gsinskf::_name, false);
+
+    // smoothed nodes come in reverse order, kept in a second log and written forward
+    t_gspill rows(1 + SMT_NAV + SMT_EXTRA);
+    vector<double> row(rows.recsize());
+    Eigen::VectorXd Xk_sav = Xk;
+    t_gsins sins_sav = sins;
+    double odoscale_sav = _odoscale;
+
+    string mode = backward ? "backward filter" : (_fltmode == FBS ? "forward/backward combination" : "RTS smoothing");
+    cerr << endl << _site << ": " << mode << " of " << _smoother->size() << " nodes" << endl;
+    long nout = _smoother->smooth([&](double t, const double* nav, const double* extra, const Eigen::VectorXd& s, const Eigen::MatrixXd& Ps)
+    {
+        _nav2sins(nav);
+        Xk = s;
+        t_gsinskf::feedback();
+        row[0] = t;
+        _sins2nav(&row[1]);
+        copy(extra, extra + SMT_EXTRA, row.begin() + 1 + SMT_NAV);
+        // the backward filter solution is float
+        if (backward) row[1 + SMT_NAV + 3] = row[1 + SMT_NAV + 4] = 0.0;
+        rows.push(row.data());
+    }, backward);
+
+    t_giof fsmt;
+    fsmt.tsys(t_gtime::GPS);
+    fsmt.mask(tmp);
+    ostringstream os;
+    sins.prt_header(os, _shm._imu_scale, _shm._odo);
+    fsmt.write(os.str().c_str(), os.str().size());
+    t_gfmtline line;
+    for (size_t i = rows.size(); i-- > 0;)
+    {
+        const double* r = rows.at(i);
+        if (!r) { nout = -1; break; }
+        _nav2sins(r + 1);
+        sins.t = r[0];
+        const double* extra = r + 1 + SMT_NAV;
+        string meas = extra[0] < 0 ? "INS" : meas2str(static_cast<MEAS_TYPE>(static_cast<int>(extra[0])));
+        _prt_line(line, meas, static_cast<int>(extra[1]), extra[2], extra[3] != 0.0, extra[4]);
+        if (line.size() > 1 << 16)
+        {
+            fsmt.write(line.data().c_str(), line.size());
+            line.clear();
+        }
+    }
+    fsmt.write(line.data().c_str(), line.size());
+
+    sins = sins_sav; Xk = Xk_sav; _odoscale = odoscale_sav;
+    if (_spdlog)
+    {
+        if (nout < 0) SPDLOG_LOGGER_ERROR(_spdlog, string("gintegration:  ") + "smoother state log could not be read back");
+        else SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _site + ": " + mode + " epochs " + to_string(nout) + " written to " + tmp);
+    }
+}
+
+void great::t_gintegration::_outage_run()
+{
+    string tmp = dynamic_cast<t_gsetout*>(_setkf)->outputs("outage");
+    if (tmp.empty()) tmp = t_gsinskf::_name + "result_outage.txt";
+    if (t_gsinskf::_name != "") substitute(tmp, "$(rec)", t_gsinskf::_name, false);
+
+    cerr << endl << _site << ": " << _outage->size() << " simulated GNSS outages over " << _outage->logged() << " IMU epochs" << endl;
+    vector<t_goutagestat> stat = _outage->run();
+
+    t_giof fout;
+    fout.tsys(t_gtime::GPS);
+    fout.mask(tmp);
+    ostringstream os;
+    t_goutagesim::write(stat, os);
+    fout.write(os.str().c_str(), os.str().size());
+    fout.flush();
+
+    if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _site + ": drift of " + to_string(stat.size()) + " simulated GNSS outages written to " + tmp);
+}
+
+void great::t_gintegration::_sins2nav(double* nav) const
+{
+    nav[0] = sins.qeb.q0; nav[1] = sins.qeb.q1; nav[2] = sins.qeb.q2; nav[3] = sins.qeb.q3;
+    for (int i = 0; i < 3; i++)
+    {
+        nav[4 + i] = sins.ve(i);
+        nav[7 + i] = sins.pos_ecef(i);
+        nav[10 + i] = sins.vn(i);
+        nav[13 + i] = sins.eb(i);
+        nav[16 + i] = sins.db(i);
+        nav[19 + i] = sins.Kg(i);
+        nav[22 + i] = sins.Ka(i);
+    }
+    nav[25] = sins.qvb.q0; nav[26] = sins.qvb.q1; nav[27] = sins.qvb.q2; nav[28] = sins.qvb.q3;
+    nav[29] = _odoscale;
+}
+
+void great::t_gintegration::_nav2sins(const double* nav)
+{
+    sins.qeb = t_gquat(nav[0], nav[1], nav[2], nav[3]);
+    for (int i = 0; i < 3; i++)
+    {
+        sins.ve(i) = nav[4 + i];
+        sins.pos_ecef(i) = nav[7 + i];
+        sins.vn(i) = nav[10 + i];
+        sins.eb(i) = nav[13 + i];
+        sins.db(i) = nav[16 + i];
+        sins.Kg(i) = nav[19 + i];
+        sins.Ka(i) = nav[22 + i];
+    }
+    sins.qvb = t_gquat(nav[25], nav[26], nav[27], nav[28]);
+    sins.Cvb = t_gbase::q2mat(sins.qvb);
+    sins.Cbv = sins.Cvb.transpose();
+    _odoscale = nav[29];
+
+    // derived attitude, position and velocity
+    sins.pos = Cart2Geod(sins.pos_ecef, false);
+    sins.eth.Update(sins.pos, sins.vn);
+    sins.vn = sins.eth.Cne * sins.ve;
+    sins.qnb = t_gbase::m2qua(sins.eth.Cne) * sins.qeb;
+    sins.att = t_gbase::q2att(sins.qnb);
+    sins.Ceb = t_gbase::q2mat(sins.qeb);
+    sins.Cnb = t_gbase::q2mat(sins.qnb);
+}
+
+void great::t_gintegration::_save_state(t_gcheckpoint& ckp)
+{
+    t_gpvtflt::_save_state(ckp);
+
+    vector<double> nav(SMT_NAV);
+    _sins2nav(nav.data());
+    ckp.section("integration");
+    ckp.put(_ins_crt);
+    ckp.put(_gnss_crt);
+    ckp.put(_initial_merge);
+    ckp.put(_shm.t);
+    ckp.put(_shm.ts);
+    ckp.put(nav);
+    ckp.put(sins.t);
+    ckp.put(sins.nts);
+    ckp.put(sins.pure_ins_time);
+    sins.imu.checkpoint(ckp);
+    ckp.put(kftk);
+    ckp.put(Pk);
+    ckp.put(Xk);
+    ckp.put(_global_variance);
+    ckp.put(_gv_sav);
+    ckp.put(param_of_sins);
+}
+
+void great::t_gintegration::_load_state(t_gcheckpoint& ckp)
+{
+    t_gpvtflt::_load_state(ckp);
+
+    vector<double> nav;
+    ckp.section("integration");
+    ckp.get(_ins_crt);
+    ckp.get(_gnss_crt);
+    ckp.get(_initial_merge);
+    ckp.get(_shm.t);
+    ckp.get(_shm.ts);
+    ckp.get(nav);
+    ckp.get(sins.t);
+    ckp.get(sins.nts);
+    ckp.get(sins.pure_ins_time);
+    sins.imu.restore(ckp);
+    ckp.get(kftk);
+    ckp.get(Pk);
+    ckp.get(Xk);
+    ckp.get(_global_variance);
+    ckp.get(_gv_sav);
+    ckp.get(param_of_sins);
+    if (!ckp.good() || nav.size() != SMT_NAV || Pk.rows() != nq || Xk.size() != nq)
+    {
+        ckp.fail();
+        return;
+    }
+    _nav2sins(nav.data());
+    _aligned = true;
+}
+
 int great::t_gintegration::_gnss_feedback(const ColumnVector& dx)
 {
     try {
@@ -224,6 +480,12 @@ void great::t_gintegration::_feedback(MEAS_TYPE type, bool successed)
         t_gsins sins_out = sins; Eigen::VectorXd Xk_out = Xk;
         _global_variance = BaseMatrix2Eigen(_Qx);
 		if (_amb_state) Xk = Columns2VectorXd(_filter->dx()).block(0, 0, nq, 1);
+        if (_amb_state && _smoother)
+        {
+            _smt_dxf = _smt_dx + Xk;
+            _smt_Pf = BaseMatrix2Eigen(_filter->Qx()).topLeftCorner(nq, nq);
+            _smt_fixed = true;
+        }
 		this->feedback();
 		if (_amb_state)this->_write();
 		sins = sins_out; Xk = Xk_out;
@@ -248,35 +510,38 @@ void great::t_gintegration::_feedback(MEAS_TYPE type, bool successed)
     }
 
     Xk.conservativeResize(nq);
+    if (_smoother) _smt_dx += Xk;
     t_gsinskf::feedback();
     Xk = Eigen::VectorXd::Zero(global_size); 
     _gv_sav = _global_variance; 
 }
 void great::t_gintegration::_write(string info)
 {
+    GPROF_SCOPE(PROF_OUTPUT);
     set<string> ambs = _param.amb_prns();
     int nsat = ambs.size();
-    // get amb status
-    string amb = "Float";
-    if (_amb_state)amb = "Fixed";
     string meas = "INS";
     if (_Meas_Type.size())    meas = meas2str(*_Meas_Type.begin()); //  ( GNSS -> ZUPT -> ODO -> NHC )
     _prt_ins_kml();
-    ostringstream os;
-    sins.prt_sins(os);
-    if (_shm._odo)    
-        os << fixed << setprecision(4) << setw(12) << 1.0 + _odoscale;
-    os << fixed << setprecision(0)
-        << " " << setw(10) << meas            // meas
-        << " " << setw(5) << nsat            // nsat
-        << fixed << setprecision(2)
-        << " " << setw(7) << _dop.pdop()     // pdop
-        << fixed << setprecision(2)
-        << " " << setw(8) << amb
-        << setw(10) << (_amb_state ? _ambfix->get_ratio() : 0.0);
-    os << endl;
-    _fins->write(os.str().c_str(), os.str().size());
-    os.str("");
+    t_gfmtline line(_fins_bin);
+    _prt_line(line, meas, nsat, _dop.pdop(), _amb_state, _amb_state ? _ambfix->get_ratio() : 0.0);
+    _fins->write(line.data().c_str(), line.size());
+}
+
+void great::t_gintegration::_prt_line(t_gfmtline& line, const string& meas, int nsat, double pdop, bool fixed_amb, double ratio)
+{
+    // get amb status
+    string amb = "Float";
+    if (fixed_amb)amb = "Fixed";
+    sins.prt_sins(line);
+    if (_shm._odo)
+        line.fix(1.0 + _odoscale, 12, 4);
+    line.lit(" ").str(meas, 10)              // meas
+        .lit(" ").num(nsat, 5)               // nsat
+        .lit(" ").fix(pdop, 7, 2)            // pdop
+        .lit(" ").str(amb, 8)
+        .fix(ratio, 10, 2);
+    line.eol();
 }
 
 int great::t_gintegration::_prt_ins_kml()
@@ -295,31 +560,8 @@ int great::t_gintegration::_prt_ins_kml()
     t_gposdata::data_pos posdata = t_gposdata::data_pos{ crt, position, velocity, Qpos, Qvel, 1.3, int(_data.size()), _amb_state };
 
     // write kml
-    if (_kml && ins) {
-        ostringstream out;
-        out << fixed << setprecision(11) << " " << setw(0) << Geo_pos[1] << ',' << Geo_pos[0];
-        string val = out.str();
-
-        xml_node root = _doc;
-        xml_node node = this->_default_node(root, _root.c_str());
-        xml_node document = node.child("Document");
-        xml_node last_child = document.last_child();
-        xml_node placemark = document.insert_child_after("Placemark", last_child);
-        string q = "#P" + _quality_grade(posdata);
-        this->_default_node(placemark, "styleUrl", q.c_str());
-        this->_default_node(placemark, "time", int2str(_ins_crt.sow()).c_str());
-        xml_node point = this->_default_node(placemark, "Point");
-        this->_default_node(point, "coordinates", val.c_str()); // for point
-        xml_node description = placemark.append_child("description");
-        description.append_child(pugi::node_cdata).set_value(_gen_kml_description(_ins_crt, posdata).c_str());
-        xml_node TimeStamp = placemark.append_child("TimeStamp");
-        string time = trim(_ins_crt.str_ymd()) + "T" + trim(_ins_crt.str_hms()) + "Z";
-        this->_default_node(TimeStamp, "when", time.c_str());
-
-        xml_node Placemark = document.child("Placemark");
-        xml_node LineString = Placemark.child("LineString");
-        this->_default_node(LineString, "coordinates", val.c_str(), false);  // for line
-    }
+    if (_kml && _kml_writer && ins)
+        _kml_writer->placemark(_ins_crt, Geo_pos[1], Geo_pos[0], _quality_grade(posdata), _gen_kml_description(_ins_crt, posdata));
 
     return 1;
 }
@@ -525,24 +767,34 @@ int great::t_gintegration::_processEpoch(const t_gtime& runEpoch)
 
         if (_isBase) {
             if (_combineDD(A, P, l) < 0) {
-                if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _site + runEpoch.str_ymdhms(" combining DD observation failed at epoch: "));
+                GLOGGER_INFO(_spdlog, "gintegration:  {} combining DD observation failed at epoch: {}", _site, runEpoch.str_ymdhms());
                 return NO_MEAS;
             }
         }
         Qsav = _Qx;
 
         if (_merge_pose(A) < 0) {
-            if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _site + runEpoch.str_ymdhms(" merge failed at epoch: "));
+            GLOGGER_INFO(_spdlog, "gintegration:  {} merge failed at epoch: {}", _site, runEpoch.str_ymdhms());
             dx = 0.0; _Qx = Qsav;
             return NO_MEAS;
         }
+        int irc_flt = -1;
         try
         {
-            _filter->update(A, P, l, dx, _Qx);
+            GPROF_SCOPE(PROF_FILTER);
+            irc_flt = _filter->update(A, P, l, dx, _Qx);
         }
         catch (...)
         {
-            if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") +  _site + runEpoch.str_ymdhms(" meas_update failed at epoch: "));
+            GLOGGER_INFO(_spdlog, "gintegration:  {} meas_update failed at epoch: {}", _site, runEpoch.str_ymdhms());
+            dx = 0.0; _Qx = Qsav;
+            return NO_MEAS;
+        }
+        if (irc_flt < 0)
+        {
+            _n_ALL_flt++;
+            _n_NPD_flt++;
+            GLOGGER_INFO(_spdlog, "gintegration:  {} meas_update failed at epoch: {}, covariance matrix not positive definite", _site, runEpoch.str_ymdhms());
             dx = 0.0; _Qx = Qsav;
             return NO_MEAS;
         }
@@ -649,15 +901,17 @@ int great::t_gintegration::_GNSS_Update()
     }
     else if (_ign_type == IGN_TYPE::TCI)
     {
+        // the LC epoch is timed by ProcessOneEpoch()
+        GPROF_SCOPE(PROF_EPOCH);
         _timeUpdate(_gnss_crt);
         Flag = MEAS_TYPE(t_gintegration::_processEpoch(_gnss_crt));
         if (Flag == NO_MEAS)
         {
-            if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _gnss_crt.str_ymdhms("TC GNSS/INS filter updating Failed at epoch: "));
+            GLOGGER_INFO(_spdlog, "gintegration:  TC GNSS/INS filter updating Failed at epoch: {}", _gnss_crt.str_ymdhms());
         }
         else
         {
-            if (_spdlog) SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") + _gnss_crt.str_ymdhms("TC GNSS/INS filter updating Succeed at epoch: "));
+            GLOGGER_INFO(_spdlog, "gintegration:  TC GNSS/INS filter updating Succeed at epoch: {}", _gnss_crt.str_ymdhms());
         }
     }
 
@@ -750,6 +1004,7 @@ bool great::t_gintegration::_time_valid(t_gtime gt, t_gtime inst)
 		this->_slip_detect(obsEpo);
 		
         _data = _gobs->obs(_site, obsEpo);
+        _gobs->consumed(_site, obsEpo);
 		if (_data.size() > 0) {
 			res_valid = true;
 			if (_gallbias) {
@@ -759,9 +1014,7 @@ bool great::t_gintegration::_time_valid(t_gtime gt, t_gtime inst)
 			}
 		}
         else {
-            if (_spdlog) {
-                SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") +  _site + gt.str_ymdhms(" no observation found at epoch: "));
-            }
+            GLOGGER_INFO(_spdlog, "gintegration:  {} no observation found at epoch: {}", _site, gt.str_ymdhms());
             res_valid = false;
         }
         if (_isBase)
@@ -769,6 +1022,8 @@ bool great::t_gintegration::_time_valid(t_gtime gt, t_gtime inst)
             if (true) {
                 _data_base.erase(_data_base.begin(), _data_base.end());
                 _data_base = _gobs->obs(_site_base, obsEpo);
+                if (!_base_shared)
+                    _gobs->consumed(_site_base, obsEpo);
             }
             if (_data_base.size() > 0) {
                 res_valid = true;
@@ -780,9 +1035,7 @@ bool great::t_gintegration::_time_valid(t_gtime gt, t_gtime inst)
                 }
             }
             else {
-                if (_spdlog) {
-                    SPDLOG_LOGGER_INFO(_spdlog, string("gintegration:  ") +  _site_base + gt.str_ymdhms(" no base observation found at epoch: "));
-                }
+                GLOGGER_INFO(_spdlog, "gintegration:  {} no base observation found at epoch: {}", _site_base, gt.str_ymdhms());
                 res_valid = false;
             }
         }
@@ -22,10 +22,15 @@
 #include "gproc/gpvtflt.h"
 #include "gdata/gposdata.h"
 #include "gmsf/gpublish.h"
+#include "gmsf/gsmoother.h"
+#include "gmsf/goutagesim.h"
 #include "gexport/ExportLibGREAT.h"
 
 using namespace gnut;
 
+#define SMT_NAV   30   ///< smoother nominal state: qeb, ve, pos_ecef, vn, eb, db, Kg, Ka, qvb, odoscale
+#define SMT_EXTRA 5    ///< smoother output info: meas, nsat, pdop, fixed, ratio
+
 namespace great
 {
 
@@ -168,6 +173,46 @@ namespace great
         */
         virtual int _prt_ins_kml();
 
+        /**
+        * @brief write one line of the ins result
+        * @param[out] line          output line
+        * @param[in]  meas          measurement type
+        * @param[in]  nsat          number of satellites
+        * @param[in]  pdop          PDOP
+        * @param[in]  fixed_amb     whether the ambiguities are fixed
+        * @param[in]  ratio         ratio of the ambiguity fixing
+        */
+        void _prt_line(t_gfmtline& line, const string& meas, int nsat, double pdop, bool fixed_amb, double ratio);
+
+        /**
+        * @brief add the current epoch to the smoother log
+        * @param[in]  out           whether the epoch is written
+        */
+        void _smt_add(bool out);
+
+        /**
+        * @brief backward RTS pass and output of the smoothed trajectory (RTS, FBS)
+        *        or of the backward filter solution (BACKWARD), see gsmoother.h
+        */
+        void _smt_run();
+
+        /** @brief nominal state of sins to array (SMT_NAV). */
+        void _sins2nav(double* nav) const;
+
+        /** @brief nominal state of sins from array (SMT_NAV), derived values recomputed. */
+        void _nav2sins(const double* nav);
+
+        /**
+        * @brief evaluate the simulated GNSS outages and write their drift statistics
+        */
+        void _outage_run();
+
+        /** @brief GNSS filter state plus the mechanization and the error-state filter. */
+        virtual void _save_state(t_gcheckpoint& ckp) override;
+
+        /** @brief restore the state saved by _save_state. */
+        virtual void _load_state(t_gcheckpoint& ckp) override;
+
     protected:
         t_gtime _ins_beg, _gnss_beg;
         t_gtime _ins_end, _gnss_end;
@@ -177,6 +222,18 @@ namespace great
         t_gpublish _publisher;
         IMUState _imu_state;
 
+        FLT_TYPE _fltmode;                       ///< FORWARD, RTS and FBS (smoothed), BACKWARD (backward filter from the smoother)
+        shared_ptr<t_gsmoother> _smoother;       ///< smoother log, nullptr when not smoothing
+        Eigen::MatrixXd _smt_phi;                ///< transition since the last smoother node
+        Eigen::MatrixXd _smt_Pprior;             ///< error state covariance after the last time update
+        Eigen::VectorXd _smt_dx;                 ///< corrections fed back since the last smoother node
+        Eigen::VectorXd _smt_dxf;                ///< fixed corrections since the last smoother node (TCI)
+        Eigen::MatrixXd _smt_Pf;                 ///< error state covariance of the fixed solution (TCI)
+        bool _smt_fixed = false;                 ///< the current node has a fixed solution
+
+        shared_ptr<t_goutagesim> _outage;        ///< simulated GNSS outages, nullptr when none are set
+        int _outage_threads;                     ///< threads evaluating the outages
+
     };
 
 }
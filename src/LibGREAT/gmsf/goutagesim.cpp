@@ -0,0 +1,257 @@
+/**
+ * @file         goutagesim.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        simulated GNSS outages evaluated in parallel from one reference run
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+#include "gmsf/goutagesim.h"
+
+namespace great
+{
+    t_goutagekf::t_goutagekf(const t_gsinskf &kf)
+        : t_gsinskf(kf)
+    {
+        // the output file, the data and the log stay with the integration
+        _fins = nullptr;
+        _imudata = nullptr;
+        _ododata = nullptr;
+        _spdlogkf = nullptr;
+        _global_variance.resize(0, 0);
+        _gv_sav.resize(0, 0);
+        Xk = Eigen::VectorXd::Zero(nq);
+        Phik = Eigen::MatrixXd::Identity(nq, nq);
+    }
+
+    t_goutagekf::~t_goutagekf()
+    {
+    }
+
+    void t_goutagekf::step(const vector<Eigen::Vector3d> &wm, const vector<Eigen::Vector3d> &vm, const t_scheme &scm,
+                           const set<MEAS_TYPE> &meas, double vf)
+    {
+        sins.Update(wm, vm, scm);
+        time_update(sins.nts);
+        kftk = sins.t;
+        _ins_crt = t_gtime(_ins_crt.gwk(), scm.t);
+
+        // same order and feedback as t_gintegration, a rejected update keeps the prediction
+        for (const auto &type : meas)
+        {
+            Eigen::MatrixXd Psav = Pk;
+            int irc = -1;
+            switch (type)
+            {
+            case ZUPT_MEAS: irc = _ZUPT_Update(); break;
+            case NHC_MEAS:  irc = _NHC_Update();  break;
+            case ODO_MEAS:
+                set_meas_ODO(vf, _ins_crt.sow() + _ins_crt.dsec());
+                irc = _meas_update();
+                break;
+            default: continue;
+            }
+            if (irc > 0)
+                feedback();
+            else
+                Pk = Psav;
+            Xk = Eigen::VectorXd::Zero(nq);
+        }
+    }
+
+    t_goutagesim::t_goutagesim(const map<double, int> &outages, int nthreads)
+        : _next(0),
+          _open(-1.0),
+          _log0(0),
+          _nlog(0),
+          _pool(make_shared<t_gthreadpool>(nthreads))
+    {
+        for (const auto &it : outages)
+        {
+            if (it.second <= 0)
+                continue;
+            t_gscenario scn;
+            scn.beg = it.first;
+            scn.end = it.first + it.second;
+            scn.length = it.second;
+            _scn.push_back(scn);
+
+            t_goutagestat st;
+            st.beg = scn.beg;
+            st.length = scn.length;
+            _stat.push_back(st);
+        }
+    }
+
+    t_goutagesim::~t_goutagesim()
+    {
+    }
+
+    void t_goutagesim::add(const t_gsinskf &kf, const vector<Eigen::Vector3d> &wm, const vector<Eigen::Vector3d> &vm, const t_scheme &scm,
+                           const set<MEAS_TYPE> &meas, double vf)
+    {
+        // windows ended before this epoch are complete in the log, one batch per thread
+        for (auto it = _active.begin(); it != _active.end();)
+        {
+            if (scm.t > _scn[*it].end + 1e-6)
+            {
+                _closed.push_back(*it);
+                it = _active.erase(it);
+            }
+            else
+                ++it;
+        }
+        if (_closed.size() >= static_cast<size_t>(_pool->size()))
+        {
+            _run_batch(_closed);
+            _closed.clear();
+        }
+
+        if (_next > 0 && scm.t <= _open + 1e-6)
+        {
+            t_gstep step;
+            step.t = scm.t;
+            step.ts = scm.ts;
+            step.wm = wm;
+            step.vm = vm;
+            step.meas = meas;
+            step.meas.erase(GNSS_MEAS);
+            step.vf = vf;
+            step.pos = kf.sins.pos;
+            step.vn = kf.sins.vn;
+            step.att = kf.sins.att;
+            _log.push_back(step);
+            _nlog++;
+        }
+
+        // fork after the last update at or after the outage begin
+        while (_next < _scn.size() && _scn[_next].beg <= scm.t + 1e-6)
+        {
+            t_gscenario &scn = _scn[_next++];
+            scn.started = true;
+            scn.first = _nlog;
+            scn.fork = make_shared<t_goutagekf>(kf);
+            scn.scm = scm;
+            _open = max(_open, scn.end);
+            _active.push_back(_next - 1);
+        }
+    }
+
+    vector<t_goutagestat> t_goutagesim::run()
+    {
+        vector<size_t> idx(_closed);
+        idx.insert(idx.end(), _active.begin(), _active.end());
+        _closed.clear();
+        _active.clear();
+        _run_batch(idx);
+        return _stat;
+    }
+
+    void t_goutagesim::_run_batch(const vector<size_t> &idx)
+    {
+        _pool->parallel_for(static_cast<int>(idx.size()), [&](int k) { _stat[idx[k]] = _run(_scn[idx[k]]); });
+        for (size_t i : idx)
+        {
+            _scn[i].done = true;
+            _scn[i].fork.reset();
+        }
+
+        // epochs before the oldest window still to run are not needed any more
+        size_t keep = _nlog;
+        for (size_t i : _active)
+            keep = min(keep, _scn[i].first);
+        for (size_t i : _closed)
+            if (!_scn[i].done)
+                keep = min(keep, _scn[i].first);
+        while (_log0 < keep && !_log.empty())
+        {
+            _log.pop_front();
+            _log0++;
+        }
+    }
+
+    t_goutagestat t_goutagesim::_run(const t_gscenario &scn) const
+    {
+        t_goutagestat st;
+        st.beg = scn.beg;
+        st.length = scn.length;
+        st.started = scn.started;
+        if (!scn.started)
+            return st;
+
+        t_goutagekf kf(*scn.fork);
+        const t_gsins &sins = kf.sins;
+        t_scheme scm = scn.scm;
+        double sum2 = 0.0;
+        for (size_t k = scn.first - _log0; k < _log.size() && _log[k].t <= scn.end + 1e-6; k++)
+        {
+            const t_gstep &step = _log[k];
+            scm.t = step.t;
+            scm.ts = step.ts;
+            kf.step(step.wm, step.vm, scm, step.meas, step.vf);
+
+            // error in the local frame of the reference
+            double B = step.pos(0), L = step.pos(1);
+            Eigen::Matrix3d Cen;
+            Cen << -sin(L), -sin(B) * cos(L), cos(B) * cos(L),
+                    cos(L), -sin(B) * sin(L), cos(B) * sin(L),
+                    0.0,     cos(B),          sin(B);
+            Eigen::Vector3d dn = Cen.transpose() * (Geod2Cart(sins.pos, false) - Geod2Cart(step.pos, false));
+            double hor = dn.head<2>().norm(), ver = fabs(dn(2));
+            double dyaw = sins.att(2) - step.att(2);
+            while (dyaw > M_PI) dyaw -= 2 * M_PI;
+            while (dyaw < -M_PI) dyaw += 2 * M_PI;
+
+            st.nepo++;
+            st.dur = step.t - scn.scm.t;
+            st.hor_end = hor;
+            st.ver_end = ver;
+            st.hor_max = max(st.hor_max, hor);
+            st.ver_max = max(st.ver_max, ver);
+            st.vel_end = (sins.vn - step.vn).norm();
+            st.yaw_end = dyaw * 180.0 / M_PI;
+            sum2 += hor * hor;
+        }
+        if (st.nepo > 0)
+            st.hor_rms = sqrt(sum2 / st.nepo);
+        return st;
+    }
+
+    void t_goutagesim::write(const vector<t_goutagestat> &stat, ostream &os)
+    {
+        os << "# " << setw(13) << "Begin(sow)" << setw(8) << "Length" << setw(8) << "Epochs" << setw(10) << "Dur(s)"
+           << setw(12) << "HorEnd(m)" << setw(12) << "VerEnd(m)" << setw(12) << "HorMax(m)" << setw(12) << "VerMax(m)"
+           << setw(12) << "HorRMS(m)" << setw(12) << "VelEnd(m/s)" << setw(12) << "YawEnd(deg)" << endl;
+
+        int n = 0;
+        double hor = 0.0, ver = 0.0, hor_max = 0.0, ver_max = 0.0;
+        os << fixed;
+        for (const auto &st : stat)
+        {
+            os << "  " << setw(13) << setprecision(3) << st.beg << setw(8) << st.length;
+            if (!st.started || st.nepo == 0)
+            {
+                os << "   not reached" << endl;
+                continue;
+            }
+            os << setw(8) << st.nepo << setw(10) << setprecision(2) << st.dur
+               << setw(12) << setprecision(3) << st.hor_end << setw(12) << st.ver_end << setw(12) << st.hor_max
+               << setw(12) << st.ver_max << setw(12) << st.hor_rms << setw(12) << st.vel_end
+               << setw(12) << setprecision(4) << st.yaw_end << endl;
+            n++;
+            hor += st.hor_end;
+            ver += st.ver_end;
+            hor_max = max(hor_max, st.hor_end);
+            ver_max = max(ver_max, st.ver_end);
+        }
+        if (n > 0)
+            os << "# outages " << n << "  mean HorEnd " << setprecision(3) << hor / n << " m  mean VerEnd " << ver / n
+               << " m  worst HorEnd " << hor_max << " m  worst VerEnd " << ver_max << " m" << endl;
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * @file         goutagesim.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        simulated GNSS outages evaluated in parallel from one reference run
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   reference run   the integration with all GNSS; at the first epoch at or after an
+ *                   outage begin the filter (mechanization, Xk/Pk, sensor errors) is
+ *                   copied (fork), the IMU increments, the constraints accepted by the
+ *                   reference (NHC/ZUPT/ODO with the odometer velocity) and the
+ *                   reference solution of every epoch inside an outage window are
+ *                   logged once, shared by overlapping windows
+ *   scenarios       every fork is propagated over its window like the integration
+ *                   without GNSS: mechanization, time update and the logged constraint
+ *                   updates with feedback, and compared with the reference epoch by epoch.
+ *                   Closed windows are run by add() in batches of one scenario per thread,
+ *                   on a thread pool over the read-only log; the log is then cut to the
+ *                   oldest open window, so it holds a few windows, not the whole run.
+ *                   run() finishes the windows still open at the end of the data
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GOUTAGESIM_H
+#define GOUTAGESIM_H
+
+#include <map>
+#include <set>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+#include "gexport/ExportLibGREAT.h"
+#include "gins/gins.h"
+#include "gins/gutility.h"
+#include "gutils/gthreadpool.h"
+
+using namespace std;
+
+namespace great
+{
+    /**
+    * @brief drift of one simulated outage
+    */
+    struct LibGREAT_LIBRARY_EXPORT t_goutagestat
+    {
+        double beg = 0.0;        ///< outage begin (sow)
+        int length = 0;          ///< requested length [s]
+        bool started = false;    ///< begin reached by the reference run
+        int nepo = 0;            ///< propagated IMU epochs
+        double dur = 0.0;        ///< propagated time [s]
+        double hor_end = 0.0;    ///< horizontal position error at the end [m]
+        double ver_end = 0.0;    ///< vertical position error at the end [m]
+        double hor_max = 0.0;    ///< maximum horizontal position error [m]
+        double ver_max = 0.0;    ///< maximum vertical position error [m]
+        double hor_rms = 0.0;    ///< rms of the horizontal position error [m]
+        double vel_end = 0.0;    ///< velocity error at the end [m/s]
+        double yaw_end = 0.0;    ///< yaw error at the end [deg]
+    };
+
+    /**
+    * @brief filter of one simulated outage, forked from the integration
+    */
+    class LibGREAT_LIBRARY_EXPORT t_goutagekf : public t_gsinskf
+    {
+    public:
+        /** @brief copy of the filter state, without output file, data and log. */
+        explicit t_goutagekf(const t_gsinskf &kf);
+
+        /** @brief default destructor. */
+        virtual ~t_goutagekf();
+
+        /**
+        * @brief one IMU epoch without GNSS
+        * @param[in] wm         angle increments of the epoch
+        * @param[in] vm         velocity increments of the epoch
+        * @param[in] scm        processing scheme of the epoch
+        * @param[in] meas       constraints applied (GNSS_MEAS is skipped)
+        * @param[in] vf         odometer forward velocity for ODO_MEAS
+        */
+        void step(const vector<Eigen::Vector3d> &wm, const vector<Eigen::Vector3d> &vm, const t_scheme &scm,
+                  const set<MEAS_TYPE> &meas, double vf);
+    };
+
+    /**
+    * @brief runner of simulated GNSS outages
+    */
+    class LibGREAT_LIBRARY_EXPORT t_goutagesim
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] outages    outage begin (sow) and length [s], t_gsetign::sim_gnss_outages()
+        * @param[in] nthreads   threads including the calling one, t_gsetign::sim_outage_threads()
+        */
+        explicit t_goutagesim(const map<double, int> &outages, int nthreads = 1);
+
+        /** @brief default destructor. */
+        virtual ~t_goutagesim();
+
+        /**
+        * @brief one epoch of the reference run, after the measurement update and feedback
+        * @param[in] kf         filter (kf.sins is the reference solution)
+        * @param[in] wm         angle increments of the epoch
+        * @param[in] vm         velocity increments of the epoch
+        * @param[in] scm        processing scheme of the epoch
+        * @param[in] meas       measurements accepted at the epoch
+        * @param[in] vf         odometer forward velocity of the ODO update
+        */
+        void add(const t_gsinskf &kf, const vector<Eigen::Vector3d> &wm, const vector<Eigen::Vector3d> &vm, const t_scheme &scm,
+                 const set<MEAS_TYPE> &meas, double vf);
+
+        /**
+        * @brief propagate the scenarios not run yet (windows open at the end of the data)
+        * @return statistics of all scenarios in the order of the outage begin
+        */
+        vector<t_goutagestat> run();
+
+        /** @brief write the statistics with a summary line. */
+        static void write(const vector<t_goutagestat> &stat, ostream &os);
+
+        /** @brief number of outages. */
+        size_t size() const { return _scn.size(); }
+
+        /** @brief logged IMU epochs. */
+        size_t logged() const { return _nlog; }
+
+        /** @brief IMU epochs held in the log. */
+        size_t buffered() const { return _log.size(); }
+
+    protected:
+        /** @brief logged epoch: IMU increments and the reference solution after it. */
+        struct t_gstep
+        {
+            double t, ts;                             ///< time, interval
+            vector<Eigen::Vector3d> wm, vm;           ///< increments
+            set<MEAS_TYPE> meas;                      ///< constraints accepted by the reference
+            double vf;                                ///< odometer forward velocity
+            Eigen::Vector3d pos, vn, att;             ///< reference position (BLH), velocity (ENU), attitude
+        };
+
+        /** @brief simulated outage. */
+        struct t_gscenario
+        {
+            double beg, end;                          ///< window (sow)
+            int length;                               ///< requested length [s]
+            bool started = false;                     ///< fork taken
+            bool done = false;                        ///< propagated, fork released
+            size_t first = 0;                         ///< first logged epoch after the fork (count of logged())
+            shared_ptr<t_goutagekf> fork;             ///< filter at the fork
+            t_scheme scm;                             ///< scheme at the fork
+        };
+
+        /** @brief propagate one scenario. */
+        t_goutagestat _run(const t_gscenario &scn) const;
+
+        /** @brief propagate the scenarios of idx on the pool, then cut the log to the open windows. */
+        void _run_batch(const vector<size_t> &idx);
+
+        vector<t_gscenario> _scn;             ///< scenarios, ascending begin
+        vector<t_goutagestat> _stat;          ///< statistics of the scenarios
+        size_t _next;                         ///< first scenario without fork
+        double _open;                         ///< end of the latest window of the started scenarios
+        deque<t_gstep> _log;                  ///< epochs inside the open windows
+        size_t _log0;                         ///< count of logged() of _log.front()
+        size_t _nlog;                         ///< logged epochs
+        vector<size_t> _active;               ///< scenarios with a fork and an open window
+        vector<size_t> _closed;               ///< scenarios with a closed window, not run yet
+        shared_ptr<t_gthreadpool> _pool;      ///< threads of the scenarios
+    };
+}
+
+#endif
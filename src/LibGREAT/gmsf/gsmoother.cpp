@@ -0,0 +1,259 @@
+/**
+ * @file         gsmoother.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Rauch-Tung-Striebel smoother of the INS error states with a disk-spilled state log
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstring>
+#include <algorithm>
+#include "gmsf/gsmoother.h"
+
+namespace great
+{
+    /** @brief seek with a 64-bit offset, long is 32-bit on Windows and the spill exceeds 2 GiB. */
+    static int _fseek64(FILE *fp, unsigned long long off, int whence)
+    {
+#if defined _WIN32 || defined _WIN64
+        return _fseeki64(fp, static_cast<__int64>(off), whence);
+#else
+        return fseeko(fp, static_cast<off_t>(off), whence);
+#endif
+    }
+
+    t_gspill::t_gspill(size_t recsize, size_t block)
+        : _rec(max<size_t>(recsize, 1)),
+          _nrec(0),
+          _nfile(0),
+          _fp(nullptr),
+          _rbeg(0),
+          _rn(0)
+    {
+        _mem = max<size_t>(block / (_rec * sizeof(double)), 1);
+        _buf.reserve(_mem * _rec);
+    }
+
+    t_gspill::~t_gspill()
+    {
+        if (_fp)
+            fclose(_fp);
+    }
+
+    bool t_gspill::push(const double *rec)
+    {
+        if (_buf.size() >= _mem * _rec)
+        {
+            if (!_fp && !(_fp = tmpfile()))
+                return false;
+            _fseek64(_fp, 0, SEEK_END);
+            if (fwrite(_buf.data(), sizeof(double), _buf.size(), _fp) != _buf.size())
+                return false;
+            _nfile += _buf.size() / _rec;
+            _buf.clear();
+        }
+        _buf.insert(_buf.end(), rec, rec + _rec);
+        _nrec++;
+        return true;
+    }
+
+    const double *t_gspill::at(size_t i)
+    {
+        if (i >= _nrec)
+            return nullptr;
+        if (i >= _nfile)
+            return &_buf[(i - _nfile) * _rec];
+
+        if (i < _rbeg || i >= _rbeg + _rn)
+        {
+            // block ending at i, the records are read backward
+            _rbeg = (i + 1 > _mem) ? i + 1 - _mem : 0;
+            _rn = min(_mem, _nfile - _rbeg);
+            _rbuf.resize(_rn * _rec);
+            if (_fseek64(_fp, static_cast<unsigned long long>(_rbeg) * _rec * sizeof(double), SEEK_SET) != 0 ||
+                fread(_rbuf.data(), sizeof(double), _rbuf.size(), _fp) != _rbuf.size())
+            {
+                _rn = 0;
+                return nullptr;
+            }
+        }
+        return &_rbuf[(i - _rbeg) * _rec];
+    }
+
+    void t_gspill::clear()
+    {
+        if (_fp)
+            fclose(_fp);
+        _fp = nullptr;
+        _nrec = _nfile = _rbeg = _rn = 0;
+        _buf.clear();
+        _rbuf.clear();
+    }
+
+    t_gsmoother::t_gsmoother(int nq, int nnav, int nextra, bool fixed, size_t block)
+        : _nq(nq),
+          _nnav(nnav),
+          _nextra(nextra),
+          _npk(nq * (nq + 1) / 2),
+          _fixed(fixed),
+          _log(2 + nnav + nextra + nq + nq * (nq + 1) + nq * nq + (fixed ? 1 + nq + nq * (nq + 1) / 2 : 0), block)
+    {
+        _rec.resize(_log.recsize());
+    }
+
+    t_gsmoother::~t_gsmoother()
+    {
+    }
+
+    bool t_gsmoother::add(double t, bool out, const double *nav, const double *extra,
+                          const Eigen::MatrixXd &Pprior, const Eigen::MatrixXd &Ppost,
+                          const Eigen::MatrixXd &Phi, const Eigen::VectorXd &dx,
+                          const Eigen::VectorXd *dxf, const Eigen::MatrixXd *Pf)
+    {
+        double *p = _rec.data();
+        *p++ = t;
+        *p++ = out ? 1.0 : 0.0;
+        memcpy(p, nav, _nnav * sizeof(double));
+        p += _nnav;
+        if (_nextra > 0)
+            memcpy(p, extra, _nextra * sizeof(double));
+        p += _nextra;
+        for (int i = 0; i < _nq; i++)
+            *p++ = dx(i);
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j <= i; j++)
+                *p++ = Pprior(i, j);
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j <= i; j++)
+                *p++ = Ppost(i, j);
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j < _nq; j++)
+                *p++ = Phi(i, j);
+        if (_fixed)
+        {
+            bool fix = dxf && Pf;
+            *p++ = fix ? 1.0 : 0.0;
+            for (int i = 0; i < _nq; i++)
+                *p++ = fix ? (*dxf)(i) : 0.0;
+            for (int i = 0; i < _nq; i++)
+                for (int j = 0; j <= i; j++)
+                    *p++ = fix ? (*Pf)(i, j) : 0.0;
+        }
+        return _log.push(_rec.data());
+    }
+
+    void t_gsmoother::_unpack(const double *rec, Eigen::MatrixXd &Pprior, Eigen::MatrixXd &Ppost, Eigen::MatrixXd &Phi, Eigen::VectorXd &dx) const
+    {
+        const double *p = rec + 2 + _nnav + _nextra;
+        for (int i = 0; i < _nq; i++)
+            dx(i) = *p++;
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j <= i; j++)
+                Pprior(i, j) = Pprior(j, i) = *p++;
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j <= i; j++)
+                Ppost(i, j) = Ppost(j, i) = *p++;
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j < _nq; j++)
+                Phi(i, j) = *p++;
+    }
+
+    bool t_gsmoother::_unpack_fix(const double *rec, Eigen::MatrixXd &Pf, Eigen::VectorXd &dxf) const
+    {
+        if (!_fixed)
+            return false;
+        const double *p = rec + 2 + _nnav + _nextra + _nq + 2 * _npk + _nq * _nq;
+        if (*p++ == 0.0)
+            return false;
+        for (int i = 0; i < _nq; i++)
+            dxf(i) = *p++;
+        for (int i = 0; i < _nq; i++)
+            for (int j = 0; j <= i; j++)
+                Pf(i, j) = Pf(j, i) = *p++;
+        return true;
+    }
+
+    long t_gsmoother::smooth(const function<void(double, const double *, const double *, const Eigen::VectorXd &, const Eigen::MatrixXd &)> &f,
+                             bool backward)
+    {
+        size_t n = _log.size();
+        if (n == 0)
+            return 0;
+
+        Eigen::MatrixXd Pprior(_nq, _nq), Ppost(_nq, _nq), Phi(_nq, _nq);
+        Eigen::MatrixXd Pprior1(_nq, _nq), Phi1(_nq, _nq), Ps(_nq, _nq), A(_nq, _nq);
+        Eigen::VectorXd dx(_nq), dx1(_nq), s = Eigen::VectorXd::Zero(_nq);
+        Eigen::MatrixXd I = Eigen::MatrixXd::Identity(_nq, _nq), Ws(_nq, _nq), Wb(_nq, _nq), Pf(_nq, _nq), Po(_nq, _nq);
+        Eigen::VectorXd dxf(_nq), so(_nq);
+        Eigen::LDLT<Eigen::MatrixXd> ldlt(_nq), ldlt_o(_nq);
+        long nout = 0;
+
+        for (size_t k = n; k-- > 0;)
+        {
+            const double *rec = _log.at(k);
+            if (!rec)
+                return -1;
+            _unpack(rec, Pprior, Ppost, Phi, dx);
+
+            if (k == n - 1)
+            {
+                s.setZero();
+                Ps = Ppost;
+            }
+            else
+            {
+                // A = P(k|k) Phi' P(k+1|k)^-1
+                ldlt.compute(Pprior1);
+                A = ldlt.solve(Phi1 * Ppost).transpose();
+                s = A * (s + dx1);
+                Ps = Ppost + A * (Ps - Pprior1) * A.transpose();
+            }
+
+            if (rec[1] != 0.0)
+            {
+                bool valid = true;
+                so = s;
+                Po = Ps;
+                if (backward)
+                {
+                    // backward filter: forward prediction (-dx, P(k|k-1)) removed from the combination
+                    Ws = Ps.ldlt().solve(I);
+                    Wb = Pprior.ldlt().solve(I);
+                    ldlt_o.compute(Ws - Wb);
+                    valid = ldlt_o.info() == Eigen::Success && ldlt_o.isPositive() && (ldlt_o.vectorD().array() > 0.0).all();
+                    if (valid)
+                    {
+                        Po = ldlt_o.solve(I);
+                        so = Po * (Ws * s + Wb * dx);
+                    }
+                }
+                else if (_unpack_fix(rec, Pf, dxf))
+                {
+                    // fixed solution combined with the backward information Ps^-1 - P(k|k)^-1
+                    Ws = Ps.ldlt().solve(I);
+                    Wb = Pf.ldlt().solve(I);
+                    ldlt_o.compute(Wb + Ws - Ppost.ldlt().solve(I));
+                    if (ldlt_o.info() == Eigen::Success && ldlt_o.isPositive() && (ldlt_o.vectorD().array() > 0.0).all())
+                    {
+                        Po = ldlt_o.solve(I);
+                        so = Po * (Wb * dxf + Ws * s);
+                    }
+                }
+
+                if (valid)
+                {
+                    f(rec[0], rec + 2, rec + 2 + _nnav, so, Po);
+                    nout++;
+                }
+            }
+
+            Pprior1.swap(Pprior);
+            Phi1.swap(Phi);
+            dx1.swap(dx);
+        }
+        return nout;
+    }
+}
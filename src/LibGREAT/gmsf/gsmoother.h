@@ -0,0 +1,168 @@
+/**
+ * @file         gsmoother.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Rauch-Tung-Striebel smoother of the INS error states with a disk-spilled state log
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   forward (filter)   one node per output or measurement epoch k:
+ *                        nominal state, P(k|k-1), P(k|k), Phi(k,k-1) accumulated since
+ *                        the previous node, correction dx(k) fed back at k
+ *   backward           s(k) = A(k) (s(k+1) + dx(k+1)),  A(k) = P(k|k) Phi(k+1)' P(k+1|k)^-1
+ *                        s = smoothed error relative to the fed back nominal state (s(N) = 0)
+ *
+ *   The RTS pass is the forward/backward (two-filter, Fraser-Potter) combination of the
+ *   linear error-state model: with Ib the information of the backward filter
+ *     Ps^-1 = P(k|k)^-1   + Ib(k|k+1)     forward solution 0,   backward prediction
+ *           = P(k|k-1)^-1 + Ib(k|k)       forward prediction -dx, backward solution
+ *   so the smoothed nodes are the combined (FBS) solution, and the backward filter follows as
+ *     Ib = Ps^-1 - P(k|k-1)^-1,   sb = Ib^-1 (Ps^-1 s + P(k|k-1)^-1 dx)
+ *   undefined (skipped) until Ib is positive definite, i.e. at the end of the run.
+ *
+ *   fixed nodes        the forward filter continues with the float state; the fixed solution
+ *                        dxf, Pf relative to the node is kept and combined with the backward
+ *                        information instead of the float solution:
+ *                        Pfs = (Pf^-1 + Ps^-1 - P(k|k)^-1)^-1,   sf = Pfs (Pf^-1 dxf + Ps^-1 s)
+ *
+ *   The nodes are fixed size records (covariances packed), kept in memory up to a
+ *   block and appended to a temporary file beyond it; the backward pass reads the
+ *   file block by block from the end, so the memory does not grow with the run.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GSMOOTHER_H
+#define GSMOOTHER_H
+
+#include <cstdio>
+#include <vector>
+#include <functional>
+#include <Eigen/Dense>
+#include "gexport/ExportLibGREAT.h"
+
+using namespace std;
+
+#define SPILL_BLOCK (8 << 20) ///< default in-memory block of t_gspill [bytes]
+
+namespace great
+{
+    /**
+    * @brief log of fixed size records (doubles), appended forward and read backward
+    */
+    class LibGREAT_LIBRARY_EXPORT t_gspill
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] recsize    record size [doubles]
+        * @param[in] block      in-memory block [bytes], full blocks go to a temporary file
+        */
+        explicit t_gspill(size_t recsize, size_t block = SPILL_BLOCK);
+
+        /** @brief destructor, removes the temporary file. */
+        virtual ~t_gspill();
+
+        t_gspill(const t_gspill &) = delete;
+        t_gspill &operator=(const t_gspill &) = delete;
+
+        /** @brief append one record, false if the temporary file failed. */
+        bool push(const double *rec);
+
+        /** @brief number of records. */
+        size_t size() const { return _nrec; }
+
+        /** @brief number of records in the temporary file. */
+        size_t spilled() const { return _nfile; }
+
+        /** @brief record size [doubles]. */
+        size_t recsize() const { return _rec; }
+
+        /** @brief record i, nullptr if out of range or not readable (backward access reads a block ending at i). */
+        const double *at(size_t i);
+
+        /** @brief remove all records. */
+        void clear();
+
+    protected:
+        size_t _rec;               ///< record size [doubles]
+        size_t _mem;               ///< records per block
+        size_t _nrec;              ///< number of records
+        size_t _nfile;             ///< records in the file
+        FILE *_fp;                 ///< temporary file
+        vector<double> _buf;       ///< records _nfile ... _nrec-1
+        vector<double> _rbuf;      ///< block read back from the file
+        size_t _rbeg;              ///< first record in _rbuf
+        size_t _rn;                ///< records in _rbuf
+    };
+
+    /**
+    * @brief RTS smoother of the INS error states (feedback filter)
+    */
+    class LibGREAT_LIBRARY_EXPORT t_gsmoother
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] nq       number of error states
+        * @param[in] nnav     size of the nominal state of one node
+        * @param[in] nextra   size of the user data of one node (e.g. output info)
+        * @param[in] fixed    whether the nodes keep a fixed solution (ambiguity resolution)
+        * @param[in] block    in-memory block [bytes]
+        */
+        t_gsmoother(int nq, int nnav, int nextra, bool fixed = false, size_t block = SPILL_BLOCK);
+
+        /** @brief default destructor. */
+        virtual ~t_gsmoother();
+
+        /**
+        * @brief add node of the forward filter
+        * @param[in] t        time
+        * @param[in] out      whether the node is an output epoch
+        * @param[in] nav      nominal state after feedback (nnav)
+        * @param[in] extra    user data (nextra)
+        * @param[in] Pprior   P(k|k-1), the leading nq x nq block is used
+        * @param[in] Ppost    P(k|k), the leading nq x nq block is used
+        * @param[in] Phi      transition since the previous node
+        * @param[in] dx       correction fed back at the node
+        * @param[in] dxf      fixed solution relative to the node, nullptr if not fixed
+        * @param[in] Pf       covariance of the fixed solution, the leading nq x nq block is used
+        * @return false if the log failed
+        */
+        bool add(double t, bool out, const double *nav, const double *extra,
+                 const Eigen::MatrixXd &Pprior, const Eigen::MatrixXd &Ppost,
+                 const Eigen::MatrixXd &Phi, const Eigen::VectorXd &dx,
+                 const Eigen::VectorXd *dxf = nullptr, const Eigen::MatrixXd *Pf = nullptr);
+
+        /** @brief number of nodes. */
+        size_t size() const { return _log.size(); }
+
+        /**
+        * @brief backward pass, f(t, nav, extra, s, Ps) for every output node in reverse order
+        * @param[in] f        s, Ps: smoothed error and its covariance relative to nav
+        * @param[in] backward pass the backward filter solution instead of the smoothed one
+        *                     (float, nodes before it is defined are skipped)
+        * @return number of output nodes, -1 if the log could not be read
+        */
+        long smooth(const function<void(double, const double *, const double *, const Eigen::VectorXd &, const Eigen::MatrixXd &)> &f,
+                    bool backward = false);
+
+    protected:
+        /** @brief unpack record. */
+        void _unpack(const double *rec, Eigen::MatrixXd &Pprior, Eigen::MatrixXd &Ppost, Eigen::MatrixXd &Phi, Eigen::VectorXd &dx) const;
+
+        /** @brief unpack the fixed solution, false if the node is not fixed. */
+        bool _unpack_fix(const double *rec, Eigen::MatrixXd &Pf, Eigen::VectorXd &dxf) const;
+
+        int _nq;                   ///< number of error states
+        int _nnav;                 ///< nominal state size
+        int _nextra;               ///< user data size
+        int _npk;                  ///< packed covariance size
+        bool _fixed;               ///< nodes keep a fixed solution
+        t_gspill _log;             ///< nodes
+        vector<double> _rec;       ///< record workspace
+    };
+}
+
+#endif
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <emmintrin.h>
 #include <assert.h>
+#include <cstring>
+#include <iterator>
 
 #ifdef USE_OPENBLAS
 #include "cblas.h"
@@ -48,29 +50,59 @@ namespace great
         }
     }
 
+    void t_gfltEquationMatrix::add_equ(t_gfltEquationMatrix &&Other)
+    {
+        B.insert(B.end(), make_move_iterator(Other.B.begin()), make_move_iterator(Other.B.end()));
+        P.insert(P.end(), Other.P.begin(), Other.P.end());
+        l.insert(l.end(), Other.l.begin(), Other.l.end());
+        _site_sat_pairlist.insert(_site_sat_pairlist.end(), make_move_iterator(Other._site_sat_pairlist.begin()), make_move_iterator(Other._site_sat_pairlist.end()));
+        _obstypelist.insert(_obstypelist.end(), Other._obstypelist.begin(), Other._obstypelist.end());
+        _newamb_list.resize(B.size(), false);
+        Other.B.clear();
+        Other.P.clear();
+        Other.l.clear();
+        Other._site_sat_pairlist.clear();
+        Other._obstypelist.clear();
+        Other._newamb_list.clear();
+    }
+
+    void t_gfltEquationMatrix::reserve(int num_equ)
+    {
+        B.reserve(num_equ);
+        P.reserve(num_equ);
+        l.reserve(num_equ);
+        _site_sat_pairlist.reserve(num_equ);
+        _obstypelist.reserve(num_equ);
+        _newamb_list.reserve(num_equ);
+    }
+
     void t_gfltEquationMatrix::chageNewMat(Matrix &B_value, SymmetricMatrix &P_value, ColumnVector &l_value, const int &par_num)
     {
-        B_value.ReSize(B.size(), par_num);
+        // rows of B are sparse, written straight into the row storage of newmat
+        int nobs = B.size();
+        B_value.ReSize(nobs, par_num);
         B_value = 0.0;
-        for (unsigned int row = 0; row < B.size(); row++)
+        Real *pB = B_value.Store();
+        for (int row = 0; row < nobs; row++)
         {
-            for (unsigned int col = 0; col < B[row].size(); col++)
+            Real *pRow = pB + (size_t)row * par_num;
+            for (const auto &item : B[row])
             {
-                B_value(row + 1, B[row][col].first) = B[row][col].second;
+                if (item.first < 1 || item.first > par_num)
+                    Throw(IndexException(row + 1, item.first, B_value, true));
+                pRow[item.first - 1] = item.second;
             }
         }
-        P_value.ReSize(P.size());
+        P_value.ReSize(nobs);
         P_value = 0.0;
-        for (unsigned int row = 0; row < P.size(); row++)
-        {
-            P_value(row + 1, row + 1) = P[row];
-        }
-        l_value.ReSize(l.size());
-        l_value = 0.0;
-        for (unsigned int row = 0; row < l.size(); row++)
+        Real *pP = P_value.Store();
+        for (int row = 0; row < nobs; row++)
         {
-            l_value(row + 1) = l[row];
+            pP[(size_t)row * (row + 1) / 2 + row] = P[row];
         }
+        l_value.ReSize(nobs);
+        if (nobs > 0)
+            memcpy(l_value.Store(), l.data(), nobs * sizeof(double));
     }
 
     int t_gfltEquationMatrix::num_equ() const
@@ -42,6 +42,18 @@ namespace great
         */
         void add_equ(const vector<pair<int, double>> &B_value, const double &P_value, const double &l_value, const string &stie_name, const string &sat_name, const t_gobscombtype &obscombtype, const bool &is_newamb);
         void add_equ(const t_gfltEquationMatrix &Other);
+
+        /**
+        * @brief append equations of Other by moving them, Other is left empty
+        * @param[in] Other equations of one satellite
+        */
+        void add_equ(t_gfltEquationMatrix &&Other);
+
+        /**
+        * @brief reserve storage for the equations of one epoch
+        * @param[in] num_equ expected number of equations
+        */
+        void reserve(int num_equ);
         
         /**
         * @brief change equations to newmat format
@@ -16,6 +16,7 @@
 #include "gmodels/gpppmodel.h"
 #include "gutils/gmatrixconv.h"
 #include "gutils/gtimesync.h"
+#include "gutils/gfileconv.h"
 #include "gall/gallprec.h"
 
 using namespace std;
@@ -26,9 +27,9 @@ namespace gnut
         : t_gspp(mark, gset),
         t_gppp(mark, gset),
         t_gsppflt(mark, gset),
-        t_gxml("kml"),
         _read(false),
         _flt(0),
+        _flt_bin(false),
         _kml(false),
         _beg_end(true)
     {
@@ -62,9 +63,9 @@ namespace gnut
         : t_gspp(mark, gset, spdlog),
         t_gppp(mark, gset, spdlog),
         t_gsppflt(mark, gset, spdlog),
-        t_gxml("kml"),
         _read(false),
         _flt(0),
+        _flt_bin(false),
         _kml(false),
         _beg_end(true)
     {
@@ -120,16 +121,12 @@ namespace gnut
         if (_grdStoModel)
             delete _grdStoModel;
 
+        // the writer thread owns the stream, the destructor drains and closes it
         if (_flt)
-        {
-            if (_flt->is_open())
-            {
-                _flt->close();
-            };
             delete _flt;
-        }
 
-        this->write(_kml_name);
+        if (_kml_writer)
+            _kml_writer->close();
     }
 
     void t_gpppflt::_timeUpdate(const t_gtime &epo)
@@ -223,10 +220,16 @@ namespace gnut
         if (!tmp.empty() && !_read)
         {
             substitute(tmp, "$(rec)", _site, false);
-            _flt = new t_giof;
+            _flt = new t_giofasync;
             _flt->tsys(t_gtime::GPS);
             _flt->mask(tmp);
             _flt->append(dynamic_cast<t_gsetout *>(_set)->append());
+            _flt_bin = dynamic_cast<t_gsetout *>(_set)->binary("flt");
+            if (_flt_bin)
+            {
+                string magic = t_gfmtline::magic();
+                _flt->write(magic.c_str(), magic.size());
+            }
         }
 
         tmp = dynamic_cast<t_gsetout *>(_set)->outputs("kml");
@@ -236,74 +239,15 @@ namespace gnut
             _kml_name = tmp;
             _kml = true;
 
-            xml_node node, document, placemark, multigeometry;
-            xml_node root = _doc;
-            node = this->_default_node(root, _root.c_str());
-
-            document = this->_default_node(node, "Document");
-
             string mode;
             string smooth = dynamic_cast<t_gsetout *>(_set)->outputs("smt");
             if (!smooth.empty())
                 mode = "_SMT";
             else
                 mode = "_FLT";
-            string desc = _site + mode;
-            this->_default_node(document, "name", desc.c_str(), false);
-
-            xml_node doc_style1 = this->_default_node(document, "Style");
-            string id1 = "P1";
-            this->_default_attr(doc_style1, "id", id1);
-            xml_node IconStyle = this->_default_node(doc_style1, "IconStyle");
-            this->_default_node(IconStyle, "color", "ff00ff64");  
-            this->_default_node(IconStyle, "scale", "0.7");
-            xml_node Icon = this->_default_node(IconStyle, "Icon");
-            this->_default_node(Icon, "href", "http://maps.google.com/mapfiles/kml/shapes/placemark_circle.png");
-
-            xml_node BalloonStyle = this->_default_node(doc_style1, "BalloonStyle");
-            this->_default_node(BalloonStyle, "color", "ffd5f3fa");  
-            xml_node text = BalloonStyle.append_child("text");
-            string str("<b><font color=\"#CC0000\" size=\"+3\">$[name]</font></b><br>$[description]</font><br/>");
-            text.append_child(pugi::node_cdata).set_value(str.c_str());
-
-            xml_node doc_style2 = document.append_copy(doc_style1);
-            string id2 = "P2";
-            this->_default_attr(doc_style2, "id", id2, true);
-            IconStyle = this->_default_node(doc_style2, "IconStyle");
-            this->_default_node(IconStyle, "color", "ff78c800", true);
-
-            xml_node doc_style3 = document.append_copy(doc_style1);
-            string id3 = "P3";
-            this->_default_attr(doc_style3, "id", id3, true);
-            IconStyle = this->_default_node(doc_style3, "IconStyle");
-            this->_default_node(IconStyle, "color", "ffff9600", true);
-
-            xml_node doc_style4 = document.append_copy(doc_style1);
-            string id4 = "P4";
-            this->_default_attr(doc_style4, "id", id4, true);
-            IconStyle = this->_default_node(doc_style4, "IconStyle");
-            this->_default_node(IconStyle, "color", "ffff6496", true);
-
-            xml_node doc_style5 = document.append_copy(doc_style1);
-            string id5 = "P5";
-            this->_default_attr(doc_style5, "id", id5, true);
-            IconStyle = this->_default_node(doc_style5, "IconStyle");
-            this->_default_node(IconStyle, "color", "ffff00ff", true);
-
-            xml_node doc_style6 = document.append_copy(doc_style1);
-            string id6 = "P6";
-            this->_default_attr(doc_style6, "id", id6, true);
-            IconStyle = this->_default_node(doc_style6, "IconStyle");
-            this->_default_node(IconStyle, "color", "ff0000ff", true);
-
-            placemark = this->_default_node(document, "Placemark");
-            this->_default_node(placemark, "name", "Trajection", false);
-            xml_node style = this->_default_node(placemark, "Style");
-            xml_node LineStyle = this->_default_node(style, "LineStyle");
-            this->_default_node(LineStyle, "color", "ff00ffff", false);
-            this->_default_node(LineStyle, "width", "2", false);
-            line = this->_default_node(placemark, "LineString");
-            this->_default_node(line, "coordinates");
+            string name(tmp);
+            substitute(name, GFILE_PREFIX, "");
+            _kml_writer = make_shared<t_gkml>(name, _site + mode, dynamic_cast<t_gsetout *>(_set)->kml_intv());
         }
 
         _read = true;
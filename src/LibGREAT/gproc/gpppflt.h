@@ -16,13 +16,15 @@
 #include "gproc/gppp.h"
 #include "gproc/gsppflt.h"
 #include "gio/gxml.h"
+#include "gio/gkml.h"
+#include "gio/giofasync.h"
+#include "gutils/gfmtline.h"
 
 namespace gnut
 {
 
     class LibGREAT_LIBRARY_EXPORT t_gpppflt : public t_gppp,
-                                            public t_gsppflt,
-                                            public t_gxml
+                                            public t_gsppflt
     {
     public:
         /**@brief constructor */
@@ -76,11 +78,12 @@ namespace gnut
         /**@brief reset parameters */
         void _reset_param();
 
-        xml_node line;                      ///< working line read from
         bool _read;                         ///< is read
         t_giof *_flt;                       ///< filter file 
+        bool _flt_bin;                      ///< filter file with binary records
         string _kml_name;                   ///< kml name
         bool _kml;                          ///< is kml
+        shared_ptr<t_gkml> _kml_writer;     ///< kml written epoch by epoch
         bool _beg_end;                      ///< processing direction
         t_randomwalk *_grdStoModel;         ///< tropo gradient models
         t_randomwalk *_ambStoModel;         ///< ambiguity models
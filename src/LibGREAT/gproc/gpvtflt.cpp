@@ -10,11 +10,15 @@
  */
 #include "gpvtflt.h"
 #include "gutils/gtimesync.h"
+#include "gutils/gfileconv.h"
 #include "gmodels/gprecisebias.h"
 #include "gmodels/gprecisebiasGPP.h"
 #include <algorithm>
+#include <thread>
+#include <exception>
 #include "gproc/gqualitycontrol.h"
 #include "gio/grtlog.h"
+#include "gutils/gprofiler.h"
 
 great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase *gset, t_gallproc *allproc)
     : t_gspp(mark, gset),
@@ -36,12 +40,25 @@ great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase *gset, t_g
     _upd_mode = dynamic_cast<t_gsetamb *>(_set)->upd_mode();
     _max_res_norm = dynamic_cast<t_gsetproc *>(_set)->max_res_norm();
     _minsat = dynamic_cast<t_gsetproc *>(_set)->minsat();
+    int sat_threads = dynamic_cast<t_gsetproc *>(_set)->sat_threads();
+    if (sat_threads > 1)
+        _sat_pool = make_shared<t_gthreadpool>(sat_threads);
+    _ckp_intv = dynamic_cast<t_gsetproc *>(_set)->checkpoint_intv();
+    _ckp_restore = dynamic_cast<t_gsetproc *>(_set)->restore();
+    _ckp_file = dynamic_cast<t_gsetout *>(_set)->outputs("ckp");
+    substitute(_ckp_file, GFILE_PREFIX, "");
+    substitute(_ckp_file, "$(rec)", _site, false);
     _isBase = false;
     _pos_constrain = false;
     if (!_site_base.empty())
         _isBase = true;
     if (_isBase)
         _rtkinit();
+    // a base shared by several rovers (or processed as a rover too) keeps its epochs
+    vector<string> list_base = dynamic_cast<t_gsetgen *>(_set)->list_base();
+    vector<string> list_rover = dynamic_cast<t_gsetgen *>(_set)->list_rover();
+    _base_shared = _isBase && (count(list_base.begin(), list_base.end(), _site_base) > 1 ||
+                               count(list_rover.begin(), list_rover.end(), _site_base) > 0);
     if (!_pos_kin)
     {
         xyz_standard = dynamic_cast<t_gsetrec *>(gset)->get_crd_xyz(_site);
@@ -111,6 +128,8 @@ great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase *gset, t_g
     _wl_Upd_time = t_gtime(WL_IDENTIFY);
     _ewl_Upd_time = t_gtime(EWL_IDENTIFY);
     _receiverType = dynamic_cast<t_gsetproc *>(_set)->get_receiverType();
+    _init_sat_models();
+    _filter_vel = shared_ptr<t_gflt>(_new_filter());
 }
 great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase *gset, t_spdlog spdlog, t_gallproc *allproc)
     : t_gspp(mark, gset, spdlog),
@@ -133,12 +152,25 @@ great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase *gset, t_s
     _upd_mode = dynamic_cast<t_gsetamb *>(_set)->upd_mode();
     _max_res_norm = dynamic_cast<t_gsetproc *>(_set)->max_res_norm();
     _minsat = dynamic_cast<t_gsetproc *>(_set)->minsat();
+    int sat_threads = dynamic_cast<t_gsetproc *>(_set)->sat_threads();
+    if (sat_threads > 1)
+        _sat_pool = make_shared<t_gthreadpool>(sat_threads);
+    _ckp_intv = dynamic_cast<t_gsetproc *>(_set)->checkpoint_intv();
+    _ckp_restore = dynamic_cast<t_gsetproc *>(_set)->restore();
+    _ckp_file = dynamic_cast<t_gsetout *>(_set)->outputs("ckp");
+    substitute(_ckp_file, GFILE_PREFIX, "");
+    substitute(_ckp_file, "$(rec)", _site, false);
     _isBase = false;
     _pos_constrain = false;
     if (!_site_base.empty())
         _isBase = true;
     if (_isBase)
         _rtkinit();
+    // a base shared by several rovers (or processed as a rover too) keeps its epochs
+    vector<string> list_base = dynamic_cast<t_gsetgen *>(_set)->list_base();
+    vector<string> list_rover = dynamic_cast<t_gsetgen *>(_set)->list_rover();
+    _base_shared = _isBase && (count(list_base.begin(), list_base.end(), _site_base) > 1 ||
+                               count(list_rover.begin(), list_rover.end(), _site_base) > 0);
     if (!_pos_kin)
     {
         xyz_standard = dynamic_cast<t_gsetrec *>(gset)->get_crd_xyz(_site);
@@ -201,6 +233,8 @@ great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase *gset, t_s
     _wl_Upd_time = t_gtime(WL_IDENTIFY);
     _ewl_Upd_time = t_gtime(EWL_IDENTIFY);
     _receiverType = dynamic_cast<t_gsetproc *>(_set)->get_receiverType();
+    _init_sat_models();
+    _filter_vel = shared_ptr<t_gflt>(_new_filter());
 }
 
 great::t_gpvtflt::~t_gpvtflt()
@@ -913,8 +947,7 @@ int great::t_gpvtflt::_prepareData()
 
     if (_data.size() < _minsat)
     {
-        if (_spdlog)
-            SPDLOG_LOGGER_INFO(_spdlog, _site + _epoch.str_ymdhms(" epoch ") + int2str(_data.size()) + " skipped (data.size < minsat)");
+        GLOGGER_INFO(_spdlog, "{} epoch {}{} skipped (data.size < minsat)", _site, _epoch.str_ymdhms(), int2str(_data.size()));
         return -1;
     }
 
@@ -954,23 +987,42 @@ int great::t_gpvtflt::_preprocess(const string &ssite, vector<t_gsatdata> &sdata
                 continue;
             }
         }
+        ++iter;
+    }
 
-        //check each satellite obs and crd
-        if (!_check_sat(ssite, &*iter, BB, iobs))
-        {
-            iter = sdata.erase(iter);
+    //check each satellite obs and crd, the satellites are independent
+    int nsat = static_cast<int>(sdata.size());
+    vector<t_gsatprep> prep(nsat);
+    // the band table is completed here, _prep_sat only reads it (find, no insert)
+    for (const auto &sat : sdata)
+    {
+        _band_index[sat.gsys()][FREQ_1];
+        _band_index[sat.gsys()][FREQ_2];
+    }
+    // the timers of the workers count for the site of the calling thread
+    const string prof_site = _site;
+    if (_sat_pool)
+        _sat_pool->parallel_for(nsat, [&](int i) {
+            t_gprofiler::site(prof_site);
+            _prep_sat(&sdata[i], prep[i]);
+        });
+
+    size_t nkeep = 0;
+    for (int i = 0; i < nsat; i++)
+    {
+        if (!_sat_pool)
+            _prep_sat(&sdata[i], prep[i]);
+        if (!_add_sat(&sdata[i], prep[i], BB, iobs))
             continue;
-        }
-        else
-        {
-            ++iter;
-        }
+        if (nkeep != static_cast<size_t>(i))
+            sdata[nkeep] = sdata[i];
+        nkeep++;
     } //end sdata
+    sdata.erase(sdata.begin() + nkeep, sdata.end());
 
     if (sdata.size() < _minsat)
     {
-        if (_spdlog)
-            SPDLOG_LOGGER_INFO(_spdlog, _epoch.str_ymdhms(ssite + " epoch ") + " skipped (Bancroft not calculated: " + int2str(sdata.size()) + " < _minsat: " + int2str(_minsat) + ")");
+        GLOGGER_INFO(_spdlog, "{} epoch {} skipped (Bancroft not calculated: {} < _minsat: {})", ssite, _epoch.str_ymdhms(), sdata.size(), _minsat);
         return -1;
     }
 
@@ -978,9 +1030,8 @@ int great::t_gpvtflt::_preprocess(const string &ssite, vector<t_gsatdata> &sdata
 
     if (BB.Nrows() < static_cast<int>(_minsat))
     {
-        if (SPDLOG_LEVEL_TRACE == _spdlog->level())
-            if (_spdlog)
-                SPDLOG_LOGGER_INFO(_spdlog, _epoch.str_ymdhms(_site + " epoch ") + " skipped (Bancroft not calculated: BB.Nrows < _minsat)");
+        if (_spdlog && SPDLOG_LEVEL_TRACE == _spdlog->level())
+            GLOGGER_INFO(_spdlog, "{} epoch {} skipped (Bancroft not calculated: BB.Nrows < _minsat)", _site, _epoch.str_ymdhms());
         return -1;
     }
 
@@ -989,7 +1040,23 @@ int great::t_gpvtflt::_preprocess(const string &ssite, vector<t_gsatdata> &sdata
         return -1;
     }
 
-    //Compute sat elevation and rho
+    //Compute sat elevation and rho, the base site is swapped into _site for the tides (sequential)
+    t_gtriple xyz_r;
+    _cmp_rec_xyz(ssite, xyz_r);
+    auto geometry = [&](int i) {
+        t_gtriple xyz_s = sdata[i].satcrd();
+        Add_rho_azel(ssite, xyz_s, xyz_r, sdata[i]);
+    };
+    nsat = static_cast<int>(sdata.size());
+    if (_sat_pool && !(_isBase && ssite != _site))
+        _sat_pool->parallel_for(nsat, [&](int i) {
+            t_gprofiler::site(prof_site);
+            geometry(i);
+        });
+    else
+        for (int i = 0; i < nsat; i++)
+            geometry(i);
+
     iter = sdata.begin();
     while (iter != sdata.end())
     {
@@ -998,8 +1065,7 @@ int great::t_gpvtflt::_preprocess(const string &ssite, vector<t_gsatdata> &sdata
             iter = sdata.erase(iter); 
             if (sdata.size() < _minsat)
             {
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, ssite + _epoch.str_ymdhms(" epoch ") + int2str(sdata.size()) + " skipped (data.size < _rtk_set->minsat)");
+                GLOGGER_INFO(_spdlog, "{} epoch {}{} skipped (data.size < _rtk_set->minsat)", ssite, _epoch.str_ymdhms(), sdata.size());
                 return -1;
             }
         }
@@ -1063,27 +1129,29 @@ void great::t_gpvtflt::_predict(const t_gtime& runEpoch)
         _syncAmb();
     }
   
+    // process noise of all parameters collected and applied in one pass
+    _proc.clear();
     _predictCrd();
     _predictClk();
     _predictBias();
     _predictIono(bl, runEpoch);
     _predictTropo();
     _predictAmb();
+    Matrix_predict(_Qx, _proc);
 }
 
 void great::t_gpvtflt::_delPar(const par_type par)
 {
     // Remove params and appropriate rows/columns covar. matrix
+    vector<int> rem;
     for (unsigned int i = 0; i <= _param.parNumber() - 1; i++)
     {
         if (_param[i].parType == par)
         {
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
-            i--;
+            rem.push_back(i);
         }
     }
+    _remPar(rem);
 
     return;
 }
@@ -1303,7 +1371,14 @@ int great::t_gpvtflt::_processEpochVel()
         P = P.SymSubMatrix(1, iobs);
         l = l.Rows(1, iobs);
 
-        _filter->update(A, P, l, dx, _Qx_vel);
+        {
+            GPROF_SCOPE(PROF_FILTER);
+            if (_filter_vel->update(A, P, l, dx, _Qx_vel) < 0)
+            {
+                GLOGGER_INFO(_spdlog, "{} epoch {}: velocity covariance matrix not positive definite", _site, _epoch.str_ymdhms());
+                return -1;
+            }
+        }
 
         int freedom = A.Nrows() - A.Ncols();
         if (freedom < 1)
@@ -1440,9 +1515,11 @@ int great::t_gpvtflt::_processEpoch(const t_gtime &runEpoch)
 
         Qsav = _Qx;
         
+        int irc_flt = -1;
         try
         {
-            _filter->update(A, P, l, dx, _Qx);
+            GPROF_SCOPE(PROF_FILTER);
+            irc_flt = _filter->update(A, P, l, dx, _Qx);
         }
         catch (...)
         {
@@ -1451,6 +1528,14 @@ int great::t_gpvtflt::_processEpoch(const t_gtime &runEpoch)
             _Qx = Qsav;
             return -1;
         }
+        if (irc_flt < 0)
+        {
+            _n_ALL_flt++;
+            _n_NPD_flt++;
+            GLOGGER_INFO(_spdlog, "{} epoch {}: filter update failed, covariance matrix not positive definite", _site, _epoch.str_ymdhms());
+            _Qx = Qsav;
+            return -1;
+        }
 
         // increasing variance after update in case of introducing new ambiguity
         if (_cntrep == 1 && !_reset_amb && !_reset_par && !_pos_kin)
@@ -1496,8 +1581,7 @@ int great::t_gpvtflt::_processEpoch(const t_gtime &runEpoch)
 
     if (_data.size() < _minsat)
     {
-        if (_spdlog)
-            SPDLOG_LOGGER_INFO(_spdlog, _site + _epoch.str_ymdhms(" epoch ") + " skipped: " + int2str(_data.size()) + " < _minsat)");
+        GLOGGER_INFO(_spdlog, "{} epoch {} skipped: {} < _minsat)", _site, _epoch.str_ymdhms(), int2str(_data.size()));
         _restore(QsavBP, XsavBP);
         return -1;
     }
@@ -1533,6 +1617,7 @@ int great::t_gpvtflt::_processEpoch(const t_gtime &runEpoch)
 
 int great::t_gpvtflt::_amb_resolution()
 {
+    GPROF_SCOPE(PROF_AMBFIX);
     ColumnVector dx_tmp = _filter->dx();
     SymmetricMatrix Qx_tmp = _filter->Qx();
     _param_fixed = _filter->param();
@@ -1581,41 +1666,42 @@ int great::t_gpvtflt::_amb_resolution()
             _sat_ref.clear();
         _ambfix->setSatRef(_sat_ref);
 
+        // EWL -> WL -> NL cascade on one view of the float solution
+        vector<AMB_MODE> modes;
         if ((_observ == gnut::OBSCOMBIN::RAW_ALL || _observ == gnut::OBSCOMBIN::RAW_MIX) && _frequency >= 3)
         {
-            _ambfix->processBatch(_epoch, _filter, "EWL");
+            modes.push_back(AMB_MODE::EWL);
         }
         if ((_observ == gnut::OBSCOMBIN::RAW_ALL || _observ == gnut::OBSCOMBIN::RAW_MIX) && _frequency >= 4)
         {
-            _ambfix->processBatch(_epoch, _filter, "EWL24");
+            modes.push_back(AMB_MODE::EWL24);
         }
         if ((_observ == gnut::OBSCOMBIN::RAW_ALL || _observ == gnut::OBSCOMBIN::RAW_MIX) && _frequency >= 5)
         {
-            _ambfix->processBatch(_epoch, _filter, "EWL25");
+            modes.push_back(AMB_MODE::EWL25);
         }
         if (_observ == OBSCOMBIN::RAW_ALL || (_observ == OBSCOMBIN::RAW_MIX  && _frequency >= 2))
         {
-            _ambfix->processBatch(_epoch, _filter, "WL");
+            modes.push_back(AMB_MODE::WL);
         }
+        modes.push_back(AMB_MODE::NL);
 
-
-        int nlfix_valid = _ambfix->processBatch(_epoch, _filter, "NL");
+        int nlfix_valid = _ambfix->processCascade(_epoch, _filter, modes);
         if (nlfix_valid < 0)
         {
             _amb_state = false;
-            if (_spdlog)
-                SPDLOG_LOGGER_INFO(_spdlog, _site + _epoch.str_ymdhms(" epoch ") + ": fix ambiguity failed !");
+            GLOGGER_INFO(_spdlog, "{} epoch {}: fix ambiguity failed !", _site, _epoch.str_ymdhms());
         }
         else
             _amb_state = _ambfix->amb_fixed();
     }
 
     // output the fixed result
-    ostringstream os;
+    t_gfmtline line(_flt_bin);
     if (_amb_state) //fixed
     {
         _param_fixed = _ambfix->getFinalParams();
-        _prtOut(_epoch, _param_fixed, _filter->Qx(), _data, os, line, true);
+        _prtOut(_epoch, _param_fixed, _filter->Qx(), _data, line, true);
 	}
     else
     {
@@ -1623,15 +1709,12 @@ int great::t_gpvtflt::_amb_resolution()
         {
             _param_fixed[iPar].value(_param_fixed[iPar].value() + dx_tmp(_param_fixed[iPar].index));
         }
-        _prtOut(_epoch, _param_fixed, Qx_tmp, _data, os, line, true);
+        _prtOut(_epoch, _param_fixed, Qx_tmp, _data, line, true);
     }
 
     // Print flt results
     if (_flt)
-    {
-        _flt->write(os.str().c_str(), os.str().size());
-        _flt->flush();
-    }
+        _flt->write(line.data().c_str(), line.size());
 
     return 1;
 }
@@ -1732,11 +1815,8 @@ int great::t_gpvtflt::_outlierDetect(const ColumnVector &v, const SymmetricMatri
         _Qx = Qsav;
         sat = _obs_index[idx - 1].first;
         string obsType = gobstype2str(_obs_index[idx - 1].second.second);
-        ostringstream os;
-        os << _site << " outlier (" << obsType << _obs_index[idx - 1].second.first << ") " << sat
-           << " v: " << fixed << setw(16) << right << setprecision(3) << max;
-        if (_spdlog)
-            SPDLOG_LOGGER_INFO(_spdlog, _epoch.str_ymdhms(" epoch ") + os.str());
+        GLOGGER_INFO(_spdlog, " epoch {}{} outlier ({}{}) {} v: {:16.3f}", _epoch.str_ymdhms(), _site, obsType,
+                     _obs_index[idx - 1].second.first, sat, max);
     }
     else
     {
@@ -1835,8 +1915,22 @@ int great::t_gpvtflt::processBatch(const t_gtime &beg_r, const t_gtime &end_r, b
 
     t_gtime now(_beg_time);
 
-    if (_spdlog)
-        SPDLOG_LOGGER_INFO(_spdlog, _site + ": Start GNSS Processing filtering: " + now.str_ymdhms() + " " + _end_time.str_ymdhms());
+    if (!_ckp_restore.empty())
+    {
+        if (restore(_ckp_restore) < 0)
+        {
+            _running = false;
+            _gmutex.unlock();
+            return -1;
+        }
+        now = _epoch;
+        if (_sampling > 1)
+            now.add_secs(int(sign * _sampling));
+        else
+            now.add_dsec(sign * _sampling);
+    }
+
+    GLOGGER_INFO(_spdlog, "{}: Start GNSS Processing filtering: {} {}", _site, now.str_ymdhms(), _end_time.str_ymdhms());
     bool time_loop = true;
 
     while (time_loop)
@@ -1870,7 +1964,8 @@ int great::t_gpvtflt::processBatch(const t_gtime &beg_r, const t_gtime &end_r, b
                 now.reset_dsec();
         }   
 
-        _slip_detect(now);
+        if (!_slip_done)
+            _slip_detect(now);
 
         int irc_epo = ProcessOneEpoch(now);
         if (irc_epo < 0)
@@ -1884,12 +1979,18 @@ int great::t_gpvtflt::processBatch(const t_gtime &beg_r, const t_gtime &end_r, b
         else
             _success = true;
 
-        if (SPDLOG_LEVEL_TRACE == _spdlog->level())
-            if (_spdlog)
-                SPDLOG_LOGGER_INFO(_spdlog, _site + now.str_ymdhms(" processing epoch: "));
+        if (_spdlog && SPDLOG_LEVEL_TRACE == _spdlog->level())
+            GLOGGER_INFO(_spdlog, "{} processing epoch: {}", _site, now.str_ymdhms());
+
+        if (!_ckp_file.empty() && _ckp_intv > 0.0 && !_fbs_sol &&
+            (_ckp_last == FIRST_TIME || fabs(now.diff(_ckp_last)) > _ckp_intv - 1e-3))
+        {
+            checkpoint(_ckp_file);
+            _ckp_last = now;
+        }
 
         double percent = now.diff(_beg_time) / _end_time.diff(_beg_time) * 100.0;
-        if (double_eq(now.sow() % 1, 0.0))
+        if (double_eq(now.sow() % 1, 0.0) && (_beg_end || !_fbs_sol))
             std::cerr << "\r" << _site << "   " << now.str_ymdhms() << setw(5) << " Q = " << (_amb_state ? 1 : 2) << fixed << setprecision(1) << setw(6) << percent << "%";
         if (_sampling > 1)
             now.add_secs(int(sign * _sampling)); // =<1Hz data
@@ -1900,6 +2001,9 @@ int great::t_gpvtflt::processBatch(const t_gtime &beg_r, const t_gtime &end_r, b
 
     _running = false;
 
+    if (!_ckp_file.empty() && _success && !_fbs_sol && _ckp_last != _epoch)
+        checkpoint(_ckp_file);
+
     if (beg_r != end_r)
     { 
         double npd_perc = 0;
@@ -1913,6 +2017,383 @@ int great::t_gpvtflt::processBatch(const t_gtime &beg_r, const t_gtime &end_r, b
     return 1;
 }
 
+int great::t_gpvtflt::processBatchFBS(const t_gtime &beg_r, const t_gtime &end_r)
+{
+    if (_grec == nullptr || !_gobs)
+        return processBatch(beg_r, end_r, true);
+
+    // checkpoints are forward states and are not taken by the smoother, both passes start at the begin
+    if (!_ckp_restore.empty())
+    {
+        if (_spdlog)
+            SPDLOG_LOGGER_ERROR(_spdlog, _site + ": <restore> cannot be combined with forward/backward smoothing, remove it or process forward");
+        cerr << _site << ": ERROR: <restore> cannot be combined with forward/backward smoothing" << endl;
+        return -1;
+    }
+
+    // both passes need all epochs, and the observations are read-only while they run;
+    // the retention of the shared observations is restored afterwards
+    double retention = _gobs->retention();
+    if (retention > 0.0)
+    {
+        if (_spdlog)
+            SPDLOG_LOGGER_WARN(_spdlog, _site + ": forward/backward smoothing keeps all epochs, retention window ignored");
+        _gobs->retention(0.0);
+    }
+    _gpre->ProcessBatch(_site, beg_r, end_r, _sampling, true);
+    if (_isBase)
+        _gpre->ProcessBatch(_site_base, beg_r, end_r, _sampling, true);
+
+    t_gpvtflt bwd(_site, _site_base, _set, _spdlog, _allproc);
+    bwd._gupd = _gupd;
+    bwd._beg_end = false;
+    bwd._slip_done = true;
+    bwd._lli_shift = true;
+    if (bwd._flt)
+    {
+        delete bwd._flt;
+        bwd._flt = nullptr;
+    }
+    bwd._kml = false;
+    bwd._kml_name.clear();
+    bwd._kml_writer.reset();
+
+    vector<t_gfbsol> sol_fwd, sol_bwd;
+    _slip_done = true;
+    _fbs_sol = &sol_fwd;
+    bwd._fbs_sol = &sol_bwd;
+    _fbs_crd = t_gtriple(0.0, 0.0, 0.0);
+
+    GLOGGER_INFO(_spdlog, "{}: Start forward/backward filtering {} {}", _site, beg_r.str_ymdhms(), end_r.str_ymdhms());
+
+    int irc_bwd = -1;
+    exception_ptr err_bwd = nullptr;
+    thread th_bwd([&]() {
+        try
+        {
+            irc_bwd = bwd.processBatch(beg_r, end_r, true);
+        }
+        catch (...)
+        {
+            err_bwd = current_exception();
+        }
+    });
+    int irc_fwd = -1;
+    try
+    {
+        irc_fwd = processBatch(beg_r, end_r, true);
+    }
+    catch (...)
+    {
+        th_bwd.join();
+        _fbs_sol = nullptr;
+        _slip_done = false;
+        _gobs->retention(retention);
+        throw;
+    }
+    th_bwd.join();
+    _fbs_sol = nullptr;
+    _slip_done = false;
+    _gobs->retention(retention);
+    if (err_bwd)
+        rethrow_exception(err_bwd);
+    if (irc_fwd < 0 || irc_bwd < 0)
+        return -1;
+
+    // combine epoch by epoch, the backward solutions are in reverse order
+    string tmp = dynamic_cast<t_gsetout *>(_set)->outputs("smt");
+    if (tmp.empty())
+        tmp = _site + "_smt.flt";
+    substitute(tmp, "$(rec)", _site, false);
+    t_giof fsmt;
+    fsmt.tsys(t_gtime::GPS);
+    fsmt.mask(tmp);
+    fsmt.append(dynamic_cast<t_gsetout *>(_set)->append());
+    _prtOutHeader(&fsmt);
+
+    reverse(sol_bwd.begin(), sol_bwd.end());
+    auto itf = sol_fwd.begin();
+    auto itb = sol_bwd.begin();
+    int nfix = 0, nall = 0;
+    t_gfmtline line;
+    while (itf != sol_fwd.end() || itb != sol_bwd.end())
+    {
+        t_gfbsol sol;
+        if (itb == sol_bwd.end() || (itf != sol_fwd.end() && itf->epoch < itb->epoch))
+            sol = *itf++;
+        else if (itf == sol_fwd.end() || itb->epoch < itf->epoch)
+            sol = *itb++;
+        else
+            sol = _fbs_combine(*itf++, *itb++);
+
+        nall++;
+        if (sol.fixed)
+            nfix++;
+        _saveCrd(sol);
+        _prtSol(sol, line);
+        if (line.size() > 1 << 16)
+        {
+            fsmt.write(line.data().c_str(), line.size());
+            line.clear();
+        }
+    }
+    fsmt.write(line.data().c_str(), line.size());
+
+    if (_spdlog)
+        SPDLOG_LOGGER_INFO(_spdlog, _site + ": forward/backward combination " + int2str(nall) + " epochs (" + int2str(nfix) + " fixed) written to " + tmp);
+
+    return 1;
+}
+
+great::t_gfbsol great::t_gpvtflt::_fbs_combine(const t_gfbsol &fwd, const t_gfbsol &bwd)
+{
+    // a fixed solution is kept, a float one does not improve it
+    if (fwd.fixed != bwd.fixed)
+        return fwd.fixed ? fwd : bwd;
+    if (bwd.Qxyz[0] < 0 || bwd.Qxyz[1] < 0 || bwd.Qxyz[2] < 0)
+        return fwd;
+    if (fwd.Qxyz[0] < 0 || fwd.Qxyz[1] < 0 || fwd.Qxyz[2] < 0)
+        return bwd;
+
+    Eigen::Matrix3d Qf, Qb;
+    Qf << fwd.Qxyz[0], fwd.Qxyz[3], fwd.Qxyz[4],
+          fwd.Qxyz[3], fwd.Qxyz[1], fwd.Qxyz[5],
+          fwd.Qxyz[4], fwd.Qxyz[5], fwd.Qxyz[2];
+    Qb << bwd.Qxyz[0], bwd.Qxyz[3], bwd.Qxyz[4],
+          bwd.Qxyz[3], bwd.Qxyz[1], bwd.Qxyz[5],
+          bwd.Qxyz[4], bwd.Qxyz[5], bwd.Qxyz[2];
+    Eigen::LDLT<Eigen::Matrix3d> ldlt_f(Qf), ldlt_b(Qb);
+    if (ldlt_f.info() != Eigen::Success || ldlt_b.info() != Eigen::Success || !ldlt_f.isPositive() || !ldlt_b.isPositive())
+        return (fwd.Qxyz[0] + fwd.Qxyz[1] + fwd.Qxyz[2] <= bwd.Qxyz[0] + bwd.Qxyz[1] + bwd.Qxyz[2]) ? fwd : bwd;
+
+    Eigen::Vector3d xf(fwd.xyz[0], fwd.xyz[1], fwd.xyz[2]), xb(bwd.xyz[0], bwd.xyz[1], bwd.xyz[2]);
+    Eigen::Matrix3d Wf = ldlt_f.solve(Eigen::Matrix3d::Identity());
+    Eigen::Matrix3d Wb = ldlt_b.solve(Eigen::Matrix3d::Identity());
+    Eigen::Matrix3d Q = (Wf + Wb).inverse();
+    Eigen::Vector3d x = Q * (Wf * xf + Wb * xb);
+
+    t_gfbsol sol = fwd;
+    sol.xyz = t_gtriple(x(0), x(1), x(2));
+    sol.Qxyz[0] = Q(0, 0);
+    sol.Qxyz[1] = Q(1, 1);
+    sol.Qxyz[2] = Q(2, 2);
+    sol.Qxyz[3] = Q(0, 1);
+    sol.Qxyz[4] = Q(0, 2);
+    sol.Qxyz[5] = Q(1, 2);
+
+    // velocity rms only (no cross terms kept)
+    for (int i = 0; i < 3; i++)
+    {
+        if (fwd.vrms[i] > 0 && bwd.vrms[i] > 0)
+        {
+            double wf = 1.0 / (fwd.vrms[i] * fwd.vrms[i]), wb = 1.0 / (bwd.vrms[i] * bwd.vrms[i]);
+            sol.vel[i] = (wf * fwd.vel[i] + wb * bwd.vel[i]) / (wf + wb);
+            sol.vrms[i] = 1.0 / sqrt(wf + wb);
+        }
+    }
+
+    sol.ratio = max(fwd.ratio, bwd.ratio);
+    sol.sig0 = max(fwd.sig0, bwd.sig0);
+    if (_isBase)
+    {
+        t_gtriple crd_base = _gallobj->obj(_site_base)->crd_arp(fwd.epoch);
+        t_gtriple ell, neu;
+        t_gtriple dxyz = sol.xyz + _grec->eccxyz(fwd.epoch) - crd_base;
+        xyz2ell(crd_base, ell, false);
+        xyz2neu(ell, dxyz, neu);
+        sol.bl = neu.norm();
+    }
+    return sol;
+}
+
+int great::t_gpvtflt::checkpoint(const string &file)
+{
+    t_gcheckpoint ckp;
+    if (ckp.open_write(file, "pvtflt"))
+        _save_state(ckp);
+    if (!ckp.close())
+    {
+        if (_spdlog)
+            SPDLOG_LOGGER_ERROR(_spdlog, _site + ": checkpoint not written: " + file);
+        return -1;
+    }
+    GLOGGER_DEBUG(_spdlog, "{}: checkpoint written at {} {}", _site, _epoch.str_ymdhms(), file);
+    return 1;
+}
+
+int great::t_gpvtflt::restore(const string &file)
+{
+    t_gcheckpoint ckp;
+    if (!ckp.open_read(file, "pvtflt"))
+    {
+        if (_spdlog)
+            SPDLOG_LOGGER_ERROR(_spdlog, _site + ": not a checkpoint of this version: " + file);
+        return -1;
+    }
+    _load_state(ckp);
+    if (!ckp.close())
+    {
+        if (_spdlog)
+            SPDLOG_LOGGER_ERROR(_spdlog, _site + ": checkpoint does not match the processing settings: " + file);
+        return -1;
+    }
+
+    // converged state, the first epoch must not reset the coordinates or the other parameters
+    _initialized = true;
+    _success = true;
+
+    // random walk processes continue from the checkpoint epoch
+    _timeUpdate(_epoch);
+
+    GLOGGER_INFO(_spdlog, "{}: filter resumed at {} from {}", _site, _epoch.str_ymdhms(), file);
+    return 1;
+}
+
+// only the previous epoch of the MW/EWL/... averages is used
+static t_map_MW ckp_last(const t_map_MW &mw)
+{
+    t_map_MW last;
+    if (!mw.empty())
+        last.insert(*mw.rbegin());
+    return last;
+}
+
+void great::t_gpvtflt::_save_state(t_gcheckpoint &ckp)
+{
+    ckp.section("pvtflt");
+    ckp.put(_site);
+    ckp.put(_site_base);
+    ckp.put(_beg_end);
+    ckp.put(_epoch);
+    ckp.put(_param);
+    ckp.put(_Qx);
+    ckp.put(_vel);
+    ckp.put(_Qx_vel);
+    ckp.put(_amb_state);
+    ckp.put(_sig_unit);
+    ckp.put(_isFirstFix);
+    ckp.put(_wl_Upd_time);
+    ckp.put(_ewl_Upd_time);
+    ckp.put(_newAMB);
+    ckp.put(_lastEcl);
+    ckp.put(_sat_ref);
+    ckp.put(_n_NPD_flt);
+    ckp.put(_n_ALL_flt);
+
+    // kinematic receiver crd written to t_gobj epoch by epoch
+    ckp.section("rec");
+    ckp.put(_pos_kin);
+    if (_pos_kin)
+    {
+        ckp.put(_grec->crd(_epoch));
+        ckp.put(_grec->std(_epoch));
+    }
+
+    // previous epoch of the cycle slip detection
+    ckp.section("preproc");
+    for (const string &site : {_site, _site_base})
+    {
+        vector<t_gobsgnss> pre;
+        map<string, double> dI;
+        bool first = true;
+        if (!site.empty())
+            _gpre->state(site, pre, dI, first);
+        ckp.put(pre);
+        ckp.put(dI);
+        ckp.put(first);
+    }
+
+    ckp.section("mw");
+    for (const t_map_MW *mw : {&_MW, &_EWL, &_LW, &_LE, &_LWL, &_rMW, &_rEWL, &_IMW, &_IEWL, &_PW, &_AFIF})
+        ckp.put(ckp_last(*mw));
+
+    ckp.put(_ambfix != nullptr);
+    if (_ambfix)
+        _ambfix->checkpoint(ckp);
+
+    auto comb = dynamic_pointer_cast<t_gcombmodel>(_base_model);
+    ckp.put(comb && comb->bias_model());
+    if (comb && comb->bias_model())
+        comb->bias_model()->checkpoint(ckp);
+}
+
+void great::t_gpvtflt::_load_state(t_gcheckpoint &ckp)
+{
+    string site, site_base;
+    bool beg_end = _beg_end;
+    ckp.section("pvtflt");
+    ckp.get(site);
+    ckp.get(site_base);
+    ckp.get(beg_end);
+    if (site != _site || site_base != _site_base || beg_end != _beg_end)
+    {
+        ckp.fail();
+        return;
+    }
+    ckp.get(_epoch);
+    ckp.get(_param);
+    ckp.get(_Qx);
+    ckp.get(_vel);
+    ckp.get(_Qx_vel);
+    ckp.get(_amb_state);
+    ckp.get(_sig_unit);
+    ckp.get(_isFirstFix);
+    ckp.get(_wl_Upd_time);
+    ckp.get(_ewl_Upd_time);
+    ckp.get(_newAMB);
+    ckp.get(_lastEcl);
+    ckp.get(_sat_ref);
+    ckp.get(_n_NPD_flt);
+    ckp.get(_n_ALL_flt);
+    if (_Qx.Nrows() != static_cast<int>(_param.parNumber()))
+        ckp.fail();
+
+    bool pos_kin = _pos_kin;
+    ckp.section("rec");
+    ckp.get(pos_kin);
+    if (pos_kin != _pos_kin)
+        ckp.fail();
+    if (_pos_kin)
+    {
+        t_gtriple crd, std;
+        ckp.get(crd);
+        ckp.get(std);
+        if (ckp.good() && !crd.zero())
+            _grec->crd(crd, std, _epoch, LAST_TIME, true);
+    }
+
+    ckp.section("preproc");
+    for (const string &site : {_site, _site_base})
+    {
+        vector<t_gobsgnss> pre;
+        map<string, double> dI;
+        bool first = true;
+        ckp.get(pre);
+        ckp.get(dI);
+        ckp.get(first);
+        if (ckp.good() && !site.empty())
+            _gpre->state(site, pre, dI, first);
+    }
+
+    ckp.section("mw");
+    for (t_map_MW *mw : {&_MW, &_EWL, &_LW, &_LE, &_LWL, &_rMW, &_rEWL, &_IMW, &_IEWL, &_PW, &_AFIF})
+        ckp.get(*mw);
+
+    bool has = false;
+    ckp.get(has);
+    if (has != (_ambfix != nullptr))
+        ckp.fail();
+    if (_ambfix)
+        _ambfix->restore(ckp);
+
+    auto comb = dynamic_pointer_cast<t_gcombmodel>(_base_model);
+    ckp.get(has);
+    if (has != (comb && comb->bias_model()))
+        ckp.fail();
+    if (comb && comb->bias_model())
+        comb->bias_model()->restore(ckp);
+}
+
 bool great::t_gpvtflt::InitProc(const t_gtime &begT, const t_gtime &endT, double *subint)
 {
     if (_beg_end)
@@ -1962,13 +2443,22 @@ bool great::t_gpvtflt::InitProc(const t_gtime &begT, const t_gtime &endT, double
 
 int great::t_gpvtflt::ProcessOneEpoch(const t_gtime &now, vector<t_gsatdata> *data_rover, vector<t_gsatdata> *data_base)
 {
+    t_gprofiler::site(_site);
+    GPROF_SCOPE(PROF_EPOCH);
+
+    // drop consumed epochs out of the retention window (long or real-time runs)
+    if (_gobs && !data_rover)
+    {
+        _gobs->consumed(_site, now, _beg_end);
+        if (_isBase && !_base_shared)
+            _gobs->consumed(_site_base, now, _beg_end);
+    }
 
     if (_getData(now, data_rover, false) == 0)
     {
-        if (SPDLOG_LEVEL_TRACE == _spdlog->level())
+        if (_spdlog && SPDLOG_LEVEL_TRACE == _spdlog->level())
         {
-            if (_spdlog)
-                SPDLOG_LOGGER_INFO(_spdlog, _site + now.str_ymdhms(" no observation found at epoch: "));
+            GLOGGER_INFO(_spdlog, "{} no observation found at epoch: {}", _site, now.str_ymdhms());
         }
         return -1;
     }
@@ -2018,10 +2508,9 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime &now, vector<t_gsatdata> *da
     {
         if (_getData(now, data_base, true) == 0)
         {
-            if (SPDLOG_LEVEL_TRACE == _spdlog->level())
+            if (_spdlog && SPDLOG_LEVEL_TRACE == _spdlog->level())
             {
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, string("gpvtflt:  ") +  _site_base + now.str_ymdhms(" no observation found at epoch: "));
+                GLOGGER_INFO(_spdlog, "gpvtflt:  {} no observation found at epoch: {}", _site_base, now.str_ymdhms());
             }
             return -1;
         }
@@ -2058,9 +2547,8 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime &now, vector<t_gsatdata> *da
     {
         _success = false;
         _removeApr(obsEpo);
-        if (SPDLOG_LEVEL_TRACE == _spdlog->level())
-            if (_spdlog)
-                SPDLOG_LOGGER_INFO(_spdlog, _site + now.str_ymdhms(" epoch ") + " was not calculated");
+        if (_spdlog && SPDLOG_LEVEL_TRACE == _spdlog->level())
+            GLOGGER_INFO(_spdlog, "{} epoch {} was not calculated", _site, now.str_ymdhms());
     }
     else
         _success = true;
@@ -2068,6 +2556,20 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime &now, vector<t_gsatdata> *da
     return irc_epo;
 }
 
+int great::t_gpvtflt::ProcessRealtimeEpoch(const t_gtime &now)
+{
+    _gmutex.lock();
+
+    _slip_detect(now);
+
+    int irc_epo = ProcessOneEpoch(now);
+    if (irc_epo >= 0)
+        _success = true;
+
+    _gmutex.unlock();
+    return irc_epo;
+}
+
 void great::t_gpvtflt::Add_UPD(t_gupd *gupd)
 {
     _gupd = gupd;
@@ -2113,6 +2615,7 @@ void great::t_gpvtflt::_udsdAmb()
     }
     if (_nSat == 0)
     {
+        vector<int> rem;
         for (unsigned int i = 0; i < _param.parNumber(); i++)
         {
             if (_param[i].parType == par_type::AMB_IF ||
@@ -2123,23 +2626,21 @@ void great::t_gpvtflt::_udsdAmb()
                 _param[i].parType == par_type::AMB_L5)
             {
 
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, "AMB will be removed! For Sat PRN " + _param[i].prn + " Epoch: " + _epoch.str_ymdhms());
+                GLOGGER_INFO(_spdlog, "AMB will be removed! For Sat PRN {} Epoch: {}", _param[i].prn, _epoch.str_ymdhms());
 
                 _amb_obs.erase(make_pair(_param[i].prn, _param[i].parType));
 
                 _newAMB.erase(_param[i].prn);
 
-                Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-                _param.delParam(i);
-                _param.reIndex();
-                i--;
+                rem.push_back(i);
             }
         }
+        _remPar(rem);
         return;
     }
     // Add ambiguity parameter and appropriate rows/columns covar. matrix
     set<string> mapPRN;
+    vector<double> add;
     for (int i = 0; i < _data.size(); i++)
     {
         auto rsatdata = _data[i];
@@ -2228,13 +2729,11 @@ void great::t_gpvtflt::_udsdAmb()
             {
                 if (_amb_obs.find(make_pair(sat, par_type::AMB_IF)) == _amb_obs.end())
                 {
-                    if (_spdlog)
-                        SPDLOG_LOGGER_INFO(_spdlog, "amb_obs not correct!" + sat + " " + _epoch.str_hms());
+                    GLOGGER_INFO(_spdlog, "amb_obs not correct!{} {}", sat, _epoch.str_hms());
                 }
                 else if (_amb_obs[make_pair(sat, par_type::AMB_IF)] != amb_obs_identifier)
                 {
-                    if (_spdlog)
-                        SPDLOG_LOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!" + sat + " " + _epoch.str_hms());
+                    GLOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!{} {}", sat, _epoch.str_hms());
                     _amb_obs[make_pair(sat, par_type::AMB_IF)] = amb_obs_identifier;
                 }
                 continue;
@@ -2247,8 +2746,7 @@ void great::t_gpvtflt::_udsdAmb()
                 newPar.value(sdamb); // first ambiguity value
                 _param.addParam(newPar);
                 _newAMB[sat] = 1;
-                Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
+                add.push_back(_sigAmbig * _sigAmbig);
             }
             else
             {
@@ -2370,13 +2868,11 @@ void great::t_gpvtflt::_udsdAmb()
                 {
                     if (_amb_obs.find(make_pair(sat, amb_type)) == _amb_obs.end())
                     {
-                        if (_spdlog)
-                            SPDLOG_LOGGER_INFO(_spdlog, "amb_obs not correct!" + sat + " " + _epoch.str_hms());
+                        GLOGGER_INFO(_spdlog, "amb_obs not correct!{} {}", sat, _epoch.str_hms());
                     }
                     else if (_amb_obs[make_pair(sat, amb_type)] != amb_obs_identifier)
                     {
-                        if (_spdlog)
-                            SPDLOG_LOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!" + sat + " " + _epoch.str_hms());
+                        GLOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!{} {}", sat, _epoch.str_hms());
                         _amb_obs[make_pair(sat, amb_type)] = amb_obs_identifier;
                     }
                     continue;
@@ -2388,8 +2884,7 @@ void great::t_gpvtflt::_udsdAmb()
                     t_gpar newPar(_site, amb_type, _param.parNumber() + 1, sat);
                     newPar.value(sdamb);
                     _param.addParam(newPar);
-                    Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                    _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
+                    add.push_back(_sigAmbig * _sigAmbig);
                     newAmb = 1;
                 }
                 else
@@ -2407,9 +2902,10 @@ void great::t_gpvtflt::_udsdAmb()
         } //end uc
 
     } //end data
+    _addPar(add);
 
     // Remove ambiguity parameter and appropriate rows/columns covar. matrix
-
+    vector<int> rem;
     for (unsigned int i = 0; i < _param.parNumber(); i++)
     {
         if (_param[i].parType == par_type::AMB_IF ||
@@ -2424,20 +2920,17 @@ void great::t_gpvtflt::_udsdAmb()
             if (prnITER == mapPRN.end())
             {
 
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, "AMB will be removed! For Sat PRN " + _param[i].prn + " Epoch: " + _epoch.str_ymdhms());
+                GLOGGER_INFO(_spdlog, "AMB will be removed! For Sat PRN {} Epoch: {}", _param[i].prn, _epoch.str_ymdhms());
 
                 _amb_obs.erase(make_pair(_param[i].prn, _param[i].parType));
 
                 _newAMB.erase(_param[i].prn);
 
-                Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-                _param.delParam(i);
-                _param.reIndex();
-                i--;
+                rem.push_back(i);
             }
         }
     }
+    _remPar(rem);
 
     return;
 }
@@ -2454,6 +2947,7 @@ void great::t_gpvtflt::_udAmb()
 
     // Add ambiguity parameter and appropriate rows/columns covar. matrix
     set<string> mapPRN;
+    vector<double> add;
 
     vector<t_gsatdata>::iterator it;
     for (it = _data.begin(); it != _data.end(); ++it)
@@ -2517,10 +3011,8 @@ void great::t_gpvtflt::_udAmb()
                 _param.addParam(newPar);
                 _newAMB[it->sat()] = 1;
 
-                Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, "AMB_IF was added! For Sat PRN " + it->sat() + " Epoch: " + _epoch.str_ymdhms());
+                add.push_back(_sigAmbig * _sigAmbig);
+                GLOGGER_INFO(_spdlog, "AMB_IF was added! For Sat PRN {} Epoch: {}", it->sat(), _epoch.str_ymdhms());
             }
             else if (it->getlli(gobs1.gobs()) >= 1 || it->getlli(gobs2.gobs()) >= 1)
             {
@@ -2539,13 +3031,11 @@ void great::t_gpvtflt::_udAmb()
                 _amb_obs[make_pair(it->sat(), par_type::AMB_IF)] = amb_obs_identifier;
             else if (_amb_obs.find(make_pair(it->sat(), par_type::AMB_IF)) == _amb_obs.end())
             {
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, "amb_obs not correct!" + it->sat() + " " + _epoch.str_hms());
+                GLOGGER_INFO(_spdlog, "amb_obs not correct!{} {}", it->sat(), _epoch.str_hms());
             }
             else if (_amb_obs[make_pair(it->sat(), par_type::AMB_IF)] != amb_obs_identifier)
             {
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!" + it->sat() + " " + _epoch.str_hms());
+                GLOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!{} {}", it->sat(), _epoch.str_hms());
                 _amb_obs[make_pair(it->sat(), par_type::AMB_IF)] = amb_obs_identifier;
             }
         }
@@ -2612,8 +3102,7 @@ void great::t_gpvtflt::_udAmb()
                     _amb_obs[make_pair(it->sat(), amb_type)] = amb_obs_identifier;
                 else if (_amb_obs[make_pair(it->sat(), amb_type)] != amb_obs_identifier)
                 {
-                    if (_spdlog)
-                        SPDLOG_LOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!" + it->sat() + " " + _epoch.str_hms());
+                    GLOGGER_INFO(_spdlog, "Warning: amb_obs switched silently!{} {}", it->sat(), _epoch.str_hms());
                     _amb_obs[make_pair(it->sat(), amb_type)] = amb_obs_identifier;
                     it->addlli(gobsi.gobs(), 1);
                 }
@@ -2624,10 +3113,8 @@ void great::t_gpvtflt::_udAmb()
                     newPar.setTime(_epoch, LAST_TIME); // beg -> end
                     _param.addParam(newPar);
 
-                    Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                    _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
-                    if (_spdlog)
-                        SPDLOG_LOGGER_INFO(_spdlog, "RAW AMB_L1 was added! For Sat PRN " + it->sat() + " Epoch: " + _epoch.str_ymdhms());
+                    add.push_back(_sigAmbig * _sigAmbig);
+                    GLOGGER_INFO(_spdlog, "RAW AMB_L1 was added! For Sat PRN {} Epoch: {}", it->sat(), _epoch.str_ymdhms());
                     newAmb = 1;
                 }
                 else if (it->getlli(gobsi.gobs()) >= 1) // check cycle slip
@@ -2647,9 +3134,10 @@ void great::t_gpvtflt::_udAmb()
         }
 
     } // end loop over all observations
+    _addPar(add);
 
     // Remove ambiguity parameter and appropriate rows/columns covar. matrix
-
+    vector<int> rem;
     for (unsigned int i = 0; i < _param.parNumber(); i++)
     {
         if (_param[i].parType == par_type::AMB_IF ||
@@ -2666,20 +3154,17 @@ void great::t_gpvtflt::_udAmb()
             if (prnITER == mapPRN.end())
             {
 
-                if (_spdlog)
-                    SPDLOG_LOGGER_INFO(_spdlog, "AMB will be removed! For Sat PRN " + _param[i].prn + " Epoch: " + _epoch.str_ymdhms());
+                GLOGGER_INFO(_spdlog, "AMB will be removed! For Sat PRN {} Epoch: {}", _param[i].prn, _epoch.str_ymdhms());
 
                 _amb_obs.erase(make_pair(_param[i].prn, _param[i].parType));
 
                 _newAMB.erase(_param[i].prn);
 
-                Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-                _param.delParam(i);
-                _param.reIndex();
-                i--;
+                rem.push_back(i);
             }
         }
     }
+    _remPar(rem);
 
     return;
 }
@@ -2736,8 +3221,9 @@ void great::t_gpvtflt::Add_rho_azel(const string &site_name, t_gtriple &xyz_s, c
     return;
 }
 
-void great::t_gpvtflt::_prtOut(t_gtime &epoch, t_gallpar &X, const SymmetricMatrix &Q, vector<t_gsatdata> &data, ostringstream &os, xml_node &node, bool saveProd)
+void great::t_gpvtflt::_prtOut(t_gtime &epoch, t_gallpar &X, const SymmetricMatrix &Q, vector<t_gsatdata> &data, t_gfmtline &line, bool saveProd)
 {
+    GPROF_SCOPE(PROF_OUTPUT);
 
     // get CRD params
     t_gtriple xyz, ell;
@@ -2784,7 +3270,6 @@ void great::t_gpvtflt::_prtOut(t_gtime &epoch, t_gallpar &X, const SymmetricMatr
         cov_yz = Q(icrdz + 1, icrdy + 1);
     }
 
-    t_gtriple crd_rms(Xrms, Yrms, Zrms);
     t_gtriple vRec(0, 0, 0);
 
     if (_doppler)
@@ -2822,33 +3307,8 @@ void great::t_gpvtflt::_prtOut(t_gtime &epoch, t_gallpar &X, const SymmetricMatr
     set<string> ambs = X.amb_prns();
     int nsat = ambs.size();
 
-    // get amb status
-    string amb = "Float";
-    if (_amb_state)
-        amb = "Fixed";
-
     if (_allprod != 0 && saveProd)
     {
-        shared_ptr<t_gprod> prdcrd = _allprod->get(_site, t_gdata::POS, epoch);
-        if (prdcrd)
-        {
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->xyz(xyz_ecc);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->xyz_rms(crd_rms);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_XY, cov_xy);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_XZ, cov_xz);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_YZ, cov_yz);
-        }
-        else
-        {
-            prdcrd = make_shared<t_gprodcrd>(_spdlog, epoch);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->xyz(xyz_ecc);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->xyz_rms(crd_rms);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_XY, cov_xy);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_XZ, cov_xz);
-            dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_YZ, cov_yz);
-            _allprod->add(prdcrd, _site);
-        }
-
         t_gtriple Ell, XYZ;
         if (_param.getCrdParam(_site, XYZ) > 0)
         {
@@ -2870,36 +3330,13 @@ void great::t_gpvtflt::_prtOut(t_gtime &epoch, t_gallpar &X, const SymmetricMatr
     t_gposdata::data_pos posdata = t_gposdata::data_pos{ crt, position, velocity, Qpos, Qvel, pdop, nsat, _amb_state };
     bool ins = dynamic_cast<t_gsetinp *>(_set)->input_size("imu") > 0 ? true : false;
     // write kml
-    if (_kml&&!ins)
+    if (_kml && _kml_writer && !ins)
     {
-        ostringstream out;
         t_gtriple ell1(ell);
         if (ell1[1] > G_PI)
             ell1[1] = ell1[1] - 2 * G_PI;
-        out << fixed << setprecision(11) << " " << setw(0) << ell1[1] * R2D << ',' << ell1[0] * R2D;
-        string val = out.str();
-
-        xml_node root = _doc;
-        node = this->_default_node(root, _root.c_str());
-        xml_node document = node.child("Document");
-        xml_node last_child = document.last_child();
-        xml_node placemark = document.insert_child_after("Placemark", last_child);
-        string q = "#P" + _quality_grade(posdata);
-        this->_default_node(placemark, "styleUrl", q.c_str());
-        this->_default_node(placemark, "time", int2str(_epoch.sow()).c_str());
-        xml_node point = this->_default_node(placemark, "Point");
-        this->_default_node(point, "coordinates", val.c_str()); // for point
-        xml_node description = placemark.append_child("description");
-        description.append_child(pugi::node_cdata).set_value(_gen_kml_description(epoch, posdata).c_str());
-        xml_node TimeStamp = placemark.append_child("TimeStamp");
-        string time = trim(epoch.str_ymd()) + "T" + trim(epoch.str_hms()) + "Z";
-        this->_default_node(TimeStamp, "when", time.c_str());
-        xml_node Placemark = document.child("Placemark");
-        xml_node LineString = Placemark.child("LineString");
-        this->_default_node(LineString, "coordinates", val.c_str(), false); 
-    }
-
-    string str_dsec = dbl2str(epoch.dsec());
+        _kml_writer->placemark(epoch, ell1[1] * R2D, ell1[0] * R2D, _quality_grade(posdata), _gen_kml_description(epoch, posdata));
+    }
 
     double bl = 0;
     t_gtriple tmpell, tmpdxyz, tmpneu;
@@ -2912,53 +3349,104 @@ void great::t_gpvtflt::_prtOut(t_gtime &epoch, t_gallpar &X, const SymmetricMatr
         bl = tmpneu.norm();
     }
 
-
-    os << fixed << setprecision(4) << " "
-       << " " << epoch.sow() + epoch.dsec();
-    if (_crd_est != CONSTRPAR::FIX)
-    {
-        os << fixed << setprecision(4)
-           << " " << setw(15) << xyz_ecc[0] // [m]
-           << " " << setw(15) << xyz_ecc[1] // [m]
-           << " " << setw(15) << xyz_ecc[2] // [m]
-           << " " << setw(10) << vRec[0]    // [m/s]
-           << " " << setw(10) << vRec[1]    // [m/s]
-           << " " << setw(10) << vRec[2]    // [m/s]
-           << fixed << setprecision(4)
-           << " " << setw(9) << Xrms  // [m]
-           << " " << setw(9) << Yrms  // [m]
-           << " " << setw(9) << Zrms  // [m]
-           << " " << setw(9) << Vxrms // [m/s]
-           << " " << setw(9) << Vyrms // [m/s]
-           << " " << setw(9) << Vzrms // [m/s]
-            ;
-    }
-    os << fixed << setprecision(0)
-       << " " << setw(5) << nsat // nsat
-       << fixed << setprecision(1)
-       << fixed << setprecision(2)
-       << " " << setw(5) << pdop // pdop
-       << fixed << setprecision(2)
-       << " " << setw(8) << _sig_unit // m0
-       << " " << setw(8) << amb;
-    if (_fix_mode != FIX_MODE::NO)
-        os << setprecision(2) << " " << fixed << setw(10) << _ambfix->get_ratio();
-    if (_isBase)
-    {
-        os << " " << fixed << setprecision(3) << setw(10) << bl; 
-    }
-    os << " " << setw(8) << _quality_grade(posdata);
+    t_gfbsol sol;
+    sol.epoch = epoch;
+    sol.xyz = xyz_ecc;
+    sol.vel = vRec;
+    sol.Qxyz[0] = Xrms < 0 ? -1.0 : Xrms * Xrms;
+    sol.Qxyz[1] = Yrms < 0 ? -1.0 : Yrms * Yrms;
+    sol.Qxyz[2] = Zrms < 0 ? -1.0 : Zrms * Zrms;
+    sol.Qxyz[3] = cov_xy;
+    sol.Qxyz[4] = cov_xz;
+    sol.Qxyz[5] = cov_yz;
+    sol.vrms = t_gtriple(Vxrms, Vyrms, Vzrms);
+    sol.nsat = nsat;
+    sol.pdop = pdop;
+    sol.sig0 = _sig_unit;
+    sol.fixed = _amb_state;
+    sol.ratio = (_fix_mode != FIX_MODE::NO) ? _ambfix->get_ratio() : 0.0;
+    sol.bl = bl;
     if (_observ == OBSCOMBIN::RAW_MIX)
     {
         map<string, int> satsnum = _param.freq_sats_num(2);
-        os << setw(8) << satsnum["Single"] << setw(8) << satsnum["Double"];
+        sol.nsingle = satsnum["Single"];
+        sol.ndouble = satsnum["Double"];
     }
-    os << endl;
+    // forward/backward passes run in parallel, only the combination is stored
+    if (_fbs_sol)
+        _fbs_sol->push_back(sol);
+    else if (saveProd)
+        _saveCrd(sol);
+
+    _prtSol(sol, line);
 
     return;
 }
 
-void great::t_gpvtflt::_prtOutHeader()
+void great::t_gpvtflt::_saveCrd(const t_gfbsol &sol)
+{
+    if (_allprod == 0)
+        return;
+
+    t_gtriple crd_rms(sol.Qxyz[0] < 0 ? -1.0 : sqrt(sol.Qxyz[0]),
+                      sol.Qxyz[1] < 0 ? -1.0 : sqrt(sol.Qxyz[1]),
+                      sol.Qxyz[2] < 0 ? -1.0 : sqrt(sol.Qxyz[2]));
+    double cov_xy = sol.Qxyz[3], cov_xz = sol.Qxyz[4], cov_yz = sol.Qxyz[5];
+    shared_ptr<t_gprod> prdcrd = _allprod->get(_site, t_gdata::POS, sol.epoch);
+    bool add = !prdcrd;
+    if (add)
+        prdcrd = make_shared<t_gprodcrd>(_spdlog, sol.epoch);
+    dynamic_pointer_cast<t_gprodcrd>(prdcrd)->xyz(sol.xyz);
+    dynamic_pointer_cast<t_gprodcrd>(prdcrd)->xyz_rms(crd_rms);
+    dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_XY, cov_xy);
+    dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_XZ, cov_xz);
+    dynamic_pointer_cast<t_gprodcrd>(prdcrd)->cov(COV_YZ, cov_yz);
+    if (add)
+        _allprod->add(prdcrd, _site);
+}
+
+void great::t_gpvtflt::_prtSol(const t_gfbsol &sol, t_gfmtline &line)
+{
+    double rms[3];
+    for (int i = 0; i < 3; i++)
+        rms[i] = sol.Qxyz[i] < 0 ? -1.0 : sqrt(sol.Qxyz[i]);
+
+    Eigen::Vector3d Qpos(rms[0] * rms[0], rms[1] * rms[1], rms[2] * rms[2]);
+    Eigen::Vector3d Qvel(sol.vrms[0] * sol.vrms[0], sol.vrms[1] * sol.vrms[1], sol.vrms[2] * sol.vrms[2]);
+    Eigen::Vector3d position(sol.xyz[0], sol.xyz[1], sol.xyz[2]), velocity(sol.vel[0], sol.vel[1], sol.vel[2]);
+    t_gposdata::data_pos posdata = t_gposdata::data_pos{ sol.epoch.sow() + sol.epoch.dsec(), position, velocity, Qpos, Qvel, sol.pdop, sol.nsat, sol.fixed };
+
+    line.lit("  ").fix(sol.epoch.sow() + sol.epoch.dsec(), 0, 4);
+    if (_crd_est != CONSTRPAR::FIX)
+    {
+        line.lit(" ").fix(sol.xyz[0], 15, 4)     // [m]
+            .lit(" ").fix(sol.xyz[1], 15, 4)     // [m]
+            .lit(" ").fix(sol.xyz[2], 15, 4)     // [m]
+            .lit(" ").fix(sol.vel[0], 10, 4)     // [m/s]
+            .lit(" ").fix(sol.vel[1], 10, 4)     // [m/s]
+            .lit(" ").fix(sol.vel[2], 10, 4)     // [m/s]
+            .lit(" ").fix(rms[0], 9, 4)          // [m]
+            .lit(" ").fix(rms[1], 9, 4)          // [m]
+            .lit(" ").fix(rms[2], 9, 4)          // [m]
+            .lit(" ").fix(sol.vrms[0], 9, 4)     // [m/s]
+            .lit(" ").fix(sol.vrms[1], 9, 4)     // [m/s]
+            .lit(" ").fix(sol.vrms[2], 9, 4);    // [m/s]
+    }
+    line.lit(" ").num(sol.nsat, 5)               // nsat
+        .lit(" ").fix(sol.pdop, 5, 2)            // pdop
+        .lit(" ").fix(sol.sig0, 8, 2)            // m0
+        .lit(" ").str(sol.fixed ? "Fixed" : "Float", 8);
+    if (_fix_mode != FIX_MODE::NO)
+        line.lit(" ").fix(sol.ratio, 10, 2);
+    if (_isBase)
+        line.lit(" ").fix(sol.bl, 10, 3);
+    line.lit(" ").str(_quality_grade(posdata), 8);
+    if (_observ == OBSCOMBIN::RAW_MIX)
+        line.num(sol.nsingle, 8).num(sol.ndouble, 8);
+    line.eol();
+}
+
+void great::t_gpvtflt::_prtOutHeader(t_giof *out)
 {
     ostringstream os;
 
@@ -3032,10 +3520,13 @@ void great::t_gpvtflt::_prtOutHeader()
     os << endl;
 
     // Print flt results
-    if (_flt)
+    if (!out)
+        out = _flt;
+    if (out)
     {
-        _flt->write(os.str().c_str(), os.str().size());
-        _flt->flush();
+        t_gfmtline line(out == _flt && _flt_bin);
+        line.lit(os.str());
+        out->write(line.data().c_str(), line.size());
     }
 }
 
@@ -3117,7 +3608,19 @@ int great::t_gpvtflt::_getData(const t_gtime& now, vector <t_gsatdata>* data, bo
             _data_base.erase(_data_base.begin(), _data_base.end());
             _data_base = _gobs->obs(_site_base, now);
         }
-        
+
+        // slips flagged forward mark the epoch after the break, backward needs the one before
+        if (_lli_shift)
+        {
+            vector<t_gsatdata> &epo_data = isBase ? _data_base : _data;
+            map<string, map<GOBS, int>> &lli_next = isBase ? _lli_next_base : _lli_next;
+            for (auto &satdata : epo_data)
+            {
+                map<GOBS, int> lli = satdata.lli();
+                satdata.lli(lli_next[satdata.sat()]);
+                lli_next[satdata.sat()] = lli;
+            }
+        }
     }
 
     return (isBase ? static_cast<int>(_data_base.size()) : static_cast<int>(_data.size()));
@@ -3162,12 +3665,22 @@ void great::t_gpvtflt::_remove_sat(const string& satid)
 }
 
 bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, Matrix& BB, int& iobs)
+{
+    t_gsatprep prep;
+    _band_index[iter->gsys()][FREQ_1];
+    _band_index[iter->gsys()][FREQ_2];
+    _prep_sat(iter, prep);
+    return _add_sat(iter, prep, BB, iobs);
+}
+
+void great::t_gpvtflt::_prep_sat(t_gsatdata* const iter, t_gsatprep& prep)
 {
     GSYS gs = iter->gsys();
 
-    //GOBSBAND b1, b2;
-    GOBSBAND b1 = _band_index[gs][FREQ_1];
-    GOBSBAND b2 = _band_index[gs][FREQ_2];
+    // read only, the table is completed before the satellites are dispatched
+    const map<FREQ_SEQ, GOBSBAND> &bands = _band_index.at(gs);
+    GOBSBAND b1 = bands.at(FREQ_1);
+    GOBSBAND b2 = bands.at(FREQ_2);
 
     iter->spdlog(_spdlog);
 
@@ -3181,20 +3694,21 @@ bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, M
     // check data availability
     if (p1 == X || l1 == X)
     {
-        return false;
+        return;
     }
 
     string strGOBS = gobs2str(p1);
     strGOBS.replace(0, 1, "S");
     double obs_snr1 = iter->getobs(str2gobs(strGOBS));
     double obs_snr2 = iter->getobs(pha2snr(l1));
-    _crt_SNR[iter->sat()][FREQ_1] = double_eq(obs_snr2, 0.0) ? obs_snr1 : obs_snr2;
+    prep.snr[0] = double_eq(obs_snr2, 0.0) ? obs_snr1 : obs_snr2;
 
     strGOBS = gobs2str(p2);
     strGOBS.replace(0, 1, "S");
     obs_snr1 = iter->getobs(str2gobs(strGOBS));
     obs_snr2 = iter->getobs(pha2snr(l2));
-    _crt_SNR[iter->sat()][FREQ_2] = double_eq(obs_snr2, 0.0) ? obs_snr1 : obs_snr2;
+    prep.snr[1] = double_eq(obs_snr2, 0.0) ? obs_snr1 : obs_snr2;
+    prep.snr_set = true;
 
     double P3, L3;
     if (_observ == OBSCOMBIN::RAW_MIX)
@@ -3214,7 +3728,7 @@ bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, M
     {
         if (p2 == X || l2 == X)
         {
-            return false;
+            return;
         }
         P3 = iter->P3(p1, p2);
         L3 = iter->L3(l1, l2);
@@ -3226,9 +3740,8 @@ bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, M
         str << "prepareData: erasing data due to no phase double bands observation, "
             << "epo: " << _epoch.str_hms() << ", "
             << "prn: " << iter->sat() << " (" << iter->channel() << ")";
-        if (_spdlog)
-            SPDLOG_LOGGER_INFO(_spdlog, str.str());
-        return false;
+        prep.msg = str.str();
+        return;
     }
 
     if (double_eq(P3, 0.0))
@@ -3237,9 +3750,8 @@ bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, M
         str << "prepareData: erasing data due to no code double bands observation, "
             << "epo: " << _epoch.str_hms() << ", "
             << "prn: " << iter->sat();
-        if (_spdlog)
-            SPDLOG_LOGGER_INFO(_spdlog, str.str());
-        return false;
+        prep.msg = str.str();
+        return;
     }
 
     if (_satPos(_epoch, *iter) < 0)
@@ -3248,18 +3760,33 @@ bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, M
        str << "prepareData: erasing data since _satPos failed, "
            << "epo: " << _epoch.str_hms() << ", "
            << "prn: " << iter->sat();
-       if (_spdlog)
-           SPDLOG_LOGGER_INFO(_spdlog, str.str());
-        return false;
+       prep.msg = str.str();
+       return;
     }
-    else
+
+    prep.P3 = P3;
+    prep.valid = true;
+}
+
+bool great::t_gpvtflt::_add_sat(t_gsatdata* const iter, const t_gsatprep& prep, Matrix& BB, int& iobs)
+{
+    if (prep.snr_set)
     {
-        iobs++;
-        BB(iobs, 1) = iter->satcrd().crd(0);
-        BB(iobs, 2) = iter->satcrd().crd(1);
-        BB(iobs, 3) = iter->satcrd().crd(2);
-        BB(iobs, 4) = P3 + iter->clk();
+        _crt_SNR[iter->sat()][FREQ_1] = prep.snr[0];
+        _crt_SNR[iter->sat()][FREQ_2] = prep.snr[1];
     }
+
+    if (!prep.msg.empty() && _spdlog)
+        SPDLOG_LOGGER_INFO(_spdlog, prep.msg);
+
+    if (!prep.valid)
+        return false;
+
+    iobs++;
+    BB(iobs, 1) = iter->satcrd().crd(0);
+    BB(iobs, 2) = iter->satcrd().crd(1);
+    BB(iobs, 3) = iter->satcrd().crd(2);
+    BB(iobs, 4) = prep.P3 + iter->clk();
     return true;
 }
 
@@ -3273,23 +3800,25 @@ bool great::t_gpvtflt::_cmp_rec_crd(const string& ssite, Matrix& BB)
     if (grec == nullptr)
         return false;
 
-    if (!_initialized && (_vBanc.Rows(1, 3) - grec->crd_arp(_epoch).crd_cvect()).NormFrobenius() > 1000)
+    // forward/backward passes keep the kinematic crd of the receiver themselves
+    t_gtriple crd_arp = (_fbs_sol && ssite == _site && !_fbs_crd.zero()) ? _fbs_crd : grec->crd_arp(_epoch);
+    if (!_initialized && (_vBanc.Rows(1, 3) - crd_arp.crd_cvect()).NormFrobenius() > 1000)
     {
         if (ssite == _site)
             _valid_crd_xml = false;
         else
         { 
-            _vBanc(1) = grec->crd_arp(_epoch)[0];
-            _vBanc(2) = grec->crd_arp(_epoch)[1];
-            _vBanc(3) = grec->crd_arp(_epoch)[2];
+            _vBanc(1) = crd_arp[0];
+            _vBanc(2) = crd_arp[1];
+            _vBanc(3) = crd_arp[2];
         }
     }
 
     if (_valid_crd_xml && !_initialized)
     {
-        _vBanc(1) = grec->crd_arp(_epoch)[0];
-        _vBanc(2) = grec->crd_arp(_epoch)[1];
-        _vBanc(3) = grec->crd_arp(_epoch)[2];
+        _vBanc(1) = crd_arp[0];
+        _vBanc(2) = crd_arp[1];
+        _vBanc(3) = crd_arp[2];
     }
 
     if (ssite == _site && _crd_est != CONSTRPAR::FIX)
@@ -3332,11 +3861,8 @@ bool great::t_gpvtflt::_cmp_rec_crd(const string& ssite, Matrix& BB)
     return true;
 }
 
-bool great::t_gpvtflt::_cmp_sat_info(const string& ssite, t_gsatdata* const iter)
+void great::t_gpvtflt::_cmp_rec_xyz(const string& ssite, t_gtriple& xyz_r)
 {
-    t_gtriple xyz_r, xyz_s;
-    xyz_s = iter->satcrd();
-
     shared_ptr<t_gobj> grec = _gallobj->obj(ssite);
 
     if (_isBase && ssite == _site_base)
@@ -3375,15 +3901,20 @@ bool great::t_gpvtflt::_cmp_sat_info(const string& ssite, t_gsatdata* const iter
                 else
                     _param.getCrdParam(ssite, xyz_r);
             }
-            if (_pos_kin)
+            // the passes of processBatchFBS run concurrently on the same t_gobj
+            if (_pos_kin && _fbs_sol)
+                _fbs_crd = xyz_r;
+            else if (_pos_kin)
             {
                 t_gtriple crd_r = xyz_r - grec->eccxyz(_epoch);
                 grec->crd(crd_r, t_gtriple(1, 1, 1), _epoch, LAST_TIME, true);
             }
         }
     }
-    Add_rho_azel(ssite, xyz_s, xyz_r, *iter); 
+}
 
+bool great::t_gpvtflt::_cmp_sat_info(const string& ssite, t_gsatdata* const iter)
+{
     // check elevation cut-off
     if (iter->ele_deg() < _minElev)
     {
@@ -3434,14 +3965,14 @@ void great::t_gpvtflt::_predictCrd()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(_vBanc(1));
-            _Qx(i + 1, i + 1) = crdInit * crdInit;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, crdInit * crdInit));
         }
         else
         {
             if (_pos_kin)
                 _param[i].value(_vBanc(1));
             if (_cntrep == 1 && _success)
-                _Qx(i + 1, i + 1) += _crdStoModel->getQ() * _crdStoModel->getQ(); 
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _crdStoModel->getQ() * _crdStoModel->getQ())); 
         }
     }
 
@@ -3451,14 +3982,14 @@ void great::t_gpvtflt::_predictCrd()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(_vBanc(2));
-            _Qx(i + 1, i + 1) = crdInit * crdInit;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, crdInit * crdInit));
         }
         else
         {
             if (_pos_kin)
                 _param[i].value(_vBanc(2));
             if (_cntrep == 1 && _success)
-                _Qx(i + 1, i + 1) += _crdStoModel->getQ() * _crdStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _crdStoModel->getQ() * _crdStoModel->getQ()));
         }
     }
 
@@ -3468,14 +3999,14 @@ void great::t_gpvtflt::_predictCrd()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(_vBanc(3));
-            _Qx(i + 1, i + 1) = crdInit * crdInit;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, crdInit * crdInit));
         }
         else
         {
             if (_pos_kin)
                 _param[i].value(_vBanc(3));
             if (_cntrep == 1 && _success)
-                _Qx(i + 1, i + 1) += _crdStoModel->getQ() * _crdStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _crdStoModel->getQ() * _crdStoModel->getQ()));
         }
     }
     if (_pos_constrain)
@@ -3483,7 +4014,7 @@ void great::t_gpvtflt::_predictCrd()
         int icrdx = _param.getParam(_site, par_type::CRD_X, "");
         for (int j = 0; j < 3; j++)
         {
-            _Qx(_param[icrdx].index + j, _param[icrdx].index + j) = SQR(_extn_rms[j]);
+            _proc.push_back(t_gprocnoise(_param[icrdx].index + j, PROC_MODEL::RESET, SQR(_extn_rms[j])));
         }
     }
 
@@ -3498,9 +4029,7 @@ void great::t_gpvtflt::_predictClk()
     if (i >= 0)
     {
         _param[i].value(_vBanc(4));
-        for (unsigned int jj = 1; jj <= _param.parNumber(); jj++)
-            _Qx(i + 1, jj) = 0.0;
-        _Qx(i + 1, i + 1) = _clkStoModel->getQ() * _clkStoModel->getQ();
+        _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::WHITE_NOISE, _clkStoModel->getQ() * _clkStoModel->getQ()));
     }
     return;
 }
@@ -3515,12 +4044,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = _sig_init_glo * _sig_init_glo;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, _sig_init_glo * _sig_init_glo));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _gloStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _gloStoModel->getQ()));
         }
     }
 
@@ -3530,12 +4059,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = _sig_init_glo * _sig_init_glo;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, _sig_init_glo * _sig_init_glo));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _gloStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _gloStoModel->getQ()));
         }
     }
 
@@ -3545,12 +4074,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = _sig_init_gal * _sig_init_gal;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, _sig_init_gal * _sig_init_gal));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _galStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _galStoModel->getQ()));
         }
     }
 
@@ -3560,12 +4089,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = _sig_init_bds * _sig_init_bds;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, _sig_init_bds * _sig_init_bds));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _bdsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _bdsStoModel->getQ()));
         }
     }
 
@@ -3575,12 +4104,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = _sig_init_qzs * _sig_init_qzs;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, _sig_init_qzs * _sig_init_qzs));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _qzsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _qzsStoModel->getQ()));
         }
     }
 
@@ -3590,12 +4119,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _gpsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _gpsStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_GAL, "");
@@ -3604,12 +4133,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _galStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _galStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_GAL_2, "");
@@ -3618,12 +4147,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _galStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _galStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_GAL_3, "");
@@ -3632,12 +4161,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _galStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _galStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_BDS, "");
@@ -3646,12 +4175,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _bdsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _bdsStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_BDS_2, "");
@@ -3660,12 +4189,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _bdsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _bdsStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_BDS_3, "");
@@ -3674,12 +4203,12 @@ void great::t_gpvtflt::_predictBias()
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
             _param[i].value(0.0);
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _bdsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _bdsStoModel->getQ()));
         }
     }
     i = _param.getParam(_site, par_type::IFB_QZS, "");
@@ -3687,12 +4216,12 @@ void great::t_gpvtflt::_predictBias()
     {
         if (!_initialized || _Qx(i + 1, i + 1) == 0.0)
         {
-            _Qx(i + 1, i + 1) = 3000 * 3000;
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, 3000 * 3000));
         }
         else
         {
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _qzsStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _qzsStoModel->getQ()));
         }
     }
     return;
@@ -3732,7 +4261,7 @@ void great::t_gpvtflt::_predictIono(const double& bl, const t_gtime& runEpoch)
                 if (_cntrep == 1 &&
                     !double_eq(_Qx(i + 1, i + 1), _sig_init_vion * _sig_init_vion))
                 {
-                    _Qx(i + 1, i + 1) += _ionStoModel->getQ(); // *_ionStoModel->getQ();
+                    _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _ionStoModel->getQ())); // *_ionStoModel->getQ();
                 }
             }
 
@@ -3740,25 +4269,27 @@ void great::t_gpvtflt::_predictIono(const double& bl, const t_gtime& runEpoch)
             if (i >= 0)
             {
                 double var = _sig_init_vion * _sig_init_vion;
-                if (_isBase && double_eq(_Qx(i + 1, i + 1), var))
+                double qii = _Qx(i + 1, i + 1);
+                if (_isBase && double_eq(qii, var))
                 {
                     var *= SQR(bl / (1e4));
-                    _Qx(i + 1, i + 1) = var;
+                    qii = var;
+                    _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, var));
                     _param[i].value(1e-6);
                 }
                 //ylx 20250319
                 //_param[i].value(0.0);
                 //_Qx(i + 1, i + 1) = var;
-                if (_cntrep == 1 && !double_eq(_Qx(i + 1, i + 1), var))
+                if (_cntrep == 1 && !double_eq(qii, var))
                 {
 
                     if (_isBase)
                     {
-                        _Qx(i + 1, i + 1) += SQR(bl / (1e4) * cos(it->ele())) * _ionStoModel->getQ();
+                        _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, SQR(bl / (1e4) * cos(it->ele())) * _ionStoModel->getQ()));
                     }
                     else
                     {
-                        _Qx(i + 1, i + 1) += _ionStoModel->getQ();
+                        _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _ionStoModel->getQ()));
                     }
                 }
             }
@@ -3775,7 +4306,7 @@ void great::t_gpvtflt::_predictTropo()
     if (i >= 0)
     {
         if (_cntrep == 1 && _initialized)
-            _Qx(i + 1, i + 1) += _grdStoModel->getQ();
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _grdStoModel->getQ()));
         if (_smooth)
             _Noise(i + 1, i + 1) = _grdStoModel->getQ();
     }
@@ -3784,7 +4315,7 @@ void great::t_gpvtflt::_predictTropo()
     if (i >= 0)
     {
         if (_cntrep == 1 && _initialized)
-            _Qx(i + 1, i + 1) += _grdStoModel->getQ();
+            _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _grdStoModel->getQ()));
         if (_smooth)
             _Noise(i + 1, i + 1) = _grdStoModel->getQ();
     }
@@ -3835,12 +4366,12 @@ void great::t_gpvtflt::_predictTropo()
                             _param[i].value(tmpgmodel->tropoModel()->getZWD(Ell, _epoch));
                         }
                     }
-                    _Qx(i + 1, i + 1) = ztdInit * ztdInit;
+                    _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RESET, ztdInit * ztdInit));
                 }
                 else
                 {
                     if (_cntrep == 1)
-                        _Qx(i + 1, i + 1) += _trpStoModel->getQ();
+                        _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _trpStoModel->getQ()));
                 }
             }
         }
@@ -3862,7 +4393,7 @@ void great::t_gpvtflt::_predictAmb()
         {
 
             if (_cntrep == 1)
-                _Qx(i + 1, i + 1) += _ambStoModel->getQ();
+                _proc.push_back(t_gprocnoise(i + 1, PROC_MODEL::RANDOM_WALK, _ambStoModel->getQ()));
             if (_smooth)
                 _Noise(i + 1, i + 1) = _ambStoModel->getQ();
             _param[i].stime = _param[i].end = _epoch;
@@ -3873,22 +4404,87 @@ void great::t_gpvtflt::_predictAmb()
 
 unsigned int great::t_gpvtflt::_cmp_equ(t_gfltEquationMatrix &equ)
 {
-    vector<t_gsatdata>::iterator it = _data.begin();
-    for (it = _data.begin(); it != _data.end();)
+    GPROF_SCOPE(PROF_EQUATION);
+
+    // code and phase per frequency, rejected satellites are compacted once at the end
+    equ.reserve(2 * max(_frequency, 1) * _data.size());
+    size_t nsat = _data.size();
+    vector<char> keep(nsat, 0);
+    if (_sat_models.empty())
+    {
+        for (size_t i = 0; i < nsat; i++)
+            keep[i] = _base_model->cmb_equ(_epoch, _param, _data[i], equ);
+    }
+    else
     {
-        if (!_base_model->cmb_equ(_epoch, _param, *it, equ))
+        // the satellites are combined in their own buffers and merged in satellite order.
+        // The first valid satellite of every system runs alone: it writes the receiver
+        // parameters (crd, clk, ztd, clk of the 3rd frequency), the others only read them.
+        vector<t_gfltEquationMatrix> sat_equ(nsat);
+        set<GSYS> ready;
+        vector<int> todo;
+        for (size_t i = 0; i < nsat; i++)
         {
-            it = _data.erase(it);
-            continue;
+            if (ready.count(_data[i].gsys()))
+            {
+                todo.push_back(i);
+                continue;
+            }
+            keep[i] = _sat_models[0]->cmb_equ(_epoch, _param, _data[i], sat_equ[i]);
+            if (keep[i])
+                ready.insert(_data[i].gsys());
         }
+
+        shared_ptr<t_gbiasmodel> bias = _sat_models[0]->bias_model();
+        for (int i : todo)
+            bias->prepare_sat(_data[i].site(), _data[i].sat());
+        // the timers of the workers (PROF_MODEL) count for the site of the calling thread
+        const string prof_site = _site;
+        _sat_pool->parallel_for_slots(todo.size(), [&](int k, int slot) {
+            t_gprofiler::site(prof_site);
+            int i = todo[k];
+            keep[i] = _sat_models[slot]->cmb_equ(_epoch, _param, _data[i], sat_equ[i]);
+        });
+
+        for (size_t i = 0; i < nsat; i++)
+            if (keep[i])
+                equ.add_equ(std::move(sat_equ[i]));
+    }
+
+    size_t nkeep = 0;
+    for (size_t i = 0; i < nsat; i++)
+    {
+        if (!keep[i])
+            continue;
         if (_observ == OBSCOMBIN::IONO_FREE)
-            _combineMW(*it);
-        ++it;
+            _combineMW(_data[i]);
+        if (nkeep != i)
+            _data[nkeep] = std::move(_data[i]);
+        nkeep++;
     }
+    _data.erase(_data.begin() + nkeep, _data.end());
 
     return equ.num_equ();
 }
 
+void great::t_gpvtflt::_init_sat_models()
+{
+    _sat_models.clear();
+    shared_ptr<t_gcombmodel> comb = dynamic_pointer_cast<t_gcombmodel>(_base_model);
+    if (!_sat_pool || !comb)
+        return;
+
+    vector<shared_ptr<t_gcombmodel>> models(1, comb);
+    for (int i = 1; i < _sat_pool->size(); i++)
+    {
+        shared_ptr<t_gcombmodel> model = comb->worker();
+        if (!model)
+            return; // RTK (t_gcombDD) combines the satellites sequentially
+        models.push_back(model);
+    }
+    _sat_models = models;
+}
+
 void great::t_gpvtflt::_posterioriTest(const Matrix& A, const SymmetricMatrix& P, const ColumnVector& l,
     const ColumnVector& dx, const SymmetricMatrix& Q, ColumnVector& v_norm, double& vtpv)
 {;
@@ -20,9 +20,40 @@
 #include "gmodels/gcombmodel.h"
 #include "gproc/gpreproc.h"
 #include "gproc/gfltmatrix.h"
+#include "gutils/gmatrixconv.h"
+#include "gutils/gthreadpool.h"
+#include "gutils/gcheckpoint.h"
 
 namespace great
 {
+    /** @brief per-satellite result of the obs check and sat crd/clk, reduced in satellite order. */
+    struct t_gsatprep
+    {
+        bool valid = false;     ///< obs available and sat crd/clk computed
+        bool snr_set = false;   ///< snr of both frequencies determined
+        double snr[2] = {0.0, 0.0}; ///< snr FREQ_1, FREQ_2
+        double P3 = 0.0;        ///< code used for Bancroft
+        string msg;             ///< reason of erasing (logged in the reduction)
+    };
+
+    /** @brief epoch solution of one direction, kept for the forward/backward combination. */
+    struct t_gfbsol
+    {
+        t_gtime epoch;          ///< epoch
+        t_gtriple xyz;          ///< ARP position [m]
+        t_gtriple vel;          ///< velocity [m/s]
+        double Qxyz[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}; ///< XX, YY, ZZ, XY, XZ, YZ [m^2], XX < 0 if not available
+        t_gtriple vrms;         ///< velocity rms [m/s], < 0 if not available
+        int nsat = 0;           ///< number of satellites
+        double pdop = -1.0;     ///< pdop
+        double sig0 = 0.0;      ///< sigma0
+        bool fixed = false;     ///< ambiguity state
+        double ratio = 0.0;     ///< ratio of the fixing
+        double bl = 0.0;        ///< baseline length [m]
+        int nsingle = 0;        ///< single frequency satellites (RAW_MIX)
+        int ndouble = 0;        ///< double frequency satellites (RAW_MIX)
+    };
+
     /**
     * @brief class for gpvtflt, derive from gpppflt
     */
@@ -52,6 +83,34 @@ namespace great
         */
         virtual int processBatch(const t_gtime &beg, const t_gtime &end, bool prtOut);
 
+        /**
+        * @brief forward and backward filter on two threads, combined epoch by epoch
+        * @note the forward pass writes the flt output as processBatch, the combination goes to the smt output
+        * @note a checkpoint to restore (<restore>) is rejected, both passes process the whole span
+        * @param[in] beg            begin time
+        * @param[in] end            end time
+        * @return -1,failed; 1,success
+        */
+        virtual int processBatchFBS(const t_gtime &beg, const t_gtime &end);
+
+        /**
+        * @brief write the filter state after the last processed epoch
+        * @param[in] file           checkpoint file
+        * @return -1,failed; 1,success
+        */
+        virtual int checkpoint(const string &file);
+
+        /**
+        * @brief resume the filter state written by checkpoint()
+        * @note call after InitProc, processing continues with the epoch after epoch()
+        * @param[in] file           checkpoint file
+        * @return -1,failed (state unchanged only if the file could not be opened); 1,success
+        */
+        virtual int restore(const string &file);
+
+        /** @brief last processed epoch. */
+        const t_gtime &epoch() const { return _epoch; }
+
         /**
         * @brief Initializing some settings.
         * @param[in] beg            begin time
@@ -69,6 +128,14 @@ namespace great
         */
         virtual int ProcessOneEpoch(const t_gtime &now, vector<t_gsatdata> *data_rover = NULL, vector<t_gsatdata> *data_base = NULL);
 
+        /**
+        * @brief One epoch processing in real-time (cycle slip detection + filtering)
+        * @note InitProc must be called before the first epoch
+        * @param[in] now    epoch already completed in t_gallobs
+        * @return -1,failed; 0,float; 1,fixed.
+        */
+        virtual int ProcessRealtimeEpoch(const t_gtime &now);
+
         /**
         * @brief Add UPD
         * @param[in] gupd    upd data
@@ -226,14 +293,38 @@ namespace great
         * @param[in] X          parameter
         * @param[in] Q          covariance matrix
         * @param[in] data       satdata
-        * @param[in] os         ostringstream
-        * @param[in] node       xml_node
+        * @param[out] line      output line
         * @param[in] saveProd   if save
         */
-        virtual void _prtOut(t_gtime &epo, t_gallpar &X, const SymmetricMatrix &Q, vector<t_gsatdata> &data, ostringstream &os, xml_node &node, bool saveProd = true);
+        virtual void _prtOut(t_gtime &epo, t_gallpar &X, const SymmetricMatrix &Q, vector<t_gsatdata> &data, t_gfmtline &line, bool saveProd = true);
+
+        /**
+        * @brief print one epoch solution (columns of _prtOutHeader).
+        * @param[in] sol        epoch solution
+        * @param[out] line      output line
+        */
+        void _prtSol(const t_gfbsol &sol, t_gfmtline &line);
 
-        /** @brief print  the result. */
-        void _prtOutHeader();
+        /**
+        * @brief store the position of one epoch solution in the products.
+        * @param[in] sol        epoch solution
+        */
+        void _saveCrd(const t_gfbsol &sol);
+
+        /**
+        * @brief print the header of the result.
+        * @param[in] out        output file, the flt output if nullptr
+        */
+        void _prtOutHeader(t_giof *out = nullptr);
+
+        /**
+        * @brief combine forward and backward solution of one epoch
+        * @note fixed solution preferred, otherwise weighted by the covariance
+        * @param[in] fwd        forward solution
+        * @param[in] bwd        backward solution
+        * @return combined solution
+        */
+        t_gfbsol _fbs_combine(const t_gfbsol &fwd, const t_gfbsol &bwd);
 
         /**
         * @brief generate Obs Index.
@@ -276,6 +367,24 @@ namespace great
         */
         bool _check_sat(const string& ssite, t_gsatdata * const iter, Matrix &BB, int &iobs);
 
+        /**
+        * @brief check obs and compute sat crd/clk of one satellite, writes nothing but the satellite and prep
+        * @note called from the workers of _sat_pool
+        * @param[in]  iter     satellite
+        * @param[out] prep     result
+        */
+        void _prep_sat(t_gsatdata * const iter, t_gsatprep &prep);
+
+        /**
+        * @brief store the result of _prep_sat (SNR, log, Bancroft row), in satellite order
+        * @param[in]  iter     satellite
+        * @param[in]  prep     result of _prep_sat
+        * @param[out] BB       BB
+        * @param[out] iobs     iobs
+        * @return true if the satellite is kept
+        */
+        bool _add_sat(t_gsatdata * const iter, const t_gsatprep &prep, Matrix &BB, int &iobs);
+
         /**
         * @brief compute rec crd.
         * @param[in] ssite    site
@@ -285,7 +394,14 @@ namespace great
         bool _cmp_rec_crd(const string& ssite, Matrix& BB);
 
         /**
-        * @brief compute sat information.
+        * @brief receiver crd used for the geometry of all satellites of the epoch.
+        * @param[in]  ssite    site
+        * @param[out] xyz_r    receiver crd
+        */
+        void _cmp_rec_xyz(const string& ssite, t_gtriple& xyz_r);
+
+        /**
+        * @brief check sat information (elevation, eclipse), the geometry is computed by Add_rho_azel.
         * @param[in] ssite    site
         * @param[in] iter     iterator
         * @return ture or false
@@ -322,6 +438,9 @@ namespace great
         */
         unsigned int _cmp_equ(t_gfltEquationMatrix &equ);
 
+        /** @brief per-thread copies of _base_model for _cmp_equ, empty if the satellites are combined sequentially. */
+        void _init_sat_models();
+
         /** @brief posteriori Test. */
         void _posterioriTest(const Matrix& A, const SymmetricMatrix& P, const ColumnVector& l,
             const ColumnVector& dx, const SymmetricMatrix& Q, ColumnVector& v_norm, double& vtpv);
@@ -330,6 +449,18 @@ namespace great
 
         void _get_result(t_gtime& epo, t_gposdata::data_pos& pos);
 
+        /**
+        * @brief save the state carried between epochs
+        * @param[in] ckp            checkpoint open for writing
+        */
+        virtual void _save_state(t_gcheckpoint &ckp);
+
+        /**
+        * @brief restore the state saved by _save_state
+        * @param[in] ckp            checkpoint open for reading
+        */
+        virtual void _load_state(t_gcheckpoint &ckp);
+
 
     protected:
         t_whitenoise *_dclkStoModel;       ///< clock drift model
@@ -339,6 +470,7 @@ namespace great
         bool _isFirstFix;                  ///< is First Fix
         double _max_res_norm;              ///< maximum normalize res 
         bool _isBase;                      ///< if using base,true; other: fasle  
+        bool _base_shared;                 ///< base used by other rovers, its epochs are not released
         Matrix _post_A;                    ///< post A P L for RTK  
         SymmetricMatrix _post_P;           ///< post A P L for RTK 
         ColumnVector _post_l;              ///< post A P L for RTK 
@@ -356,6 +488,10 @@ namespace great
         t_gallpar _param_fixed;            ///< param fixed
         t_gtriple _vel;                    ///< vel
         SymmetricMatrix _Qx_vel;           ///< Qx_vel
+        shared_ptr<t_gflt> _filter_vel;    ///< filter of the velocity, t_SRF_seq keeps the factor of its own Qx
+        vector<t_gprocnoise> _proc;        ///< process noise of the current prediction
+        shared_ptr<t_gthreadpool> _sat_pool; ///< per-satellite preprocessing pool (sat_threads > 1)
+        vector<shared_ptr<t_gcombmodel>> _sat_models; ///< model of every pool thread, [0] is _base_model
         map<string, double> _crt_ele;      ///< crt vel
         map<string, map<FREQ_SEQ, double>> _crt_SNR;///< crt SNR
         vector<pair<string, pair<FREQ_SEQ, GOBSTYPE>>> _obs_index;///< obs index
@@ -377,6 +513,18 @@ namespace great
 
         t_gtriple _extn_pos, _extn_rms; // external position and its rms
         bool _pos_constrain;
+
+        bool _slip_done = false;           ///< cycle slips already flagged for the whole span
+        bool _lli_shift = false;           ///< LLI moved one epoch back (backward pass over forward slips)
+        map<string, map<GOBS, int>> _lli_next; ///< LLI of the last epoch of the backward pass
+        map<string, map<GOBS, int>> _lli_next_base; ///< same for the base site
+        vector<t_gfbsol> *_fbs_sol = nullptr; ///< epoch solutions collected for the combination
+        t_gtriple _fbs_crd;                   ///< kinematic receiver crd (ARP) of the pass, the shared t_gobj is not written
+
+        double _ckp_intv = 0.0;            ///< checkpoint interval [s], 0 = only at the end
+        string _ckp_file;                  ///< ckp output (empty = no checkpoints)
+        string _ckp_restore;               ///< checkpoint to resume from
+        t_gtime _ckp_last = FIRST_TIME;    ///< epoch of the last checkpoint
     };
 }
 
@@ -0,0 +1,193 @@
+/**
+ * @file         grtpvt.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        real-time epoch-by-epoch driver for t_gpvtflt
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gproc/grtpvt.h"
+#include "gutils/gstring.h"
+
+namespace great
+{
+    t_grtpvt::t_grtpvt(t_gpvtflt *pvt, const string &site, const string &site_base, t_spdlog spdlog)
+        : _pvt(pvt),
+          _site(site),
+          _site_base(site_base),
+          _spdlog(spdlog),
+          _budget(RTPVT_BUDGET),
+          _max_queue(RTPVT_MAXQUEUE),
+          _report(RTPVT_REPORT),
+          _stop(false),
+          _last(FIRST_TIME),
+          _nproc(0),
+          _nfail(0),
+          _nskip(0),
+          _nover(0)
+    {
+    }
+
+    t_grtpvt::~t_grtpvt()
+    {
+    }
+
+    void t_grtpvt::push(const string &site, const t_gtime &epo)
+    {
+        int bit = 0;
+        if (site == _site)
+            bit = 1;
+        else if (!_site_base.empty() && site == _site_base)
+            bit = 2;
+        if (bit == 0)
+            return;
+
+        int need = _site_base.empty() ? 1 : 3;
+        t_clock::time_point now = t_clock::now();
+
+        unique_lock<mutex> lck(_mtx);
+
+        t_rtpending &pend = _pending[epo];
+        pend.mask |= bit;
+        pend.decoded = now;
+        if (pend.mask != need)
+        {
+            // rover or base never completed
+            while ((int)_pending.size() > 5 * _max_queue)
+            {
+                _pending.erase(_pending.begin());
+                _nskip++;
+            }
+            return;
+        }
+
+        // older incomplete epochs will not be completed any more
+        auto itEND = _pending.upper_bound(epo);
+        for (auto it = _pending.begin(); it != itEND; ++it)
+            if (it->second.mask != need)
+                _nskip++;
+        _pending.erase(_pending.begin(), itEND);
+
+        _queue.push_back({epo, now});
+        while ((int)_queue.size() > _max_queue)
+        {
+            _queue.pop_front();
+            _nskip++;
+        }
+
+        lck.unlock();
+        _cv.notify_one();
+    }
+
+    int t_grtpvt::run(const t_gtime &beg, const t_gtime &end)
+    {
+        if (_init(beg, end) < 0)
+            return -1;
+
+        if (_spdlog)
+            SPDLOG_LOGGER_INFO(_spdlog, _site_base + _site + ": Start real-time processing, latency budget " + format("%.1f", _budget) + " ms");
+
+        while (true)
+        {
+            t_rtepoch item;
+            {
+                unique_lock<mutex> lck(_mtx);
+                _cv.wait_for(lck, chrono::milliseconds(500), [this] { return _stop || !_queue.empty(); });
+                if (_stop)
+                    break;
+                if (_queue.empty())
+                    continue;
+
+                // behind real time: skip epochs already out of budget, keep the newest
+                t_clock::time_point now = t_clock::now();
+                while (_queue.size() > 1 && _elapsed(_queue.front().decoded, now) > _budget)
+                {
+                    _queue.pop_front();
+                    _nskip++;
+                }
+
+                item = _queue.front();
+                _queue.pop_front();
+            }
+
+            if (item.epoch > end)
+                break;
+            if (item.epoch < beg || (_last != FIRST_TIME && item.epoch <= _last))
+            {
+                _nskip++;
+                continue;
+            }
+
+            t_clock::time_point start = t_clock::now();
+            int irc = _process(item.epoch);
+            t_clock::time_point done = t_clock::now();
+
+            double total = _elapsed(item.decoded, done);
+            _lat_wait.add(_elapsed(item.decoded, start));
+            _lat_proc.add(_elapsed(start, done));
+            _lat_total.add(total);
+
+            if (total > _budget)
+            {
+                _nover++;
+                if (_spdlog)
+                    SPDLOG_LOGGER_DEBUG(_spdlog, _site + item.epoch.str_ymdhms(" latency budget exceeded: ") + format(" %.1f ms", total));
+            }
+
+            if (irc < 0)
+                _nfail++;
+            else
+                _nproc++;
+            _last = item.epoch;
+
+            if (_report > 0 && (_nproc + _nfail) % _report == 0)
+                if (_spdlog)
+                    SPDLOG_LOGGER_INFO(_spdlog, report_str());
+        }
+
+        if (_spdlog)
+            SPDLOG_LOGGER_INFO(_spdlog, report_str());
+
+        return (int)_nproc;
+    }
+
+    void t_grtpvt::stop()
+    {
+        {
+            lock_guard<mutex> lck(_mtx);
+            _stop = true;
+        }
+        _cv.notify_all();
+    }
+
+    string t_grtpvt::report_str() const
+    {
+        return _site_base + _site + format(": epochs %ld (failed %ld, skipped %ld, over budget %ld)",
+                                            _nproc.load(), _nfail.load(), _nskip.load(), _nover.load()) +
+               "\n    decode->solution " + _lat_total.summary() +
+               "\n    queue wait       " + _lat_wait.summary() +
+               "\n    processing       " + _lat_proc.summary();
+    }
+
+    int t_grtpvt::_init(const t_gtime &beg, const t_gtime &end)
+    {
+        if (!_pvt)
+            return -1;
+
+        _pvt->InitProc(beg, end);
+        return 1;
+    }
+
+    int t_grtpvt::_process(const t_gtime &epo)
+    {
+        return _pvt->ProcessRealtimeEpoch(epo);
+    }
+
+    double t_grtpvt::_elapsed(const t_clock::time_point &from, const t_clock::time_point &to)
+    {
+        return chrono::duration<double, milli>(to - from).count();
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * @file         grtpvt.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        real-time epoch-by-epoch driver for t_gpvtflt
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   decoder thread(s)                       driver thread
+ *   -----------------                       -------------
+ *   epoch completed in t_gallobs ---push()--> queue --> ProcessRealtimeEpoch()
+ *
+ *   An epoch is queued when the rover (and base, for RTK) observations are complete.
+ *   If the solution falls behind, queued epochs whose latency already exceeds the
+ *   budget are skipped in favour of the newest one, so that the latency stays bounded.
+ *   Latencies are measured from push() (decoding finished) to the solution.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GRTPVT_H
+#define GRTPVT_H
+
+#include <string>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+
+#include "gexport/ExportLibGREAT.h"
+#include "gproc/gpvtflt.h"
+#include "gutils/glatency.h"
+
+using namespace std;
+using namespace gnut;
+
+#define RTPVT_BUDGET 50.0     ///< default latency budget [ms]
+#define RTPVT_MAXQUEUE 20     ///< default maximum number of queued epochs
+#define RTPVT_REPORT 600      ///< default latency report interval [epochs]
+
+namespace great
+{
+    /**
+    * @brief class for real-time processing of t_gpvtflt driven by decoded epochs
+    */
+    class LibGREAT_LIBRARY_EXPORT t_grtpvt
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] pvt          filter (not owned)
+        * @param[in] site         rover site
+        * @param[in] site_base    base site (empty for PPP)
+        * @param[in] spdlog       logger
+        */
+        t_grtpvt(t_gpvtflt *pvt, const string &site, const string &site_base, t_spdlog spdlog);
+
+        /** @brief default destructor. */
+        virtual ~t_grtpvt();
+
+        /** @brief set latency budget [ms], <process><latency_budget> in GREAT_PVT. */
+        void budget(double ms) { _budget = ms; }
+        double budget() const { return _budget; }
+
+        /** @brief set maximum number of queued epochs. */
+        void max_queue(int n) { _max_queue = (n > 0 ? n : 1); }
+
+        /** @brief set interval of latency reports [epochs] (0 = only at the end). */
+        void report(int n) { _report = n; }
+
+        /**
+        * @brief notify completed epoch of a site (thread-safe, called from decoder)
+        * @param[in] site    site name
+        * @param[in] epo     epoch completed in t_gallobs
+        */
+        void push(const string &site, const t_gtime &epo);
+
+        /**
+        * @brief process queued epochs until stop() or an epoch after end
+        * @param[in] beg    begin time
+        * @param[in] end    end time
+        * @return number of processed epochs, -1 if not initialized
+        */
+        virtual int run(const t_gtime &beg, const t_gtime &end);
+
+        /** @brief request stop of run(). */
+        void stop();
+
+        /** @brief latency histograms: decode -> start, processing, decode -> solution. */
+        const t_glatency &latency_wait() const { return _lat_wait; }
+        const t_glatency &latency_proc() const { return _lat_proc; }
+        const t_glatency &latency_total() const { return _lat_total; }
+
+        /** @brief epoch counters. */
+        long nproc() const { return _nproc; }
+        long nfail() const { return _nfail; }
+        long nskip() const { return _nskip; }
+        long nover() const { return _nover; }
+
+        /** @brief latency report for logging. */
+        string report_str() const;
+
+    protected:
+        typedef chrono::steady_clock t_clock;
+
+        /** @brief queued epoch with time of completion. */
+        struct t_rtepoch
+        {
+            t_gtime epoch;
+            t_clock::time_point decoded;
+        };
+
+        /** @brief rover/base completion of pending epoch. */
+        struct t_rtpending
+        {
+            int mask = 0;
+            t_clock::time_point decoded;
+        };
+
+        /** @brief initialize the filter for the processing period, <0 if not possible. */
+        virtual int _init(const t_gtime &beg, const t_gtime &end);
+
+        /** @brief process one epoch, <0 without solution. */
+        virtual int _process(const t_gtime &epo);
+
+        /** @brief elapsed time [ms]. */
+        static double _elapsed(const t_clock::time_point &from, const t_clock::time_point &to);
+
+        t_gpvtflt *_pvt;                        ///< filter
+        string _site;                           ///< rover
+        string _site_base;                      ///< base
+        t_spdlog _spdlog;                       ///< logger
+
+        double _budget;                         ///< latency budget [ms]
+        int _max_queue;                         ///< maximum queued epochs
+        int _report;                            ///< report interval [epochs]
+
+        mutex _mtx;                             ///< queue mutex
+        condition_variable _cv;                 ///< queue notification
+        deque<t_rtepoch> _queue;                ///< completed epochs
+        map<t_gtime, t_rtpending> _pending;     ///< epochs waiting for rover/base
+        bool _stop;                             ///< stop request
+
+        t_gtime _last;                          ///< last processed epoch
+        t_glatency _lat_wait;                   ///< decode -> start of processing
+        t_glatency _lat_proc;                   ///< processing
+        t_glatency _lat_total;                  ///< decode -> solution
+        atomic<long> _nproc;                    ///< processed epochs
+        atomic<long> _nfail;                    ///< epochs without solution
+        atomic<long> _nskip;                    ///< skipped (late/incomplete) epochs
+        atomic<long> _nover;                    ///< solutions exceeding the budget
+    };
+}
+
+#endif
@@ -67,6 +67,8 @@ t_gcfg_ppp::t_gcfg_ppp()
   _OFMT_supported.insert(PPP_OUT);
   _OFMT_supported.insert(FLT_OUT);
   _OFMT_supported.insert(KML_OUT);
+  _OFMT_supported.insert(PROF_OUT);
+  _OFMT_supported.insert(RATIO_OUT);
 }
 
 
@@ -10,6 +10,7 @@
  */
 #include "gset/gsetamb.h"
 #include <sstream>
+#include <algorithm>
 
 using namespace std;
 using namespace pugi;
@@ -41,6 +42,8 @@ namespace great
              << "<upd_mode> upd </upd_mode>\n"
              << "<fix_mode> SEARCH/NO </fix_mode>\n"
              << "<ratio> 3.0 </ratio>\n"
+             << "<lambda_mode> LAMBDA/MLAMBDA </lambda_mode>\n"
+             << "<lambda_ncan> 2 </lambda_ncan>\n"
              << "<all_baselines> NO </all_baselines>\n"
              << "<min_common_time> 30 </min_common_time>\n"
              << "<widelane_decision     maxdev = \"0.15\" maxsig = \"0.10\" alpha = \"1000\"/>\n"
@@ -109,7 +112,10 @@ namespace great
             {"EWL", "extra_widelane_decision"}, {"WL", "widelane_decision"}, {"NL", "narrowlane_decision"}};
         map<string, double> amb_decision;
         if (_default_decision.find(type) == _default_decision.end())
+        {
+            _gmutex.unlock();
             return amb_decision;
+        }
         amb_decision = _default_decision[type];
         for (auto iter = amb_decision.begin(); iter != amb_decision.end(); ++iter)
         {
@@ -164,6 +170,32 @@ namespace great
         return str2int(tmp);
     }
 
+    LAMBDA_MODE t_gsetamb::lambda_mode()
+    {
+        _gmutex.lock();
+
+        string tmp = trim(_doc.child(XMLKEY_ROOT).child(XMLKEY_AMBIGUITY).child_value("lambda_mode"));
+
+        _gmutex.unlock();
+        if (tmp == "MLAMBDA" || tmp == "mlambda")
+            return LAMBDA_MODE::MLAMBDA;
+        if (!tmp.empty() && tmp != "LAMBDA" && tmp != "lambda")
+            spdlog::warn("warning: not defined lambda mode[" + tmp + "], LAMBDA used");
+        return LAMBDA_MODE::LAMBDA;
+    }
+
+    int t_gsetamb::lambda_ncan()
+    {
+        _gmutex.lock();
+
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_AMBIGUITY).child_value("lambda_ncan");
+
+        _gmutex.unlock();
+        if (tmp.empty())
+            return 2;
+        return max(str2int(tmp), 2);
+    }
+
     FIX_MODE t_gsetamb::str2fixmode(string str)
     {
         if (str == "NO")
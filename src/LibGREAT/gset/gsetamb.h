@@ -59,6 +59,13 @@ namespace great
         UPD    ///< wl upd + nl upd.
     };
 
+    /** @brief enum of integer search method. */
+    enum class LAMBDA_MODE
+    {
+        LAMBDA, ///< classic LAMBDA.
+        MLAMBDA ///< modified LAMBDA (faster for many ambiguities).
+    };
+
     /**
     * @brief        class for set ambiguity fixed xml
     */
@@ -160,6 +167,18 @@ namespace great
         */
         int full_fix_num();
 
+        /**
+        * @brief  get integer search method.
+        * @return    LAMBDA_MODE    search method (default LAMBDA)
+        */
+        LAMBDA_MODE lambda_mode();
+
+        /**
+        * @brief  get number of candidates of the integer search.
+        * @return    int    number of candidates (default 2)
+        */
+        int lambda_ncan();
+
     protected:
         map<string, map<string, double>> _default_decision = {
             {"EWL", {{"maxdev", 0.07}, {"maxsig", 0.10}, {"alpha", 1000}}},
@@ -10,6 +10,8 @@
  */
 
 #include "gset/gsetign.h"
+#include <thread>
+#include <algorithm>
 
 using namespace Eigen;
 
@@ -843,6 +845,19 @@ IGN_TYPE great::t_gsetign::ign_type()
     return great::str2ign(x);
 }
 
+FLT_TYPE great::t_gsetign::fltmode()
+{
+    _gmutex.lock();
+    string x = _doc.child(XMLKEY_ROOT).child(XMLKEY_IGN).attribute("filtermode").value();
+    _gmutex.unlock();
+    transform(x.begin(), x.end(), x.begin(), ::toupper);
+    if (x == "FORWARD" || x == "0") return FORWARD;
+    if (x == "BACKWARD" || x == "1") return BACKWARD;
+    if (x == "FBS" || x == "2") return FBS;
+    if (x == "RTS" || x == "3") return RTS;
+    return _fltmode;
+}
+
 map<double, int> great::t_gsetign::sim_gnss_outages()
 {
     map<double, int> outages;
@@ -860,6 +875,16 @@ map<double, int> great::t_gsetign::sim_gnss_outages()
     return outages;
 }
 
+int great::t_gsetign::sim_outage_threads()
+{
+    _gmutex.lock();
+    int n = _doc.child(XMLKEY_ROOT).child(XMLKEY_IGN).child("GNSS").child("SimOutages").attribute("threads").as_int(0);
+    _gmutex.unlock();
+    if (n <= 0)
+        n = max(1, static_cast<int>(thread::hardware_concurrency()));
+    return n;
+}
+
 IMU_TYPE great::t_gsetign::imu_type()
 {
     _gmutex.lock();
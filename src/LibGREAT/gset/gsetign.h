@@ -419,9 +419,28 @@ namespace great
         */
         IGN_TYPE ign_type();
 
+        /**
+        * @brief    get filter mode, attribute "filtermode" of the integration node.
+        * @return    FLT_TYPE     FORWARD, BACKWARD, FBS or RTS (name or number)
+        * @note     in the integration (t_gintegration) FBS is the RTS solution (the two-filter
+        *           combination of the linear error-state model) and BACKWARD the backward filter
+        *           solution derived from it; both are written to the "smt" output
+        */
+        FLT_TYPE fltmode();
 
+
+        /**
+        * @brief    simulated GNSS outages, attributes "beg" (sow) and "length" (s) of GNSS/SimOutages.
+        * @return    map<double, int>     begin and length of every outage
+        */
         map<double, int> sim_gnss_outages();
 
+        /**
+        * @brief    threads evaluating the simulated outages, attribute "threads" of GNSS/SimOutages.
+        * @return    int     number of threads (default: hardware concurrency)
+        */
+        int sim_outage_threads();
+
         /**
          * @brief
          *
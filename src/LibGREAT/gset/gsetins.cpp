@@ -152,6 +152,7 @@ void great::t_gsetins::help()
         << "   ts=\"" << _ts << "\" \n"
         << "   gyro_unit=\"" << _GyroUnit << "\" \n"
         << "   acce_unit=\"" << _AcceUnit << "\" \n"
+        << "   <DataFormat><Stream Capacity=\"0\" /></DataFormat>  (buffered samples when streaming, 0 = preload, single site only) \n"
 
         << "  />\n";
 
@@ -180,6 +181,16 @@ int great::t_gsetins::resampled_freq()
     return res;
 }
 
+int great::t_gsetins::stream_capacity()
+{
+    _gmutex.lock();
+
+    int res = _doc.child(XMLKEY_ROOT).child(XMLKEY_INS).child("DataFormat").child("Stream").attribute("Capacity").as_int();
+
+    _gmutex.unlock();
+    return res < 0 ? 0 : res;
+}
+
 great::UNIT_TYPE great::t_gsetins::GyroUnit()
 {
     _gmutex.lock();
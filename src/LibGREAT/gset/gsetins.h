@@ -60,6 +60,15 @@ namespace great
         * @return    int
         */
         int resampled_freq();
+
+        /**
+        * @brief    get capacity of the streaming IMU/ODO buffer.
+        * @note     0 = preload the whole files before processing
+        * @note     streaming applies to single-site processing, several sites preload the files
+        * @return    int    maximum number of buffered samples
+        */
+        int stream_capacity();
+
         /**
         * @brief    get    unit of gyro.
         * @return    UNIT_TYPE    unit of gyro
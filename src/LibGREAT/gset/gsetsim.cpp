@@ -0,0 +1,198 @@
+/**
+ * @file         gsetsim.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        control set from XML for the GNSS/IMU data simulation
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gset/gsetsim.h"
+
+great::t_gsetsim::t_gsetsim() : t_gsetbase()
+{
+    _set.insert(XMLKEY_SIM);
+}
+
+great::t_gsetsim::~t_gsetsim()
+{
+}
+
+void great::t_gsetsim::check()
+{
+    _gmutex.lock();
+    xml_node parent = _doc.child(XMLKEY_ROOT);
+    xml_node node = _default_node(parent, XMLKEY_SIM);
+
+    _default_attr(node, "threads", 0);
+    _default_attr(node, "seed", 1);
+    _default_attr(node, "block", 3600.0);
+
+    xml_node sta = _default_node(node, "stations");
+    _default_attr(sta, "count", 0);
+
+    xml_node gnss = _default_node(node, "gnss");
+    _default_attr(gnss, "code_noise", 0.3);
+    _default_attr(gnss, "phase_noise", 0.003);
+    _default_attr(gnss, "elev_mask", 7.0);
+    _default_attr(gnss, "vtec", 20.0);
+    _default_attr(gnss, "ztd_rw", 0.005);
+    _default_attr(gnss, "clk_offset", 1e-4);
+    _default_attr(gnss, "clk_rw", 1e-10);
+
+    xml_node imu = _default_node(node, "imu");
+    _default_attr(imu, "freq", 200);
+    _default_attr(imu, "gyro_noise", 0.005);
+    _default_attr(imu, "acce_noise", 0.03);
+    _default_attr(imu, "gyro_bias", 0.5);
+    _default_attr(imu, "acce_bias", 0.1);
+
+    xml_node traj = _default_node(node, "trajectory");
+    _default_attr(traj, "count", 0);
+    _default_attr(traj, "speed", 10.0);
+    _default_attr(traj, "static", 300.0);
+    _default_attr(traj, "turn", 120.0);
+
+    _gmutex.unlock();
+}
+
+void great::t_gsetsim::help()
+{
+    _gmutex.lock();
+    cerr << " <sim threads=\"0\" seed=\"1\" block=\"3600\" >\n"
+         << "   <stations count=\"0\" antenna=\"\" />  \t <!-- generated stations, in addition to gen/rec -->\n"
+         << "   <gnss code_noise=\"0.3\" phase_noise=\"0.003\" elev_mask=\"7\" vtec=\"20\" ztd_rw=\"0.005\" clk_offset=\"1e-4\" clk_rw=\"1e-10\" />\n"
+         << "   <imu freq=\"200\" gyro_noise=\"0.005\" acce_noise=\"0.03\" gyro_bias=\"0.5\" acce_bias=\"0.1\" /> \t <!-- deg/sqrt(h), m/s/sqrt(h), deg/h, mg -->\n"
+         << "   <trajectory count=\"0\" speed=\"10\" static=\"300\" turn=\"120\" /> \t <!-- vehicles: m/s, s, s -->\n"
+         << " </sim>\n";
+    _gmutex.unlock();
+}
+
+double great::t_gsetsim::_value(const char *child, const char *attr, double def)
+{
+    _gmutex.lock();
+    xml_attribute a = _doc.child(XMLKEY_ROOT).child(XMLKEY_SIM).child(child).attribute(attr);
+    double res = a ? a.as_double() : def;
+    _gmutex.unlock();
+    return res;
+}
+
+int great::t_gsetsim::threads()
+{
+    _gmutex.lock();
+    int res = _doc.child(XMLKEY_ROOT).child(XMLKEY_SIM).attribute("threads").as_int();
+    _gmutex.unlock();
+    return res < 0 ? 0 : res;
+}
+
+unsigned int great::t_gsetsim::seed()
+{
+    _gmutex.lock();
+    unsigned int res = _doc.child(XMLKEY_ROOT).child(XMLKEY_SIM).attribute("seed").as_uint(1);
+    _gmutex.unlock();
+    return res;
+}
+
+double great::t_gsetsim::block()
+{
+    _gmutex.lock();
+    double res = _doc.child(XMLKEY_ROOT).child(XMLKEY_SIM).attribute("block").as_double(3600.0);
+    _gmutex.unlock();
+    return res > 0.0 ? res : 3600.0;
+}
+
+int great::t_gsetsim::nsta()
+{
+    return int(_value("stations", "count", 0));
+}
+
+string great::t_gsetsim::antenna()
+{
+    _gmutex.lock();
+    string res = _doc.child(XMLKEY_ROOT).child(XMLKEY_SIM).child("stations").attribute("antenna").value();
+    _gmutex.unlock();
+    return res;
+}
+
+double great::t_gsetsim::code_noise()
+{
+    return _value("gnss", "code_noise", 0.3);
+}
+
+double great::t_gsetsim::phase_noise()
+{
+    return _value("gnss", "phase_noise", 0.003);
+}
+
+double great::t_gsetsim::elev_mask()
+{
+    return _value("gnss", "elev_mask", 7.0);
+}
+
+double great::t_gsetsim::vtec()
+{
+    return _value("gnss", "vtec", 20.0);
+}
+
+double great::t_gsetsim::ztd_rw()
+{
+    return _value("gnss", "ztd_rw", 0.005);
+}
+
+double great::t_gsetsim::clk_offset()
+{
+    return _value("gnss", "clk_offset", 1e-4);
+}
+
+double great::t_gsetsim::clk_rw()
+{
+    return _value("gnss", "clk_rw", 1e-10);
+}
+
+int great::t_gsetsim::imu_freq()
+{
+    int res = int(_value("imu", "freq", 200));
+    return res > 0 ? res : 200;
+}
+
+double great::t_gsetsim::gyro_noise()
+{
+    return _value("imu", "gyro_noise", 0.005);
+}
+
+double great::t_gsetsim::acce_noise()
+{
+    return _value("imu", "acce_noise", 0.03);
+}
+
+double great::t_gsetsim::gyro_bias()
+{
+    return _value("imu", "gyro_bias", 0.5);
+}
+
+double great::t_gsetsim::acce_bias()
+{
+    return _value("imu", "acce_bias", 0.1);
+}
+
+int great::t_gsetsim::ntraj()
+{
+    return int(_value("trajectory", "count", 0));
+}
+
+double great::t_gsetsim::speed()
+{
+    return _value("trajectory", "speed", 10.0);
+}
+
+double great::t_gsetsim::static_time()
+{
+    return _value("trajectory", "static", 300.0);
+}
+
+double great::t_gsetsim::turn_period()
+{
+    return _value("trajectory", "turn", 120.0);
+}
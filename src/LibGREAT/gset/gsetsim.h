@@ -0,0 +1,109 @@
+/**
+ * @file         gsetsim.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        control set from XML for the GNSS/IMU data simulation
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   <sim threads="0" seed="1" block="3600">
+ *     <stations count="0" antenna="" />
+ *     <gnss code_noise="0.3" phase_noise="0.003" elev_mask="7" vtec="20"
+ *           ztd_rw="0.005" clk_offset="1e-4" clk_rw="1e-10" />
+ *     <imu freq="200" gyro_noise="0.005" acce_noise="0.03" gyro_bias="0.5" acce_bias="0.1" />
+ *     <trajectory count="0" speed="10" static="300" turn="120" />
+ *   </sim>
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GSETSIM_H
+#define GSETSIM_H
+
+#define XMLKEY_SIM "sim"
+
+#include "gexport/ExportLibGREAT.h"
+#include "gset/gsetbase.h"
+
+using namespace gnut;
+
+namespace great
+{
+    /**
+    * @class t_gsetsim
+    * @brief simulation configure
+    */
+    class LibGREAT_LIBRARY_EXPORT t_gsetsim : public virtual t_gsetbase
+    {
+    public:
+        /** @brief default constructor. */
+        t_gsetsim();
+
+        /** @brief default destructor. */
+        virtual ~t_gsetsim();
+
+        /** @brief settings check. */
+        void check();
+
+        /** @brief settings help. */
+        void help();
+
+        /** @brief worker threads, 0 = hardware concurrency. */
+        int threads();
+
+        /** @brief random seed, the same seed gives the same data. */
+        unsigned int seed();
+
+        /** @brief time span [s] simulated at once for all receivers. */
+        double block();
+
+        /** @brief number of generated static stations (in addition to the receivers in gen). */
+        int nsta();
+
+        /** @brief antenna of the generated stations and trajectories, empty = no PCO/PCV. */
+        string antenna();
+
+        /** @brief code and phase noise at zenith [m], grows with 1/sin(elevation). */
+        double code_noise();
+        double phase_noise();
+
+        /** @brief elevation mask [deg]. */
+        double elev_mask();
+
+        /** @brief daytime vertical TEC maximum [TECU], 0 = no ionosphere. */
+        double vtec();
+
+        /** @brief random walk of the zenith wet delay [m/sqrt(h)]. */
+        double ztd_rw();
+
+        /** @brief receiver clock offset bound [s] and random walk [s/sqrt(s)]. */
+        double clk_offset();
+        double clk_rw();
+
+        /** @brief IMU sampling rate [Hz]. */
+        int imu_freq();
+
+        /** @brief angle random walk [deg/sqrt(h)] and velocity random walk [m/s/sqrt(h)]. */
+        double gyro_noise();
+        double acce_noise();
+
+        /** @brief constant gyro [deg/h] and accelerometer [mg] bias sigma. */
+        double gyro_bias();
+        double acce_bias();
+
+        /** @brief number of vehicle trajectories. */
+        int ntraj();
+
+        /** @brief vehicle speed [m/s], static time at start [s] and period of the S-turns [s]. */
+        double speed();
+        double static_time();
+        double turn_period();
+
+    protected:
+        /** @brief attribute of a sim child node, def if missing. */
+        double _value(const char *child, const char *attr, double def);
+    };
+}
+
+#endif
@@ -0,0 +1,417 @@
+/**
+ * @file         gcheckpoint.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        binary checkpoint file of the filter state
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#if defined _WIN32 || defined _WIN64
+#include <windows.h>
+#endif
+#include "gutils/gcheckpoint.h"
+
+namespace great
+{
+    static const char CKP_MAGIC[8] = {'G', 'R', 'E', 'A', 'T', 'C', 'K', 'P'};
+
+    t_gcheckpoint::t_gcheckpoint()
+        : _writing(false),
+          _good(false)
+    {
+    }
+
+    t_gcheckpoint::~t_gcheckpoint()
+    {
+        if (_out.is_open())
+        {
+            _out.close();
+            remove((_file + ".tmp").c_str());
+        }
+        if (_in.is_open())
+            _in.close();
+    }
+
+    bool t_gcheckpoint::open_write(const string &file, const string &kind)
+    {
+        _file = file;
+        _writing = true;
+        _out.open((file + ".tmp").c_str(), ios::out | ios::binary | ios::trunc);
+        _good = _out.is_open();
+        _write(CKP_MAGIC, sizeof(CKP_MAGIC));
+        put(static_cast<int>(CKP_VERSION));
+        put(kind);
+        return _good;
+    }
+
+    bool t_gcheckpoint::open_read(const string &file, const string &kind)
+    {
+        _file = file;
+        _writing = false;
+        _in.open(file.c_str(), ios::in | ios::binary);
+        _good = _in.is_open();
+
+        char magic[sizeof(CKP_MAGIC)] = {0};
+        int version = 0;
+        string tmp;
+        _read(magic, sizeof(magic));
+        get(version);
+        get(tmp);
+        if (!equal(magic, magic + sizeof(magic), CKP_MAGIC) || version != CKP_VERSION || tmp != kind)
+            _good = false;
+        return _good;
+    }
+
+    bool t_gcheckpoint::close()
+    {
+        if (_writing)
+        {
+            if (!_out.is_open())
+                return false;
+            _out.close();
+            _good = _good && !_out.fail();
+            string tmp = _file + ".tmp";
+            // replaced atomically, the previous checkpoint survives a crash
+            if (_good)
+            {
+#if defined _WIN32 || defined _WIN64
+                _good = (MoveFileExA(tmp.c_str(), _file.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+#else
+                _good = (rename(tmp.c_str(), _file.c_str()) == 0);
+#endif
+            }
+            if (!_good)
+                remove(tmp.c_str());
+        }
+        else if (_in.is_open())
+        {
+            _in.close();
+        }
+        return _good;
+    }
+
+    void t_gcheckpoint::section(const string &name)
+    {
+        if (_writing)
+        {
+            put(name);
+            return;
+        }
+        string tmp;
+        get(tmp);
+        if (tmp != name)
+            _good = false;
+    }
+
+    void t_gcheckpoint::put(const string &v)
+    {
+        put(static_cast<long>(v.size()));
+        _write(v.data(), v.size());
+    }
+
+    void t_gcheckpoint::get(string &v)
+    {
+        long n = 0;
+        get(n);
+        if (!_good || n < 0 || n > (1L << 24))
+        {
+            _good = false;
+            return;
+        }
+        v.resize(n);
+        if (n > 0)
+            _read(&v[0], n);
+    }
+
+    void t_gcheckpoint::put(const t_gtime &v)
+    {
+        put(v.tsys());
+        put(v.mjd(false));
+        put(v.sod(false));
+        put(v.dsec(false));
+    }
+
+    void t_gcheckpoint::get(t_gtime &v)
+    {
+        t_gtime::t_tsys ts = t_gtime::GPS;
+        int mjd = 0, sod = 0;
+        double dsec = 0.0;
+        get(ts);
+        get(mjd);
+        get(sod);
+        get(dsec);
+        v = t_gtime(ts);
+        v.from_mjd(mjd, sod, dsec, false);
+    }
+
+    void t_gcheckpoint::put(const t_gtriple &v)
+    {
+        for (size_t i = 0; i < 3; i++)
+            put(v[i]);
+    }
+
+    void t_gcheckpoint::get(t_gtriple &v)
+    {
+        for (size_t i = 0; i < 3; i++)
+            get(v[i]);
+    }
+
+    void t_gcheckpoint::put(const t_gquat &v)
+    {
+        put(v.q0);
+        put(v.q1);
+        put(v.q2);
+        put(v.q3);
+    }
+
+    void t_gcheckpoint::get(t_gquat &v)
+    {
+        get(v.q0);
+        get(v.q1);
+        get(v.q2);
+        get(v.q3);
+    }
+
+    void t_gcheckpoint::put(const GeneralMatrix &v)
+    {
+        put(v.Nrows());
+        put(v.Ncols());
+        put(v.Storage());
+        if (v.Storage() > 0)
+            _write(v.data(), sizeof(Real) * v.Storage());
+    }
+
+    void t_gcheckpoint::_get_store(GeneralMatrix &v, int nrows, int ncols)
+    {
+        int storage = 0;
+        get(storage);
+        if (!_good || v.Nrows() != nrows || v.Ncols() != ncols || v.Storage() != storage)
+        {
+            _good = false;
+            return;
+        }
+        if (storage > 0)
+            _read(v.data(), sizeof(Real) * storage);
+    }
+
+    void t_gcheckpoint::get(Matrix &v)
+    {
+        int r = 0, c = 0;
+        get(r);
+        get(c);
+        if (!_good || r < 0 || c < 0)
+        {
+            _good = false;
+            return;
+        }
+        v.ReSize(r, c);
+        _get_store(v, r, c);
+    }
+
+    void t_gcheckpoint::get(SymmetricMatrix &v)
+    {
+        int r = 0, c = 0;
+        get(r);
+        get(c);
+        if (!_good || r < 0 || r != c)
+        {
+            _good = false;
+            return;
+        }
+        v.ReSize(r);
+        _get_store(v, r, c);
+    }
+
+    void t_gcheckpoint::get(ColumnVector &v)
+    {
+        int r = 0, c = 0;
+        get(r);
+        get(c);
+        if (!_good || r < 0 || c != 1)
+        {
+            _good = false;
+            return;
+        }
+        v.ReSize(r);
+        _get_store(v, r, c);
+    }
+
+    void t_gcheckpoint::get(DiagonalMatrix &v)
+    {
+        int r = 0, c = 0;
+        get(r);
+        get(c);
+        if (!_good || r < 0 || r != c)
+        {
+            _good = false;
+            return;
+        }
+        v.ReSize(r);
+        _get_store(v, r, c);
+    }
+
+    void t_gcheckpoint::put(const t_gpar &v)
+    {
+        put(v.parType);
+        put(v.index);
+        put(v.prn);
+        put(v.site);
+        put(v.beg);
+        put(v.end);
+        put(v.stime);
+        put(v.aprval);
+        put(v.pred);
+        put(v.zhd);
+        put(v.zwd);
+        put(v.amb_ini);
+        put(v.idx_pcv);
+        put(v.nazi);
+        put(v.nzen);
+        put(v.dzen);
+        put(v.dazi);
+        put(v.zen1);
+        put(v.zen2);
+        put(v.azi1);
+        put(v.azi2);
+        put(v.fq);
+        put(v.value());
+        put(v.apriori());
+        put(v.mf_ztd());
+        put(v.mf_grd());
+    }
+
+    void t_gcheckpoint::get(t_gpar &v)
+    {
+        double value = 0.0, apriori = 0.0;
+        ZTDMPFUNC mf_ztd;
+        GRDMPFUNC mf_grd;
+        get(v.parType);
+        get(v.index);
+        get(v.prn);
+        get(v.site);
+        get(v.beg);
+        get(v.end);
+        get(v.stime);
+        get(v.aprval);
+        get(v.pred);
+        get(v.zhd);
+        get(v.zwd);
+        get(v.amb_ini);
+        get(v.idx_pcv);
+        get(v.nazi);
+        get(v.nzen);
+        get(v.dzen);
+        get(v.dazi);
+        get(v.zen1);
+        get(v.zen2);
+        get(v.azi1);
+        get(v.azi2);
+        get(v.fq);
+        get(value);
+        get(apriori);
+        get(mf_ztd);
+        get(mf_grd);
+        v.value(value);
+        v.apriori(apriori);
+        v.setMF(mf_ztd);
+        v.setMF(mf_grd);
+    }
+
+    void t_gcheckpoint::put(const t_gobsgnss &v)
+    {
+        vector<GOBS> obs = v.obs();
+        put(v.site());
+        put(v.sat());
+        put(v.epoch());
+        put(v.channel());
+        put(v.getele());
+        put(static_cast<long>(obs.size()));
+        for (const auto &o : obs)
+        {
+            put(o);
+            put(v.getobs(o));
+        }
+        put(v.lli());
+    }
+
+    void t_gcheckpoint::get(t_gobsgnss &v)
+    {
+        string site, sat;
+        t_gtime epoch;
+        int channel = 0;
+        double ele = 0.0;
+        long n = 0;
+        map<GOBS, int> lli;
+        get(site);
+        get(sat);
+        get(epoch);
+        get(channel);
+        get(ele);
+        get(n);
+        if (!_good || sat.empty())
+        {
+            _good = false;
+            return;
+        }
+        v = t_gobsgnss();
+        v.site(site);
+        v.sat(sat);
+        v.epo(epoch);
+        v.channel(channel);
+        v.addele(ele);
+        for (long i = 0; i < n && _good; i++)
+        {
+            GOBS o;
+            double d = 0.0;
+            get(o);
+            get(d);
+            v.addobs(o, d);
+        }
+        get(lli);
+        v.lli(lli);
+    }
+
+    void t_gcheckpoint::put(const t_gallpar &v)
+    {
+        put(v.getAllPar());
+    }
+
+    void t_gcheckpoint::get(t_gallpar &v)
+    {
+        vector<t_gpar> pars;
+        get(pars);
+        if (!_good)
+            return;
+        v.delAllParam();
+        for (const auto &par : pars)
+            v.addParam(par);
+    }
+
+    void t_gcheckpoint::_write(const void *p, size_t n)
+    {
+        if (!_good || !_writing)
+        {
+            _good = false;
+            return;
+        }
+        _out.write(static_cast<const char *>(p), n);
+        if (_out.fail())
+            _good = false;
+    }
+
+    void t_gcheckpoint::_read(void *p, size_t n)
+    {
+        if (!_good || _writing)
+        {
+            _good = false;
+            return;
+        }
+        _in.read(static_cast<char *>(p), n);
+        if (_in.gcount() != static_cast<streamsize>(n))
+            _good = false;
+    }
+}
@@ -0,0 +1,243 @@
+/**
+ * @file         gcheckpoint.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        binary checkpoint file of the filter state
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   file     "GREATCKP", version, kind (e.g. "pvtflt"), then named sections
+ *   section  name followed by its values, checked when reading, so a file of
+ *            another kind or version is rejected instead of misread
+ *
+ *   Values are written in the machine representation (same build, same
+ *   platform). A checkpoint is written to <file>.tmp and renamed on close(),
+ *   an interrupted write leaves the previous checkpoint intact.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GCHECKPOINT_H
+#define GCHECKPOINT_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <type_traits>
+#include <Eigen/Dense>
+#include "gexport/ExportLibGREAT.h"
+#include "gutils/gtime.h"
+#include "gutils/gtriple.h"
+#include "gall/gallpar.h"
+#include "gdata/gobsgnss.h"
+#include "newmat/newmat.h"
+#include "gins/gquat.h"
+
+using namespace std;
+using namespace gnut;
+
+#define CKP_VERSION 2 ///< checkpoint format version
+
+namespace great
+{
+    /**
+    * @brief checkpoint file, one object for writing or reading
+    */
+    class LibGREAT_LIBRARY_EXPORT t_gcheckpoint
+    {
+    public:
+        /** @brief default constructor. */
+        t_gcheckpoint();
+
+        /** @brief default destructor, an unclosed write is discarded. */
+        virtual ~t_gcheckpoint();
+
+        t_gcheckpoint(const t_gcheckpoint &) = delete;
+        t_gcheckpoint &operator=(const t_gcheckpoint &) = delete;
+
+        /**
+        * @brief start writing
+        * @param[in] file     checkpoint file
+        * @param[in] kind     state owner, checked by open_read
+        * @return false if the file could not be created
+        */
+        bool open_write(const string &file, const string &kind);
+
+        /**
+        * @brief start reading
+        * @param[in] file     checkpoint file
+        * @param[in] kind     expected state owner
+        * @return false if missing, of another kind or version
+        */
+        bool open_read(const string &file, const string &kind);
+
+        /**
+        * @brief finish, a complete write replaces the checkpoint file
+        * @return false if any value failed
+        */
+        bool close();
+
+        /** @brief no value failed so far. */
+        bool good() const { return _good; }
+
+        /** @brief mark the checkpoint as not usable (e.g. state of another configuration). */
+        void fail() { _good = false; }
+
+        /** @brief checkpoint file. */
+        const string &file() const { return _file; }
+
+        /** @brief write the section name, or check it when reading. */
+        void section(const string &name);
+
+        /** @brief arithmetic and enum values. */
+        template <class T>
+        typename enable_if<is_arithmetic<T>::value || is_enum<T>::value>::type put(const T &v)
+        {
+            _write(&v, sizeof(T));
+        }
+        template <class T>
+        typename enable_if<is_arithmetic<T>::value || is_enum<T>::value>::type get(T &v)
+        {
+            _read(&v, sizeof(T));
+        }
+
+        void put(const string &v);
+        void get(string &v);
+        void put(const t_gtime &v);
+        void get(t_gtime &v);
+        void put(const t_gtriple &v);
+        void get(t_gtriple &v);
+        void put(const t_gquat &v);
+        void get(t_gquat &v);
+        void put(const GeneralMatrix &v);
+        void get(Matrix &v);
+        void get(SymmetricMatrix &v);
+        void get(ColumnVector &v);
+        void get(DiagonalMatrix &v);
+        void put(const t_gpar &v);
+        void get(t_gpar &v);
+        void put(const t_gallpar &v);
+        void get(t_gallpar &v);
+        void put(const t_gobsgnss &v);
+        void get(t_gobsgnss &v);
+
+        /** @brief Eigen dense matrices and vectors. */
+        template <class S, int R, int C, int O, int MR, int MC>
+        void put(const Eigen::Matrix<S, R, C, O, MR, MC> &v)
+        {
+            put(static_cast<long>(v.rows()));
+            put(static_cast<long>(v.cols()));
+            _write(v.data(), sizeof(S) * v.size());
+        }
+        template <class S, int R, int C, int O, int MR, int MC>
+        void get(Eigen::Matrix<S, R, C, O, MR, MC> &v)
+        {
+            long r = 0, c = 0;
+            get(r);
+            get(c);
+            if (!_good || r < 0 || c < 0 || (R != Eigen::Dynamic && r != R) || (C != Eigen::Dynamic && c != C))
+            {
+                _good = false;
+                return;
+            }
+            v.resize(r, c);
+            _read(v.data(), sizeof(S) * v.size());
+        }
+
+        /** @brief containers of the types above. */
+        template <class A, class B>
+        void put(const pair<A, B> &v)
+        {
+            put(v.first);
+            put(v.second);
+        }
+        template <class A, class B>
+        void get(pair<A, B> &v)
+        {
+            get(v.first);
+            get(v.second);
+        }
+        template <class T>
+        void put(const vector<T> &v)
+        {
+            put(static_cast<long>(v.size()));
+            for (size_t i = 0; i < v.size(); i++)
+                put(static_cast<const T &>(v[i]));
+        }
+        template <class T>
+        void get(vector<T> &v)
+        {
+            long n = 0;
+            get(n);
+            v.clear();
+            for (long i = 0; i < n && _good; i++)
+            {
+                T x;
+                get(x);
+                v.push_back(x);
+            }
+        }
+        template <class T>
+        void put(const set<T> &v)
+        {
+            put(static_cast<long>(v.size()));
+            for (const auto &x : v)
+                put(x);
+        }
+        template <class T>
+        void get(set<T> &v)
+        {
+            long n = 0;
+            get(n);
+            v.clear();
+            for (long i = 0; i < n && _good; i++)
+            {
+                T x;
+                get(x);
+                v.insert(x);
+            }
+        }
+        template <class K, class V>
+        void put(const map<K, V> &v)
+        {
+            put(static_cast<long>(v.size()));
+            for (const auto &x : v)
+            {
+                put(x.first);
+                put(x.second);
+            }
+        }
+        template <class K, class V>
+        void get(map<K, V> &v)
+        {
+            long n = 0;
+            get(n);
+            v.clear();
+            for (long i = 0; i < n && _good; i++)
+            {
+                K k;
+                get(k);
+                get(v[k]);
+            }
+        }
+
+    protected:
+        /** @brief raw write/read, clears good() on failure. */
+        void _write(const void *p, size_t n);
+        void _read(void *p, size_t n);
+
+        /** @brief newmat store of the expected size. */
+        void _get_store(GeneralMatrix &v, int nrows, int ncols);
+
+        string _file;            ///< checkpoint file
+        ofstream _out;           ///< writing to _file.tmp
+        ifstream _in;            ///< reading _file
+        bool _writing;           ///< open for writing
+        bool _good;              ///< no failure
+    };
+}
+
+#endif
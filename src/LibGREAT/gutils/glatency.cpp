@@ -0,0 +1,151 @@
+/**
+ * @file         glatency.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        fixed-bin latency histogram for real-time monitoring
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <algorithm>
+#include "gutils/glatency.h"
+#include "gutils/gstring.h"
+
+namespace great
+{
+    t_glatency::t_glatency(double width, int nbins)
+        : _width(width > 0.0 ? width : 1.0),
+          _bins(std::max(nbins, 1) + 1, 0),
+          _count(0),
+          _sum(0.0),
+          _max(0.0)
+    {
+    }
+
+    t_glatency::~t_glatency()
+    {
+    }
+
+    void t_glatency::add(double ms)
+    {
+        if (ms < 0.0)
+            ms = 0.0;
+
+        _gmutex.lock();
+        size_t idx = (size_t)(ms / _width);
+        if (idx >= _bins.size() - 1)
+        {
+            idx = _bins.size() - 1;
+            // bounded, keep only the largest values
+            if (_over.size() < 1000)
+                _over.push_back(ms);
+            else
+            {
+                auto it = std::min_element(_over.begin(), _over.end());
+                if (*it < ms)
+                    *it = ms;
+            }
+        }
+        _bins[idx]++;
+        _count++;
+        _sum += ms;
+        if (ms > _max)
+            _max = ms;
+        _gmutex.unlock();
+    }
+
+    void t_glatency::reset()
+    {
+        _gmutex.lock();
+        fill(_bins.begin(), _bins.end(), 0);
+        _over.clear();
+        _count = 0;
+        _sum = 0.0;
+        _max = 0.0;
+        _gmutex.unlock();
+    }
+
+    long t_glatency::count() const
+    {
+        return _count;
+    }
+
+    double t_glatency::mean() const
+    {
+        return _count > 0 ? _sum / _count : 0.0;
+    }
+
+    double t_glatency::max() const
+    {
+        return _max;
+    }
+
+    double t_glatency::percentile(double p) const
+    {
+        _gmutex.lock();
+        if (_count == 0)
+        {
+            _gmutex.unlock();
+            return 0.0;
+        }
+
+        long need = (long)ceil(std::min(std::max(p, 0.0), 100.0) / 100.0 * _count);
+        if (need < 1)
+            need = 1;
+
+        double value = _max;
+        long cum = 0;
+        for (size_t i = 0; i < _bins.size() - 1; ++i)
+        {
+            cum += _bins[i];
+            if (cum >= need)
+            {
+                value = std::min((i + 1) * _width, _max);
+                _gmutex.unlock();
+                return value;
+            }
+        }
+
+        // overflow bin, values are kept sorted on demand
+        vector<double> over(_over);
+        sort(over.begin(), over.end());
+        long idx = need - cum - 1 - (_bins.back() - (long)over.size());
+        if (!over.empty())
+            value = over[std::min(std::max(idx, 0L), (long)over.size() - 1)];
+        _gmutex.unlock();
+        return value;
+    }
+
+    long t_glatency::above(double ms) const
+    {
+        _gmutex.lock();
+        long n = 0;
+        size_t first = (size_t)ceil(ms / _width);
+        for (size_t i = first; i < _bins.size() - 1; ++i)
+            n += _bins[i];
+        if (ms < (_bins.size() - 1) * _width)
+            n += _bins.back();
+        else
+            for (double v : _over)
+                n += (v > ms);
+        _gmutex.unlock();
+        return n;
+    }
+
+    vector<long> t_glatency::bins() const
+    {
+        _gmutex.lock();
+        vector<long> tmp(_bins);
+        _gmutex.unlock();
+        return tmp;
+    }
+
+    string t_glatency::summary() const
+    {
+        return format("n=%ld mean=%.1f p50=%.1f p95=%.1f p99=%.1f max=%.1f ms",
+                      count(), mean(), percentile(50), percentile(95), percentile(99), max());
+    }
+}
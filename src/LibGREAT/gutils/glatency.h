@@ -0,0 +1,83 @@
+/**
+ * @file         glatency.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        fixed-bin latency histogram for real-time monitoring
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GLATENCY_H
+#define GLATENCY_H
+
+#include <string>
+#include <vector>
+#include "gexport/ExportLibGREAT.h"
+#include "gutils/gmutex.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    /**
+    * @brief latency histogram with constant bin width and one overflow bin
+    * @note add() is O(1) and allocation free, percentiles are resolved to the bin width
+    */
+    class LibGREAT_LIBRARY_EXPORT t_glatency
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] width    bin width [ms]
+        * @param[in] nbins    number of bins (values above nbins*width go to overflow)
+        */
+        t_glatency(double width = 1.0, int nbins = 200);
+
+        /** @brief default destructor. */
+        virtual ~t_glatency();
+
+        /** @brief add one latency value [ms]. */
+        void add(double ms);
+
+        /** @brief clear all counts. */
+        void reset();
+
+        /** @brief number of values. */
+        long count() const;
+
+        /** @brief mean latency [ms]. */
+        double mean() const;
+
+        /** @brief maximum latency [ms]. */
+        double max() const;
+
+        /** @brief percentile [ms] (upper edge of the bin), p in <0,100>. */
+        double percentile(double p) const;
+
+        /** @brief number of values exceeding limit [ms]. */
+        long above(double ms) const;
+
+        /** @brief counts per bin (last item is overflow). */
+        vector<long> bins() const;
+
+        /** @brief bin width [ms]. */
+        double width() const { return _width; }
+
+        /** @brief one line summary: n, mean, p50, p95, p99, max. */
+        string summary() const;
+
+    protected:
+        double _width;        ///< bin width [ms]
+        vector<long> _bins;   ///< counts, last = overflow
+        vector<double> _over; ///< exact values of overflow bin (for percentiles)
+        long _count;          ///< number of values
+        double _sum;          ///< sum of values [ms]
+        double _max;          ///< maximum value [ms]
+        mutable t_gmutex _gmutex;
+    };
+}
+
+#endif
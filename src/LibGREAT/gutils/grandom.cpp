@@ -0,0 +1,45 @@
+/**
+ * @file         grandom.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        reproducible random numbers for the simulated data
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include "gutils/grandom.h"
+#include "gutils/gconst.h"
+
+namespace great
+{
+    t_grandom::t_grandom(unsigned int seed)
+        : _gen(seed),
+          _has(false),
+          _next(0.0)
+    {
+    }
+
+    t_grandom::~t_grandom()
+    {
+    }
+
+    double t_grandom::gauss()
+    {
+        if (_has)
+        {
+            _has = false;
+            return _next;
+        }
+        double u1 = 0.0;
+        while (u1 <= 1e-300)
+            u1 = uniform();
+        double u2 = uniform();
+        double r = sqrt(-2.0 * log(u1));
+        _next = r * sin(2.0 * G_PI * u2);
+        _has = true;
+        return r * cos(2.0 * G_PI * u2);
+    }
+}
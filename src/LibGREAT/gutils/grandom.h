@@ -0,0 +1,51 @@
+/**
+ * @file         grandom.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        reproducible random numbers for the simulated data
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   The same seed gives the same sequence on every platform: std::mt19937 and
+ *   Box-Muller, no std::*_distribution (their algorithms are not specified).
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GRANDOM_H
+#define GRANDOM_H
+
+#include <random>
+#include "gexport/ExportLibGREAT.h"
+
+using namespace std;
+
+namespace great
+{
+    /**
+    * @brief uniform and normal random numbers of one generator
+    */
+    class LibGREAT_LIBRARY_EXPORT t_grandom
+    {
+    public:
+        /** @brief constructor. */
+        explicit t_grandom(unsigned int seed = 1);
+
+        /** @brief default destructor. */
+        virtual ~t_grandom();
+
+        /** @brief uniform in [0,1), 27 bits. */
+        double uniform() { return (_gen() >> 5) * (1.0 / 134217728.0); }
+
+        /** @brief standard normal. */
+        double gauss();
+
+    protected:
+        mt19937 _gen;   ///< generator
+        bool _has;      ///< second Box-Muller value available
+        double _next;   ///< second Box-Muller value
+    };
+}
+
+#endif
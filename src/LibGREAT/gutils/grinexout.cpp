@@ -0,0 +1,104 @@
+/**
+ * @file         grinexout.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        RINEX 3.04 observation file writer for the simulated data
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include "gutils/grinexout.h"
+
+namespace great
+{
+    t_grinexout::t_grinexout()
+        : _pgm("GREAT"),
+          _observer("SIMULATION"),
+          _rec("SIMULATED"),
+          _ant("SIMULATED"),
+          _intv(0.0)
+    {
+    }
+
+    t_grinexout::~t_grinexout()
+    {
+    }
+
+    string t_grinexout::hline(const string &content, const string &label)
+    {
+        string line = content.substr(0, 60);
+        line.resize(60, ' ');
+        return line + label + "\n";
+    }
+
+    string t_grinexout::header(const t_gtime &first) const
+    {
+        char tmp[256];
+        string out;
+
+        if (_types.size() == 1)
+        {
+            GSYS gsys = _types.begin()->first;
+            snprintf(tmp, sizeof(tmp), "     3.04           OBSERVATION DATA    %c (%s)", t_gsys::gsys2char(gsys), t_gsys::gsys2str(gsys).c_str());
+            out += hline(tmp, "RINEX VERSION / TYPE");
+        }
+        else
+            out += hline("     3.04           OBSERVATION DATA    M (MIXED)", "RINEX VERSION / TYPE");
+        snprintf(tmp, sizeof(tmp), "%-20s%-20s", _pgm.c_str(), "GREAT-WHU");
+        out += hline(tmp, "PGM / RUN BY / DATE");
+        out += hline(_marker, "MARKER NAME");
+        if (!_marker_type.empty())
+            out += hline(_marker_type, "MARKER TYPE");
+        snprintf(tmp, sizeof(tmp), "%-20s%-20s", _observer.c_str(), "GREAT-WHU");
+        out += hline(tmp, "OBSERVER / AGENCY");
+        snprintf(tmp, sizeof(tmp), "%-20s%-20s%-20s", "0", _rec.c_str(), "1.0");
+        out += hline(tmp, "REC # / TYPE / VERS");
+        snprintf(tmp, sizeof(tmp), "%-20s%-20s", "0", _ant.c_str());
+        out += hline(tmp, "ANT # / TYPE");
+        snprintf(tmp, sizeof(tmp), "%14.4f%14.4f%14.4f", _xyz[0], _xyz[1], _xyz[2]);
+        out += hline(tmp, "APPROX POSITION XYZ");
+        snprintf(tmp, sizeof(tmp), "%14.4f%14.4f%14.4f", _hen[0], _hen[1], _hen[2]);
+        out += hline(tmp, "ANTENNA: DELTA H/E/N");
+        for (const auto &it : _types)
+        {
+            string types;
+            for (const auto &type : it.second)
+                types += " " + type;
+            snprintf(tmp, sizeof(tmp), "%c   %2d%s", t_gsys::gsys2char(it.first), int(it.second.size()), types.c_str());
+            out += hline(tmp, "SYS / # / OBS TYPES");
+        }
+        if (_intv > 0.0)
+        {
+            snprintf(tmp, sizeof(tmp), "%10.3f", _intv);
+            out += hline(tmp, "INTERVAL");
+        }
+        int y = 0, m = 0, d = 0, h = 0, mi = 0, s = 0;
+        first.ymd(y, m, d);
+        first.hms(h, mi, s);
+        snprintf(tmp, sizeof(tmp), "%6d%6d%6d%6d%6d%13.7f     GPS", y, m, d, h, mi, s + first.dsec());
+        out += hline(tmp, "TIME OF FIRST OBS");
+        out += hline("", "END OF HEADER");
+        return out;
+    }
+
+    string t_grinexout::epoch(const t_gtime &t, int nsat)
+    {
+        char tmp[64];
+        int y = 0, m = 0, d = 0, h = 0, mi = 0, s = 0;
+        t.ymd(y, m, d);
+        t.hms(h, mi, s);
+        snprintf(tmp, sizeof(tmp), "> %4d %02d %02d %02d %02d%11.7f  0%3d\n", y, m, d, h, mi, s + t.dsec(), nsat);
+        return tmp;
+    }
+
+    void t_grinexout::satellite(t_gfmtline &line, const string &sat, const double *obs, int nobs)
+    {
+        line.str(sat, 3);
+        for (int i = 0; i < nobs; i++)
+            line.fix(obs[i], 14, 3).lit("  ");
+        line.eol();
+    }
+}
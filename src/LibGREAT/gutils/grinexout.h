@@ -0,0 +1,111 @@
+/**
+ * @file         grinexout.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        RINEX 3.04 observation file writer for the simulated data
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   header       set the fields, then header(first epoch)
+ *   epoch        "> yyyy mm dd hh mi ss.sssssss  0nnn", flag 0 only
+ *   satellite    F14.3 values in the order of SYS / # / OBS TYPES, blank LLI
+ *                and signal strength, formatted with t_gfmtline (no iostreams)
+ *
+ *   The output is read back by t_rinexo.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GRINEXOUT_H
+#define GRINEXOUT_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "gutils/gsys.h"
+#include "gutils/gtime.h"
+#include "gutils/gtriple.h"
+#include "gutils/gfmtline.h"
+#include "gexport/ExportLibGREAT.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    /**
+    * @brief header and record lines of a RINEX 3 observation file
+    */
+    class LibGREAT_LIBRARY_EXPORT t_grinexout
+    {
+    public:
+        /** @brief default constructor. */
+        t_grinexout();
+
+        /** @brief default destructor. */
+        virtual ~t_grinexout();
+
+        /** @brief PGM / RUN BY / DATE program. */
+        void program(const string &pgm) { _pgm = pgm; }
+
+        /** @brief MARKER NAME and MARKER TYPE (no line if empty). */
+        void marker(const string &name, const string &type = "")
+        {
+            _marker = name;
+            _marker_type = type;
+        }
+
+        /** @brief OBSERVER / AGENCY observer. */
+        void observer(const string &obs) { _observer = obs; }
+
+        /** @brief REC # / TYPE / VERS and ANT # / TYPE types. */
+        void receiver(const string &type) { _rec = type; }
+        void antenna(const string &type) { _ant = type; }
+
+        /** @brief APPROX POSITION XYZ [m] and ANTENNA: DELTA H/E/N [m]. */
+        void position(const t_gtriple &xyz) { _xyz = xyz; }
+        void delta_hen(const t_gtriple &hen) { _hen = hen; }
+
+        /** @brief SYS / # / OBS TYPES of a system. */
+        void obstypes(GSYS gsys, const vector<string> &types) { _types[gsys] = types; }
+
+        /** @brief INTERVAL [s]. */
+        void interval(double intv) { _intv = intv; }
+
+        /**
+        * @brief header
+        * @param[in] first    TIME OF FIRST OBS
+        * @return header lines up to END OF HEADER
+        */
+        string header(const t_gtime &first) const;
+
+        /** @brief epoch line of nsat satellites. */
+        static string epoch(const t_gtime &t, int nsat);
+
+        /**
+        * @brief satellite line appended to line
+        * @param[in] sat      satellite
+        * @param[in] obs      values in the order of the system's obstypes()
+        * @param[in] nobs     number of values
+        */
+        static void satellite(t_gfmtline &line, const string &sat, const double *obs, int nobs);
+
+        /** @brief header line: content in columns 1-60, label from column 61 (also ANTEX). */
+        static string hline(const string &content, const string &label);
+
+    protected:
+        string _pgm;                        ///< program
+        string _marker;                     ///< marker name
+        string _marker_type;                ///< marker type
+        string _observer;                   ///< observer
+        string _rec;                        ///< receiver type
+        string _ant;                        ///< antenna type
+        t_gtriple _xyz;                     ///< approximate position [m]
+        t_gtriple _hen;                     ///< antenna height, east, north [m]
+        map<GSYS, vector<string>> _types;   ///< observation types per system
+        double _intv;                       ///< sampling [s]
+    };
+}
+
+#endif
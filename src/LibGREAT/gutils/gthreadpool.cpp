@@ -0,0 +1,128 @@
+/**
+ * @file         gthreadpool.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        persistent fork-join pool for loops with independent items
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gutils/gthreadpool.h"
+
+namespace great
+{
+    t_gthreadpool::t_gthreadpool(int nthreads)
+        : _job(nullptr),
+          _n(0),
+          _gen(0),
+          _busy(0),
+          _stop(false),
+          _next(0),
+          _err_idx(-1)
+    {
+        for (int i = 1; i < nthreads; i++)
+            _workers.push_back(thread(&t_gthreadpool::_run, this, i));
+    }
+
+    t_gthreadpool::~t_gthreadpool()
+    {
+        {
+            lock_guard<mutex> lock(_mtx);
+            _stop = true;
+        }
+        _cv_job.notify_all();
+        for (auto &w : _workers)
+            w.join();
+    }
+
+    void t_gthreadpool::parallel_for(int n, const function<void(int)> &f)
+    {
+        parallel_for_slots(n, [&f](int i, int) { f(i); });
+    }
+
+    void t_gthreadpool::parallel_for_slots(int n, const function<void(int, int)> &f)
+    {
+        if (n <= 0)
+            return;
+
+        if (_workers.empty() || n == 1)
+        {
+            for (int i = 0; i < n; i++)
+                f(i, 0);
+            return;
+        }
+
+        {
+            lock_guard<mutex> lock(_mtx);
+            _job = &f;
+            _n = n;
+            _next = 0;
+            _err_idx = -1;
+            _err = nullptr;
+            _busy = static_cast<int>(_workers.size());
+            _gen++;
+        }
+        _cv_job.notify_all();
+
+        _work(0);
+
+        unique_lock<mutex> lock(_mtx);
+        _cv_done.wait(lock, [this] { return _busy == 0; });
+        _job = nullptr;
+        if (_err)
+        {
+            exception_ptr err = _err;
+            _err = nullptr;
+            lock.unlock();
+            rethrow_exception(err);
+        }
+    }
+
+    void t_gthreadpool::_run(int slot)
+    {
+        long gen = 0;
+        while (true)
+        {
+            {
+                unique_lock<mutex> lock(_mtx);
+                _cv_job.wait(lock, [this, gen] { return _stop || _gen != gen; });
+                if (_stop)
+                    return;
+                gen = _gen;
+            }
+
+            _work(slot);
+
+            bool last = false;
+            {
+                lock_guard<mutex> lock(_mtx);
+                last = (--_busy == 0);
+            }
+            if (last)
+                _cv_done.notify_one();
+        }
+    }
+
+    void t_gthreadpool::_work(int slot)
+    {
+        const function<void(int, int)> &f = *_job;
+        for (int i = _next++; i < _n; i = _next++)
+        {
+            try
+            {
+                f(i, slot);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(_mtx);
+                if (_err_idx < 0 || i < _err_idx)
+                {
+                    _err_idx = i;
+                    _err = current_exception();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file         gthreadpool.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        persistent fork-join pool for loops with independent items
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   parallel_for(n, f)   f(0) ... f(n-1) on the workers and the calling thread,
+ *                        returns when all items are done
+ *   parallel_for_slots(n, f)
+ *                        the same with f(i, slot), slot 0 ... size()-1 is the
+ *                        thread running the item (0: the calling thread), for
+ *                        per-thread scratch objects
+ *
+ *   The workers are started once and wait between the calls, so the pool can be
+ *   used for every epoch. The items are taken in ascending order; results written
+ *   to per-item slots and reduced afterwards in item order do not depend on the
+ *   number of threads.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GTHREADPOOL_H
+#define GTHREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+#include "gexport/ExportLibGREAT.h"
+
+using namespace std;
+
+namespace great
+{
+    /**
+    * @brief fork-join pool, one parallel_for() at a time
+    */
+    class LibGREAT_LIBRARY_EXPORT t_gthreadpool
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] nthreads   number of threads including the calling one (<= 1: no workers)
+        */
+        explicit t_gthreadpool(int nthreads);
+
+        /** @brief destructor, stops and joins the workers. */
+        virtual ~t_gthreadpool();
+
+        t_gthreadpool(const t_gthreadpool &) = delete;
+        t_gthreadpool &operator=(const t_gthreadpool &) = delete;
+
+        /** @brief number of threads including the calling one. */
+        int size() const { return static_cast<int>(_workers.size()) + 1; }
+
+        /**
+        * @brief call f(i) for i = 0 ... n-1
+        * @note the exception of the lowest failed item is rethrown to the caller
+        * @param[in] n      number of items
+        * @param[in] f      item function, must not call parallel_for() of the same pool
+        */
+        void parallel_for(int n, const function<void(int)> &f);
+
+        /**
+        * @brief call f(i, slot) for i = 0 ... n-1, slot is the thread running item i
+        * @note no two items of one call run on the same slot at the same time
+        * @param[in] n      number of items
+        * @param[in] f      item function, must not call parallel_for() of the same pool
+        */
+        void parallel_for_slots(int n, const function<void(int, int)> &f);
+
+    protected:
+        /** @brief worker loop. */
+        void _run(int slot);
+
+        /** @brief take and process items of the current job. */
+        void _work(int slot);
+
+        vector<thread> _workers;                 ///< worker threads
+        mutex _mtx;                              ///< guards the job state below
+        condition_variable _cv_job;              ///< new job or stop
+        condition_variable _cv_done;             ///< all workers left the job
+        const function<void(int, int)> *_job;    ///< current job
+        int _n;                                  ///< number of items of the current job
+        long _gen;                               ///< job generation
+        int _busy;                               ///< workers in the current job
+        bool _stop;                              ///< stop request
+        atomic<int> _next;                       ///< next item to take
+        int _err_idx;                            ///< lowest failed item
+        exception_ptr _err;                      ///< its exception
+    };
+}
+
+#endif
@@ -21,6 +21,7 @@ namespace gnut
     t_gallobs::t_gallobs() : t_gdata(),
                              _set(0),
                              _nepoch(0),
+                             _retention(0.0),
                              _overwrite(false)
     {
         id_type(t_gdata::ALLOBS);
@@ -30,6 +31,7 @@ namespace gnut
         : t_gdata(spdlog),
           _set(0),
           _nepoch(0),
+          _retention(0.0),
           _overwrite(false)
     {
         id_type(t_gdata::ALLOBS);
@@ -39,6 +41,7 @@ namespace gnut
         : t_gdata(spdlog),
           _set(set),
           _nepoch(0),
+          _retention(0.0),
           _overwrite(false)
     {
         if (nullptr == set)
@@ -62,6 +65,7 @@ namespace gnut
         _sys = dynamic_cast<t_gsetgen *>(_set)->sys();
         _smp = dynamic_cast<t_gsetgen *>(_set)->sampling();
         _scl = dynamic_cast<t_gsetgen *>(_set)->sampling_scalefc(); // scaling 10^decimal-digits
+        _retention = dynamic_cast<t_gsetgen *>(_set)->retention();
 
         return;
     }
@@ -261,24 +265,7 @@ namespace gnut
     {
         _gmutex.lock();
 
-        // repair small out-sync ( < 10 ms )
-        double outsync = fmod(obs->epoch().dsec(), _smp) - round(fmod(obs->epoch().dsec(), _smp));
-        if (fabs(outsync) < 0.014 && fabs(outsync) > 1e-6)
-        {
-            obs->epo(obs->epoch() - outsync);
-            vector<GOBS> v_obs = obs->obs();
-            vector<GOBS>::iterator itOBS = v_obs.begin();
-            for (; itOBS != v_obs.end(); ++itOBS)
-            {
-                GOBSTYPE obstype = str2gobstype(gobs2str(*itOBS));
-                if (obstype == TYPE_P || obstype == TYPE_C)
-                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync);
-                else if (obstype == TYPE_L)
-                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync / obs->wavelength(str2gobsband(gobs2str(*itOBS))));
-                else if (obstype == TYPE_S) // add wh
-                    obs->resetobs(*itOBS, obs->getobs(*itOBS));
-            }
-        }
+        _fix_outsync(obs);
 
         t_gtime t(obs->epoch()), tt = t;
         string site = obs->site();
@@ -301,23 +288,7 @@ namespace gnut
                 _mapobj[site][tt].erase(sat);
             }
 
-            if (_nepoch > 0 && _mapobj[site].size() > _nepoch + 10)
-            {
-                auto itEPO = _mapobj[site].begin();
-                while (itEPO != _mapobj[site].end())
-                {
-
-                    if (_mapobj[site].size() <= _nepoch)
-                    {
-                        break;
-                    }
-
-                    t_gtime t = itEPO->first;
-
-                    _mapobj[site][t].erase(_mapobj[site][t].begin(), _mapobj[site][t].end());
-                    _mapobj[site].erase(itEPO++);
-                }
-            }
+            _trim_epochs(site);
 
             if (obs->id_type() == t_gdata::OBSGNSS)
             {
@@ -343,6 +314,99 @@ namespace gnut
         return 0;
     }
 
+    int t_gallobs::addobs(const vector<t_spt_gobs> &vobs)
+    {
+        _gmutex.lock();
+
+        int cnt = 0;
+        string site;
+        t_gtime epo;
+        t_map_osat *osat = nullptr;
+
+        for (auto obs : vobs)
+        {
+            if (obs->id_type() != t_gdata::OBSGNSS)
+            {
+                if (_spdlog)
+                    SPDLOG_LOGGER_WARN(_spdlog, "warning: t_gobsgnss record not identified!");
+                continue;
+            }
+
+            _fix_outsync(obs);
+
+            // all records of a decoded epoch share site & epoch, look them up only once
+            if (osat == nullptr || obs->site() != site || obs->epoch() != epo)
+            {
+                site = obs->site();
+                epo = obs->epoch();
+                _map_sites.insert(site);
+
+                t_gtime tt = epo;
+                _find_epo(site, epo, tt);
+                _trim_epochs(site);
+                osat = &_mapobj[site][tt];
+            }
+
+            auto itSAT = osat->find(obs->sat());
+            if (itSAT == osat->end())
+            {
+                osat->insert(itSAT, make_pair(obs->sat(), obs));
+                cnt++;
+            }
+            else if (_overwrite)
+            {
+                itSAT->second = obs;
+                cnt++;
+            }
+        }
+
+        _gmutex.unlock();
+        return cnt;
+    }
+
+    void t_gallobs::_fix_outsync(t_spt_gobs &obs)
+    {
+        // repair small out-sync ( < 10 ms )
+        double outsync = fmod(obs->epoch().dsec(), _smp) - round(fmod(obs->epoch().dsec(), _smp));
+        if (fabs(outsync) < 0.014 && fabs(outsync) > 1e-6)
+        {
+            obs->epo(obs->epoch() - outsync);
+            vector<GOBS> v_obs = obs->obs();
+            vector<GOBS>::iterator itOBS = v_obs.begin();
+            for (; itOBS != v_obs.end(); ++itOBS)
+            {
+                GOBSTYPE obstype = str2gobstype(gobs2str(*itOBS));
+                if (obstype == TYPE_P || obstype == TYPE_C)
+                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync);
+                else if (obstype == TYPE_L)
+                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync / obs->wavelength(str2gobsband(gobs2str(*itOBS))));
+                else if (obstype == TYPE_S) // add wh
+                    obs->resetobs(*itOBS, obs->getobs(*itOBS));
+            }
+        }
+    }
+
+    void t_gallobs::_trim_epochs(const string &site)
+    {
+        if (_nepoch > 0 && _mapobj[site].size() > _nepoch + 10)
+        {
+            auto itEPO = _mapobj[site].begin();
+            while (itEPO != _mapobj[site].end())
+            {
+
+                if (_mapobj[site].size() <= _nepoch)
+                {
+                    break;
+                }
+
+                t_gtime t = itEPO->first;
+
+                _mapobj[site][t].erase(_mapobj[site][t].begin(), _mapobj[site][t].end());
+                _mapobj[site].erase(itEPO++);
+            }
+        }
+    }
+
     t_gallobs::t_map_osat t_gallobs::find(const string &site, const t_gtime &t)
     {
 
@@ -495,7 +559,7 @@ namespace gnut
         boost::mutex::scoped_lock lock(_mutex);
 #endif
         _gmutex.lock();
-        double range = 30 * 60;
+        double range = (_retention > 0.0) ? _retention : 30 * 60;
         t_map_oref::iterator itFirst = _mapobj[site].begin();
         t_map_oref::iterator itEnd = _mapobj[site].lower_bound(t - range);
         if (itEnd == itFirst)
@@ -511,6 +575,51 @@ namespace gnut
         _gmutex.unlock();
     }
 
+    int t_gallobs::consumed(const string &site, const t_gtime &t, bool beg_end)
+    {
+        if (_retention <= 0.0)
+            return 0;
+
+        _gmutex.lock();
+
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end() || itSITE->second.size() <= 2)
+        {
+            _gmutex.unlock();
+            return 0;
+        }
+
+        t_map_oref &epochs = itSITE->second;
+        int nerase = 0;
+        if (beg_end)
+        {
+            // keep the window before t and at least one epoch before t (preprocessing)
+            auto itEnd = epochs.lower_bound(t - _retention);
+            auto itPrev = epochs.lower_bound(t);
+            if (itPrev != epochs.begin())
+                --itPrev;
+            if (itEnd == epochs.end() || itPrev->first < itEnd->first)
+                itEnd = itPrev;
+            nerase = distance(epochs.begin(), itEnd);
+            epochs.erase(epochs.begin(), itEnd);
+        }
+        else
+        {
+            // backward processing, the window is after t
+            auto itBeg = epochs.upper_bound(t + _retention);
+            auto itNext = epochs.upper_bound(t);
+            if (itNext != epochs.end())
+                ++itNext;
+            if (itBeg != epochs.end() && (itNext == epochs.end() || itBeg->first < itNext->first))
+                itBeg = itNext;
+            nerase = distance(itBeg, epochs.end());
+            epochs.erase(itBeg, epochs.end());
+        }
+
+        _gmutex.unlock();
+        return nerase;
+    }
+
     void t_gallobs::setepoches(const string& site)
     {
         _allepoches = epochs(site);
@@ -191,6 +191,14 @@ namespace gnut
          */
         int addobs(t_spt_gobs obs); 
 
+        /**
+         * @brief add all satellite observations of one epoch at once (single lock, single epoch lookup)
+         * 
+         * @param vobs 
+         * @return int number of inserted records
+         */
+        int addobs(const vector<t_spt_gobs> &vobs);
+
         /**
          * @brief number of epochs for station
          * 
@@ -260,6 +268,26 @@ namespace gnut
          */
         virtual void erase(const string& site, const t_gtime& t); 
 
+        /**
+         * @brief set/get retention window [s] of consumed epochs (0 = keep all)
+         * @note read from <gen><retention> by gset(), forward/backward smoothing keeps all epochs
+         *
+         * @param sec
+         */
+        void retention(double sec) { _retention = sec; }
+        double retention() const { return _retention; }
+
+        /**
+         * @brief epoch t of site was consumed by the filter, drop epochs out of the retention window
+         * @note at least one epoch before t is kept (cycle slip detection)
+         *
+         * @param site
+         * @param t
+         * @param beg_end   processing direction
+         * @return int      number of erased epochs
+         */
+        virtual int consumed(const string &site, const t_gtime &t, bool beg_end = true);
+
         /**
          * @brief
          *
@@ -277,9 +305,16 @@ namespace gnut
         /**@brief find epoch from the map */
         int _find_epo(const string &site, const t_gtime &epo, t_gtime &tt); 
 
+        /**@brief repair small out-sync of the observation epoch ( < 10 ms ) */
+        void _fix_outsync(t_spt_gobs &obs);
+
+        /**@brief keep at most _nepoch epochs for site */
+        void _trim_epochs(const string &site);
+
     protected:
         t_gsetbase *_set = nullptr;
         unsigned int _nepoch;            ///< maximum number of epochs (0 = keep all)
+        double _retention;               ///< retention window of consumed epochs [s] (0 = keep all)
         t_map_oobj _mapobj;              ///< map over all objects (receivers)
         t_map_xflt _filter;              ///< structure of stations/files filtered data (QC)
         bool _overwrite;                 ///< rewrite/add only mode
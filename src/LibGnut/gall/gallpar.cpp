@@ -258,6 +258,11 @@ namespace gnut
         return _vParam[idx];
     }
 
+    const t_gpar &t_gallpar::operator[](const size_t idx) const
+    {
+        return _vParam[idx];
+    }
+
     t_gallpar t_gallpar::operator-(const t_gallpar &gallpar)
     {
         t_gallpar diff;
@@ -431,7 +436,7 @@ namespace gnut
         return 1;
     }
 
-    vector<t_gpar> t_gallpar::getAllPar()
+    vector<t_gpar> t_gallpar::getAllPar() const
     {
         return _vParam;
     }
@@ -128,6 +128,7 @@ namespace gnut
         *@brief override operator
         */
         t_gpar &operator[](const size_t idx);
+        const t_gpar &operator[](const size_t idx) const;
 
         /**
          * @brief 
@@ -179,7 +180,7 @@ namespace gnut
          * 
          * @return vector<t_gpar> 
          */
-        vector<t_gpar> getAllPar();
+        vector<t_gpar> getAllPar() const;
 
         /**
          * @brief 
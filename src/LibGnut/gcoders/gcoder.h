@@ -127,6 +127,14 @@ namespace gnut
          */
         virtual int decode_data(char *buff, int sz, int &cnt, vector<string> &errmsg) { return 0; } // = 0;
 
+        /**
+         * @brief end of input, pass data kept by the decoder (default: nothing kept)
+         * @param cnt 
+         * @param errmsg 
+         * @return int 
+         */
+        virtual int decode_end(int &cnt, vector<string> &errmsg) { return 0; }
+
         /** @brief get irc. */
         const int &irc() const { return _irc; }
 
@@ -1102,17 +1102,12 @@ namespace gnut
                 continue;
             }
 
-            vector<t_spt_gobs>::const_iterator itOBS = _vobs.begin();
-            while (itOBS != _vobs.end())
-            {
-
-                if (_spdlog)
-                    SPDLOG_LOGGER_DEBUG(_spdlog, (*itOBS)->sat() + " obs filled " + (*itOBS)->epoch().str_ymdhms() + " " + (*itOBS)->site());
+            // bulk insert of the whole epoch (single lock & epoch lookup)
+            int nobs = ((t_gallobs *)itDAT->second)->addobs(_vobs);
 
-                ((t_gallobs *)itDAT->second)->addobs(*itOBS);
+            if (_spdlog)
+                SPDLOG_LOGGER_DEBUG(_spdlog, int2str(nobs) + " obs filled " + _epoch.str_ymdhms() + " " + _site);
 
-                itOBS++;
-            }
             cnt++;
             itDAT++;
         }
@@ -34,6 +34,8 @@ namespace gnut
 
     int t_rinexo3::_decode_head()
     {
+        // observation types may change, rebuild descriptors for data records
+        _fastobs.clear();
 
         // -------- "SYS / # / OBS TYPES" --------
         if (_line.substr(60, 19).find("SYS / # / OBS TYPES") != string::npos)
@@ -650,51 +652,117 @@ namespace gnut
             return _stop_read();
 
         // filter GNSS and SAT
-        bool filter_sat = _filter_gnss(tmpsat);
-        if (!filter_sat)
+        if (!_filter_gnss(tmpsat))
         {
             _xsys++;
             if (_spdlog)
                 SPDLOG_LOGGER_DEBUG(_spdlog, "skip " + tmpsat);
+            return 1;
         }
 
         t_spt_gobs obs = make_shared<t_gobsgnss>(_spdlog, _site, tmpsat, _epoch);
 
-        // loop over sys-defined observation types
-        t_rnxhdr::t_vobstypes::const_iterator it = _mapobs[tmpsat.substr(0, 1)].begin();
-        unsigned int len;
-        while (_complete && (it != _mapobs[tmpsat.substr(0, 1)].end()))
+        // loop over sys-defined observation types (fixed columns: F14.3 + LLI + SSI)
+        // keyed on the evaluated satellite, as the lookup in _mapobs was before
+        const vector<t_fastobs> &vobs = _fast_obstypes(tmpsat.substr(0, 1));
+        const char *buf = _line.c_str();
+        unsigned int len = _line.length();
+
+        for (ii = 0; _complete && ii < (int)vobs.size(); ++ii)
         {
+            const t_fastobs &fo = vobs[ii];
             idx = 3 + 16 * ii;
-            len = _line.length();
-
-            // getline succeed only if 'EOL' found
-            if (len <= 0 && len < (idx + 14))
-                return _stop_read();
 
             // check completness (excluding last SNR+LLI - sometimes missing)
             if (len < (idx + 14))
             {
-                if (filter_sat)
-                    _null_log(tmpsat, gobs2str(it->first));
+                _null_log(tmpsat, gobs2str(fo.type));
+                continue;
             }
-            else
+            if (!fo.used)
+                continue;
+
+            double valdbl = 0.0;
+            if (!str2fix(buf + idx, 14, 3, valdbl))
+            {
+                // not a plain F14.3 field, general conversion of the bounded field
+                char field[15];
+                memcpy(field, buf + idx, 14);
+                field[14] = '\0';
+                valdbl = strtod(field, NULL);
+            }
+            if (double_eq(valdbl, 0.0))
+                continue; // eliminate 0.000
+
+            obs->addobs(fo.type, valdbl * fo.scale);
+
+            if (!fo.lli)
+                continue;
+
+            // read LLI
+            int lli = 0;
+            if (len - 1 > (idx + 14) && buf[idx + 14] >= '0' && buf[idx + 14] <= '9')
             {
-                if (filter_sat)
-                    _read_obs(idx, it, obs);
+                lli = buf[idx + 14] - '0';
+                if (lli > 3)
+                    lli -= 4;
             }
+            obs->addlli(fo.type, lli);
 
-            ii++;
-            it++;
+            // read SNR flag (phase only) and convert to SNR observation
+            if (fo.phase)
+            {
+                static const double ssi2snr[] = {0.0, 6.0, 15.0, 20.0, 27.0, 33.0, 39.0, 45.0, 50.0, 60.0};
 
-        } // while (over observation types)
+                if (len - 1 >= (idx + 14 + 1))
+                {
+                    char ssi = buf[idx + 14 + 1];
+                    if (ssi == ' ' || ssi == '\t')
+                        obs->addobs(fo.snrtype, 0.0);
+                    else if (ssi >= '1' && ssi <= '9')
+                        obs->addobs(fo.snrtype, ssi2snr[ssi - '0']);
+                }
+                else
+                {
+                    obs->addobs(fo.snrtype, 0.0);
+                }
+            }
+        }
 
-        if (filter_sat)
-            _vobs.push_back(obs);
+        _vobs.push_back(obs);
 
         return 1;
     }
 
+    const vector<t_rinexo3::t_fastobs> &t_rinexo3::_fast_obstypes(const string &sys)
+    {
+        auto itFAST = _fastobs.find(sys);
+        if (itFAST != _fastobs.end())
+            return itFAST->second;
+
+        vector<t_fastobs> &vobs = _fastobs[sys];
+
+        auto itMAP = _mapobs.find(sys);
+        if (itMAP == _mapobs.end())
+            return vobs;
+
+        GSYS gsys = t_gsys::str2gsys(sys);
+        for (const auto &itOBS : itMAP->second)
+        {
+            t_fastobs fo;
+            fo.type = itOBS.first;
+            fo.scale = itOBS.second;
+            fo.used = !(_obs[gsys].size() > 0 && _obs[gsys].find(gobs2str(fo.type)) == _obs[gsys].end());
+            fo.lli = !(fo.type >= 300 && fo.type < 400) && // signal-to-noise ratio
+                     !(fo.type >= 1300 && fo.type < 1400);
+            fo.phase = fo.type >= 100 && fo.type < 200;
+            fo.snrtype = fo.phase ? pha2snr(fo.type) : X;
+            vobs.push_back(fo);
+        }
+
+        return vobs;
+    }
+
     int t_rinexo3::_fix_band(string sys, string &go)
     {
 
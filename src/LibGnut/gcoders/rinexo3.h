@@ -97,6 +97,21 @@ namespace gnut
         /** @brief fix band (BDS). */
         virtual int _fix_band(string sys, string &go);
 
+        /** @brief fixed-column (F14.3 + LLI + SSI) descriptor of a single observation type. */
+        struct t_fastobs
+        {
+            GOBS type;    ///< observation type
+            GOBS snrtype; ///< SNR type filled from SSI (phase only)
+            double scale; ///< header scale factor
+            bool used;    ///< passed the observation filter
+            bool lli;     ///< LLI field is read (not for SNR)
+            bool phase;   ///< SSI field is read (phase only)
+        };
+
+        /** @brief get observation descriptors for system (first character of the satellite), built once per header. */
+        const vector<t_fastobs> &_fast_obstypes(const string &sys);
+
+        map<string, vector<t_fastobs>> _fastobs; ///< cached observation descriptors per system
         t_rnxhdr::t_obstypes _mapcyc;  ///< map of GOBS phase quater-cycle shifts
         t_rnxhdr::t_obstypes _glofrq;  ///< map of GLONASS slot/frequency
         t_rnxhdr::t_vobstypes _globia; ///< vec of GLONASS obs code-phase biases
@@ -0,0 +1,841 @@
+/**
+ * @file         rtcm3.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        RTCM 3 stream decoder (MSM4/5/7 observations, GPS/GLO/GAL/BDS ephemerides)
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "gcoders/rtcm3.h"
+#include "gall/gallobj.h"
+#include "gdata/gobsgnss.h"
+#include "gdata/gnavgps.h"
+#include "gdata/gnavglo.h"
+#include "gdata/gnavgal.h"
+#include "gdata/gnavbds.h"
+#include "gutils/gconst.h"
+#include "gutils/gfileconv.h"
+#include "gutils/gtypeconv.h"
+
+using namespace std;
+
+namespace gnut
+{
+    static const double RANGE_MS = CLIGHT * 0.001; ///< range in 1 ms
+    static const double SC2RAD = G_PI;             ///< semi-circle to radian
+    static const double P2_66 = 1.355252715606880E-20; ///< 2^-66
+
+    // GPS/BDS URA index to meters
+    static const double URA_EPH[] = {2.4, 3.4, 4.85, 6.85, 9.65, 13.65, 24.0, 48.0, 96.0, 192.0,
+                                     384.0, 768.0, 1536.0, 3072.0, 6144.0, 6144.0};
+
+    // Galileo SISA index to meters
+    static double _sisa2m(int sisa)
+    {
+        if (sisa <= 49)
+            return sisa * 0.01;
+        if (sisa <= 74)
+            return 0.5 + (sisa - 50) * 0.02;
+        if (sisa <= 99)
+            return 1.0 + (sisa - 75) * 0.04;
+        if (sisa <= 125)
+            return 2.0 + (sisa - 100) * 0.16;
+        return -1.0; // NAPA
+    }
+
+    t_rtcm3::t_rtcm3(t_gsetbase *s, string version, int sz)
+        : t_gcoder(s, version, sz, "rtcm3"),
+          _site(""),
+          _reftime(FIRST_TIME),
+          _epo(FIRST_TIME),
+          _ncrc(0)
+    {
+    }
+
+    t_rtcm3::~t_rtcm3()
+    {
+    }
+
+    int t_rtcm3::decode_head(char *buff, int sz, vector<string> &errmsg)
+    {
+        _mutex.lock();
+        t_gcoder::_add2buffer(buff, sz);
+        _mutex.unlock();
+        return -1;
+    }
+
+    int t_rtcm3::decode_data(char *buff, int sz, int &cnt, vector<string> &errmsg)
+    {
+        _mutex.lock();
+
+        if (buff && sz > 0)
+            t_gcoder::_add2buffer(buff, sz);
+
+        if (_site.empty())
+        {
+            // mountpoint or file name
+            string name = base_name(_fname);
+            size_t idx = name.find('.');
+            _site = name.substr(0, min(idx, (size_t)4));
+            transform(_site.begin(), _site.end(), _site.begin(), ::toupper);
+        }
+
+        const char *tmpbuff = nullptr;
+        int len = t_gcoder::_getbuffer(tmpbuff);
+        const unsigned char *b = (const unsigned char *)tmpbuff;
+
+        int pos = 0;
+        while (pos + 6 <= len)
+        {
+            // frame synchronization
+            if (b[pos] != RTCM3_PREAMB)
+            {
+                pos++;
+                continue;
+            }
+
+            int mlen = _getbitu(b + pos, 14, 10);
+            if (pos + mlen + 6 > len)
+                break; // incomplete frame
+
+            if (_crc24q(b + pos, mlen + 3) != _getbitu(b + pos, (mlen + 3) * 8, 24))
+            {
+                _ncrc++;
+                pos++;
+                continue;
+            }
+
+            if (mlen >= 2)
+                _decode_msg(b + pos + 3, mlen, cnt);
+
+            pos += mlen + 6;
+        }
+
+        t_gcoder::_consume(pos);
+
+        _mutex.unlock();
+        return pos;
+    }
+
+    int t_rtcm3::decode_end(int &cnt, vector<string> &errmsg)
+    {
+        _mutex.lock();
+        int irc = 0;
+        if (!_epo_obs.empty())
+        {
+            irc = _fill_obs();
+            cnt += irc;
+        }
+        _mutex.unlock();
+        return irc;
+    }
+
+    int t_rtcm3::_decode_msg(const unsigned char *msg, int len, int &cnt)
+    {
+        int type = _getbitu(msg, 0, 12);
+        int irc = 0;
+
+        switch (type)
+        {
+        case 1019:
+            irc = _decode_1019(msg, len);
+            break;
+        case 1020:
+            irc = _decode_1020(msg, len);
+            break;
+        case 1042:
+            irc = _decode_1042(msg, len);
+            break;
+        case 1045:
+            irc = _decode_1045(msg, len, false);
+            break;
+        case 1046:
+            irc = _decode_1045(msg, len, true);
+            break;
+        default:
+        {
+            GSYS gsys = GNS;
+            if (type >= 1071 && type <= 1077)
+                gsys = GPS;
+            else if (type >= 1081 && type <= 1087)
+                gsys = GLO;
+            else if (type >= 1091 && type <= 1097)
+                gsys = GAL;
+            else if (type >= 1111 && type <= 1117)
+                gsys = QZS;
+            else if (type >= 1121 && type <= 1127)
+                gsys = BDS;
+
+            int msm = type % 10;
+            if (gsys != GNS && (msm == 4 || msm == 5 || msm == 7))
+                irc = _decode_msm(msg, len, gsys, msm, cnt);
+            break;
+        }
+        }
+
+        if (irc > 0)
+            _nmsg[type]++;
+
+        return irc;
+    }
+
+    int t_rtcm3::_decode_msm(const unsigned char *msg, int len, GSYS gsys, int msm, int &cnt)
+    {
+        int i = 12 + 12; // message number, reference station id
+
+        t_gtime epo;
+        if (gsys == GLO)
+        {
+            int dow = _getbitu(msg, i, 3);
+            double tod = _getbitu(msg, i + 3, 27) * 0.001;
+            epo = _glo2time(dow, tod);
+        }
+        else
+        {
+            double tow = _getbitu(msg, i, 30) * 0.001;
+            epo = _tow2time(tow, gsys == BDS ? t_gtime::BDS : t_gtime::GPS);
+        }
+        i += 30;
+
+        int sync = _getbitu(msg, i, 1);
+        i += 1 + 3 + 7 + 2 + 2 + 1 + 3; // sync, IODS, reserved, clock steering, ext. clock, smoothing
+
+        // satellite & signal masks
+        int sats[64], sigs[32], nsat = 0, nsig = 0;
+        for (int j = 0; j < 64; ++j)
+            if (_getbitu(msg, i + j, 1))
+                sats[nsat++] = j + 1;
+        i += 64;
+        for (int j = 0; j < 32; ++j)
+            if (_getbitu(msg, i + j, 1))
+                sigs[nsig++] = j + 1;
+        i += 32;
+
+        if (nsat * nsig > 64 || i + nsat * nsig > len * 8)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "rtcm3: MSM cell mask overflow " + t_gsys::gsys2str(gsys));
+            return -1;
+        }
+
+        bool cell[64];
+        int ncell = 0;
+        for (int j = 0; j < nsat * nsig; ++j)
+        {
+            cell[j] = _getbitu(msg, i + j, 1) != 0;
+            ncell += cell[j];
+        }
+        i += nsat * nsig;
+
+        int nbits_sat = (msm == 4) ? 18 : 36;
+        int nbits_sig = (msm == 4) ? 48 : (msm == 5 ? 63 : 80);
+        if (i + nsat * nbits_sat + ncell * nbits_sig > len * 8)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "rtcm3: MSM message too short " + t_gsys::gsys2str(gsys));
+            return -1;
+        }
+
+        // satellite data
+        double rng[64], rate[64];
+        int ext[64];
+        for (int j = 0; j < nsat; ++j)
+        {
+            rng[j] = rate[j] = 0.0;
+            ext[j] = 15;
+        }
+        for (int j = 0; j < nsat; ++j, i += 8)
+        {
+            unsigned int v = _getbitu(msg, i, 8);
+            if (v != 255)
+                rng[j] = v * RANGE_MS;
+        }
+        if (msm != 4)
+            for (int j = 0; j < nsat; ++j, i += 4)
+                ext[j] = _getbitu(msg, i, 4);
+        for (int j = 0; j < nsat; ++j, i += 10)
+        {
+            unsigned int v = _getbitu(msg, i, 10);
+            if (rng[j] != 0.0)
+                rng[j] += v * P2_10 * RANGE_MS;
+        }
+        if (msm != 4)
+            for (int j = 0; j < nsat; ++j, i += 14)
+            {
+                int v = _getbits(msg, i, 14);
+                if (v != -8192)
+                    rate[j] = v * 1.0;
+            }
+
+        // signal data
+        double pr[64], cp[64], rr[64], cnr[64];
+        int lock[64], half[64];
+        const int npr = (msm == 7) ? 20 : 15;
+        const int ncp = (msm == 7) ? 24 : 22;
+        const int nlk = (msm == 7) ? 10 : 4;
+        const int ncn = (msm == 7) ? 10 : 6;
+        const int ipr = (msm == 7) ? -524288 : -16384;
+        const int icp = (msm == 7) ? -8388608 : -2097152;
+        const double spr = (msm == 7) ? P2_29 : P2_24;
+        const double scp = (msm == 7) ? P2_31 : P2_29;
+        const double scn = (msm == 7) ? 0.0625 : 1.0;
+
+        for (int j = 0; j < ncell; ++j, i += npr)
+        {
+            int v = _getbits(msg, i, npr);
+            pr[j] = (v == ipr) ? -1e16 : v * spr * RANGE_MS;
+        }
+        for (int j = 0; j < ncell; ++j, i += ncp)
+        {
+            int v = _getbits(msg, i, ncp);
+            cp[j] = (v == icp) ? -1e16 : v * scp * RANGE_MS;
+        }
+        for (int j = 0; j < ncell; ++j, i += nlk)
+            lock[j] = _getbitu(msg, i, nlk);
+        for (int j = 0; j < ncell; ++j, i += 1)
+            half[j] = _getbitu(msg, i, 1);
+        for (int j = 0; j < ncell; ++j, i += ncn)
+            cnr[j] = _getbitu(msg, i, ncn) * scn;
+        for (int j = 0; j < ncell; ++j)
+            rr[j] = -1e16;
+        if (msm != 4)
+            for (int j = 0; j < ncell; ++j, i += 15)
+            {
+                int v = _getbits(msg, i, 15);
+                if (v != -16384)
+                    rr[j] = v * 0.0001;
+            }
+
+        // new epoch started without closing the previous one
+        if (!_epo_obs.empty() && epo != _epo)
+            cnt += _fill_obs();
+        _epo = epo;
+        epoch = epo;
+
+        GSYS gs = gsys;
+        int k = 0;
+        for (int j = 0; j < nsat; ++j)
+        {
+            string prn = t_gsys::eval_sat(sats[j], gs);
+            bool use_sat = _filter_gnss(prn);
+
+            if (gsys == GLO && ext[j] <= 13)
+                _glo_chn[prn] = ext[j] - 7;
+
+            for (int s = 0; s < nsig; ++s)
+            {
+                if (!cell[j * nsig + s])
+                    continue;
+                int ic = k++;
+
+                string code = _msm_sig(gsys, sigs[s]);
+                if (!use_sat || code.empty() || rng[j] == 0.0)
+                    continue;
+
+                t_spt_gobs &obs = _epo_obs[prn];
+                if (!obs)
+                {
+                    obs = make_shared<t_gobsgnss>(_spdlog, _site, prn, epo);
+                    if (_glo_chn.find(prn) != _glo_chn.end())
+                        obs->channel(_glo_chn[prn]);
+                }
+
+                double wl = (gsys == GLO && _glo_chn.find(prn) == _glo_chn.end()) ? 0.0 : obs->wavelength(char2gobsband(code[0]));
+
+                GOBS gC = str2gobs("C" + code);
+                GOBS gL = str2gobs("L" + code);
+                GOBS gD = str2gobs("D" + code);
+                GOBS gS = str2gobs("S" + code);
+
+                // requested observations only
+                const set<string> &req = _obs[gsys];
+                bool all = req.empty();
+
+                if (pr[ic] > -1e15 && (all || req.count(gobs2str(gC))))
+                    obs->addobs(gC, rng[j] + pr[ic]);
+
+                if (cp[ic] > -1e15 && wl > 0.0 && (all || req.count(gobs2str(gL))))
+                {
+                    obs->addobs(gL, (rng[j] + cp[ic]) / wl);
+
+                    // loss of lock from lock time indicator
+                    int lli = 0;
+                    map<GOBS, int> &prev = _lock[prn];
+                    auto itLCK = prev.find(gL);
+                    if (itLCK != prev.end() && ((lock[ic] == 0 && itLCK->second == 0) || lock[ic] < itLCK->second))
+                        lli |= 1;
+                    if (half[ic])
+                        lli |= 2;
+                    prev[gL] = lock[ic];
+                    obs->addlli(gL, lli);
+                }
+
+                if (msm != 4 && rr[ic] > -1e15 && wl > 0.0 && (all || req.count(gobs2str(gD))))
+                    obs->addobs(gD, -(rate[j] + rr[ic]) / wl);
+
+                if (cnr[ic] > 0.0 && (all || req.count(gobs2str(gS))))
+                    obs->addobs(gS, cnr[ic]);
+            }
+        }
+
+        // last message of the epoch
+        if (sync == 0)
+            cnt += _fill_obs();
+
+        return 1;
+    }
+
+    int t_rtcm3::_fill_obs()
+    {
+        if (_epo_obs.empty())
+            return 0;
+
+        vector<t_spt_gobs> vobs;
+        vobs.reserve(_epo_obs.size());
+        for (auto &itOBS : _epo_obs)
+            vobs.push_back(itOBS.second);
+        _epo_obs.clear();
+
+        if (_epo < _beg || _epo > _end || !_filter_epoch(_epo))
+            return 0;
+
+        int cnt = 0;
+        for (auto itDAT = _data.begin(); itDAT != _data.end(); ++itDAT)
+        {
+            if (itDAT->second->id_type() != t_gdata::ALLOBS)
+                continue;
+
+            int nobs = ((t_gallobs *)itDAT->second)->addobs(vobs);
+            (void)nobs; // only logged, SPDLOG_LOGGER_DEBUG may be compiled out
+
+            if (_spdlog)
+                SPDLOG_LOGGER_DEBUG(_spdlog, int2str(nobs) + " obs filled " + _epo.str_ymdhms() + " " + _site);
+            cnt = 1;
+        }
+
+        if (cnt && _notify)
+            _notify(_site, _epo);
+
+        return cnt;
+    }
+
+    int t_rtcm3::_fill_nav(shared_ptr<t_gnav> geph, const string &prn, const t_gtime &toc, const t_gnavdata &data)
+    {
+        if (!_filter_gnss(prn))
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_DEBUG(_spdlog, "skip " + prn);
+            return 0;
+        }
+
+        if (geph->data2nav(prn, toc, data) < 0)
+            return -1;
+        geph->gio(_gio_ptr.lock());
+
+        for (auto it = _data.begin(); it != _data.end(); ++it)
+        {
+            if (it->second->id_type() == t_gdata::ALLNAV ||
+                it->second->id_group() == t_gdata::GRP_EPHEM)
+            {
+                ((t_gallnav *)it->second)->add(geph);
+            }
+            else if (it->second->id_type() == t_gdata::ALLOBJ && geph->id_type() == t_gdata::EPHGLO)
+            {
+                shared_ptr<t_gobj> one_obj = ((t_gallobj *)it->second)->obj(prn);
+                if (one_obj != 0)
+                    one_obj->channel(dynamic_pointer_cast<t_gnavglo>(geph)->channel());
+            }
+        }
+
+        if (_spdlog)
+            SPDLOG_LOGGER_DEBUG(_spdlog, geph->linefmt() + " rtcm3");
+        return 1;
+    }
+
+    int t_rtcm3::_decode_1019(const unsigned char *msg, int len)
+    {
+        if (len < 61)
+            return -1;
+
+        t_gnavdata data = {0};
+        int i = 12;
+        int prn = _getbitu(msg, i, 6);     i += 6;
+        int week = _getbitu(msg, i, 10);   i += 10;
+        int sva = _getbitu(msg, i, 4);     i += 4;
+        data[20] = _getbitu(msg, i, 2);    i += 2;  // codes on L2
+        data[19] = _getbits(msg, i, 14) * P2_43 * SC2RAD; i += 14;
+        data[3] = _getbitu(msg, i, 8);     i += 8;
+        double toc = _getbitu(msg, i, 16) * 16.0; i += 16;
+        data[2] = _getbits(msg, i, 8) * P2_55;  i += 8;
+        data[1] = _getbits(msg, i, 16) * P2_43; i += 16;
+        data[0] = _getbits(msg, i, 22) * P2_31; i += 22;
+        data[26] = _getbitu(msg, i, 10);   i += 10;
+        data[4] = _getbits(msg, i, 16) * P2_5;  i += 16;
+        data[5] = _getbits(msg, i, 16) * P2_43 * SC2RAD; i += 16;
+        data[6] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[7] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[8] = _getbitu(msg, i, 32) * P2_33; i += 32;
+        data[9] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[10] = _getbitu(msg, i, 32) * P2_19; i += 32;
+        data[11] = _getbitu(msg, i, 16) * 16.0; i += 16;
+        data[12] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[13] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[14] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[15] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[16] = _getbits(msg, i, 16) * P2_5;  i += 16;
+        data[17] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[18] = _getbits(msg, i, 24) * P2_43 * SC2RAD; i += 24;
+        data[25] = _getbits(msg, i, 8) * P2_31; i += 8;
+        data[24] = _getbitu(msg, i, 6);    i += 6;
+        data[22] = _getbitu(msg, i, 1);    i += 1;  // L2 P data flag
+        data[28] = _getbitu(msg, i, 1) ? 6.0 : 4.0; // fit interval [h]
+
+        week = _week(week, 1024);
+        data[21] = week;
+        data[23] = URA_EPH[sva];
+
+        if (toc - data[11] > 302400.0)
+            week--;
+        else if (toc - data[11] < -302400.0)
+            week++;
+        t_gtime tt(t_gtime::GPS);
+        tt.from_gws(week, toc);
+
+        string sat = t_gsys::eval_sat(prn, GPS);
+        shared_ptr<t_gnav> geph = make_shared<t_gnavgps>(_spdlog);
+        return _fill_nav(geph, sat, tt, data);
+    }
+
+    int t_rtcm3::_decode_1020(const unsigned char *msg, int len)
+    {
+        if (len < 45)
+            return -1;
+
+        t_gnavdata data = {0};
+        int i = 12;
+        int prn = _getbitu(msg, i, 6);      i += 6;
+        int frq = _getbitu(msg, i, 5) - 7;  i += 5 + 1 + 1 + 2;
+        int tk_h = _getbitu(msg, i, 5);     i += 5;
+        int tk_m = _getbitu(msg, i, 6);     i += 6;
+        int tk_s = _getbitu(msg, i, 1) * 30; i += 1;
+        int bn = _getbitu(msg, i, 1);       i += 1 + 1;
+        int tb = _getbitu(msg, i, 7);       i += 7;
+        data[4] = _getbitg(msg, i, 24) * P2_20;  i += 24;
+        data[3] = _getbitg(msg, i, 27) * P2_11;  i += 27;
+        data[5] = _getbitg(msg, i, 5) * P2_30;   i += 5;
+        data[8] = _getbitg(msg, i, 24) * P2_20;  i += 24;
+        data[7] = _getbitg(msg, i, 27) * P2_11;  i += 27;
+        data[9] = _getbitg(msg, i, 5) * P2_30;   i += 5;
+        data[12] = _getbitg(msg, i, 24) * P2_20; i += 24;
+        data[11] = _getbitg(msg, i, 27) * P2_11; i += 27;
+        data[13] = _getbitg(msg, i, 5) * P2_30;  i += 5 + 1;
+        data[1] = _getbitg(msg, i, 11) * P2_40;  i += 11 + 2 + 1;
+        double taun = _getbitg(msg, i, 22) * P2_30; i += 22 + 5;
+        data[14] = _getbitu(msg, i, 5);
+
+        data[0] = -taun;
+        data[6] = bn;
+        data[10] = frq;
+        data[2] = tk_h * 3600.0 + tk_m * 60.0 + tk_s - 10800.0; // Moscow -> UTC time of day
+
+        string sat = t_gsys::eval_sat(prn, GLO);
+        _glo_chn[sat] = frq;
+
+        // tb [15 min] in Moscow time, closest day to the reference time
+        t_gtime ref = _reference();
+        ref.tsys(t_gtime::UTC);
+        t_gtime toe(t_gtime::UTC);
+        toe.from_gws(ref.gwk(), ref.dow() * 86400.0 + tb * 900.0 - 10800.0);
+        if (toe - ref > 43200.0)
+            toe = toe - 86400.0;
+        else if (toe - ref < -43200.0)
+            toe = toe + 86400.0;
+
+        shared_ptr<t_gnav> geph = make_shared<t_gnavglo>(_spdlog);
+        return _fill_nav(geph, sat, toe, data);
+    }
+
+    int t_rtcm3::_decode_1042(const unsigned char *msg, int len)
+    {
+        if (len < 64)
+            return -1;
+
+        t_gnavdata data = {0};
+        int i = 12;
+        int prn = _getbitu(msg, i, 6);     i += 6;
+        int week = _getbitu(msg, i, 13);   i += 13;
+        int urai = _getbitu(msg, i, 4);    i += 4;
+        data[19] = _getbits(msg, i, 14) * P2_43 * SC2RAD; i += 14;
+        data[3] = _getbitu(msg, i, 5);     i += 5;
+        double toc = _getbitu(msg, i, 17) * 8.0; i += 17;
+        data[2] = _getbits(msg, i, 11) * P2_66; i += 11;
+        data[1] = _getbits(msg, i, 22) * P2_50; i += 22;
+        data[0] = _getbits(msg, i, 24) * P2_33; i += 24;
+        data[28] = _getbitu(msg, i, 5);    i += 5;
+        data[4] = _getbits(msg, i, 18) * P2_6;  i += 18;
+        data[5] = _getbits(msg, i, 16) * P2_43 * SC2RAD; i += 16;
+        data[6] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[7] = _getbits(msg, i, 18) * P2_31; i += 18;
+        data[8] = _getbitu(msg, i, 32) * P2_33; i += 32;
+        data[9] = _getbits(msg, i, 18) * P2_31; i += 18;
+        data[10] = _getbitu(msg, i, 32) * P2_19; i += 32;
+        data[11] = _getbitu(msg, i, 17) * 8.0;  i += 17;
+        data[12] = _getbits(msg, i, 18) * P2_31; i += 18;
+        data[13] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[14] = _getbits(msg, i, 18) * P2_31; i += 18;
+        data[15] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[16] = _getbits(msg, i, 18) * P2_6;  i += 18;
+        data[17] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[18] = _getbits(msg, i, 24) * P2_43 * SC2RAD; i += 24;
+        data[25] = _getbits(msg, i, 10) * 1E-10; i += 10;
+        data[26] = _getbits(msg, i, 10) * 1E-10; i += 10;
+        data[24] = _getbitu(msg, i, 1);
+
+        int gweek = _week(week, 8192, CONV_BWK2GWK); // GPS-numbered week of BDT
+        data[21] = gweek - CONV_BWK2GWK;
+        data[23] = URA_EPH[urai];
+
+        if (toc - data[11] > 302400.0)
+            gweek--;
+        else if (toc - data[11] < -302400.0)
+            gweek++;
+        t_gtime tt(t_gtime::BDS);
+        tt.from_gws(gweek, toc);
+
+        string sat = t_gsys::eval_sat(prn, BDS);
+        shared_ptr<t_gnav> geph = make_shared<t_gnavbds>(_spdlog);
+        return _fill_nav(geph, sat, tt, data);
+    }
+
+    int t_rtcm3::_decode_1045(const unsigned char *msg, int len, bool inav)
+    {
+        if (len < (inav ? 63 : 62))
+            return -1;
+
+        t_gnavdata data = {0};
+        int i = 12;
+        int prn = _getbitu(msg, i, 6);     i += 6;
+        int week = _getbitu(msg, i, 12);   i += 12;
+        data[3] = _getbitu(msg, i, 10);    i += 10;
+        int sisa = _getbitu(msg, i, 8);    i += 8;
+        data[19] = _getbits(msg, i, 14) * P2_43 * SC2RAD; i += 14;
+        double toc = _getbitu(msg, i, 14) * 60.0; i += 14;
+        data[2] = _getbits(msg, i, 6) * P2_59;  i += 6;
+        data[1] = _getbits(msg, i, 21) * P2_46; i += 21;
+        data[0] = _getbits(msg, i, 31) * P2_34; i += 31;
+        data[4] = _getbits(msg, i, 16) * P2_5;  i += 16;
+        data[5] = _getbits(msg, i, 16) * P2_43 * SC2RAD; i += 16;
+        data[6] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[7] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[8] = _getbitu(msg, i, 32) * P2_33; i += 32;
+        data[9] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[10] = _getbitu(msg, i, 32) * P2_19; i += 32;
+        data[11] = _getbitu(msg, i, 14) * 60.0;  i += 14;
+        data[12] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[13] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[14] = _getbits(msg, i, 16) * P2_29; i += 16;
+        data[15] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[16] = _getbits(msg, i, 16) * P2_5;  i += 16;
+        data[17] = _getbits(msg, i, 32) * P2_31 * SC2RAD; i += 32;
+        data[18] = _getbits(msg, i, 24) * P2_43 * SC2RAD; i += 24;
+        data[25] = _getbits(msg, i, 10) * P2_32; i += 10;
+
+        int health = 0;
+        if (inav)
+        {
+            data[26] = _getbits(msg, i, 10) * P2_32; i += 10;
+            int e5b_hs = _getbitu(msg, i, 2);  i += 2;
+            int e5b_dvs = _getbitu(msg, i, 1); i += 1;
+            int e1_hs = _getbitu(msg, i, 2);   i += 2;
+            int e1_dvs = _getbitu(msg, i, 1);
+            health = (e5b_hs << 7) | (e5b_dvs << 6) | (e1_hs << 1) | e1_dvs;
+            data[20] = 517; // I/NAV E1-B, E5b (af0-af2 toc E5b,E1)
+        }
+        else
+        {
+            int e5a_hs = _getbitu(msg, i, 2);  i += 2;
+            int e5a_dvs = _getbitu(msg, i, 1);
+            health = (e5a_hs << 4) | (e5a_dvs << 3);
+            data[20] = 258; // F/NAV E5a (af0-af2 toc E5a,E1)
+        }
+        data[24] = health;
+        data[23] = _sisa2m(sisa);
+
+        week = _week(week + 1024, 4096); // GST week aligned with GPS week
+        data[21] = week;
+
+        if (toc - data[11] > 302400.0)
+            week--;
+        else if (toc - data[11] < -302400.0)
+            week++;
+        t_gtime tt(t_gtime::GAL);
+        tt.from_gws(week, toc);
+
+        string sat = t_gsys::eval_sat(prn, GAL);
+        shared_ptr<t_gnav> geph = make_shared<t_gnavgal>(_spdlog);
+        return _fill_nav(geph, sat, tt, data);
+    }
+
+    t_gtime t_rtcm3::_reference() const
+    {
+        if (_reftime != FIRST_TIME)
+            return _reftime;
+        if (_epo != FIRST_TIME)
+            return _epo;
+        if (_beg != FIRST_TIME && _beg != LAST_TIME)
+            return _beg;
+        return t_gtime::current_time(t_gtime::GPS);
+    }
+
+    t_gtime t_rtcm3::_tow2time(double tow, const t_gtime::t_tsys &ts) const
+    {
+        t_gtime ref = _reference();
+        ref.tsys(ts);
+
+        int week = ref.gwk();
+        double sow = ref.sow() + ref.dsec();
+        if (tow < sow - 302400.0)
+            week++;
+        else if (tow > sow + 302400.0)
+            week--;
+
+        t_gtime tt(ts);
+        tt.from_gws(week, tow);
+        tt.tsys(t_gtime::GPS);
+        return tt;
+    }
+
+    t_gtime t_rtcm3::_glo2time(int dow, double tod) const
+    {
+        t_gtime ref = _reference();
+        ref.tsys(t_gtime::UTC);
+
+        // reference in Moscow time (UTC + 3h)
+        int week = ref.gwk();
+        double sow = ref.sow() + ref.dsec() + 10800.0;
+        double msow = 0.0;
+        if (dow < 7)
+        {
+            msow = dow * 86400.0 + tod;
+            if (msow < sow - 302400.0)
+                msow += 604800.0;
+            else if (msow > sow + 302400.0)
+                msow -= 604800.0;
+        }
+        else
+        {
+            msow = floor(sow / 86400.0) * 86400.0 + tod;
+            if (msow < sow - 43200.0)
+                msow += 86400.0;
+            else if (msow > sow + 43200.0)
+                msow -= 86400.0;
+        }
+
+        t_gtime tt(t_gtime::UTC);
+        tt.from_gws(week, msow - 10800.0);
+        tt.tsys(t_gtime::GPS);
+        return tt;
+    }
+
+    int t_rtcm3::_week(int week, int mod, int offset) const
+    {
+        int full = week + offset;
+        int ref = _reference().gwk();
+        int n = (int)floor((ref - full) / (double)mod + 0.5);
+        return full + n * mod;
+    }
+
+    string t_rtcm3::_msm_sig(const GSYS &gsys, int sig)
+    {
+        // RTCM 10403.3 MSM signal id -> RINEX 3 band/attribute
+        static const char *gps[32] = {"", "1C", "1P", "1W", "", "", "", "2C", "2P", "2W", "", "", "", "", "2S", "2L",
+                                      "2X", "", "", "", "", "5I", "5Q", "5X", "", "", "", "", "", "1S", "1L", "1X"};
+        static const char *glo[32] = {"", "1C", "1P", "", "", "", "", "2C", "2P", "", "", "", "", "", "", "",
+                                      "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", ""};
+        static const char *gal[32] = {"", "1C", "1A", "1B", "1X", "1Z", "", "6C", "6A", "6B", "6X", "6Z", "", "7I", "7Q", "7X",
+                                      "", "8I", "8Q", "8X", "", "5I", "5Q", "5X", "", "", "", "", "", "", "", ""};
+        static const char *qzs[32] = {"", "1C", "", "", "", "", "", "", "6S", "6L", "6X", "", "", "", "2S", "2L",
+                                      "2X", "", "", "", "", "5I", "5Q", "5X", "", "", "", "", "", "1S", "1L", "1X"};
+        // BDS-3 B2b (7D) is handled as band 9 as in RINEX 3.04 decoding
+        static const char *bds[32] = {"", "2I", "2Q", "2X", "", "", "", "6I", "6Q", "6X", "", "", "", "7I", "7Q", "7X",
+                                      "", "", "", "", "", "5D", "5P", "5X", "9D", "", "", "", "", "1D", "1P", "1X"};
+
+        if (sig < 1 || sig > 32)
+            return "";
+
+        switch (gsys)
+        {
+        case GPS:
+            return gps[sig - 1];
+        case GLO:
+            return glo[sig - 1];
+        case GAL:
+            return gal[sig - 1];
+        case QZS:
+            return qzs[sig - 1];
+        case BDS:
+            return bds[sig - 1];
+        default:
+            return "";
+        }
+    }
+
+    unsigned int t_rtcm3::_getbitu(const unsigned char *buff, int pos, int len)
+    {
+        unsigned int bits = 0;
+        for (int i = pos; i < pos + len; ++i)
+            bits = (bits << 1) + ((buff[i / 8] >> (7 - i % 8)) & 1u);
+        return bits;
+    }
+
+    int t_rtcm3::_getbits(const unsigned char *buff, int pos, int len)
+    {
+        unsigned int bits = _getbitu(buff, pos, len);
+        if (len <= 0 || 32 <= len || !(bits & (1u << (len - 1))))
+            return (int)bits;
+        return (int)(bits | (~0u << len)); // extend sign
+    }
+
+    double t_rtcm3::_getbitg(const unsigned char *buff, int pos, int len)
+    {
+        double value = _getbitu(buff, pos + 1, len - 1);
+        return _getbitu(buff, pos, 1) ? -value : value;
+    }
+
+    unsigned int t_rtcm3::_crc24q(const unsigned char *buff, int len)
+    {
+        // built once, function-local static initialization is thread safe
+        struct t_tbl
+        {
+            unsigned int v[256];
+        };
+        static const t_tbl tbl = []() {
+            t_tbl t;
+            for (unsigned int i = 0; i < 256; ++i)
+            {
+                unsigned int crc = i << 16;
+                for (int j = 0; j < 8; ++j)
+                {
+                    crc <<= 1;
+                    if (crc & 0x1000000)
+                        crc ^= 0x1864CFB;
+                }
+                t.v[i] = crc & 0xFFFFFF;
+            }
+            return t;
+        }();
+
+        unsigned int crc = 0;
+        for (int i = 0; i < len; ++i)
+            crc = ((crc << 8) & 0xFFFFFF) ^ tbl.v[(crc >> 16) ^ buff[i]];
+        return crc;
+    }
+
+} // namespace
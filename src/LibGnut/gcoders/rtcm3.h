@@ -0,0 +1,151 @@
+/**
+ * @file         rtcm3.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        RTCM 3 stream decoder (MSM4/5/7 observations, GPS/GLO/GAL/BDS ephemerides)
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   supported messages:
+ *   ===================================================================================
+ *     MSM4/5/7    1074/1075/1077 GPS, 1084/1085/1087 GLO, 1094/1095/1097 GAL,
+ *                 1114/1115/1117 QZS, 1124/1125/1127 BDS
+ *     ephemeris   1019 GPS, 1020 GLO, 1042 BDS, 1045 GAL F/NAV, 1046 GAL I/NAV
+ *   ===================================================================================
+ *   An epoch is passed to t_gallobs when the MSM multiple message bit is zero
+ *   (or when a message of a new epoch arrives, or at the end of input). Weeks are
+ *   resolved with respect to the reference time (current time for streams, set
+ *   reftime() for recordings).
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef RTCM3_H
+#define RTCM3_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+
+#include "gcoders/gcoder.h"
+#include "gall/gallobs.h"
+#include "gall/gallnav.h"
+#include "gdata/gnav.h"
+#include "gutils/gtime.h"
+#include "gutils/gsys.h"
+#include "gutils/gobs.h"
+
+#define RTCM3_PREAMB 0xD3 ///< RTCM 3 frame preamble
+#define RTCM3_MAXLEN 1023 ///< maximum message length [bytes]
+
+using namespace std;
+
+namespace gnut
+{
+
+    /**
+    *@brief Class for RTCM 3 decoding derive from t_gcoder
+    */
+    class LibGnut_LIBRARY_EXPORT t_rtcm3 : public t_gcoder
+    {
+
+    public:
+        /** @brief constructor set + version + sz. */
+        t_rtcm3(t_gsetbase *s, string version = "", int sz = DEFAULT_BUFFER_SIZE);
+
+        /** @brief default destructor. */
+        virtual ~t_rtcm3();
+
+        /** @brief no header in RTCM 3 streams (data are kept for decode_data). */
+        virtual int decode_head(char *buff, int sz, vector<string> &errmsg);
+
+        /**
+         * @brief decode all complete RTCM 3 frames in the buffer
+         *
+         * @param buff
+         * @param sz
+         * @param cnt     number of epochs passed to t_gallobs
+         * @param errmsg
+         * @return int    number of bytes consumed
+         */
+        virtual int decode_data(char *buff, int sz, int &cnt, vector<string> &errmsg);
+
+        /** @brief end of input, pass the epoch still waiting for messages with the multiple message bit set. */
+        virtual int decode_end(int &cnt, vector<string> &errmsg);
+
+        /** @brief set/get site name of the observations (default: mountpoint/file name). */
+        void site(const string &s) { _site = s; }
+        const string &site() const { return _site; }
+
+        /** @brief set reference time for week resolution (recorded streams). */
+        void reftime(const t_gtime &t) { _reftime = t; }
+
+        /** @brief number of decoded messages per type. */
+        const map<int, int> &msgcount() const { return _nmsg; }
+
+        /** @brief number of frames with CRC failure. */
+        int crcfail() const { return _ncrc; }
+
+        /** @brief callback for epochs completed in t_gallobs (site, epoch), called from the reading thread. */
+        void epoch_notify(function<void(const string &, const t_gtime &)> f) { _notify = f; }
+
+    protected:
+        /** @brief decode single message (without frame). */
+        virtual int _decode_msg(const unsigned char *msg, int len, int &cnt);
+
+        /** @brief decode MSM 4/5/7 observations. */
+        virtual int _decode_msm(const unsigned char *msg, int len, GSYS gsys, int msm, int &cnt);
+
+        /** @brief decode ephemerides. */
+        virtual int _decode_1019(const unsigned char *msg, int len);
+        virtual int _decode_1020(const unsigned char *msg, int len);
+        virtual int _decode_1042(const unsigned char *msg, int len);
+        virtual int _decode_1045(const unsigned char *msg, int len, bool inav);
+
+        /** @brief pass collected epoch to t_gallobs. */
+        virtual int _fill_obs();
+
+        /** @brief pass ephemeris to t_gallnav. */
+        virtual int _fill_nav(shared_ptr<t_gnav> geph, const string &prn, const t_gtime &toc, const t_gnavdata &data);
+
+        /** @brief reference time for week resolution. */
+        t_gtime _reference() const;
+
+        /** @brief time from time-of-week in time system ts (week resolved). */
+        t_gtime _tow2time(double tow, const t_gtime::t_tsys &ts) const;
+
+        /** @brief GPS time from GLONASS day-of-week (7 = unknown) and time-of-day. */
+        t_gtime _glo2time(int dow, double tod) const;
+
+        /** @brief week resolution of truncated week number (modulo nbits). */
+        int _week(int week, int mod, int offset = 0) const;
+
+        /** @brief RINEX 3 signal code for MSM signal id (empty if not supported). */
+        static string _msm_sig(const GSYS &gsys, int sig);
+
+        /** @brief bit field extraction. */
+        static unsigned int _getbitu(const unsigned char *buff, int pos, int len);
+        static int _getbits(const unsigned char *buff, int pos, int len);
+        static double _getbitg(const unsigned char *buff, int pos, int len); ///< sign-magnitude (GLONASS)
+
+        /** @brief CRC-24Q parity. */
+        static unsigned int _crc24q(const unsigned char *buff, int len);
+
+        string _site;                         ///< working site
+        t_gtime _reftime;                     ///< reference time (FIRST_TIME = current time)
+        t_gtime _epo;                         ///< working epoch
+        map<string, t_spt_gobs> _epo_obs;     ///< working observations of the epoch
+        map<string, map<GOBS, int>> _lock;    ///< lock time indicators (cycle slips)
+        map<string, int> _glo_chn;            ///< GLONASS frequency channels
+        map<int, int> _nmsg;                  ///< decoded messages per type
+        int _ncrc;                            ///< frames with CRC failure
+        function<void(const string &, const t_gtime &)> _notify; ///< epoch completed
+
+    private:
+    };
+
+} // namespace
+
+#endif
@@ -331,7 +331,10 @@ namespace gnut
         _gmutex.lock();
 
         if (!this->_valid())
+        {
+            _gmutex.unlock();
             return -1;
+        }
 
         data[0] = -_tau; // in RINEX is stored -tauN
         data[1] = _gamma;
@@ -496,7 +496,10 @@ namespace gnut
         _gmutex.lock();
 
         if (!this->_valid())
+        {
+            _gmutex.unlock();
             return -1;
+        }
 
         data[0] = _f0;
         data[1] = _f1;
@@ -2002,12 +2002,11 @@ namespace gnut
 #endif
         _gmutex.lock();
 
-        if (!code.is_code())
-            return NULL_GOBS;
-        if (!L1.is_phase())
-            return NULL_GOBS;
-        if (!L2.is_phase())
+        if (!code.is_code() || !L1.is_phase() || !L2.is_phase())
+        {
+            _gmutex.unlock();
             return NULL_GOBS;
+        }
 
         double coef1, coef2, coefC;
         double C = _obs_range(code);
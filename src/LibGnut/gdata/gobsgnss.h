@@ -624,6 +624,13 @@ namespace gnut
          */
         void site(const string &id) { _staid = id; }
 
+        /**
+         * @brief set satellite lost-of-lock identifications
+         *
+         * @param lli
+         */
+        void lli(const map<GOBS, int> &lli) { _glli = lli; }
+
         /**
          * @brief set epoch
          * 
@@ -10,6 +10,7 @@
 #include "gio/gio.h"
 #include "gutils/gcommon.h"
 #include "gutils/gtypeconv.h"
+#include "gutils/gprofiler.h"
 
 using namespace std;
 
@@ -130,7 +131,10 @@ namespace gnut
             // volatile int decoded = 0;
             if (_coder && nbytes > 0)
             {
-                _coder->decode_data(loc_buff, nbytes, _count, errmsg);
+                {
+                    GPROF_SCOPE(PROF_DECODE);
+                    _coder->decode_data(loc_buff, nbytes, _count, errmsg);
+                }
                 
                 if (_coder->end_epoch > t_gtime(0, 0))
                 {
@@ -148,6 +152,10 @@ namespace gnut
 
         }
 
+        // end of input, e.g. the last epoch of a stream kept for further messages
+        if (_coder)
+            _coder->decode_end(_count, errmsg);
+
         _stop_common();
         delete[] loc_buff;
         _gmutex.unlock();
@@ -0,0 +1,102 @@
+/**
+ * @file         giofasync.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        output file written by a background thread
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <chrono>
+#include "gio/giofasync.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_giofasync::t_giofasync(string mask, size_t bufsize)
+        : t_giof(mask),
+          _bufsize(bufsize > 0 ? bufsize : 1),
+          _busy(false),
+          _flush(false),
+          _stop(false),
+          _err(0)
+    {
+        _front.reserve(_bufsize);
+        _writer = thread(&t_giofasync::_run, this);
+    }
+
+    t_giofasync::~t_giofasync()
+    {
+        {
+            lock_guard<mutex> lk(_mtx);
+            _stop = true;
+        }
+        _cv_data.notify_one();
+        if (_writer.joinable())
+            _writer.join();
+    }
+
+    int t_giofasync::write(const char *buff, int size)
+    {
+        if (_mask == "" || size < 1)
+            return -1;
+
+        unique_lock<mutex> lk(_mtx);
+        if (_err > 0)
+            return -1;
+        _cv_space.wait(lk, [this] { return _front.size() < 4 * _bufsize; });
+        _front.append(buff, size);
+        bool full = _front.size() >= _bufsize;
+        lk.unlock();
+        if (full)
+            _cv_data.notify_one();
+        return size;
+    }
+
+    int t_giofasync::sync()
+    {
+        unique_lock<mutex> lk(_mtx);
+        _flush = true;
+        _cv_data.notify_one();
+        _cv_space.wait(lk, [this] { return _front.empty() && !_busy; });
+        return _err > 0 ? -1 : 0;
+    }
+
+    void t_giofasync::_run()
+    {
+        string back;
+        back.reserve(_bufsize);
+        unique_lock<mutex> lk(_mtx);
+        while (true)
+        {
+            // a partial buffer goes out after one second, the file follows the processing
+            _cv_data.wait_for(lk, chrono::seconds(1), [this] { return _stop || _flush || _front.size() >= _bufsize; });
+            _flush = false;
+            if (_front.empty())
+            {
+                _cv_space.notify_all();
+                if (_stop)
+                    break;
+                continue;
+            }
+
+            back.swap(_front);
+            _busy = true;
+            lk.unlock();
+            _cv_space.notify_all();
+
+            int irc = t_giof::write(back.data(), static_cast<int>(back.size()));
+            back.clear();
+
+            lk.lock();
+            _busy = false;
+            if (irc < 0)
+                _err++;
+            _cv_space.notify_all();
+        }
+    }
+
+} // namespace
@@ -0,0 +1,73 @@
+/**
+ * @file         giofasync.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        output file written by a background thread
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   write()   appends to a memory buffer and returns, the writer thread moves
+ *             the buffer to t_giof::write() when it holds bufsize bytes or after
+ *             one second without reaching it; the producer blocks only when
+ *             four buffers are waiting (bounded memory)
+ *   sync()    returns when everything written so far is in the file
+ *
+ *   The file name mask is evaluated once per buffer instead of once per call.
+ *   The fstream must not be used directly (flush(), close()) while the
+ *   writer runs, the destructor drains the buffer before closing.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GIOFASYNC_H
+#define GIOFASYNC_H
+
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include "gio/giof.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /** @brief t_giof with buffered writes on a background thread. */
+    class LibGnut_LIBRARY_EXPORT t_giofasync : public t_giof
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] mask       file name mask
+        * @param[in] bufsize    bytes collected before a write to the file
+        */
+        explicit t_giofasync(string mask = "", size_t bufsize = 1 << 20);
+
+        /** @brief destructor, writes the rest and stops the thread. */
+        virtual ~t_giofasync();
+
+        /** @brief queue the data, returns size or -1 after a failed file write. */
+        virtual int write(const char *buff, int size) override;
+
+        /** @brief wait until the queued data is written, returns -1 if a write failed. */
+        int sync();
+
+    protected:
+        /** @brief writer thread. */
+        void _run();
+
+        size_t _bufsize;                ///< buffer size
+        string _front;                  ///< data not yet taken by the writer
+        bool _busy;                     ///< writer is writing a buffer
+        bool _flush;                    ///< sync() requested
+        bool _stop;                     ///< destructor called
+        int _err;                       ///< failed file writes
+        mutex _mtx;                     ///< guards the members above
+        condition_variable _cv_data;    ///< data or request for the writer
+        condition_variable _cv_space;   ///< buffer taken by the writer
+        thread _writer;                 ///< writer thread
+    };
+
+} // namespace
+
+#endif
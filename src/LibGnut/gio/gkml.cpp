@@ -0,0 +1,177 @@
+/**
+ * @file         gkml.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        streaming KML writer of the solution trajectory
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include "gio/gkml.h"
+#include "gutils/gtypeconv.h"
+
+namespace gnut
+{
+    static const char *KML_COLOR[] = {"ff00ff64", "ff78c800", "ffff9600", "ffff6496", "ffff00ff", "ff0000ff"};
+
+    // text of a CDATA section, "]]>" cannot appear inside
+    static string _cdata(const string &s)
+    {
+        string out(s);
+        for (size_t pos = out.find("]]>"); pos != string::npos; pos = out.find("]]>", pos + 15))
+            out.replace(pos, 3, "]]]]><![CDATA[>");
+        return "<![CDATA[" + out + "]]>";
+    }
+
+    // character data
+    static string _escape(const string &s)
+    {
+        string out;
+        for (char c : s)
+        {
+            switch (c)
+            {
+            case '&': out += "&amp;"; break;
+            case '<': out += "&lt;"; break;
+            case '>': out += "&gt;"; break;
+            default: out += c;
+            }
+        }
+        return out;
+    }
+
+    t_gkml::t_gkml(const string &file, const string &name, double intv)
+        : _file(file),
+          _name(name),
+          _intv(intv),
+          _line(0),
+          _opened(false),
+          _closed(false),
+          _good(true),
+          _npts(0)
+    {
+    }
+
+    t_gkml::~t_gkml()
+    {
+        close();
+    }
+
+    bool t_gkml::placemark(const t_gtime &epoch, double lon, double lat, const string &grade, const string &desc)
+    {
+        if (_closed || !_good)
+            return false;
+        if (_intv > 0.0 && _npts > 0 && fabs(epoch.diff(_last)) < _intv - 1e-6)
+            return false;
+        if (!_opened && !_open())
+            return false;
+
+        ostringstream crd;
+        crd << fixed << setprecision(11) << " " << lon << ',' << lat;
+
+        _out << "    <Placemark>\n"
+             << "      <styleUrl>#P" << grade << "</styleUrl>\n"
+             << "      <time>" << int2str(epoch.sow()) << "</time>\n"
+             << "      <Point>\n"
+             << "        <coordinates>" << crd.str() << "</coordinates>\n"
+             << "      </Point>\n"
+             << "      <description>" << _cdata(desc) << "</description>\n"
+             << "      <TimeStamp>\n"
+             << "        <when>" << trim(epoch.str_ymd()) << "T" << trim(epoch.str_hms()) << "Z</when>\n"
+             << "      </TimeStamp>\n"
+             << "    </Placemark>\n";
+
+        if (_line)
+            fputs(crd.str().c_str(), _line);
+
+        _good = !_out.fail();
+        _last = epoch;
+        _npts++;
+        return _good;
+    }
+
+    void t_gkml::close()
+    {
+        if (_closed)
+            return;
+        if (!_opened && !_open())
+        {
+            _closed = true;
+            return;
+        }
+        _closed = true;
+
+        _out << "    <Placemark>\n"
+             << "      <name>Trajection</name>\n"
+             << "      <Style>\n"
+             << "        <LineStyle>\n"
+             << "          <color>ff00ffff</color>\n"
+             << "          <width>2</width>\n"
+             << "        </LineStyle>\n"
+             << "      </Style>\n"
+             << "      <LineString>\n"
+             << "        <coordinates>";
+        if (_line)
+        {
+            char buf[65536];
+            size_t n;
+            rewind(_line);
+            while ((n = fread(buf, 1, sizeof(buf), _line)) > 0)
+                _out.write(buf, n);
+            fclose(_line);
+            _line = 0;
+        }
+        _out << "</coordinates>\n"
+             << "      </LineString>\n"
+             << "    </Placemark>\n"
+             << "  </Document>\n"
+             << "</kml>\n";
+        _out.close();
+        if (_out.fail())
+            cerr << "Warning: KML-file not completed: " << _file << endl;
+    }
+
+    bool t_gkml::_open()
+    {
+        _opened = true;
+        _out.open(_file.c_str(), ios::out | ios::trunc);
+        if (!_out.is_open())
+        {
+            cerr << "Warning: Cannot create KML-file " << _file << endl;
+            _good = false;
+            return false;
+        }
+        _line = tmpfile();
+        if (!_line)
+            cerr << "Warning: Cannot create temporary file, KML-file without trajectory line" << endl;
+
+        _out << "<?xml version=\"1.0\"?>\n"
+             << "<kml>\n"
+             << "  <Document>\n"
+             << "    <name>" << _escape(_name) << "</name>\n";
+        for (size_t i = 0; i < sizeof(KML_COLOR) / sizeof(KML_COLOR[0]); i++)
+        {
+            _out << "    <Style id=\"P" << i + 1 << "\">\n"
+                 << "      <IconStyle>\n"
+                 << "        <color>" << KML_COLOR[i] << "</color>\n"
+                 << "        <scale>0.7</scale>\n"
+                 << "        <Icon>\n"
+                 << "          <href>http://maps.google.com/mapfiles/kml/shapes/placemark_circle.png</href>\n"
+                 << "        </Icon>\n"
+                 << "      </IconStyle>\n"
+                 << "      <BalloonStyle>\n"
+                 << "        <color>ffd5f3fa</color>\n"
+                 << "        <text>" << _cdata("<b><font color=\"#CC0000\" size=\"+3\">$[name]</font></b><br>$[description]</font><br/>") << "</text>\n"
+                 << "      </BalloonStyle>\n"
+                 << "    </Style>\n";
+        }
+        _good = !_out.fail();
+        return _good;
+    }
+}
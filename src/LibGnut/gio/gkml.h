@@ -0,0 +1,88 @@
+/**
+ * @file         gkml.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        streaming KML writer of the solution trajectory
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   kml/Document   name, styles P1 ... P6 (quality grades), one Placemark per output
+ *                  epoch written when it is added, the "Trajection" LineString last
+ *
+ *   The placemarks go to the file as they come and the line coordinates to a
+ *   temporary file copied in at close(), so the memory does not grow with the
+ *   run. With an interval, epochs closer than it to the last written one are
+ *   skipped (placemarks and line).
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GKML_H
+#define GKML_H
+
+#include <cstdio>
+#include <string>
+#include <fstream>
+#include "gexport/ExportLibGnut.h"
+#include "gutils/gtime.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+    * @brief KML trajectory written epoch by epoch
+    */
+    class LibGnut_LIBRARY_EXPORT t_gkml
+    {
+    public:
+        /**
+        * @brief constructor, the file is created with the first placemark or at close()
+        * @param[in] file       kml file
+        * @param[in] name       document name
+        * @param[in] intv       minimum interval of the written epochs [s], 0 = all
+        */
+        t_gkml(const string &file, const string &name, double intv = 0.0);
+
+        /** @brief destructor, calls close(). */
+        virtual ~t_gkml();
+
+        t_gkml(const t_gkml &) = delete;
+        t_gkml &operator=(const t_gkml &) = delete;
+
+        /**
+        * @brief add one epoch
+        * @param[in] epoch      epoch
+        * @param[in] lon        longitude [deg]
+        * @param[in] lat        latitude [deg]
+        * @param[in] grade      quality grade, style "#P<grade>"
+        * @param[in] desc       balloon description (html)
+        * @return false if skipped by the interval or the file failed
+        */
+        bool placemark(const t_gtime &epoch, double lon, double lat, const string &grade, const string &desc);
+
+        /** @brief write the trajectory line and close the document. */
+        void close();
+
+        /** @brief number of written placemarks. */
+        long size() const { return _npts; }
+
+    protected:
+        /** @brief create the file and write the document head with the styles. */
+        bool _open();
+
+        string _file;           ///< kml file
+        string _name;           ///< document name
+        double _intv;           ///< minimum interval [s]
+        ofstream _out;          ///< kml file
+        FILE *_line;            ///< line coordinates
+        bool _opened;           ///< file created
+        bool _closed;           ///< document closed
+        bool _good;             ///< no write failed
+        t_gtime _last;          ///< last written epoch
+        long _npts;             ///< written placemarks
+    };
+}
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * @file         gntrip.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        NTRIP (v2, HTTP/1.1) client io based on tcp class
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include "gio/gntrip.h"
+#include "gutils/gtypeconv.h"
+
+using namespace std;
+
+namespace gnut
+{
+
+    t_gntrip::t_gntrip(t_spdlog spdlog)
+        : t_gtcp(spdlog),
+          _user(""),
+          _passwd(""),
+          _mount(""),
+          _raw(""),
+          _chunked(false),
+          _chunk_left(0)
+    {
+    }
+
+    t_gntrip::~t_gntrip()
+    {
+    }
+
+    int t_gntrip::path(string str)
+    {
+        if (str == "")
+            return -1;
+
+        string prefix = GNTRIP_PREFIX;
+        if (str.find(prefix) != 0)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "warning: path does not contain ntrip://host:port/mountpoint  [check ntrip://]");
+            return -1;
+        }
+
+        string rest = str.substr(prefix.length());
+
+        // user:passwd@
+        size_t idx = rest.rfind('@');
+        if (idx != string::npos)
+        {
+            string auth = rest.substr(0, idx);
+            rest = rest.substr(idx + 1);
+            size_t ic = auth.find(':');
+            _user = auth.substr(0, ic);
+            _passwd = (ic == string::npos) ? "" : auth.substr(ic + 1);
+        }
+
+        // host[:port]/mountpoint
+        idx = rest.find('/');
+        if (idx == string::npos || idx + 1 >= rest.length())
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "warning: ntrip mountpoint not defined [" + str + "]");
+            return -1;
+        }
+        _mount = rest.substr(idx + 1);
+
+        if (_host_port(rest.substr(0, idx), NTRIP_PORT) < 0 || _port <= 0)
+            return -1;
+
+        return t_gio::path(str);
+    }
+
+    int t_gntrip::_connect()
+    {
+        if (t_gtcp::_connect() < 0)
+            return -1;
+
+        _raw.clear();
+        _chunked = false;
+        _chunk_left = 0;
+
+        string req = "GET /" + _mount + " HTTP/1.1\r\n" +
+                     "Host: " + _host + ":" + int2str(_port) + "\r\n" +
+                     "Ntrip-Version: Ntrip/2.0\r\n" +
+                     "User-Agent: " + NTRIP_AGENT + "\r\n";
+        if (!_user.empty())
+            req += "Authorization: Basic " + _base64(_user + ":" + _passwd) + "\r\n";
+        req += "Connection: close\r\n\r\n";
+
+        if (_send(req.c_str(), (int)req.length()) < 0)
+        {
+            _close();
+            return -1;
+        }
+
+        // response header, NTRIP v1 casters answer with the status line only
+        char buff[TCPBUF_SIZE];
+        size_t iend = string::npos;
+        int ntry = 0;
+        while (true)
+        {
+            size_t ieol = _raw.find("\r\n");
+            if (ieol != string::npos)
+            {
+                string status = _raw.substr(0, ieol);
+                if (status.compare(0, 7, "ICY 200") == 0)
+                {
+                    _raw.erase(0, ieol + 2);
+                    if (_spdlog)
+                        SPDLOG_LOGGER_INFO(_spdlog, "ntrip: mountpoint " + _mount + " requested (v1)");
+                    return 1;
+                }
+                if (status.compare(0, 5, "HTTP/") != 0)
+                {
+                    if (_spdlog)
+                    {
+                        if (status.compare(0, 11, "SOURCETABLE") == 0)
+                            SPDLOG_LOGGER_ERROR(_spdlog, "ntrip: mountpoint not found, sourcetable received " + _host + "/" + _mount);
+                        else
+                            SPDLOG_LOGGER_ERROR(_spdlog, "ntrip: request refused [" + status + "] " + _host + "/" + _mount);
+                    }
+                    _close();
+                    return -1;
+                }
+                if ((iend = _raw.find("\r\n\r\n")) != string::npos)
+                    break;
+            }
+
+            int nbytes = _recv(buff, sizeof(buff));
+            if (nbytes < 0 || (nbytes == 0 && ++ntry > 1) || _raw.length() > 16 * TCPBUF_SIZE)
+            {
+                if (_spdlog)
+                    SPDLOG_LOGGER_ERROR(_spdlog, "ntrip: no response from caster " + _host + "/" + _mount);
+                _close();
+                return -1;
+            }
+            _raw.append(buff, nbytes);
+        }
+
+        string header = _raw.substr(0, iend);
+        _raw.erase(0, iend + 4);
+
+        string status = header.substr(0, header.find("\r\n"));
+        if (status.find(" 200") == string::npos)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_ERROR(_spdlog, "ntrip: request refused [" + status + "] " + _host + "/" + _mount);
+            _close();
+            return -1;
+        }
+
+        string lower = header;
+        transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        if (lower.find("content-type: gnss/sourcetable") != string::npos)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_ERROR(_spdlog, "ntrip: mountpoint not found, sourcetable received " + _host + "/" + _mount);
+            _close();
+            return -1;
+        }
+        _chunked = (lower.find("transfer-encoding: chunked") != string::npos);
+
+        if (_spdlog)
+            SPDLOG_LOGGER_INFO(_spdlog, "ntrip: mountpoint " + _mount + " requested" + string(_chunked ? " (chunked)" : ""));
+        return 1;
+    }
+
+    int t_gntrip::_gio_read(char *buff, int size)
+    {
+        while (_stop != 1)
+        {
+            int nbytes = 0;
+            if (_chunked)
+            {
+                nbytes = _dechunk(buff, size);
+                if (nbytes != 0)
+                    return nbytes;
+            }
+            else if (!_raw.empty())
+            {
+                nbytes = min(size, (int)_raw.length());
+                memcpy(buff, _raw.data(), nbytes);
+                _raw.erase(0, nbytes);
+                return nbytes;
+            }
+            else
+            {
+                return t_gtcp::_gio_read(buff, size);
+            }
+
+            // more raw data needed for the next chunk
+            char tmp[TCPBUF_SIZE];
+            nbytes = t_gtcp::_gio_read(tmp, sizeof(tmp));
+            if (nbytes <= 0)
+                return nbytes;
+            _raw.append(tmp, nbytes);
+        }
+
+        return -1;
+    }
+
+    int t_gntrip::_dechunk(char *buff, int size)
+    {
+        int nout = 0;
+        while (nout < size)
+        {
+            if (_chunk_left == 0)
+            {
+                // skip CRLF after chunk data
+                while (!_raw.empty() && (_raw[0] == '\r' || _raw[0] == '\n'))
+                    _raw.erase(0, 1);
+
+                size_t iend = _raw.find("\r\n");
+                if (iend == string::npos)
+                    break;
+
+                _chunk_left = (int)strtol(_raw.substr(0, iend).c_str(), NULL, 16);
+                _raw.erase(0, iend + 2);
+                if (_chunk_left == 0)
+                {
+                    if (_spdlog)
+                        SPDLOG_LOGGER_WARN(_spdlog, "ntrip: stream closed by caster " + _host + "/" + _mount);
+                    return nout > 0 ? nout : -1;
+                }
+            }
+
+            int ncopy = min(min(_chunk_left, size - nout), (int)_raw.length());
+            if (ncopy <= 0)
+                break;
+            memcpy(buff + nout, _raw.data(), ncopy);
+            _raw.erase(0, ncopy);
+            _chunk_left -= ncopy;
+            nout += ncopy;
+        }
+
+        return nout;
+    }
+
+    string t_gntrip::_base64(const string &str)
+    {
+        static const char tbl[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        string out;
+        size_t i = 0;
+        for (; i + 2 < str.length(); i += 3)
+        {
+            unsigned int v = ((unsigned char)str[i] << 16) | ((unsigned char)str[i + 1] << 8) | (unsigned char)str[i + 2];
+            out += tbl[(v >> 18) & 0x3F];
+            out += tbl[(v >> 12) & 0x3F];
+            out += tbl[(v >> 6) & 0x3F];
+            out += tbl[v & 0x3F];
+        }
+        if (i + 1 == str.length())
+        {
+            unsigned int v = ((unsigned char)str[i] << 16);
+            out += tbl[(v >> 18) & 0x3F];
+            out += tbl[(v >> 12) & 0x3F];
+            out += "==";
+        }
+        else if (i + 2 == str.length())
+        {
+            unsigned int v = ((unsigned char)str[i] << 16) | ((unsigned char)str[i + 1] << 8);
+            out += tbl[(v >> 18) & 0x3F];
+            out += tbl[(v >> 12) & 0x3F];
+            out += tbl[(v >> 6) & 0x3F];
+            out += '=';
+        }
+        return out;
+    }
+
+} // namespace
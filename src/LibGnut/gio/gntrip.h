@@ -0,0 +1,77 @@
+/**
+ * @file         gntrip.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        NTRIP (v2, HTTP/1.1) client io based on tcp class
+ *               ntrip://[user:passwd@]host[:port]/mountpoint
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GNTRIP_H
+#define GNTRIP_H
+
+#include <string>
+
+#include "gio/gtcp.h"
+
+#define GNTRIP_PREFIX "ntrip://"
+#define NTRIP_PORT 2101          ///< default caster port
+#define NTRIP_AGENT "NTRIP GREAT/1.0"
+
+using namespace std;
+
+namespace gnut
+{
+
+    /** @brief class for t_gntrip derive from t_gtcp. */
+    class LibGnut_LIBRARY_EXPORT t_gntrip : public t_gtcp
+    {
+
+    public:
+        /** @brief default constructor. */
+        t_gntrip(t_spdlog spdlog);
+
+        /** @brief default destructor. */
+        virtual ~t_gntrip();
+
+        /**
+        * @brief set ntrip://[user:passwd@]host[:port]/mountpoint.
+        * @param[in]    str        stream path
+        * @return
+        *    @retval =-1 false
+        *    @retval =1    true
+        */
+        virtual int path(string str);
+
+        /** @brief get mountpoint. */
+        const string &mountpoint() const { return _mount; }
+
+    protected:
+        /** @brief read stream data (chunked transfer decoded). */
+        virtual int _gio_read(char *buff, int size);
+
+        /** @brief connect and request the mountpoint. */
+        virtual int _connect();
+
+        /** @brief decode chunked transfer from _raw to buff. */
+        int _dechunk(char *buff, int size);
+
+        /** @brief base64 encoding for basic authorization. */
+        static string _base64(const string &str);
+
+        string _user;     ///< user name
+        string _passwd;   ///< password
+        string _mount;    ///< mountpoint
+        string _raw;      ///< received data not yet passed to decoder
+        bool _chunked;    ///< chunked transfer encoding
+        int _chunk_left;  ///< bytes left in current chunk
+
+    private:
+    };
+
+} // namespace
+
+#endif
@@ -21,6 +21,7 @@ History
 #include "gutils/gfileconv.h"
 #include "gio/grtlog.h"
 #include "spdlog/spdlog.h"
+#include "spdlog/async.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/daily_file_sink.h"
@@ -31,11 +32,38 @@ using namespace spdlog;
 
 namespace gnut
 {
+    // logger of the type, Factory is spdlog::synchronous_factory or spdlog::async_factory
+    template <class Factory>
+    static t_spdlog _make_logger(const string &type, const string &name, const string &file)
+    {
+        if (type.find("CONSOLE") != string::npos)
+            return spdlog::stdout_color_mt<Factory>(name);
+        if (type.find("ROTATING") != string::npos)
+            return spdlog::rotating_logger_mt<Factory>(name, file, 1024 * 1024, 10);
+        if (type.find("BASIC") != string::npos)
+            return spdlog::basic_logger_mt<Factory>(name, file);
+        if (type.find("DAILY") != string::npos)
+            return spdlog::daily_logger_mt<Factory>(name, file, 0, 0);
+        return spdlog::stdout_color_mt<Factory>(name);
+    }
+
+    static t_spdlog _make_logger(const string &type, const string &name, const string &file, bool async)
+    {
+        if (!async)
+            return _make_logger<spdlog::synchronous_factory>(type, name, file);
+
+        // one worker for all loggers, a full queue blocks the caller (no message lost)
+        if (!spdlog::thread_pool())
+            spdlog::init_thread_pool(LOG_ASYNC_QUEUE, 1);
+        return _make_logger<spdlog::async_factory>(type, name, file);
+    }
+
     t_grtlog::t_grtlog()
     {
     }
-    t_grtlog::t_grtlog(const string &log_type, const level::level_enum &log_level, const string &log_name)
+    t_grtlog::t_grtlog(const string &log_type, const level::level_enum &log_level, const string &log_name, bool log_async)
     {
+        _async = log_async;
         _type = log_type;
         transform(_type.begin(), _type.end(), _type.begin(), ::toupper);
         _name = log_name;
@@ -49,45 +77,30 @@ namespace gnut
 
         string str_log_name = _name;
 
-        if (_type.find("CONSOLE") != string::npos)
-        {
-            _spdlog = spdlog::stdout_color_mt(_name);
-        }
-        else if (_type.find("ROTATING") != string::npos)
-        {
-            _spdlog = spdlog::rotating_logger_mt(_name, str_log_name, 1024 * 1024, 10);
-        }
-        else if (_type.find("BASIC") != string::npos)
-        {
-            if (ACCESS(str_log_name.c_str(), 0) != -1)
-            {
-                int re = (remove(str_log_name.c_str()));
-                spdlog::info(re);
-            }
-            _spdlog = spdlog::basic_logger_mt(_name, str_log_name);
-        }
-        else if (_type.find("DAILY") != string::npos)
+        // basic and daily logs start empty
+        bool file_log = _type.find("CONSOLE") == string::npos && _type.find("ROTATING") == string::npos;
+        if (file_log && (_type.find("BASIC") != string::npos || _type.find("DAILY") != string::npos))
         {
             if (ACCESS(str_log_name.c_str(), 0) != -1)
             {
                 int re = (remove(str_log_name.c_str()));
                 spdlog::info(re);
             }
-            _spdlog = spdlog::daily_logger_mt(_name, str_log_name, 0, 0);
-        }
-        else
-        {
-            _spdlog = spdlog::stdout_color_mt(_name);
         }
+        _spdlog = _make_logger(_type, _name, str_log_name, _async);
 
         _spdlog->set_level(_level);
-        _spdlog->flush_on(_level);
+        _spdlog->flush_on(_async ? level::err : _level);
         _spdlog->set_pattern(_pattern);
     }
 
     t_grtlog::~t_grtlog()
     {
-        spdlog::drop(_name);
+        if (_spdlog)
+            _spdlog->flush();
+        // a default constructed log has no name, spdlog's default logger is named ""
+        if (!_name.empty())
+            spdlog::drop(_name);
     }
 
     std::shared_ptr<logger> t_grtlog::spdlog()
@@ -95,8 +108,9 @@ namespace gnut
         return _spdlog;
     }
 
-    void t_grtlog::set_log(const string &log_type, const level::level_enum &log_level, const string &log_name)
+    void t_grtlog::set_log(const string &log_type, const level::level_enum &log_level, const string &log_name, bool log_async)
     {
+        _async = log_async;
         _type = log_type;
         transform(_type.begin(), _type.end(), _type.begin(), ::toupper);
         _name = log_name;
@@ -108,29 +122,10 @@ namespace gnut
         spdlog::set_pattern(_pattern);
         spdlog::flush_on(_level);
 
-        if (_type.find("CONSOLE") != string::npos)
-        {
-            _spdlog = spdlog::stdout_color_mt(_name);
-        }
-        else if (_type.find("ROTATING") != string::npos)
-        {
-            _spdlog = spdlog::rotating_logger_mt(_name, _name + ".spd_log", 1024 * 1024, 10);
-        }
-        else if (_type.find("BASIC") != string::npos)
-        {
-            _spdlog = spdlog::basic_logger_mt(_name, _name + ".spd_log");
-        }
-        else if (_type.find("DAILY") != string::npos)
-        {
-            _spdlog = spdlog::daily_logger_mt(_name, _name + ".spd_log", 0, 0);
-        }
-        else
-        {
-            _spdlog = spdlog::stdout_color_mt(_name);
-        }
+        _spdlog = _make_logger(_type, _name, _name + ".spd_log", _async);
 
         _spdlog->set_level(_level);
-        _spdlog->flush_on(_level);
+        _spdlog->flush_on(_async ? level::err : _level);
         _spdlog->set_pattern(_pattern);
     }
 
@@ -29,6 +29,23 @@ History
 #include <string>
 #include "spdlog/spdlog.h"
 
+#define LOG_ASYNC_QUEUE 32768 ///< messages waiting for the asynchronous worker
+
+/**
+ * @brief logging with the level checked first: the arguments (epoch strings etc.)
+ *        are evaluated only for an enabled level, pass them as fmt arguments
+ *        ("{}") instead of concatenating the message
+ */
+#define GLOGGER_CALL(logger, lvl, macro, ...)                \
+    do                                                       \
+    {                                                        \
+        if ((logger) && (logger)->should_log(lvl))           \
+            macro(logger, __VA_ARGS__);                      \
+    } while (0)
+#define GLOGGER_DEBUG(logger, ...) GLOGGER_CALL(logger, spdlog::level::debug, SPDLOG_LOGGER_DEBUG, __VA_ARGS__)
+#define GLOGGER_INFO(logger, ...) GLOGGER_CALL(logger, spdlog::level::info, SPDLOG_LOGGER_INFO, __VA_ARGS__)
+#define GLOGGER_WARN(logger, ...) GLOGGER_CALL(logger, spdlog::level::warn, SPDLOG_LOGGER_WARN, __VA_ARGS__)
+
 using namespace spdlog;
 namespace gnut
 {
@@ -48,8 +65,10 @@ namespace gnut
          * @param log_type 
          * @param log_level 
          * @param log_name 
+         * @param log_async  messages written by a worker thread from a bounded queue,
+         *                   flushed on errors and at exit only
          */
-        t_grtlog(const std::string &log_type, const level::level_enum &log_level, const std::string &log_name);
+        t_grtlog(const std::string &log_type, const level::level_enum &log_level, const std::string &log_name, bool log_async = false);
 
         /**
          * @brief Destroy the t grtlog object
@@ -70,8 +89,9 @@ namespace gnut
          * @param log_type 
          * @param log_level 
          * @param log_name 
+         * @param log_async 
          */
-        void set_log(const std::string &log_type, const level::level_enum &log_level, const std::string &log_name);
+        void set_log(const std::string &log_type, const level::level_enum &log_level, const std::string &log_name, bool log_async = false);
 
         string name() { return _name; }
 
@@ -80,6 +100,7 @@ namespace gnut
         std::string _type;
         std::string _pattern;
         level::level_enum _level;
+        bool _async = false;
         t_spdlog _spdlog;
     };
 
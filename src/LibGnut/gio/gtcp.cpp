@@ -0,0 +1,275 @@
+/**
+ * @file         gtcp.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        TCP client io based on gio class (tcp://host:port)
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#if defined _WIN32 || defined _WIN64
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#include <cstring>
+#include <algorithm>
+
+#include "gio/gtcp.h"
+#include "gutils/gtypeconv.h"
+
+using namespace std;
+
+namespace gnut
+{
+
+#if defined _WIN32 || defined _WIN64
+    // winsock must be started once per process
+    static bool _wsa_startup()
+    {
+        static const bool started = []() {
+            WSADATA wsa;
+            return WSAStartup(MAKEWORD(2, 2), &wsa) == 0;
+        }();
+        return started;
+    }
+#endif
+
+    t_gtcp::t_gtcp(t_spdlog spdlog)
+        : t_gio(spdlog),
+          _host(""),
+          _port(0),
+          _nrecon(0),
+          _wait_first(TCP_RECONNECT_MS),
+          _wait_max(TCP_RECONNECT_MAX_MS)
+    {
+        _size = TCPBUF_SIZE;
+    }
+
+    t_gtcp::~t_gtcp()
+    {
+        _close();
+    }
+
+    int t_gtcp::path(string str)
+    {
+        if (str == "")
+            return -1;
+
+        string prefix = GTCP_PREFIX;
+        if (str.find(prefix) != 0)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "warning: path does not contain tcp://host:port  [check tcp://]");
+            return -1;
+        }
+
+        if (_host_port(str.substr(prefix.length()), -1) < 0 || _port <= 0)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "warning: path does not contain tcp://host:port  [" + str + "]");
+            return -1;
+        }
+
+        return t_gio::path(str);
+    }
+
+    int t_gtcp::init_read()
+    {
+        if (_connect() < 0)
+        {
+            _opened = 0;
+            return -1;
+        }
+
+        _opened = 1;
+        return 1;
+    }
+
+    int t_gtcp::_host_port(const string &str, int defport)
+    {
+        string hostport = str;
+        size_t idx = hostport.find('/');
+        if (idx != string::npos)
+            hostport = hostport.substr(0, idx);
+
+        idx = hostport.rfind(':');
+        if (idx == string::npos)
+        {
+            _host = hostport;
+            _port = defport;
+        }
+        else
+        {
+            _host = hostport.substr(0, idx);
+            _port = str2int(hostport.substr(idx + 1));
+        }
+
+        return _host.empty() ? -1 : 1;
+    }
+
+    int t_gtcp::_connect()
+    {
+        _close();
+
+#if defined _WIN32 || defined _WIN64
+        if (!_wsa_startup())
+            return -1;
+#endif
+
+        struct addrinfo hints, *res = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        if (getaddrinfo(_host.c_str(), int2str(_port).c_str(), &hints, &res) != 0 || !res)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_ERROR(_spdlog, "tcp: cannot resolve host " + _host);
+            return -1;
+        }
+
+        for (struct addrinfo *ai = res; ai != nullptr; ai = ai->ai_next)
+        {
+            int fd = (int)socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+            if (fd < 0)
+                continue;
+
+            if (connect(fd, ai->ai_addr, (int)ai->ai_addrlen) == 0)
+            {
+                _fd = fd;
+                break;
+            }
+#if defined _WIN32 || defined _WIN64
+            closesocket(fd);
+#else
+            close(fd);
+#endif
+        }
+        freeaddrinfo(res);
+
+        if (_fd < 0)
+        {
+            if (_spdlog)
+                SPDLOG_LOGGER_ERROR(_spdlog, "tcp: cannot connect to " + _host + ":" + int2str(_port));
+            return -1;
+        }
+
+        // receive timeout, so that stop requests are checked
+#if defined _WIN32 || defined _WIN64
+        DWORD tv = TCP_TIMEOUT * 1000;
+        setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, (const char *)&tv, sizeof(tv));
+#else
+        struct timeval tv;
+        tv.tv_sec = TCP_TIMEOUT;
+        tv.tv_usec = 0;
+        setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, (const char *)&tv, sizeof(tv));
+#endif
+
+        if (_spdlog)
+            SPDLOG_LOGGER_INFO(_spdlog, "tcp: connected to " + _host + ":" + int2str(_port));
+        return 1;
+    }
+
+    int t_gtcp::_recv(char *buff, int size)
+    {
+        if (_fd < 0)
+            return -1;
+
+        int nbytes = (int)recv(_fd, buff, size, 0);
+        if (nbytes > 0)
+            return nbytes;
+        if (nbytes == 0)
+            return -1; // closed by peer
+
+#if defined _WIN32 || defined _WIN64
+        if (WSAGetLastError() == WSAETIMEDOUT)
+            return 0;
+#else
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return 0;
+#endif
+        return -1;
+    }
+
+    int t_gtcp::_send(const char *buff, int size)
+    {
+        if (_fd < 0)
+            return -1;
+
+        int sent = 0;
+        while (sent < size)
+        {
+            int nbytes = (int)send(_fd, buff + sent, size - sent, 0);
+            if (nbytes <= 0)
+                return -1;
+            sent += nbytes;
+        }
+        return sent;
+    }
+
+    int t_gtcp::_gio_read(char *buff, int size)
+    {
+        // a connection that is lost again before any data counts as failed,
+        // the wait grows after each loss and the stream gives up for good
+        // after TCP_RECONNECT_TOTAL reconnections (a flapping server)
+        int nfail = 0;
+        int wait = _wait_first;
+
+        while (_stop != 1)
+        {
+            int nbytes = _recv(buff, size);
+            if (nbytes > 0)
+                return nbytes;
+            if (nbytes == 0)
+                continue; // timeout, check stop request
+
+            // lost connection
+            if (++nfail > TCP_RECONNECT || ++_nrecon > TCP_RECONNECT_TOTAL)
+            {
+                if (_spdlog)
+                    SPDLOG_LOGGER_ERROR(_spdlog, "tcp: too many reconnections, giving up " + _host + ":" + int2str(_port));
+                break;
+            }
+
+            if (_spdlog)
+                SPDLOG_LOGGER_WARN(_spdlog, "tcp: connection lost, reconnecting " + _host + ":" + int2str(_port) +
+                                                " in " + int2str(wait) + " ms");
+            for (int slept = 0; slept < wait && _stop != 1; slept += 100)
+                t_gtime::gmsleep(min(100, wait - slept));
+            wait = min(2 * wait, _wait_max);
+            _connect();
+        }
+
+        return -1;
+    }
+
+    void t_gtcp::_close()
+    {
+        if (_fd < 0)
+            return;
+
+#if defined _WIN32 || defined _WIN64
+        closesocket(_fd);
+#else
+        close(_fd);
+#endif
+        _fd = -1;
+    }
+
+    int t_gtcp::_stop_common()
+    {
+        _close();
+        return t_gio::_stop_common();
+    }
+
+} // namespace
@@ -0,0 +1,110 @@
+/**
+ * @file         gtcp.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        TCP client io based on gio class (tcp://host:port)
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GTCP_H
+#define GTCP_H
+
+#include <string>
+
+#include "gio/gio.h"
+
+#define GTCP_PREFIX "tcp://"
+#define TCPBUF_SIZE 4096    ///< receive buffer size
+#define TCP_TIMEOUT 10      ///< [s] receive timeout (check of stop request)
+#define TCP_RECONNECT 10    ///< maximum number of reconnections without data
+#define TCP_RECONNECT_TOTAL 100 ///< maximum number of reconnections of a stream
+#define TCP_RECONNECT_MS 3000 ///< [ms] first wait before reconnecting
+#define TCP_RECONNECT_MAX_MS 60000 ///< [ms] longest wait, doubled after each lost connection
+
+using namespace std;
+
+namespace gnut
+{
+
+    /** @brief class for t_gtcp derive from t_gio. */
+    class LibGnut_LIBRARY_EXPORT t_gtcp : public t_gio
+    {
+
+    public:
+        /** @brief default constructor. */
+        t_gtcp(t_spdlog spdlog);
+
+        /** @brief default destructor. */
+        virtual ~t_gtcp();
+
+        /** @brief connect. */
+        virtual int init_read();
+
+        /**
+        * @brief set tcp://host:port.
+        * @param[in]    str        stream path
+        * @return
+        *    @retval =-1 false
+        *    @retval =1    true
+        */
+        virtual int path(string str);
+
+        /** @brief get tcp://host:port. */
+        virtual string path() const { return _path; }
+
+        /** @brief get host. */
+        const string &host() const { return _host; }
+
+        /** @brief get port. */
+        int port() const { return _port; }
+
+        /** @brief set first and longest wait before reconnecting [ms]. */
+        void reconnect_wait(int first_ms, int max_ms)
+        {
+            _wait_first = first_ms;
+            _wait_max = max_ms;
+        }
+
+    protected:
+        /** @brief read data from socket (blocking, reconnects on lost connection).
+        * @param[in]    buff    buffer of the data
+        * @param[in]    size    buffer size of the data
+        * @return
+            @retval >0    number of bytes read
+            @retval <=0    fail
+        */
+        virtual int _gio_read(char *buff, int size);
+
+        /** @brief open the socket and connect to host:port (derived streams add handshake). */
+        virtual int _connect();
+
+        /** @brief receive from socket, 0 for timeout, <0 for closed connection. */
+        virtual int _recv(char *buff, int size);
+
+        /** @brief send all bytes to socket. */
+        virtual int _send(const char *buff, int size);
+
+        /** @brief close the socket. */
+        virtual void _close();
+
+        /** @brief common function for socket close. */
+        virtual int _stop_common();
+
+        /** @brief split host[:port] string. */
+        int _host_port(const string &str, int defport);
+
+        string _host; ///< remote host
+        int _port;    ///< remote port
+        int _nrecon;  ///< reconnections since the start
+        int _wait_first; ///< [ms] first wait before reconnecting
+        int _wait_max;   ///< [ms] longest wait before reconnecting
+
+    private:
+    };
+
+} // namespace
+
+#endif
@@ -235,6 +235,10 @@ namespace gnut
         void setMF(ZTDMPFUNC MF);
         void setMF(GRDMPFUNC MF);
 
+        /** @brief get mapping functions. */
+        ZTDMPFUNC mf_ztd() const { return _mf_ztd; }
+        GRDMPFUNC mf_grd() const { return _mf_grd; }
+
     protected:
         double _value;     ///< value
         ZTDMPFUNC _mf_ztd; ///< mapping function for ZTD
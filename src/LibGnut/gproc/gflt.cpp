@@ -12,6 +12,7 @@
 #include <cmath>
 #include <iostream>
 #include <chrono>
+#include <algorithm>
 
 #include "gproc/gflt.h"
 #include "gutils/gmatrixconv.h"
@@ -129,10 +130,19 @@ namespace gnut
     {
     }
 
+    t_kalman_eigen::t_kalman_eigen()
+    {
+    }
+
     t_SRF::t_SRF()
     {
     }
 
+    t_SRF_seq::t_SRF_seq()
+        : _nfactor(0)
+    {
+    }
+
     t_SRIF::t_SRIF()
     {
     }
@@ -145,10 +155,18 @@ namespace gnut
     {
     }
 
+    t_kalman_eigen::~t_kalman_eigen()
+    {
+    }
+
     t_SRF::~t_SRF()
     {
     }
 
+    t_SRF_seq::~t_SRF_seq()
+    {
+    }
+
     t_SRIF::~t_SRIF()
     {
     }
@@ -203,37 +221,132 @@ namespace gnut
         t_kalman::update(_A, _P, _l, _dx, _Qx);
     }
 
-    void t_kalman::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    // Kalman gain by Cholesky solves, Joseph form update; R covariance of (whitened) observations
+    static int kalman_update(const Matrix &A, const SymmetricMatrix &R, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
     {
-        Matrix K; // Kalman gain
-        Matrix NN;
+        Matrix AQ = A * Qx;
+        SymmetricMatrix NN;
+        NN << R + AQ * A.t();
 
-        NN = Pl.i() + A * Qx * A.t();
+        LowerTriangularMatrix L;
+        try
+        {
+            L = Cholesky(NN);
+        }
+        catch (NPDException)
+        {
+            return -1;
+        }
 
-        K = Qx * A.t() * NN.i();
+        // K = Qx A' NN^-1 = (L'^-1 L^-1 A Qx)'
+        UpperTriangularMatrix U = L.t();
+        Matrix K = (U.i() * (L.i() * AQ)).t();
 
         IdentityMatrix I = IdentityMatrix(Qx.nrows());
-        Matrix KA = K * A;
         Matrix I_KA = I - K * A;
 
-        dx = K * l;                                      // update state vector
-        Qx << I_KA * Qx * I_KA.t() + K * Pl.i() * K.t(); // update variance-covariance matrix of state
+        dx = K * l;                                   // update state vector
+        Qx << I_KA * Qx * I_KA.t() + K * R * K.t();   // update variance-covariance matrix of state
+        return 1;
     }
 
-    void t_kalman::update(const Matrix &A, const SymmetricMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    int t_kalman::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
     {
-        Matrix K; // Kalman gain
-        Matrix NN;
-        SymmetricMatrix Pli = Pl.i();
+        // reciprocal weights
+        SymmetricMatrix R(Pl.Nrows());
+        R = 0.0;
+        for (int i = 1; i <= Pl.Nrows(); i++)
+            R(i, i) = 1.0 / Pl(i);
+        return kalman_update(A, R, l, dx, Qx);
+    }
 
-        NN = Pli + A * Qx * A.t();
-        K = Qx * A.t() * NN.i();
-        IdentityMatrix I = IdentityMatrix(Qx.nrows());
-        Matrix KA = K * A;
-        Matrix I_KA = I - K * A;
+    int t_kalman::update(const Matrix &A, const SymmetricMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        // whitened with Pl = W W', the observations are then uncorrelated with unit variance
+        LowerTriangularMatrix W;
+        try
+        {
+            W = Cholesky(Pl);
+        }
+        catch (NPDException)
+        {
+            return -1;
+        }
+        Matrix WA = W.t() * A;
+        ColumnVector Wl = W.t() * l;
+        SymmetricMatrix R(Pl.Nrows());
+        R = 0.0;
+        for (int i = 1; i <= Pl.Nrows(); i++)
+            R(i, i) = 1.0;
+        return kalman_update(WA, R, Wl, dx, Qx);
+    }
 
-        dx = K * l;                                   // update state vector
-        Qx << I_KA * Qx * I_KA.t() + K * Pli * K.t(); // update variance-covariance matrix of state
+    void t_kalman_eigen::update()
+    {
+        t_kalman_eigen::update(_A, _P, _l, _dx, _Qx);
+    }
+
+    int t_kalman_eigen::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        int nObs = Pl.Nrows();
+        _Re.setZero(nObs, nObs);
+        for (int i = 0; i < nObs; i++)
+            _Re(i, i) = 1.0 / Pl.Store()[i];
+        Matrix2Eigen(A, _Ae);
+        Vector2Eigen(l, _le);
+
+        _update(dx, Qx);
+        return 1;
+    }
+
+    int t_kalman_eigen::update(const Matrix &A, const SymmetricMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        // whitened with Pl = U' U, the observations are then uncorrelated with unit variance
+        Matrix2Eigen(Pl, _Re);
+        Eigen::LLT<Eigen::MatrixXd> llt(_Re);
+        if (llt.info() != Eigen::Success)
+            Throw(NPDException(Pl));
+        Matrix2Eigen(A, _Ae);
+        Vector2Eigen(l, _le);
+        _Ae = llt.matrixU() * _Ae;
+        _le = llt.matrixU() * _le;
+        _Re.setIdentity();
+
+        _update(dx, Qx);
+        return 1;
+    }
+
+    void t_kalman_eigen::_update(ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        Matrix2Eigen(Qx, _Qe);
+
+        if (!update_eigen(_Ae, _Re, _le, _dxe, _Qe))
+            Throw(NPDException(Qx));
+
+        Eigen2Vector(_dxe, dx);
+        Eigen2Matrix(_Qe, Qx);
+    }
+
+    bool t_kalman_eigen::update_eigen(const Eigen::MatrixXd &A, const Eigen::MatrixXd &R, const Eigen::VectorXd &l,
+                                      Eigen::VectorXd &dx, Eigen::MatrixXd &Q)
+    {
+        // innovation covariance S = A Q A' + R = L L', factorised instead of inverted
+        Eigen::MatrixXd AQ = A * Q;
+        Eigen::MatrixXd S = R;
+        S.noalias() += AQ * A.transpose();
+        Eigen::LLT<Eigen::MatrixXd> llt(S);
+        if (llt.info() != Eigen::Success)
+            return false;
+
+        // W = L^-1 A Q, then K = Q A' S^-1 = W' L^-1 and K A Q = W' W
+        llt.matrixL().solveInPlace(AQ);
+        Eigen::VectorXd z = llt.matrixL().solve(l);
+        dx.noalias() = AQ.transpose() * z;
+
+        // Q - K A Q (equal to the Joseph form for this gain), symmetric by construction
+        Q.selfadjointView<Eigen::Lower>().rankUpdate(AQ.transpose(), -1.0);
+        Q.triangularView<Eigen::StrictlyUpper>() = Q.transpose();
+        return true;
     }
 
     void t_SRF::update()
@@ -241,7 +354,7 @@ namespace gnut
         t_SRF::update(_A, _P, _l, _dx, _Qx);
     }
 
-    void t_SRF::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    int t_SRF::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
     {
         int nObs = A.Nrows();
         int nPar = A.Ncols();
@@ -254,7 +367,7 @@ namespace gnut
         }
         catch (NPDException)
         {
-            return;
+            return -1;
         }
 
         Matrix SA = SS * A.t();
@@ -283,9 +396,10 @@ namespace gnut
 
         dx = KT.t() * l;
         Qx << (SS.t() * SS);
+        return 1;
     }
 
-    void t_SRF::update(const Matrix &A, const SymmetricMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    int t_SRF::update(const Matrix &A, const SymmetricMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
     {
 
         int nObs = A.Nrows();
@@ -299,7 +413,7 @@ namespace gnut
         }
         catch (NPDException)
         {
-            return;
+            return -1;
         }
 
         Matrix SA = SS * A.t();
@@ -330,10 +444,332 @@ namespace gnut
 
         dx = KT.t() * l;
         Qx << (SS.t() * SS);
+        return 1;
+    }
+
+    void t_SRF_seq::update()
+    {
+        t_SRF_seq::update(_A, _P, _l, _dx, _Qx);
+    }
+
+    int t_SRF_seq::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        int nObs = A.Nrows();
+        _Aw = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(A.Store(), nObs, A.Ncols());
+        Vector2Eigen(l, _lw);
+        _rw.resize(nObs);
+        for (int i = 0; i < nObs; i++)
+            _rw(i) = 1.0 / Pl.Store()[i];
+
+        return _update(dx, Qx);
+    }
+
+    int t_SRF_seq::update(const Matrix &A, const SymmetricMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        int nObs = A.Nrows();
+        _Aw = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(A.Store(), nObs, A.Ncols());
+        Vector2Eigen(l, _lw);
+        _rw.resize(nObs);
+
+        bool diag = true;
+        const double *p = Pl.Store();
+        for (int r = 0; r < nObs && diag; r++, p += r)
+        {
+            for (int c = 0; c < r; c++)
+            {
+                if (p[c] != 0.0)
+                {
+                    diag = false;
+                    break;
+                }
+            }
+            _rw(r) = 1.0 / p[r];
+        }
+
+        if (!diag)
+        {
+            // whitening, P = L L' -> L' A, L' l with unit variances
+            Matrix2Eigen(Pl, _Qe);
+            Eigen::LLT<Eigen::MatrixXd> llt(_Qe);
+            if (llt.info() != Eigen::Success)
+                return -1;
+            _Aw = llt.matrixU() * _Aw;
+            _lw = llt.matrixU() * _lw;
+            _rw.setOnes();
+        }
+
+        return _update(dx, Qx);
+    }
+
+    int t_SRF_seq::_update(ColumnVector &dx, SymmetricMatrix &Qx)
+    {
+        if (!_sync(Qx))
+            return -1;
 
+        int nObs = _Aw.rows();
+        int nPar = _Aw.cols();
+        _dxe.setZero(nPar);
+        for (int k = 0; k < nObs; k++)
+        {
+            const double *a = _Aw.row(k).data();
+            _nz.clear();
+            for (int i = 0; i < nPar; i++)
+            {
+                if (a[i] != 0.0)
+                    _nz.push_back(i);
+            }
+            if (_nz.empty())
+                continue;
+            _scalar(a, _lw(k), _rw(k));
+        }
+
+        // Qx = U U', kept for the next epoch
+        _Qe.setZero(nPar, nPar);
+        _Qe.selfadjointView<Eigen::Lower>().rankUpdate(_U);
+        Eigen2Vector(_dxe, dx);
+        Eigen2Matrix(_Qe, Qx);
+        _Qsav = Qx;
+        return 1;
+    }
+
+    void t_SRF_seq::rem_states(const vector<int> &ind)
+    {
+        int n = _U.rows();
+        if (ind.empty() || _Qsav.Nrows() != n)
+            return;
+        vector<int> rem(ind);
+        sort(rem.begin(), rem.end());
+        rem.erase(unique(rem.begin(), rem.end()), rem.end());
+        if (rem.front() < 1 || rem.back() > n)
+        {
+            // not the covariance of the last update
+            _U.resize(0, 0);
+            _Qsav.ReSize(0);
+            return;
+        }
+
+        vector<int> keep;
+        for (int i = 0, k = 0; i < n; i++)
+        {
+            if (k < (int)rem.size() && rem[k] - 1 == i)
+            {
+                _decouple(i);
+                k++;
+                continue;
+            }
+            keep.push_back(i);
+        }
+        Eigen::MatrixXd U(keep.size(), keep.size());
+        for (size_t c = 0; c < keep.size(); c++)
+            for (size_t r = 0; r <= c; r++)
+                U(r, c) = _U(keep[r], keep[c]);
+        U.triangularView<Eigen::StrictlyLower>().setZero();
+        _U.swap(U);
+        Matrix_rem(_Qsav, rem);
+    }
+
+    void t_SRF_seq::add_states(const vector<double> &var)
+    {
+        int n = _U.rows();
+        if (var.empty() || _Qsav.Nrows() != n)
+            return;
+        for (size_t i = 0; i < var.size(); i++)
+        {
+            if (!(var[i] > 0.0))
+            {
+                _U.resize(0, 0);
+                _Qsav.ReSize(0);
+                return;
+            }
+        }
+
+        // new states are uncorrelated: the factor is block diagonal
+        _U.conservativeResize(n + var.size(), n + var.size());
+        _U.rightCols(var.size()).setZero();
+        _U.bottomRows(var.size()).setZero();
+        for (size_t i = 0; i < var.size(); i++)
+            _U(n + i, n + i) = sqrt(var[i]);
+        Matrix_add(_Qsav, var);
+    }
+
+    bool t_SRF_seq::_sync(const SymmetricMatrix &Qx)
+    {
+        int n = Qx.Nrows();
+        const double *q = Qx.Store();
+        if (_U.rows() == n && _Qsav.Nrows() == n)
+        {
+            const double *qs = _Qsav.Store();
+
+            // reset states: changed, row/column zero but the diagonal (white noise process)
+            vector<bool> reset(n, false);
+            for (int r = 0; r < n; r++)
+            {
+                size_t d = (size_t)r * (r + 1) / 2 + r;
+                bool zero = q[d] > 0.0, changed = q[d] != qs[d];
+                for (int c = 0; c < n && zero; c++)
+                {
+                    if (c == r)
+                        continue;
+                    size_t p = r > c ? (size_t)r * (r + 1) / 2 + c : (size_t)c * (c + 1) / 2 + r;
+                    zero = q[p] == 0.0;
+                    changed = changed || qs[p] != 0.0;
+                }
+                reset[r] = zero && changed;
+            }
+
+            // other elements unchanged, diagonal increased only
+            vector<pair<int, double>> add;
+            bool keep = true;
+            for (int r = 0, p = 0; r < n && keep; r++)
+            {
+                for (int c = 0; c <= r; c++, p++)
+                {
+                    if (reset[r] || reset[c] || q[p] == qs[p])
+                        continue;
+                    if (c != r || q[p] < qs[p])
+                    {
+                        keep = false;
+                        break;
+                    }
+                    add.push_back(make_pair(r, q[p] - qs[p]));
+                }
+            }
+            if (keep)
+            {
+                for (int r = 0; r < n; r++)
+                {
+                    if (!reset[r])
+                        continue;
+                    _decouple(r);
+                    _U(r, r) = sqrt(q[(size_t)r * (r + 1) / 2 + r]);
+                }
+                for (size_t i = 0; i < add.size(); i++)
+                    _rank1(add[i].first, add[i].second);
+                return true;
+            }
+        }
+
+        _nfactor++;
+        if (_factorize(Qx))
+            return true;
+
+        _U.resize(0, 0);
+        _Qsav.ReSize(0);
+        return false;
+    }
+
+    bool t_SRF_seq::_factorize(const SymmetricMatrix &Qx)
+    {
+        int n = Qx.Nrows();
+        const double *q = Qx.Store();
+        _U.setZero(n, n);
+        for (int j = n - 1; j >= 0; j--)
+        {
+            const double *qj = q + j * (j + 1) / 2;
+            double d = qj[j];
+            for (int k = j + 1; k < n; k++)
+                d -= _U(j, k) * _U(j, k);
+            if (!(d > 0.0))
+                return false;
+            _U(j, j) = sqrt(d);
+            for (int i = j - 1; i >= 0; i--)
+            {
+                double s = qj[i];
+                for (int k = j + 1; k < n; k++)
+                    s -= _U(i, k) * _U(j, k);
+                _U(i, j) = s / _U(j, j);
+            }
+        }
+        return true;
+    }
+
+    void t_SRF_seq::_rank1(int k, double d)
+    {
+        _f.setZero(k + 1);
+        _f(k) = sqrt(d);
+        for (int j = k; j >= 0; j--)
+        {
+            if (_f(j) == 0.0)
+                continue;
+            double u = _U(j, j);
+            double r = sqrt(u * u + _f(j) * _f(j));
+            double c = r / u;
+            double s = _f(j) / u;
+            _U(j, j) = r;
+            for (int i = j - 1; i >= 0; i--)
+            {
+                _U(i, j) = (_U(i, j) + s * _f(i)) / c;
+                _f(i) = c * _f(i) - s * _U(i, j);
+            }
+        }
+    }
+
+    void t_SRF_seq::_decouple(int k)
+    {
+        // row k only enters row/column k of U U'; column k is nonzero in rows <= j at step j,
+        // so rotating it into column j keeps U upper triangular and U U' unchanged
+        _U.row(k).setZero();
+        for (int j = k - 1; j >= 0; j--)
+        {
+            double b = _U(j, k);
+            if (b == 0.0)
+                continue;
+            double a = _U(j, j);
+            double h = sqrt(a * a + b * b);
+            double c = a / h;
+            double s = b / h;
+            for (int i = 0; i <= j; i++)
+            {
+                double uj = _U(i, j);
+                double uk = _U(i, k);
+                _U(i, j) = c * uj + s * uk;
+                _U(i, k) = c * uk - s * uj;
+            }
+            _U(j, k) = 0.0;
+        }
+    }
+
+    void t_SRF_seq::_scalar(const double *a, double l, double r)
+    {
+        int n = _U.rows();
+
+        // f = U' a and innovation, over the non-zero elements of a only
+        double v = l;
+        for (size_t k = 0; k < _nz.size(); k++)
+            v -= a[_nz[k]] * _dxe(_nz[k]);
+        _f.resize(n);
+        for (int j = 0; j < n; j++)
+        {
+            double f = 0.0;
+            for (size_t k = 0; k < _nz.size() && _nz[k] <= j; k++)
+                f += _U(_nz[k], j) * a[_nz[k]];
+            _f(j) = f;
+        }
+
+        // Carlson: U (I - f f' / alpha) triangularised column by column
+        _w.setZero(n);
+        double alpha = r;
+        for (int j = 0; j < n; j++)
+        {
+            double fj = _f(j);
+            if (fj == 0.0)
+                continue;
+            double beta = alpha;
+            alpha += fj * fj;
+            double gamma = sqrt(alpha * beta);
+            double eta = beta / gamma;
+            double zeta = fj / gamma;
+            for (int i = 0; i <= j; i++)
+            {
+                double tau = _U(i, j);
+                _U(i, j) = eta * tau - zeta * _w(i);
+                _w(i) += tau * fj;
+            }
+        }
+        _dxe += _w * (v / alpha);
     }
 
-    void t_SRIF::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
+    int t_SRIF::update(const Matrix &A, const DiagonalMatrix &Pl, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Qx)
     {
         int nObs = A.Nrows();
         int nPar = A.Ncols();
@@ -365,6 +801,7 @@ namespace gnut
 
         dx = R.i() * z;
         Qx = INF.i();
+        return 1;
     }
 
 } // namespace
@@ -21,6 +21,7 @@
 
 #include "newmat/newmat.h"
 #include "newmat/newmatap.h"
+#include <Eigen/Dense>
 #include "gall/gallpar.h"
 #include "gexport/ExportLibGnut.h"
 
@@ -49,9 +50,9 @@ namespace gnut
         * @param[in]  l           l matrix in flt
         * @param[in]  dx       dx matrix in flt
         * @param[in]  Q              Q matrix in flt
-        * @return void
+        * @return 1 if updated, -1 if not positive definite (dx and Q unchanged)
         */
-        virtual void update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q){};
+        virtual int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q) { return 1; };
 
         /**
         * @brief update parametere.
@@ -61,9 +62,9 @@ namespace gnut
         * @param[in]  l           l matrix in flt
         * @param[in]  dx       dx matrix in flt
         * @param[in]  Q              Q matrix in flt
-        * @return void
+        * @return 1 if updated, -1 if not positive definite (dx and Q unchanged)
         */
-        virtual void update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q){};
+        virtual int update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q) { return 1; };
 
         /**
         * @brief add data.
@@ -122,6 +123,18 @@ namespace gnut
         /** @brief reset Qx. */
         virtual void resetQ();
 
+        /**
+        * @brief rows/columns about to be removed from the Qx of the owner (filters keeping state between epochs).
+        * @param[in]  ind        1-based rows/columns of the current Qx, ascending
+        */
+        virtual void rem_states(const vector<int> &ind) {}
+
+        /**
+        * @brief rows/columns appended to the Qx of the owner, zero but the diagonal.
+        * @param[in]  var        variances of the new rows
+        */
+        virtual void add_states(const vector<double> &var) {}
+
         /** @brief set Qx Matrix specified location 
         * @param[in]  row        row of Qx matrix in flt
         * @param[in]  col        col of Qx matrix in flt
@@ -154,25 +167,25 @@ namespace gnut
         ColumnVector stdx();
 
         /** @brief get dx */
-        ColumnVector dx() { return _dx; }
+        const ColumnVector &dx() const { return _dx; }
 
         /** @brief get Qx */
-        SymmetricMatrix Qx() { return _Qx; }
+        const SymmetricMatrix &Qx() const { return _Qx; }
 
         /** @brief get param */
-        t_gallpar param() { return _param; }
+        const t_gallpar &param() const { return _param; }
 
         /** @brief get sigma0 */
-        double sigma0() { return _sigma0; }
+        double sigma0() const { return _sigma0; }
 
         /** @brief get vtpv */
-        double vtpv() { return _vtpv; }
+        double vtpv() const { return _vtpv; }
 
         /** @brief get nobs total */
-        int nobs_total() { return _nobs_total; }
+        int nobs_total() const { return _nobs_total; }
 
         /** @brief get npar number */
-        int npar_number() { return _npar_number; }
+        int npar_number() const { return _npar_number; }
 
         /** @brief set/get amb 
         * @param[in]  state         amb state  in flt
@@ -203,7 +216,12 @@ namespace gnut
         bool _amb = false;          ///< fix amb
     };
 
-    /** @brief class for Classical formule for Kalman filter. */
+    /**
+    * @brief class for Classical formule for Kalman filter.
+    *
+    * The gain is computed by Cholesky solves of the innovation covariance, correlated
+    * observations are whitened first, the covariance is updated in the Joseph form.
+    */
     class LibGnut_LIBRARY_EXPORT t_kalman : public t_gflt
     {
 
@@ -216,8 +234,75 @@ namespace gnut
 
         /** @brief update parameter. */
         virtual void update();
-        void update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
-        void update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+        int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+        int update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+    };
+
+    /**
+    * @brief class for Kalman filter with Eigen kernels derive from t_gflt.
+    *
+    * Same gain as t_kalman, the innovation covariance S = L L' is factorised (Cholesky)
+    * and solved instead of inverted. The covariance is updated as Q - W'W with W = L^-1 A Q,
+    * which needs one triangular solve and one rank update instead of the Joseph form products.
+    */
+    class LibGnut_LIBRARY_EXPORT t_kalman_eigen : public t_gflt
+    {
+    public:
+        /** @brief default constructor. */
+        t_kalman_eigen();
+
+        /** @brief default destructor. */
+        ~t_kalman_eigen();
+
+        /** @brief update parameter. */
+        virtual void update();
+
+        /**
+        * @brief update parametere, throws NPDException if the innovation covariance is not positive definite.
+        *
+        * @param[in]  A        A matrix in flt
+        * @param[in]  P        P matrix in flt
+        * @param[in]  l           l matrix in flt
+        * @param[in]  dx       dx matrix in flt
+        * @param[in]  Q              Q matrix in flt
+        * @return 1
+        */
+        int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+
+        /**
+        * @brief update parametere, throws NPDException if P or the innovation covariance is not positive definite.
+        *
+        * @param[in]  A        A matrix in flt
+        * @param[in]  P        P matrix in flt
+        * @param[in]  l           l matrix in flt
+        * @param[in]  dx       dx matrix in flt
+        * @param[in]  Q              Q matrix in flt
+        * @return 1
+        */
+        int update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+
+        /**
+        * @brief measurement update on Eigen matrices (in place, for callers keeping the covariance in Eigen).
+        *
+        * @param[in]     A        design matrix (m x n)
+        * @param[in]     R        covariance of observations (m x m)
+        * @param[in]     l        observed minus computed (m)
+        * @param[out]    dx       state correction (n)
+        * @param[in,out] Q        covariance of state (n x n)
+        * @return false if the innovation covariance is not positive definite (Q unchanged)
+        */
+        static bool update_eigen(const Eigen::MatrixXd &A, const Eigen::MatrixXd &R, const Eigen::VectorXd &l,
+                                 Eigen::VectorXd &dx, Eigen::MatrixXd &Q);
+
+    protected:
+        /** @brief common part of the newmat interface, _Ae, _Re and _le filled by the caller. */
+        void _update(ColumnVector &dx, SymmetricMatrix &Q);
+
+        Eigen::MatrixXd _Ae;  ///< design matrix
+        Eigen::MatrixXd _Re;  ///< covariance of observations
+        Eigen::VectorXd _le;  ///< observed minus computed
+        Eigen::VectorXd _dxe; ///< state correction
+        Eigen::MatrixXd _Qe;  ///< covariance of state
     };
 
     /** @brief class for Square root covariance filter derive from t_gflt. */
@@ -241,9 +326,9 @@ namespace gnut
         * @param[in]  l           l matrix in flt
         * @param[in]  dx       dx matrix in flt
         * @param[in]  Q              Q matrix in flt
-        * @return void
+        * @return 1 if updated, -1 if not positive definite (dx and Q unchanged)
         */
-        void update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+        int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
 
         /**
         * @brief update parametere.
@@ -253,9 +338,99 @@ namespace gnut
         * @param[in]  l           l matrix in flt
         * @param[in]  dx       dx matrix in flt
         * @param[in]  Q              Q matrix in flt
-        * @return void
+        * @return 1 if updated, -1 if not positive definite (dx and Q unchanged)
         */
-        void update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+        int update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+    };
+
+    /**
+    * @brief class for sequential square root covariance filter derive from t_gflt.
+    *
+    * Qx = U U' with U upper triangular is kept between epochs. Observations are
+    * processed one by one (Carlson update, sparse rows), correlated observations
+    * are whitened first. Between epochs the factor follows Qx without a new
+    * factorisation for process noise added to the diagonal, reset (white noise)
+    * states and parameters removed or appended by the owner (rem_states/add_states).
+    * Any other change of Qx outside the filter rebuilds the factor.
+    */
+    class LibGnut_LIBRARY_EXPORT t_SRF_seq : public t_gflt
+    {
+    public:
+        /** @brief default constructor. */
+        t_SRF_seq();
+
+        /** @brief default destructor. */
+        ~t_SRF_seq();
+
+        /** @brief update parameter. */
+        virtual void update();
+
+        /**
+        * @brief update parametere, Qx and dx are unchanged if Qx is not positive definite.
+        *
+        * @param[in]  A        A matrix in flt
+        * @param[in]  P        P matrix in flt
+        * @param[in]  l           l matrix in flt
+        * @param[in]  dx       dx matrix in flt
+        * @param[in]  Q              Q matrix in flt
+        * @return 1 if updated, -1 if not positive definite (dx and Q unchanged)
+        */
+        int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+
+        /**
+        * @brief update parametere, Qx and dx are unchanged if Qx or P is not positive definite.
+        *
+        * @param[in]  A        A matrix in flt
+        * @param[in]  P        P matrix in flt
+        * @param[in]  l           l matrix in flt
+        * @param[in]  dx       dx matrix in flt
+        * @param[in]  Q              Q matrix in flt
+        * @return 1 if updated, -1 if not positive definite (dx and Q unchanged)
+        */
+        int update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+
+        /** @brief drop the rows/columns from the factor, 1-based ascending. */
+        void rem_states(const vector<int> &ind) override;
+
+        /** @brief append rows/columns to the factor. */
+        void add_states(const vector<double> &var) override;
+
+        /** @brief square root of Qx of the last update, Qx = U U', U upper triangular. */
+        const Eigen::MatrixXd &factor() const { return _U; }
+
+        /** @brief number of full factorisations of Qx. */
+        long nfactor() const { return _nfactor; }
+
+    protected:
+        /** @brief bring _U to Qx: reuse, rank one updates of the diagonal or new factorisation. */
+        bool _sync(const SymmetricMatrix &Qx);
+
+        /** @brief Qx = U U' from the last row up, false if not positive definite. */
+        bool _factorize(const SymmetricMatrix &Qx);
+
+        /** @brief U U' += d e_k e_k'. */
+        void _rank1(int k, double d);
+
+        /** @brief row/column k of U U' set to zero: row k cleared, column k rotated into the columns left of it. */
+        void _decouple(int k);
+
+        /** @brief Carlson update by one observation, a(i) for i in _nz. */
+        void _scalar(const double *a, double l, double r);
+
+        /** @brief measurement update by rows of _Aw, _lw with variances _rw, -1 if Qx is not positive definite. */
+        int _update(ColumnVector &dx, SymmetricMatrix &Qx);
+
+        Eigen::MatrixXd _U;    ///< square root of Qx, upper triangular
+        SymmetricMatrix _Qsav; ///< Qx of the last update (U U'), empty if U is not valid
+        Eigen::VectorXd _dxe;  ///< state correction
+        Eigen::VectorXd _f;    ///< U' a
+        Eigen::VectorXd _w;    ///< unscaled gain
+        vector<int> _nz;       ///< non-zero elements of the current row
+        Eigen::MatrixXd _Qe;   ///< U U'
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> _Aw; ///< (whitened) design matrix
+        Eigen::VectorXd _lw;   ///< (whitened) observations
+        Eigen::VectorXd _rw;   ///< variances of _lw
+        long _nfactor;         ///< number of full factorisations
     };
 
     /** @brief class for Square root information filter derive from t_gflt. */
@@ -276,9 +451,9 @@ namespace gnut
         * @param[in]  l           l matrix in flt
         * @param[in]  dx       dx matrix in flt
         * @param[in]  Q              Q matrix in flt
-        * @return void
+        * @return 1
         */
-        void update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
+        int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q);
     };
 
 } // namespace
@@ -31,6 +31,7 @@
 #include "gproc/gpreproc.h"
 #include "gutils/gcommon.h"
 #include "gutils/gtimesync.h"
+#include "gutils/gprofiler.h"
 #include "gutils/gtypeconv.h"
 #include "gmodels/gbancroft.h"
 
@@ -115,6 +116,7 @@ namespace gnut
 
     int t_gpreproc::ProcessBatch(string site, const t_gtime &beg_r, const t_gtime &end_r, double sampl, bool sync, bool save)
     {
+        GPROF_SCOPE(PROF_PREPROC);
 
         int sign = 1;
         t_gtime beg;
@@ -397,6 +399,23 @@ namespace gnut
         this->_nav = nav;
     }
 
+    void t_gpreproc::state(const string &site, vector<t_gobsgnss> &pre, map<string, double> &dI, bool &first) const
+    {
+        auto itPre = _epoDataPre.find(site);
+        auto itI = _dI.find(site);
+        auto itFirst = _firstEpo.find(site);
+        pre = (itPre != _epoDataPre.end()) ? itPre->second : vector<t_gobsgnss>();
+        dI = (itI != _dI.end()) ? itI->second : map<string, double>();
+        first = (itFirst == _firstEpo.end() || itFirst->second);
+    }
+
+    void t_gpreproc::state(const string &site, const vector<t_gobsgnss> &pre, const map<string, double> &dI, bool first)
+    {
+        _epoDataPre[site] = pre;
+        _dI[site] = dI;
+        _firstEpo[site] = first || pre.empty();
+    }
+
     void t_gpreproc::_repair(vector<t_spt_gobs> epoData, double dL)
     {
 
@@ -58,6 +58,12 @@ namespace gnut
         /** @brief for set the priviate values. */
         void setNav(t_gallnav *nav);
 
+        /** @brief get the state carried to the next epoch of a site (previous epoch, ionospheric changes). */
+        void state(const string &site, vector<t_gobsgnss> &pre, map<string, double> &dI, bool &first) const;
+
+        /** @brief set the state of a site, e.g. resumed from a checkpoint. */
+        void state(const string &site, const vector<t_gobsgnss> &pre, const map<string, double> &dI, bool first);
+
         typedef map<int, map<t_gobs_pair, double>> t_map_slp;
         typedef map<int, vector<t_gobs_pair>> t_vec_slp;
 
@@ -8,6 +8,7 @@
 -*/
 
 #include "gproc/gsppflt.h"
+#include <algorithm>
 #include "gutils/gmatrixconv.h"
 #include "gutils/gtimesync.h"
 #include "gprod/gprodclk.h"
@@ -29,11 +30,7 @@ namespace gnut
 
         t_gspp::_get_settings();
 
-        string fltModStr(dynamic_cast<t_gsetflt *>(_set)->method_flt());
-        if (fltModStr.compare("kalman") == 0)
-            _filter = new t_kalman();
-        else if (fltModStr.compare("srcf") == 0)
-            _filter = new t_SRF();
+        _filter = _new_filter();
 
         _trpStoModel = new t_randomwalk();
         _trpStoModel->setq(dynamic_cast<t_gsetflt *>(_set)->rndwk_ztd());
@@ -132,12 +129,8 @@ namespace gnut
           _n_ALL_smt(0)
     {
         t_gspp::_get_settings();
-        string fltModStr(dynamic_cast<t_gsetflt *>(_set)->method_flt());
-        if (fltModStr.compare("kalman") == 0)
-            _filter = new t_kalman();
-        else if (fltModStr.compare("srcf") == 0)
-            _filter = new t_SRF();
-        else
+        _filter = _new_filter();
+        if (!_filter)
         {
             if (_spdlog)
                 SPDLOG_LOGGER_INFO(_spdlog, _site + " not correct filter setting - check XML-config");
@@ -592,7 +585,15 @@ namespace gnut
 
             Qsav = _Qx;
 
-            _filter->update(A, P, l, dx, _Qx);
+            if (_filter->update(A, P, l, dx, _Qx) < 0)
+            {
+                _n_ALL_flt++;
+                _n_NPD_flt++;
+                if (_spdlog)
+                    SPDLOG_LOGGER_DEBUG(_spdlog, _site + _epoch.str_ymdhms(" epoch ") + " skipped: covariance matrix not positive definite");
+                _restore(QsavBP, XsavBP);
+                return -1;
+            }
 
             // increasing variance after update in case of introducing new ambiguity
             for (size_t iPar = 0; iPar < _param.parNumber(); iPar++)
@@ -1636,6 +1637,20 @@ namespace gnut
         _param = XsavBP;
     }
 
+    t_gflt *t_gsppflt::_new_filter()
+    {
+        string fltModStr(dynamic_cast<t_gsetflt *>(_set)->method_flt());
+        if (fltModStr.compare("kalman") == 0)
+            return new t_kalman();
+        else if (fltModStr.compare("srcf") == 0)
+            return new t_SRF();
+        else if (fltModStr.compare("kalman_eigen") == 0)
+            return new t_kalman_eigen();
+        else if (fltModStr.compare("srcf_seq") == 0)
+            return new t_SRF_seq();
+        return nullptr;
+    }
+
     int t_gsppflt::_satPos(t_gtime &epo, t_gsatdata &gsatdata)
     {
 
@@ -1757,14 +1772,16 @@ namespace gnut
                 parQzs = true;
         }
 
+        // Add parameters, appropriate rows/columns covar. matrix at once
+        vector<double> add;
+
         // Add GLO ISB parameter
         if (!parGlo && obsGlo && !onlyGlo)
         {
             t_gpar newPar(_data.begin()->site(), par_type::GLO_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_glo * _sig_init_glo;
+            add.push_back(_sig_init_glo * _sig_init_glo);
         }
 
         // Add GAL ISB parameter
@@ -1773,8 +1790,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::GAL_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_gal * _sig_init_gal;
+            add.push_back(_sig_init_gal * _sig_init_gal);
         }
 
         // Add BDS ISB parameter
@@ -1783,8 +1799,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::BDS_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_bds * _sig_init_bds;
+            add.push_back(_sig_init_bds * _sig_init_bds);
         }
 
         // Add QZS ISB parameter
@@ -1793,45 +1808,38 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::QZS_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_qzs * _sig_init_qzs;
+            add.push_back(_sig_init_qzs * _sig_init_qzs);
         }
 
+        _addPar(add);
+
+        // Remove parameters and appropriate rows/columns covar. matrix at once
+        vector<int> rem;
+
         // Remove GLO ISB paremeter
         if (parGlo && !obsGlo)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::GLO_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::GLO_ISB, ""));
         }
 
         // Remove GAL ISB paremeter
         if (parGal && !obsGal)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::GAL_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::GAL_ISB, ""));
         }
 
         // Remove BDS ISB paremeter
         if (parBds && !obsBds)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::BDS_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::BDS_ISB, ""));
         }
 
         // Remove QZS ISB paremeter
         if (parQzs && !obsQzs)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::QZS_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::QZS_ISB, ""));
         }
+        _remPar(rem);
 
     } 
 
@@ -1843,6 +1851,7 @@ namespace gnut
 
         // Add ionosphere parameter and appropriate rows/columns covar. matrix
         set<string> mapPRN;
+        vector<double> add;
 
         vector<t_gsatdata>::iterator it;
         for (it = _data.begin(); it != _data.end(); it++)
@@ -1862,14 +1871,15 @@ namespace gnut
                     parSION.value(0.0);
 
                     _param.addParam(parSION);
-                    Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                    _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_vion * _sig_init_vion;
+                    add.push_back(_sig_init_vion * _sig_init_vion);
                 }
             }
 
         } // end loop over all observations
+        _addPar(add);
 
         // Remove params and appropriate rows/columns covar. matrix
+        vector<int> rem;
         for (unsigned int i = 0; i <= _param.parNumber() - 1; i++)
         {
             if (_param[i].parType == par_type::VION)
@@ -1880,10 +1890,7 @@ namespace gnut
                 if (prnITER == mapPRN.end())
                 {
 
-                    Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-                    _param.delParam(i);
-                    _param.reIndex();
-                    i--;
+                    rem.push_back(i);
                 }
             }
         }
@@ -1899,13 +1906,11 @@ namespace gnut
                 if (prnITER == mapPRN.end())
                 {
 
-                    Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-                    _param.delParam(i);
-                    _param.reIndex();
-                    i--;
+                    rem.push_back(i);
                 }
             }
         }
+        _remPar(rem);
 
         return;
     }
@@ -2019,14 +2024,16 @@ namespace gnut
             ++it;
         }              
 
+        // Add parameters, appropriate rows/columns covar. matrix at once
+        vector<double> add;
+
         // Add GPS IFB parameter
         if (!parGps && obsGps)
         {
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GPS, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000; 
+            add.push_back(3000.0 * 3000);
         }
 
         // Add GAL IFB parameter
@@ -2035,8 +2042,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GAL, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            add.push_back(3000.0 * 3000);
         }
 
         // Add BDS IFB parameter
@@ -2045,8 +2051,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_BDS, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000 * 3000;
+            add.push_back(3000 * 3000);
         }
 
         // Add QZS IFB parameter
@@ -2055,8 +2060,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_QZS, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            add.push_back(3000.0 * 3000);
         }
 
         // Add GAL IFB_2 parameter
@@ -2065,8 +2069,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GAL_2, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            add.push_back(3000.0 * 3000);
         }
 
         // Add GAL IFB_3 parameter
@@ -2075,8 +2078,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GAL_3, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            add.push_back(3000.0 * 3000);
         }
 
         // Add BDS IFB_2 parameter
@@ -2085,8 +2087,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_BDS_2, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000 * 3000;
+            add.push_back(3000 * 3000);
         }
 
         // Add BDS IFB_3 parameter
@@ -2095,81 +2096,95 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_BDS_3, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000 * 3000;
+            add.push_back(3000 * 3000);
         }
 
+        _addPar(add);
+
+        // Remove parameters and appropriate rows/columns covar. matrix at once
+        vector<int> rem;
+
         // Remove GPS IFB paremeter
         if (parGps && !obsGps)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_GPS, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_GPS, ""));
         }
 
         // Remove GAL IFB paremeter
         if (parGal && !obsGal)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_GAL, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_GAL, ""));
         }
 
         // Remove BDS IFB paremeter
         if (parBds && !obsBds)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_BDS, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_BDS, ""));
         }
 
         // Remove QZS IFB paremeter
         if (parQzs && !obsQzs)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_QZS, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_QZS, ""));
         }
 
         // Remove GAL IFB_2 paremeter
         if (parGal_2 && !obsGal_4)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_GAL_2, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_GAL_2, ""));
         }
 
         // Remove GAL IFB_3 paremeter
         if (parGal_3 && !obsGal_5)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_GAL_3, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_GAL_3, ""));
         }
 
         // Remove BDS IFB_2 paremeter
         if (parBds_2 && !obsBds_4)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_BDS_2, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_BDS_2, ""));
         }
 
         // Remove BDS IFB_3 paremeter
         if (parBds_3 && !obsBds_5)
         {
-            int i = _param.getParam(_data.begin()->site(), par_type::IFB_BDS_3, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
-            _param.delParam(i);
-            _param.reIndex();
+            rem.push_back(_param.getParam(_data.begin()->site(), par_type::IFB_BDS_3, ""));
         }
+        _remPar(rem);
+    }
+
+    void t_gsppflt::_addPar(vector<double> &var)
+    {
+        // parameters are appended to _param as found, Qx follows once all of them are known
+        if (var.empty())
+            return;
+        Matrix_add(_Qx, var);
+        if (_filter)
+            _filter->add_states(var);
+        var.clear();
+    }
+
+    void t_gsppflt::_remPar(vector<int> &idx)
+    {
+        sort(idx.begin(), idx.end());
+        idx.erase(unique(idx.begin(), idx.end()), idx.end());
+        idx.erase(remove_if(idx.begin(), idx.end(), [](int i) { return i < 0; }), idx.end());
+        if (idx.empty())
+            return;
+
+        // rows/columns in ascending order, Matrix_rem shifts the following ones itself
+        vector<int> ind;
+        for (int i : idx)
+            ind.push_back(_param[i].index);
+        if (_filter)
+            _filter->rem_states(ind);
+        Matrix_rem(_Qx, ind);
+
+        for (auto it = idx.rbegin(); it != idx.rend(); ++it)
+            _param.delParam(*it);
+        _param.reIndex();
+        idx.clear();
     }
 
     int t_gsppflt::_getgobs(string prn, GOBSTYPE type, GOBSBAND band, t_gobs &gobs)
@@ -64,6 +64,9 @@ namespace gnut
         /** @brief Restore state and covariance matrix. */
         virtual void _restore(const SymmetricMatrix &Qsav, const t_gallpar &Xsav);
 
+        /** @brief new filter of the method set in xml (method_flt), nullptr if unknown. */
+        t_gflt *_new_filter();
+
         /** @brief Satelite position. */
         virtual int _satPos(t_gtime &, t_gsatdata &);
 
@@ -100,6 +103,18 @@ namespace gnut
         /** @brief Add/Remove inter-freq. biases. */
         void _syncIFB();
 
+        /**
+        * @brief add rows/columns of Qx for the parameters appended to _param since the last call, in one pass.
+        * @param[in] var    initial variances in the order the parameters were appended, cleared on return
+        */
+        void _addPar(vector<double> &var);
+
+        /**
+        * @brief remove parameters and their rows/columns of Qx in one pass.
+        * @param[in] idx    positions in _param (any order), cleared on return
+        */
+        void _remPar(vector<int> &idx);
+
         /** @brief save observations residuals. */
         void _save_residuals(ColumnVector &v, vector<t_gsatdata> &satdata, RESIDTYPE restype);
 
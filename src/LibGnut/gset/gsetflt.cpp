@@ -14,6 +14,7 @@
 
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
 
 #include "gset/gsetflt.h"
 
@@ -41,6 +42,7 @@ namespace gnut
         _rndwk_grd = 0.3;
         _rndwk_amb = 0.1;
         _method_flt = "kalman";
+        _smooth = "none";
         _reset_amb = 0;
         _reset_par = 0;
     }
@@ -62,6 +64,20 @@ namespace gnut
         return tmp;
     }
 
+    string t_gsetflt::smooth()
+    {
+        _gmutex.lock();
+
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_FLT).attribute("smooth").value();
+        transform(tmp.begin(), tmp.end(), tmp.begin(), ::tolower);
+        if (tmp != "fbs")
+        {
+            tmp = _smooth;
+        }
+        _gmutex.unlock();
+        return tmp;
+    }
+
     double t_gsetflt::noise_clk()
     {
         _gmutex.lock();
@@ -241,6 +257,7 @@ namespace gnut
         xml_node node = _default_node(parent, XMLKEY_FLT);
 
         _default_attr(node, "method_flt", _method_flt);
+        _default_attr(node, "smooth", _smooth);
         _default_attr(node, "noise_clk", _noise_clk);
         _default_attr(node, "noise_dclk", _noise_dclk);
         _default_attr(node, "noise_crd", _noise_crd);
@@ -267,6 +284,7 @@ namespace gnut
 
         cerr << " <filter \n"
              << "   method_flt=\"" << _method_flt << "\" \n"
+             << "   smooth=\"" << _smooth << "\" \n"
              << "   noise_clk=\"" << _noise_clk << "\" \n"
              << "   noise_crd=\"" << _noise_crd << "\" \n"
              << "   rndwk_ztd=\"" << _rndwk_ztd << "\" \n"
@@ -275,7 +293,8 @@ namespace gnut
              << "  />\n";
 
         cerr << "\t<!-- filter description:\n"
-             << "\t method_flt    .. type of filtering method (SRCF, Kalman)\n"
+             << "\t method_flt    .. type of filtering method (kalman, kalman_eigen, srcf, srcf_seq)\n"
+             << "\t smooth        .. none, fbs (forward and backward filter combined, written to the smt output)\n"
              << "\t noise_clk     .. white noise for clocks \n"
              << "\t noise_crd     .. white noise for coordinates \n"
              << "\t rndwk_ztd     .. random walk process for ZTD [mm/sqrt(hour)] \n"
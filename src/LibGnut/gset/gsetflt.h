@@ -58,6 +58,12 @@ namespace gnut
          */
         string method_flt();
 
+        /**
+         * @brief get the smoothing mode of the batch processing
+         * @return string : none (forward filter only) or fbs (forward/backward combination)
+         */
+        string smooth();
+
         /**
          * @brief get the noise of clk in flt
          * @return double : the noise of clk in flt
@@ -160,7 +166,8 @@ namespace gnut
         int reset_par(double d);
 
     protected:
-        string _method_flt; ///< type of filtering method (kalman, SRCF)
+        string _method_flt; ///< type of filtering method (kalman, kalman_eigen, SRCF, SRCF_seq)
+        string _smooth;     ///< smoothing mode (none, fbs)
         double _noise_clk;  ///< white noise for receiver clock [m]
         double _noise_crd;  ///< white noise for coordinates [m]
         double _noise_dclk; ///< white noise for receiver clock speed [m/s]
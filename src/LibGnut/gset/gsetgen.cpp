@@ -116,6 +116,21 @@ namespace gnut
         return tmp;
     }
 
+    double t_gsetgen::retention()
+    {
+        _gmutex.lock();
+
+        string str = _doc.child(XMLKEY_ROOT).child(XMLKEY_GEN).child_value("retention");
+
+        // delete spaces
+        str.erase(remove(str.begin(), str.end(), ' '), str.end());
+
+        double tmp = str.empty() ? 0.0 : str2dbl(str);
+
+        _gmutex.unlock();
+        return (tmp > 0.0) ? tmp : 0.0;
+    }
+
     double t_gsetgen::sampling_default() const
     {
         return DEF_SAMPLING;
@@ -312,7 +327,8 @@ namespace gnut
         cerr << "\t<!-- general description:\n"
              << "\t beg    .. beg time          (default: all)\n"
              << "\t end    .. end time          (default: all)\n"
-             << "\t int    .. data sampling     (default: 30s)\n";
+             << "\t int    .. data sampling     (default: 30s)\n"
+             << "\t retention .. keep consumed data [s] (default: 0 = all)\n";
 
         if (_gnss)
             cerr << "\t sys    .. GNSS system(s)    (default: all)\n";
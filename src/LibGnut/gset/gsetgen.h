@@ -93,6 +93,13 @@ namespace gnut
          */
         const int &sampling_decimal() { return _dec; }
 
+        /**
+         * @brief get the retention window of consumed data (long or real-time runs)
+         * @note forward/backward smoothing keeps all epochs
+         * @return double : retention window [s], 0 = keep all data in memory
+         */
+        double retention();
+
         /**
          * @brief get the List of system names
          * @return set<string> : List of system names
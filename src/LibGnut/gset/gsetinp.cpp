@@ -57,8 +57,12 @@ namespace gnut
             return IFMT::IFCB_INP;
         if (tmp == "IMU")
             return IFMT::IMU_INP; 
+        if (tmp == "IMUBIN")
+            return IFMT::IMUBIN_INP;
         if (tmp == "ODO")
             return IFMT::ODO_INP;
+        if (tmp == "RTCM" || tmp == "RTCM3")
+            return IFMT::RTCM_INP;
 
         string message = "The Type : " + tmp + " is not support, check your xml";
         spdlog::warn(message);
@@ -97,8 +101,12 @@ namespace gnut
 			return "EOP";
         case IFMT::IMU_INP:
             return "IMU";
+        case IFMT::IMUBIN_INP:
+            return "IMUBIN";
         case IFMT::ODO_INP:
             return "ODO";
+        case IFMT::RTCM_INP:
+            return "RTCM";
         default:
             spdlog::critical("No fmt for {}, check your inp.", f);
             throw logic_error("check your inp");
@@ -55,6 +55,8 @@ namespace gnut
         UPD_INP,        ///< upd file
         IMU_INP,     ///< imu file for inertial navigation system (by zhshen)
         ODO_INP,       ///< odo file (by zhshen)
+        RTCM_INP,      ///< RTCM 3 stream/file
+        IMUBIN_INP,    ///< binary (memory mapped) imu file
         UNDEF = -1
     };
 
@@ -44,6 +44,22 @@ namespace gnut
             return KML_OUT;
         if (tmp == "INS")
             return INS_OUT;
+        if (tmp == "SMT")
+            return SMT_OUT;
+        if (tmp == "CKP")
+            return CKP_OUT;
+        if (tmp == "OUTAGE")
+            return OUTAGE_OUT;
+        if (tmp == "PROF")
+            return PROF_OUT;
+        if (tmp == "RINEXO")
+            return RINEXO_OUT;
+        if (tmp == "IMU")
+            return IMU_OUT;
+        if (tmp == "IMUBIN")
+            return IMUBIN_OUT;
+        if (tmp == "RATIO")
+            return RATIO_OUT;
         return OFMT(-1);
     }
 
@@ -59,6 +75,22 @@ namespace gnut
             return "PPP";
         case FLT_OUT:
             return "FLT";
+        case SMT_OUT:
+            return "SMT";
+        case CKP_OUT:
+            return "CKP";
+        case OUTAGE_OUT:
+            return "OUTAGE";
+        case PROF_OUT:
+            return "PROF";
+        case RINEXO_OUT:
+            return "RINEXO";
+        case IMU_OUT:
+            return "IMU";
+        case IMUBIN_OUT:
+            return "IMUBIN";
+        case RATIO_OUT:
+            return "RATIO";
         default:
             return "UNDEF";
         }
@@ -167,6 +199,14 @@ namespace gnut
         }
     }
 
+    bool t_gsetout::log_async()
+    {
+        _gmutex.lock();
+        bool tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_OUT).child("log").attribute("async").as_bool();
+        _gmutex.unlock();
+        return tmp;
+    }
+
     level::level_enum t_gsetout::log_level()
     {
         _gmutex.lock();
@@ -227,6 +267,27 @@ namespace gnut
         return ver;
     }
 
+    double t_gsetout::kml_intv()
+    {
+        _gmutex.lock();
+
+        double intv = _doc.child(XMLKEY_ROOT).child(XMLKEY_OUT).child("kml").attribute("intv").as_double(0.0);
+
+        _gmutex.unlock();
+        return intv > 0.0 ? intv : 0.0;
+    }
+
+    bool t_gsetout::binary(const string &fmt)
+    {
+        _gmutex.lock();
+
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_OUT).child(fmt.c_str()).attribute("format").as_string();
+        transform(tmp.begin(), tmp.end(), tmp.begin(), ::tolower);
+
+        _gmutex.unlock();
+        return tmp == "bin";
+    }
+
     set<string> t_gsetout::oformats()
     {
         return _oformats();
@@ -307,6 +368,17 @@ namespace gnut
 
         cerr << " <outputs append=\"" << _append << "\" verb=\"" << _verb << "\" >\n"
              << "   <flt> file://dir/name </flt>    \t\t <!-- filter output encoder -->\n"
+             << "   <smt> file://dir/name </smt> \t\t <!-- smoothed solution (RTS or forward/backward) -->\n"
+             << "   <ckp> file://dir/name </ckp> \t\t <!-- filter checkpoint, see process checkpoint_intv/restore -->\n"
+             << "   <outage> file://dir/name </outage> \t <!-- statistics of the simulated GNSS outages -->\n"
+             << "   <ins format=\"bin\"> file://dir/name </ins> \t <!-- binary records, GREAT_Bin2Txt prints the text -->\n"
+             << "   <log type=\"BASIC\" async=\"false\" /> \t <!-- async: worker thread, flushed on errors and at exit -->\n"
+             << "   <kml intv=\"0\"> file://dir/name </kml> \t <!-- kml trajectory, placemarks at least intv [s] apart -->\n"
+             << "   <prof> file://dir/name </prof> \t <!-- wall time per processing stage, timers off without it -->\n"
+             << "   <rinexo> file://dir/ </rinexo> \t <!-- simulated RINEX 3 obs, dir or mask with $(rec) -->\n"
+             << "   <imu> file://dir/ </imu> \t\t <!-- simulated IMU samples and reference trajectory -->\n"
+             << "   <imubin> file://dir/name </imubin> \t <!-- text imu input converted to the binary imu file -->\n"
+             << "   <ratio> file://dir/ratio-$(rec) </ratio> \t <!-- ambiguity ratio test per epoch, default ratio-<rec> -->\n"
              << " </outputs>\n";
 
         _gmutex.unlock();
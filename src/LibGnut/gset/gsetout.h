@@ -49,7 +49,15 @@ namespace gnut
         PPP_OUT,
         FLT_OUT,
         KML_OUT,
-        INS_OUT
+        INS_OUT,
+        SMT_OUT,
+        CKP_OUT,
+        OUTAGE_OUT,
+        PROF_OUT,
+        RINEXO_OUT,
+        IMU_OUT,
+        IMUBIN_OUT,
+        RATIO_OUT
     };
 
     class LibGnut_LIBRARY_EXPORT t_gsetout : public virtual t_gsetbase
@@ -128,6 +136,11 @@ namespace gnut
         */
         string log_pattern();
 
+        /*
+        * @brief  get asynchronous logging request, <log async="true">
+        */
+        bool log_async();
+
         /**
          * @brief  get formats
          * @return set<string> : all the outputs
@@ -141,6 +154,18 @@ namespace gnut
          */
         string version(const string &fmt);
 
+        /**
+         * @brief  get minimum interval of the kml placemarks, <kml intv="..."> [s]
+         * @return double : interval, 0 = all epochs
+         */
+        double kml_intv();
+
+        /**
+         * @brief  get binary record request, <fmt format="bin"> (see t_gfmtline)
+         * @param[in] fmt file format
+         * @return bool : binary records instead of text
+         */
+        bool binary(const string &fmt);
 
 
     protected:
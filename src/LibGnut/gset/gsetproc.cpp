@@ -66,6 +66,9 @@ namespace gnut
         _sd_sat = false;
         _basepos = BASEPOS::SPP;
         _minsat = static_cast<size_t>(6); 
+        _sat_threads = 1;
+        _checkpoint_intv = 0.0;
+        _latency_budget = 50.0;
 
         _meanpolemodel = modeofmeanpole::cubic;
     }
@@ -383,6 +386,57 @@ namespace gnut
         return tmp_int;
     }
 
+    int t_gsetproc::sat_threads()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("sat_threads");
+        str_erase(tmp);
+        int tmp_int = _sat_threads;
+        if (tmp != "")
+            tmp_int = std::stoi(tmp);
+        if (tmp_int < 1)
+            tmp_int = 1;
+        _gmutex.unlock();
+        return tmp_int;
+    }
+
+    double t_gsetproc::checkpoint_intv()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("checkpoint_intv");
+        str_erase(tmp);
+        double tmp_dbl = _checkpoint_intv;
+        if (tmp != "")
+            tmp_dbl = str2dbl(tmp);
+        if (tmp_dbl < 0.0)
+            tmp_dbl = 0.0;
+        _gmutex.unlock();
+        return tmp_dbl;
+    }
+
+    double t_gsetproc::latency_budget()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("latency_budget");
+        str_erase(tmp);
+        double tmp_dbl = _latency_budget;
+        if (tmp != "")
+            tmp_dbl = str2dbl(tmp);
+        if (tmp_dbl <= 0.0)
+            tmp_dbl = _latency_budget;
+        _gmutex.unlock();
+        return tmp_dbl;
+    }
+
+    string t_gsetproc::restore()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("restore");
+        str_erase(tmp);
+        _gmutex.unlock();
+        return tmp;
+    }
+
     string t_gsetproc::ref_clk()
     {
         _gmutex.lock();
@@ -641,6 +695,10 @@ namespace gnut
              << "   minimum_elev=\"" << _minimum_elev << "\" \n"
              << "   max_res_norm=\"" << _max_res_norm << "\" \n"
              << "   basepos=\"" << basepos2str(_basepos) << "\" \n"
+             << "   sat_threads=\"" << _sat_threads << "\" \n"
+             << "   checkpoint_intv=\"" << _checkpoint_intv << "\" \n"
+             << "   restore=\"\" \n"
+             << "   latency_budget=\"" << _latency_budget << "\" \n"
              << " />\n";
 
         cerr << "\t<!-- process description:\n"
@@ -659,6 +717,10 @@ namespace gnut
              << "\t minimum_elev  .. elevation angle cut-off [degree]\n"
              << "\t max_res_norm  .. maximal normalized residuals\n"
              << "\t basepos  .. base site coordinate\n"
+             << "\t sat_threads .. threads for satellite positions, geometry and observation models of one epoch (1 = sequential)\n"
+             << "\t checkpoint_intv .. interval of the filter checkpoints written to the ckp output [s] (0 = only at the end)\n"
+             << "\t restore  .. checkpoint file to resume the filter from, processing continues after its epoch\n"
+             << "\t latency_budget .. real-time runs: latency budget of one epoch [ms], older queued epochs are skipped\n"
              << "\t -->\n\n";
 
         _gmutex.unlock();
@@ -240,6 +240,18 @@ namespace gnut
         /**@brief min satellite number */
         int minsat();
 
+        /**@brief number of threads for the per-satellite preprocessing and models of one epoch (1 = sequential) */
+        int sat_threads();
+
+        /**@brief interval of the filter checkpoints [s], 0 = only at the end of the run */
+        double checkpoint_intv();
+
+        /**@brief checkpoint file to resume the filter from (empty = start from scratch) */
+        string restore();
+
+        /**@brief latency budget of one epoch in real-time runs [ms] */
+        double latency_budget();
+
         /**@brief set process */
         string ref_clk();
         SLIPMODEL slip_model();
@@ -353,6 +365,9 @@ namespace gnut
         double _rec_zen_end;            ///< end zenith angle of receiver PCV
         double _rec_dzen;               ///< zenith angle of receiver PCV
         int _minsat;                    ///< minimum satellite number
+        int _sat_threads;               ///< threads for the per-satellite preprocessing and models
+        double _checkpoint_intv;        ///< interval of the filter checkpoints
+        double _latency_budget;         ///< latency budget of one real-time epoch [ms]
         BASEPOS _basepos;               ///< base position
         bool _sd_sat;                   ///< single differented between sat and sat_ref
         modeofmeanpole _meanpolemodel;  ///< different mean pole modeling
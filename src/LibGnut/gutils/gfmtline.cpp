@@ -0,0 +1,243 @@
+/**
+ * @file         gfmtline.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        result line formatted without iostreams, as text or as a binary record
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "gutils/gfmtline.h"
+
+namespace gnut
+{
+    static const char FMT_MAGIC[8] = {'G', 'R', 'E', 'A', 'T', 'F', 'M', 'T'};
+
+    static const double FMT_POW10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12};
+
+    static void _pad(string &out, size_t len, int w)
+    {
+        if (w > 0 && len < static_cast<size_t>(w))
+            out.append(w - len, ' ');
+    }
+
+    t_gfmtline::t_gfmtline(bool binary)
+        : _bin(binary)
+    {
+        _buf.reserve(256);
+    }
+
+    t_gfmtline::~t_gfmtline()
+    {
+    }
+
+    t_gfmtline &t_gfmtline::fix(double v, int w, int p)
+    {
+        if (!_bin)
+        {
+            append_fix(_buf, v, w, p);
+            return *this;
+        }
+        unsigned char wp[2] = {static_cast<unsigned char>(max(0, min(w, 255))), static_cast<unsigned char>(max(0, min(p, 255)))};
+        _buf += 'F';
+        _put(wp, 2);
+        _put(&v, sizeof(v));
+        return *this;
+    }
+
+    t_gfmtline &t_gfmtline::num(long long v, int w)
+    {
+        if (!_bin)
+        {
+            char tmp[32];
+            int n = snprintf(tmp, sizeof(tmp), "%lld", v);
+            _pad(_buf, n, w);
+            _buf.append(tmp, n);
+            return *this;
+        }
+        unsigned char uw = static_cast<unsigned char>(max(0, min(w, 255)));
+        int64_t x = v;
+        _buf += 'I';
+        _put(&uw, 1);
+        _put(&x, sizeof(x));
+        return *this;
+    }
+
+    t_gfmtline &t_gfmtline::str(const string &s, int w)
+    {
+        if (!_bin)
+        {
+            _pad(_buf, s.size(), w);
+            _buf += s;
+            return *this;
+        }
+        unsigned char uw = static_cast<unsigned char>(max(0, min(w, 255)));
+        uint32_t n = static_cast<uint32_t>(s.size());
+        _buf += 'S';
+        _put(&uw, 1);
+        _put(&n, sizeof(n));
+        _buf += s;
+        return *this;
+    }
+
+    t_gfmtline &t_gfmtline::lit(const string &s)
+    {
+        if (!_bin)
+        {
+            _buf += s;
+            return *this;
+        }
+        uint32_t n = static_cast<uint32_t>(s.size());
+        _buf += 'L';
+        _put(&n, sizeof(n));
+        _buf += s;
+        return *this;
+    }
+
+    t_gfmtline &t_gfmtline::lit(const char *s)
+    {
+        if (!_bin)
+        {
+            _buf += s;
+            return *this;
+        }
+        return lit(string(s));
+    }
+
+    string t_gfmtline::magic()
+    {
+        string m(FMT_MAGIC, sizeof(FMT_MAGIC));
+        m += static_cast<char>(FMTLINE_VERSION);
+        return m;
+    }
+
+    void t_gfmtline::append_fix(string &out, double v, int w, int p)
+    {
+        char tmp[64];
+        double a = fabs(v);
+        bool slow = (p < 0 || p > 12 || !(a < 1e15));
+
+        // digits of round(|v| * 10^p); printf rounds the exact binary value, a
+        // product too close to a tie to decide goes the slow way
+        double x = 0.0, fl = 0.0;
+        if (!slow)
+        {
+            x = a * FMT_POW10[p];
+            fl = floor(x);
+            slow = !(x < 9.0e15) || fabs(x - fl - 0.5) <= 4.0 * x * numeric_limits<double>::epsilon();
+        }
+        if (slow)
+        {
+            int n = snprintf(tmp, sizeof(tmp), "%*.*f", max(w, 0), max(p, 0), v);
+            if (n > 0 && n < static_cast<int>(sizeof(tmp)))
+            {
+                out.append(tmp, n);
+                return;
+            }
+            string big(n + 1, '\0');
+            snprintf(&big[0], big.size(), "%*.*f", max(w, 0), max(p, 0), v);
+            out.append(big.c_str(), n);
+            return;
+        }
+
+        uint64_t r = static_cast<uint64_t>(fl) + (x - fl > 0.5 ? 1 : 0);
+        char *end = tmp + sizeof(tmp);
+        char *c = end;
+        for (int i = 0; i < p; i++)
+        {
+            *--c = static_cast<char>('0' + r % 10);
+            r /= 10;
+        }
+        if (p > 0)
+            *--c = '.';
+        do
+        {
+            *--c = static_cast<char>('0' + r % 10);
+            r /= 10;
+        } while (r > 0);
+        if (signbit(v))
+            *--c = '-';
+
+        _pad(out, end - c, w);
+        out.append(c, end - c);
+    }
+
+    bool t_gfmtline::to_text(istream &is, ostream &os)
+    {
+        t_gfmtline line;
+        string s;
+        char tag;
+        while (is.get(tag))
+        {
+            unsigned char wp[2] = {0, 0};
+            uint32_t n = 0;
+            switch (tag)
+            {
+            case 'G':
+            {
+                char m[sizeof(FMT_MAGIC)] = {0};
+                m[0] = tag;
+                is.read(m + 1, sizeof(m) - 1);
+                char ver = 0;
+                is.get(ver);
+                if (!is || memcmp(m, FMT_MAGIC, sizeof(m)) != 0 || ver != FMTLINE_VERSION)
+                    return false;
+                break;
+            }
+            case 'F':
+            {
+                double v = 0.0;
+                is.read(reinterpret_cast<char *>(wp), 2);
+                is.read(reinterpret_cast<char *>(&v), sizeof(v));
+                if (!is)
+                    return false;
+                line.fix(v, wp[0], wp[1]);
+                break;
+            }
+            case 'I':
+            {
+                int64_t v = 0;
+                is.read(reinterpret_cast<char *>(wp), 1);
+                is.read(reinterpret_cast<char *>(&v), sizeof(v));
+                if (!is)
+                    return false;
+                line.num(v, wp[0]);
+                break;
+            }
+            case 'S':
+            case 'L':
+                if (tag == 'S')
+                    is.read(reinterpret_cast<char *>(wp), 1);
+                is.read(reinterpret_cast<char *>(&n), sizeof(n));
+                if (!is || n > (1u << 24))
+                    return false;
+                s.resize(n);
+                if (n > 0)
+                    is.read(&s[0], n);
+                if (!is)
+                    return false;
+                if (tag == 'S')
+                    line.str(s, wp[0]);
+                else
+                    line.lit(s);
+                break;
+            default:
+                return false;
+            }
+            if (line.size() > (1u << 16))
+            {
+                os.write(line.data().data(), line.size());
+                line.clear();
+            }
+        }
+        os.write(line.data().data(), line.size());
+        return !os.fail();
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file         gfmtline.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        result line formatted without iostreams, as text or as a binary record
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   text     fix(v, w, p) prints like  fixed << setprecision(p) << setw(w) << v,
+ *            num() and str() like setw(w) << v, right aligned
+ *   binary   the same calls store the values with their width and precision,
+ *            to_text() prints a binary file exactly as the text output
+ *
+ *            "GREATFMT" + version   file magic, may repeat (appended files)
+ *            'F' w p double         fixed point value
+ *            'I' w int64            integer
+ *            'S' w uint32 chars     string
+ *            'L' uint32 chars       literal text (separators, headers, new lines)
+ *
+ *   Binary values are in the machine representation (same platform).
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GFMTLINE_H
+#define GFMTLINE_H
+
+#include <string>
+#include <iostream>
+#include "gexport/ExportLibGnut.h"
+
+using namespace std;
+
+#define FMTLINE_VERSION 1 ///< binary record format version
+
+namespace gnut
+{
+    /**
+    * @brief one or more output lines
+    */
+    class LibGnut_LIBRARY_EXPORT t_gfmtline
+    {
+    public:
+        /**
+        * @brief constructor
+        * @param[in] binary     store binary records instead of text
+        */
+        explicit t_gfmtline(bool binary = false);
+
+        /** @brief default destructor. */
+        virtual ~t_gfmtline();
+
+        /** @brief fixed point value, width w and p decimals. */
+        t_gfmtline &fix(double v, int w, int p);
+
+        /** @brief integer, width w. */
+        t_gfmtline &num(long long v, int w = 0);
+
+        /** @brief string, width w. */
+        t_gfmtline &str(const string &s, int w = 0);
+
+        /** @brief text as it is. */
+        t_gfmtline &lit(const string &s);
+        t_gfmtline &lit(const char *s);
+
+        /** @brief new line. */
+        t_gfmtline &eol() { return lit("\n"); }
+
+        /** @brief binary records. */
+        bool binary() const { return _bin; }
+
+        /** @brief formatted text or binary records. */
+        const string &data() const { return _buf; }
+        size_t size() const { return _buf.size(); }
+        bool empty() const { return _buf.empty(); }
+
+        /** @brief remove the content, the capacity is kept. */
+        void clear() { _buf.clear(); }
+
+        /** @brief magic starting a binary file. */
+        static string magic();
+
+        /**
+        * @brief print binary records as text
+        * @param[in] is         binary records
+        * @param[out] os        text
+        * @return false if the records are corrupted or of another version
+        */
+        static bool to_text(istream &is, ostream &os);
+
+        /** @brief append v as fixed << setprecision(p) << setw(w) would. */
+        static void append_fix(string &out, double v, int w, int p);
+
+    protected:
+        /** @brief append raw bytes. */
+        void _put(const void *p, size_t n) { _buf.append(static_cast<const char *>(p), n); }
+
+        bool _bin;      ///< binary records
+        string _buf;    ///< content
+    };
+}
+
+#endif
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <cstring>
 
 #include "gutils/gmatrixconv.h"
 #include "gutils/gconst.h"
@@ -19,8 +20,44 @@ using namespace std;
 
 namespace gnut
 {
+    // packed lower triangle of newmat SymmetricMatrix: (r, c), r >= c, 0-based at r * (r + 1) / 2 + c
+    static inline size_t _tri(int r)
+    {
+        return (size_t)r * (r + 1) / 2;
+    }
+
+    // keeps the 0-based rows/cols 'keep' (ascending) of Q in one pass
+    static void _Matrix_keep(SymmetricMatrix &Q, const vector<int> &keep)
+    {
+        int m = keep.size();
+        SymmetricMatrix Qn(m);
+        const Real *src = Q.Store();
+        Real *dst = Qn.Store();
+        for (int a = 0; a < m; a++)
+        {
+            const Real *srow = src + _tri(keep[a]);
+            if (keep[a] == a)
+            {
+                // nothing removed before this row
+                memcpy(dst, srow, (a + 1) * sizeof(Real));
+                dst += a + 1;
+                continue;
+            }
+            for (int b = 0; b <= a; b++)
+                *dst++ = srow[keep[b]];
+        }
+        Q.swap(Qn);
+    }
+
     void Matrix_remRC(SymmetricMatrix &Q, int row, int col)
     {
+        if (row == col)
+        {
+            vector<int> ind(1, row);
+            Matrix_rem(Q, ind);
+            return;
+        }
+
         SymmetricMatrix Qt(Q.Nrows());
         Qt = Q;
         Q.ReSize(Q.Nrows() - 1);
@@ -46,18 +83,61 @@ namespace gnut
 
     void Matrix_rem(SymmetricMatrix &Q, vector<int> &ind)
     {
+        // indices are applied one after another, each one decrements the following ones
+        // (as removing them one by one), the covariance is compacted once at the end
+        int n = Q.Nrows();
+        vector<int> pos(n);
+        for (int i = 0; i < n; i++)
+            pos[i] = i;
+
         vector<int>::iterator it;
         vector<int>::iterator it2;
         for (it = ind.begin(); it != ind.end(); it++)
         {
-            Matrix_remRC(Q, *it, *it);
+            if (*it < 1 || *it > (int)pos.size())
+                Throw(IndexException(*it - 1, *it - 1, Q, true));
+            pos.erase(pos.begin() + *it - 1);
             for (it2 = it; it2 != ind.end(); it2++)
                 (*it2)--;
         }
+
+        if ((int)pos.size() != n)
+            _Matrix_keep(Q, pos);
     }
 
     void Matrix_addRC(SymmetricMatrix &Q, int row, int col)
     {
+        int n = Q.Nrows();
+        if (row == col && row >= 1 && row <= n + 1)
+        {
+            // zero row/col inserted at 'row', rows are copied as (at most) two blocks
+            int r = row - 1;
+            SymmetricMatrix Qn(n + 1);
+            const Real *src = Q.Store();
+            Real *dst = Qn.Store();
+            for (int a = 0; a <= n; a++)
+            {
+                Real *drow = dst + _tri(a);
+                if (a < r)
+                {
+                    memcpy(drow, src + _tri(a), (a + 1) * sizeof(Real));
+                }
+                else if (a == r)
+                {
+                    memset(drow, 0, (a + 1) * sizeof(Real));
+                }
+                else
+                {
+                    const Real *srow = src + _tri(a - 1);
+                    memcpy(drow, srow, r * sizeof(Real));
+                    drow[r] = 0.0;
+                    memcpy(drow + r + 1, srow + r, (a - r) * sizeof(Real));
+                }
+            }
+            Q.swap(Qn);
+            return;
+        }
+
         SymmetricMatrix Qt(Q.Nrows());
         Qt = Q;
         Q.ReSize(Q.Nrows() + 1);
@@ -99,6 +179,26 @@ namespace gnut
         }
     }
 
+    void Matrix_add(SymmetricMatrix &Q, const vector<double> &var)
+    {
+        if (var.empty())
+            return;
+
+        // the old lower triangle is the leading part of the new one, the new rows are zero but the diagonal
+        int n = Q.Nrows();
+        int m = n + (int)var.size();
+        SymmetricMatrix Qn(m);
+        Real *dst = Qn.Store();
+        memcpy(dst, Q.Store(), _tri(n) * sizeof(Real));
+        for (int a = n; a < m; a++)
+        {
+            Real *drow = dst + _tri(a);
+            memset(drow, 0, a * sizeof(Real));
+            drow[a] = var[a - n];
+        }
+        Q.swap(Qn);
+    }
+
     void Matrix_addRC(Matrix &Q, int row, int col)
     {
         Matrix Qt(Q.Nrows(), Q.Ncols());
@@ -322,4 +422,82 @@ namespace gnut
         }
     }
 
+    void Matrix_predict(SymmetricMatrix &Q, const vector<t_gprocnoise> &proc)
+    {
+        int n = Q.Nrows();
+        double *q = Q.Store();
+        for (size_t k = 0; k < proc.size(); k++)
+        {
+            int i = proc[k].idx - 1;
+            if (i < 0 || i >= n)
+                Throw(IndexException(proc[k].idx, proc[k].idx, Q, true));
+
+            double *qi = q + _tri(i);
+            switch (proc[k].model)
+            {
+            case PROC_MODEL::RANDOM_WALK:
+                qi[i] += proc[k].q;
+                break;
+            case PROC_MODEL::WHITE_NOISE:
+                // row i is contiguous left of the diagonal, column i is one element per following row
+                memset(qi, 0, i * sizeof(double));
+                for (int r = i + 1; r < n; r++)
+                    q[_tri(r) + i] = 0.0;
+                qi[i] = proc[k].q;
+                break;
+            case PROC_MODEL::RESET:
+                qi[i] = proc[k].q;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void Matrix2Eigen(const SymmetricMatrix &Q, Eigen::MatrixXd &E)
+    {
+        int n = Q.Nrows();
+        E.resize(n, n);
+        const double *q = Q.Store();
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = 0; c <= r; c++)
+                E(r, c) = E(c, r) = q[c];
+            q += r + 1;
+        }
+    }
+
+    void Matrix2Eigen(const Matrix &M, Eigen::MatrixXd &E)
+    {
+        E = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(M.Store(), M.Nrows(), M.Ncols());
+    }
+
+    void Vector2Eigen(const ColumnVector &v, Eigen::VectorXd &e)
+    {
+        e = Eigen::Map<const Eigen::VectorXd>(v.Store(), v.Nrows());
+    }
+
+    void Eigen2Matrix(const Eigen::MatrixXd &E, SymmetricMatrix &Q)
+    {
+        int n = E.rows();
+        if (Q.Nrows() != n)
+            Q.ReSize(n);
+        double *q = Q.Store();
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = 0; c <= r; c++)
+                q[c] = E(r, c);
+            q += r + 1;
+        }
+    }
+
+    void Eigen2Vector(const Eigen::VectorXd &e, ColumnVector &v)
+    {
+        int n = e.size();
+        if (v.Nrows() != n)
+            v.ReSize(n);
+        if (n > 0)
+            memcpy(v.Store(), e.data(), n * sizeof(double));
+    }
+
 } // namespace
@@ -23,6 +23,8 @@
 #include <ostream>
 #include <vector>
 
+#include <Eigen/Dense>
+
 #include "newmat/newmat.h"
 #include "gexport/ExportLibGnut.h"
 
@@ -30,6 +32,32 @@ using namespace std;
 namespace gnut
 {
 
+    /** @brief process model of one parameter in the time update. */
+    enum class PROC_MODEL
+    {
+        CONST,       ///< no change
+        RANDOM_WALK, ///< Q(i,i) += q
+        WHITE_NOISE, ///< row/column i cleared, Q(i,i) = q
+        RESET        ///< Q(i,i) = q, correlations kept
+    };
+
+    /** @brief time update of one parameter. */
+    struct LibGnut_LIBRARY_EXPORT t_gprocnoise
+    {
+        t_gprocnoise(int i, PROC_MODEL m, double v) : idx(i), model(m), q(v) {}
+        int idx;          ///< index in Q (from 1)
+        PROC_MODEL model; ///< process model
+        double q;         ///< noise or variance
+    };
+
+    /**
+    * @brief time update of SymMatrix, applied in the given order touching only the rows/columns listed.
+    * @param[in,out] &        a SymmetricMatrix
+    * @param[in]     proc     process models
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Matrix_predict(SymmetricMatrix &, const vector<t_gprocnoise> &proc);
+
     /**
     * @brief remove   r_th row and c_th column in SymMatrix
     * @param[in]     &        a SymmetricMatrix
@@ -57,6 +85,14 @@ namespace gnut
     */
     LibGnut_LIBRARY_EXPORT void Matrix_addRC(SymmetricMatrix &, int row, int col);
 
+    /**
+    * @brief append rows and columns at the end of SymMatrix in one pass
+    * @param[in,out] &        a SymmetricMatrix
+    * @param[in]     var      variances of the new rows (diagonal), the rest of the rows is zero
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Matrix_add(SymmetricMatrix &, const vector<double> &var);
+
     /**
     * @brief add zero r_th row and c_th column in Matrix
     * @param[in]     &        a Matrix
@@ -111,6 +147,46 @@ namespace gnut
     /** @brief add zero r_th row in Column Vector. */
     LibGnut_LIBRARY_EXPORT void Vector_add(ColumnVector &, int row);
 
+    /**
+    * @brief copy SymmetricMatrix to full Eigen matrix (packed storage, no index checks).
+    * @param[in]     Q        a SymmetricMatrix
+    * @param[out]    E        Eigen matrix, resized
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Matrix2Eigen(const SymmetricMatrix &Q, Eigen::MatrixXd &E);
+
+    /**
+    * @brief copy Matrix to Eigen matrix (row storage, no index checks).
+    * @param[in]     M        a Matrix
+    * @param[out]    E        Eigen matrix, resized
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Matrix2Eigen(const Matrix &M, Eigen::MatrixXd &E);
+
+    /**
+    * @brief copy ColumnVector to Eigen vector.
+    * @param[in]     v        a ColumnVector
+    * @param[out]    e        Eigen vector, resized
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Vector2Eigen(const ColumnVector &v, Eigen::VectorXd &e);
+
+    /**
+    * @brief copy lower triangle of square Eigen matrix to SymmetricMatrix.
+    * @param[in]     E        Eigen matrix
+    * @param[out]    Q        a SymmetricMatrix, resized
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Eigen2Matrix(const Eigen::MatrixXd &E, SymmetricMatrix &Q);
+
+    /**
+    * @brief copy Eigen vector to ColumnVector.
+    * @param[in]     e        Eigen vector
+    * @param[out]    v        a ColumnVector, resized
+    * @return void
+    */
+    LibGnut_LIBRARY_EXPORT void Eigen2Vector(const Eigen::VectorXd &e, ColumnVector &v);
+
     /** @brief Rotation Matrix. */
     LibGnut_LIBRARY_EXPORT Matrix rotX(double Angle);
     LibGnut_LIBRARY_EXPORT Matrix rotY(double Angle);
@@ -16,6 +16,7 @@ namespace gnut
 {
 
     t_gmutex::t_gmutex()
+        : _owner(thread::id())
     {
 #ifdef USE_OPENMP
         omp_init_lock(&_mutex);
@@ -25,12 +26,13 @@ namespace gnut
     }
 
     t_gmutex::t_gmutex(const t_gmutex &Other)
+        : _owner(thread::id())
     {
+        // the lock state is not copied, the copy is a new unlocked mutex
 #ifdef USE_OPENMP
         omp_init_lock(&this->_mutex);
-        isLock = Other.isLock;
 #endif
-        isLock = Other.isLock;
+        isLock = false;
     }
 
     t_gmutex::~t_gmutex()
@@ -44,35 +46,28 @@ namespace gnut
 
     void t_gmutex::lock()
     {
+        // the owner only (isLock alone let a second thread through)
+        if (_owner.load() == this_thread::get_id())
+            return;
 #ifdef USE_OPENMP
-        if (!isLock)
-        {
-            omp_set_lock(&_mutex);
-            isLock = true;
-        }
+        omp_set_lock(&_mutex);
 #else
-        if (!isLock)
-        {
-            _mutex.lock();
-            isLock = true;
-        }
-#endif 
+        _mutex.lock();
+#endif
+        _owner.store(this_thread::get_id());
+        isLock = true;
     }
 
     void t_gmutex::unlock()
     {
+        if (_owner.load() != this_thread::get_id())
+            return;
+        isLock = false;
+        _owner.store(thread::id());
 #ifdef USE_OPENMP
-        if (isLock)
-        {
-            omp_unset_lock(&_mutex);
-            isLock = false;
-        }
+        omp_unset_lock(&_mutex);
 #else
-        if (isLock)
-        {
-            _mutex.unlock();
-            isLock = false;
-        }
+        _mutex.unlock();
 #endif
     }
 
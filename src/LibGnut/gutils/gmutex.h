@@ -33,10 +33,15 @@
 
 #include <thread>
 #include <mutex>
+#include <atomic>
 
 namespace gnut
 {
-    /** @brief class for t_gmutex. */
+    /**
+    * @brief class for t_gmutex.
+    * @note lock() by the owning thread and unlock() by a thread not owning the mutex are ignored,
+    *       other threads wait until the owner unlocks.
+    */
     class LibGnut_LIBRARY_EXPORT t_gmutex
     {
     public:
@@ -61,6 +66,7 @@ namespace gnut
         bool isLock = false;
 
     protected:
+        atomic<thread::id> _owner; ///< thread holding the lock
 #ifdef USE_OPENMP
         omp_lock_t _mutex;
 #else
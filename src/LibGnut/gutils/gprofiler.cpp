@@ -0,0 +1,229 @@
+/**
+ * @file         gprofiler.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        per-stage wall time of the processing, scoped timers with thread local sums
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <memory>
+#include <iomanip>
+#include <cstring>
+#include "gutils/gprofiler.h"
+
+namespace gnut
+{
+    // sums of one stage
+    struct t_gprofstat
+    {
+        unsigned long long n;
+        long long sum;
+        long long max;
+        unsigned long long hist[PROF_NBIN];
+    };
+
+    // sums of one thread for one site, written by that thread only
+    struct t_gprofblock
+    {
+        string site;
+        t_gprofstat stat[PROF_NSTAGE];
+    };
+
+    // all blocks, they live to the end of the program (threads keep pointers)
+    static mutex &_prof_mtx()
+    {
+        static mutex mtx;
+        return mtx;
+    }
+
+    static list<unique_ptr<t_gprofblock>> &_prof_blocks()
+    {
+        static list<unique_ptr<t_gprofblock>> blocks;
+        return blocks;
+    }
+
+    // blocks of the calling thread
+    struct t_gprofthread
+    {
+        t_gprofblock *crt = nullptr;
+        map<string, t_gprofblock *> sites;
+    };
+
+    static thread_local t_gprofthread _prof_thread;
+
+    atomic<bool> t_gprofiler::_on(false);
+
+    void t_gprofiler::site(const string &name)
+    {
+        if (!enabled())
+            return;
+
+        t_gprofthread &th = _prof_thread;
+        if (th.crt && th.crt->site == name)
+            return;
+
+        auto it = th.sites.find(name);
+        if (it != th.sites.end())
+        {
+            th.crt = it->second;
+            return;
+        }
+
+        unique_ptr<t_gprofblock> blk(new t_gprofblock);
+        blk->site = name;
+        memset(blk->stat, 0, sizeof(blk->stat));
+        th.crt = blk.get();
+        th.sites[name] = th.crt;
+
+        lock_guard<mutex> lk(_prof_mtx());
+        _prof_blocks().push_back(move(blk));
+    }
+
+    void t_gprofiler::add(PROF_STAGE stage, long long ns)
+    {
+        if (stage < 0 || stage >= PROF_NSTAGE)
+            return;
+        if (!_prof_thread.crt)
+            site("");
+        if (!_prof_thread.crt)
+            return;
+
+        t_gprofstat &st = _prof_thread.crt->stat[stage];
+        st.n++;
+        st.sum += ns;
+        if (ns > st.max)
+            st.max = ns;
+
+        long long us = ns / 1000;
+        int bin = 0;
+        while (us > 0 && bin < PROF_NBIN - 1)
+        {
+            us >>= 1;
+            bin++;
+        }
+        st.hist[bin]++;
+    }
+
+    void t_gprofiler::reset()
+    {
+        lock_guard<mutex> lk(_prof_mtx());
+        for (auto &blk : _prof_blocks())
+            memset(blk->stat, 0, sizeof(blk->stat));
+    }
+
+    string t_gprofiler::stage2str(PROF_STAGE stage)
+    {
+        switch (stage)
+        {
+        case PROF_EPOCH:
+            return "EPOCH";
+        case PROF_DECODE:
+            return "DECODE";
+        case PROF_PREPROC:
+            return "PREPROC";
+        case PROF_MODEL:
+            return "MODEL";
+        case PROF_EQUATION:
+            return "EQUATION";
+        case PROF_FILTER:
+            return "FILTER";
+        case PROF_AMBFIX:
+            return "AMBFIX";
+        case PROF_INSMECH:
+            return "INSMECH";
+        case PROF_OUTPUT:
+            return "OUTPUT";
+        default:
+            return "UNDEF";
+        }
+    }
+
+    void t_gprofiler::report(ostream &os)
+    {
+        // threads of the same site are summed
+        map<string, vector<t_gprofstat>> sites;
+        {
+            lock_guard<mutex> lk(_prof_mtx());
+            for (const auto &blk : _prof_blocks())
+            {
+                vector<t_gprofstat> &sum = sites[blk->site];
+                if (sum.empty())
+                {
+                    sum.resize(PROF_NSTAGE);
+                    memset(sum.data(), 0, sum.size() * sizeof(t_gprofstat));
+                }
+                for (int i = 0; i < PROF_NSTAGE; i++)
+                {
+                    const t_gprofstat &st = blk->stat[i];
+                    sum[i].n += st.n;
+                    sum[i].sum += st.sum;
+                    sum[i].max = max(sum[i].max, st.max);
+                    for (int b = 0; b < PROF_NBIN; b++)
+                        sum[i].hist[b] += st.hist[b];
+                }
+            }
+        }
+
+        os << "# processing profile, wall time per stage (stages are nested in EPOCH, site - : no site)\n"
+           << "#    site  stage          calls     total[s]     mean[us]      max[us]  epoch[%]\n";
+        for (const auto &site : sites)
+        {
+            const string name = site.first.empty() ? "-" : site.first;
+            const t_gprofstat &epo = site.second[PROF_EPOCH];
+            for (int i = 0; i < PROF_NSTAGE; i++)
+            {
+                const t_gprofstat &st = site.second[i];
+                if (st.n == 0)
+                    continue;
+                os << setw(10) << name << "  " << left << setw(10) << stage2str(PROF_STAGE(i)) << right
+                   << setw(10) << st.n
+                   << fixed << setprecision(3)
+                   << setw(13) << st.sum * 1e-9
+                   << setprecision(1)
+                   << setw(13) << st.sum * 1e-3 / st.n
+                   << setw(13) << st.max * 1e-3;
+                if (epo.sum > 0)
+                    os << setprecision(2) << setw(10) << 100.0 * st.sum / epo.sum;
+                else
+                    os << setw(10) << "-";
+                os << "\n";
+            }
+        }
+
+        for (const auto &site : sites)
+        {
+            const t_gprofstat &epo = site.second[PROF_EPOCH];
+            if (epo.n == 0)
+                continue;
+
+            int first = 0, last = PROF_NBIN - 1;
+            while (first < last && epo.hist[first] == 0)
+                first++;
+            while (last > first && epo.hist[last] == 0)
+                last--;
+
+            os << "#\n# epoch durations, site " << site.first << "\n"
+               << "#    from[us]      to[us]       count  share[%]\n";
+            for (int b = first; b <= last; b++)
+            {
+                long long from = b == 0 ? 0 : 1LL << (b - 1);
+                os << setw(13) << from;
+                if (b < PROF_NBIN - 1)
+                    os << setw(12) << (1LL << b);
+                else
+                    os << setw(12) << "-";
+                os << setw(12) << epo.hist[b]
+                   << fixed << setprecision(2) << setw(10) << 100.0 * epo.hist[b] / epo.n << "\n";
+            }
+        }
+        os.flush();
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file         gprofiler.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        per-stage wall time of the processing, scoped timers with thread local sums
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   GPROF_SCOPE(PROF_FILTER);       times the rest of the enclosing block
+ *   t_gprofiler::site("WUH2");      following timers of this thread count for the site
+ *
+ *   Disabled (default), a timer costs one relaxed atomic load. Enabled, it reads
+ *   the steady clock twice and adds to the block of the thread and site, no lock.
+ *   Stages nest (PROF_EPOCH contains the others, PROF_EQUATION contains PROF_MODEL),
+ *   the report gives each stage as a share of PROF_EPOCH and the histogram of
+ *   the epoch durations. report() is meant for the end of the run, after the
+ *   processing threads have stopped.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GPROFILER_H
+#define GPROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <iostream>
+#include "gexport/ExportLibGnut.h"
+
+using namespace std;
+
+#define PROF_NBIN 24 ///< histogram bins, 0: < 1 us, i: [2^(i-1), 2^i) us, the last one open
+
+#define GPROF_CAT2(a, b) a##b
+#define GPROF_CAT(a, b) GPROF_CAT2(a, b)
+#define GPROF_SCOPE(stage) gnut::t_gproftimer GPROF_CAT(_gprof_, __LINE__)(stage)
+
+namespace gnut
+{
+    /** @brief processing stages. */
+    enum PROF_STAGE
+    {
+        PROF_EPOCH,     ///< one epoch of the filter
+        PROF_DECODE,    ///< decoding of the input data
+        PROF_PREPROC,   ///< cycle slips and clock jumps (t_gpreproc)
+        PROF_MODEL,     ///< observation model of one satellite (t_gprecisebias)
+        PROF_EQUATION,  ///< equation assembly
+        PROF_FILTER,    ///< filter measurement update (t_gflt, INS Kalman filter)
+        PROF_AMBFIX,    ///< ambiguity resolution (t_gambiguity)
+        PROF_INSMECH,   ///< INS mechanisation
+        PROF_OUTPUT,    ///< result output
+        PROF_NSTAGE
+    };
+
+    /** @brief collects the timers and writes the report. */
+    class LibGnut_LIBRARY_EXPORT t_gprofiler
+    {
+    public:
+        /** @brief switch the timers on/off, off by default. */
+        static void enable(bool on) { _on.store(on, memory_order_relaxed); }
+
+        /** @brief timers are on. */
+        static bool enabled() { return _on.load(memory_order_relaxed); }
+
+        /** @brief following timers of the calling thread count for the site. */
+        static void site(const string &name);
+
+        /** @brief add one duration [ns] of the stage to the calling thread. */
+        static void add(PROF_STAGE stage, long long ns);
+
+        /** @brief summary per site and stage, histogram of the epochs. */
+        static void report(ostream &os);
+
+        /** @brief remove the collected times. */
+        static void reset();
+
+        /** @brief name of the stage. */
+        static string stage2str(PROF_STAGE stage);
+
+    private:
+        static atomic<bool> _on; ///< timers on
+    };
+
+    /** @brief times its own lifetime for a stage. */
+    class LibGnut_LIBRARY_EXPORT t_gproftimer
+    {
+    public:
+        explicit t_gproftimer(PROF_STAGE stage)
+            : _stage(stage),
+              _on(t_gprofiler::enabled())
+        {
+            if (_on)
+                _beg = chrono::steady_clock::now();
+        }
+
+        ~t_gproftimer()
+        {
+            if (_on)
+                t_gprofiler::add(_stage, chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - _beg).count());
+        }
+
+        t_gproftimer(const t_gproftimer &) = delete;
+        t_gproftimer &operator=(const t_gproftimer &) = delete;
+
+    private:
+        PROF_STAGE _stage;                      ///< timed stage
+        bool _on;                               ///< profiler was on at the start
+        chrono::steady_clock::time_point _beg;  ///< start
+    };
+}
+
+#endif
@@ -12,6 +12,8 @@
 #include <cmath>
 #include <limits>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 
 #include "gutils/gtypeconv.h"
 #include "gutils/gconst.h"
@@ -211,6 +213,63 @@ namespace gnut
     }
 #endif
 
+    // all 8 bytes are ASCII digits (byte-wise, no carries between ASCII bytes)
+    static inline bool _is_digit8(uint64_t v)
+    {
+        return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+    }
+
+    bool str2fix(const char *p, int width, int ndec, double &val)
+    {
+        static const double scale[] = {1.0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+        val = 0.0;
+        if (width <= 0 || ndec < 0 || ndec > 9 || ndec >= width)
+            return false;
+
+        // skip leading blanks
+        int ipt = width - ndec - 1;
+        int beg = 0;
+        while (beg < width && p[beg] == ' ')
+            ++beg;
+        if (beg == width)
+            return true; // blank field
+        if (p[ipt] != '.')
+            return false;
+
+        bool neg = false;
+        if (beg < ipt && (p[beg] == '-' || p[beg] == '+'))
+        {
+            neg = (p[beg] == '-');
+            ++beg;
+        }
+
+        // integer + decimal digits, left-padded with '0' up to 16 bytes
+        int nint = ipt - beg;
+        int ndig = nint + ndec;
+        if (nint < 0 || ndig > 16)
+            return false;
+
+        char dig[16];
+        memset(dig, '0', 16 - ndig);
+        memcpy(dig + 16 - ndig, p + beg, nint);
+        memcpy(dig + 16 - ndec, p + ipt + 1, ndec);
+
+        uint64_t hi, lo;
+        memcpy(&hi, dig, 8);
+        memcpy(&lo, dig + 8, 8);
+        if (!_is_digit8(hi) || !_is_digit8(lo))
+            return false;
+
+        int64_t mant = 0;
+        for (int i = 16 - ndig; i < 16; ++i)
+            mant = mant * 10 + (dig[i] - '0');
+
+        val = (neg ? -mant : mant) / scale[ndec];
+        return true;
+    }
+
     double strSci2dbl(const string &s)
     {
         double i = 0.0;
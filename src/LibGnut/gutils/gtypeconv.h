@@ -52,6 +52,22 @@ namespace gnut
     double str2dbl(const char *); // faster char* to double conversion (avoiding blanks)
 #endif
 
+    /**
+     * @brief fixed-column (Fw.d) field to double conversion without allocation
+     *
+     * Digits are validated 8 bytes at a time, the mantissa is accumulated as an integer
+     * and scaled once, so the result is identical to strtod for plain Fw.d fields.
+     *
+     * @param[in]  p        pointer to the first character of the field
+     * @param[in]  width    field width (e.g. 14 for RINEX F14.3)
+     * @param[in]  ndec     number of decimals (e.g. 3 for RINEX F14.3)
+     * @param[out] val      converted value (0.0 for a blank field)
+     * @return
+        true    field is blank or a plain Fw.d number
+        false   field has another layout, use str2dbl instead
+     */
+    LibGnut_LIBRARY_EXPORT bool str2fix(const char *p, int width, int ndec, double &val);
+
     /**@brief integer to string conversion (widtht can be added !!!) */
     LibGnut_LIBRARY_EXPORT string int2str(const int &);                      
 
@@ -0,0 +1,500 @@
+/**
+ * @file         GREAT_Bench.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Main Function of the benchmarks, hot kernels and end-to-end runs on synthetic data
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include "gbench.h"
+#include "gbenchdata.h"
+#include "gset/gcfg_ppp.h"
+#include "gall/gallobs.h"
+#include "gall/gallobj.h"
+#include "gall/gallpcv.h"
+#include "gall/gallprod.h"
+#include "gprod/gprodcrd.h"
+#include "gcoders/atx.h"
+#include "gcoders/rinexo.h"
+#include "gproc/gpvtflt.h"
+#include "gio/grtlog.h"
+#include "gproc/gflt.h"
+#include "gutils/gconst.h"
+#include "gutils/gsysconv.h"
+#include "gutils/gtypeconv.h"
+#include "gutils/gtrs2crs.h"
+#include "gmodels/gtideIERS.h"
+#include "gambfix/glambda.h"
+#include "gambfix/gmlambda.h"
+#include "gins/gins.h"
+
+using namespace std;
+using namespace gnut;
+using namespace great;
+
+// decode a file into data, the receivers of RINEX headers into obj
+static void decode_file(t_spdlog spdlog, t_gcoder &coder, const string &path, t_gdata *data, t_gdata *obj = nullptr)
+{
+    coder.spdlog(spdlog);
+    t_gfile gio(spdlog);
+    gio.path("file://" + path);
+    coder.clear();
+    coder.path("file://" + path);
+    coder.add_data("ID0", data);
+    if (obj)
+        coder.add_data("OBJ", obj);
+    gio.coder(&coder);
+    gio.run_read();
+}
+
+// decode a RINEX observation file into obs
+static void decode_rinexo(t_spdlog spdlog, t_gsetbase *gset, const string &path, t_gallobs &obs, t_gallobj *obj = nullptr)
+{
+    t_rinexo coder(gset, "", 4096);
+    decode_file(spdlog, coder, path, &obs, obj);
+}
+
+// random symmetric positive definite matrix with strong correlations, lower triangle row by row
+static void lambda_problem(t_gbenchdata &gen, int n, vector<double> &Q, vector<double> &a)
+{
+    Matrix B(2 * n, n);
+    for (int i = 1; i <= 2 * n; i++)
+        for (int j = 1; j <= n; j++)
+            B(i, j) = gen.gauss() + (i % n == j % n ? 3.0 : 0.0);
+    Matrix N = B.t() * B;
+    SymmetricMatrix S(n);
+    S << N;
+    S = S.i() * 0.05;
+
+    Q.assign(n * n, 0.0);
+    a.assign(n, 0.0);
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j <= i; j++)
+            Q[i * n + j] = S(i + 1, j + 1);
+        a[i] = round(10.0 * gen.gauss()) + 0.1 * gen.gauss();
+    }
+}
+
+static void help(const char *app)
+{
+    cerr << "Usage: " << app << " [options]\n"
+         << "  -f <pattern>   run the cases containing pattern in group/name\n"
+         << "  -r <n>         timed runs per case (default 5)\n"
+         << "  -s <factor>    iterations scale (default 1)\n"
+         << "  -n <nsta>      stations of the end-to-end GNSS case (default 4)\n"
+         << "  -d <dir>       directory for the synthetic files and the PPP logs (default .)\n"
+         << "  -o <file>      csv output (group,name,items,min_ns,median_ns)\n"
+         << "  -seed <n>      synthetic data seed (default 1)\n"
+         << "  --keep         keep the synthetic files and the PPP logs in <dir>\n"
+         << "  -l             list the cases\n";
+}
+
+// MAIN
+int main(int argc, char **argv)
+{
+    t_gbench bench;
+    string dir = ".", csv_file, filter;
+    unsigned int seed = 1;
+    int nsta = 4;
+    bool list = false, keep = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string opt = argv[i];
+        bool has = i + 1 < argc;
+        if (opt == "-f" && has)
+            bench.filter(argv[++i]);
+        else if (opt == "-r" && has)
+            bench.repeat(str2int(argv[++i]));
+        else if (opt == "-s" && has)
+            bench.scale(str2dbl(argv[++i]));
+        else if (opt == "-n" && has)
+            nsta = max(1, str2int(argv[++i]));
+        else if (opt == "-d" && has)
+            dir = argv[++i];
+        else if (opt == "-o" && has)
+            csv_file = argv[++i];
+        else if (opt == "-seed" && has)
+            seed = str2int(argv[++i]);
+        else if (opt == "-l")
+            list = true;
+        else if (opt == "--keep")
+            keep = true;
+        else
+        {
+            help(argv[0]);
+            return 1;
+        }
+    }
+
+    // default settings: all GPS satellites, the synthetic sites are accepted by the decoder
+    t_gcfg_ppp gset;
+    t_grtlog bench_log("CONSOLE", spdlog::level::err, "great_bench");
+    t_spdlog my_logger = bench_log.spdlog();
+    t_gbenchdata gen(seed);
+
+    // ---------------------------------------------------------------- synthetic files
+    const int nepo = 2880;
+    const double intv = 30.0;
+    vector<string> rnx;
+    string ppp_log = dir + "/great_bench_ppp";
+
+    // everything written to <dir>: observations, PPP log (t_grtlog adds .spd_log) and ratio files
+    auto cleanup = [&]() {
+        if (keep)
+            return;
+        for (const auto &path : rnx)
+            remove(path.c_str());
+        for (int ista = 0; ista < nsta; ista++)
+            remove((dir + "/great_bench_ratio-" + gen.site(ista)).c_str());
+        remove((ppp_log + ".spd_log").c_str());
+    };
+    for (int ista = 0; ista < nsta && !list; ista++)
+    {
+        // short name ssssdddf.yyo, no site in the settings: the decoder takes the site from the file name
+        char name[64];
+        snprintf(name, sizeof(name), "s%s%03d0.%02do", gen.site(ista).substr(1).c_str(), gen.beg().doy(), gen.beg().year() % 100);
+        string path = dir + "/" + name;
+        ofstream f(path.c_str(), ios::out | ios::binary | ios::trunc);
+        if (!f.is_open())
+        {
+            cerr << "Cannot create " << path << endl;
+            cleanup();
+            return 1;
+        }
+        f << gen.rinexo(ista, nepo, intv);
+        rnx.push_back(path);
+    }
+
+    t_gallprec orb(my_logger);
+    gen.prec(orb, 86400.0 + 900.0, 900.0);
+
+    // ---------------------------------------------------------------- micro benchmarks
+    bench.add("micro", "rinexo_decode_epoch", 1, [&](long long n) {
+        long long items = 0;
+        for (long long i = 0; i < n; i++)
+        {
+            t_gallobs obs(my_logger, &gset);
+            decode_rinexo(my_logger, &gset, rnx[0], obs);
+            items += obs.epochs(gen.site(0)).size();
+        }
+        return items;
+    });
+
+    bench.add("micro", "sp3_interpolation", 20000, [&](long long n) {
+        double xyz[3];
+        for (long long i = 0; i < n; i++)
+        {
+            t_gtime t = gen.beg();
+            t.add_dsec(fmod(i * 37.0, 86000.0));
+            orb.pos(gen.sat(i % gen.nsat()), t, xyz, nullptr, nullptr, false);
+            bench_keep(xyz[0]);
+        }
+        return n;
+    });
+
+    t_gtrs2crs trs2crs(true, nullptr, "06");
+    bench.add("micro", "trs2crs_calcRotMat", 200, [&](long long n) {
+        for (long long i = 0; i < n; i++)
+        {
+            t_gtime t = gen.beg();
+            t.add_dsec(30.0 * i);
+            trs2crs.calcRotMat(t, false, false, false, false, false);
+            bench_keep(trs2crs.getRotMat()(1, 1));
+        }
+        return n;
+    });
+
+    t_gtideIERS tide(my_logger);
+    trs2crs.calcRotMat(gen.beg(), false, false, false, false, false);
+    Matrix rot = trs2crs.getRotMat();
+    bench.add("micro", "tide_solid", 20000, [&](long long n) {
+        t_gtriple xyz = gen.site_crd(0);
+        for (long long i = 0; i < n; i++)
+        {
+            // [km], J2000
+            ColumnVector sun(3), moon(3);
+            sun << 1.2e8 << -8.0e7 << -3.5e7;
+            moon << 2.5e5 + i % 100 << 2.6e5 << 1.1e5;
+            t_gtriple dx = tide.tide_solid(gen.beg(), xyz, rot, sun, moon);
+            bench_keep(dx[0]);
+        }
+        return n;
+    });
+
+    // filter sizes: PPP (12 satellites, IF code/phase) and multi-GNSS RTK
+    const int kal_size[2][2] = {{24, 17}, {96, 50}};
+    for (int k = 0; k < 2; k++)
+    {
+        int nobs = kal_size[k][0], npar = kal_size[k][1];
+        auto A = make_shared<Matrix>(nobs, npar);
+        auto l = make_shared<ColumnVector>(nobs);
+        auto P = make_shared<DiagonalMatrix>(nobs);
+        auto Q0 = make_shared<SymmetricMatrix>(npar);
+        for (int i = 1; i <= nobs; i++)
+        {
+            for (int j = 1; j <= npar; j++)
+                (*A)(i, j) = (j <= 4 || j == 4 + (i + 1) / 2) ? gen.gauss() : 0.0;
+            (*l)(i) = gen.gauss();
+            (*P)(i) = i % 2 ? 1.0 : 1e4;
+        }
+        *Q0 = 0.0;
+        for (int j = 1; j <= npar; j++)
+            (*Q0)(j, j) = 10.0 + j;
+
+        string size = int2str(nobs) + "x" + int2str(npar);
+        bench.add("micro", "kalman_update_" + size, 2000 / (k * 9 + 1), [=](long long n) {
+            t_kalman flt;
+            ColumnVector dx(npar);
+            for (long long i = 0; i < n; i++)
+            {
+                SymmetricMatrix Q = *Q0;
+                flt.update(*A, *P, *l, dx, Q);
+                bench_keep(dx(1));
+            }
+            return n;
+        });
+        bench.add("micro", "kalman_eigen_update_" + size, 2000 / (k * 9 + 1), [=](long long n) {
+            t_kalman_eigen flt;
+            ColumnVector dx(npar);
+            for (long long i = 0; i < n; i++)
+            {
+                SymmetricMatrix Q = *Q0;
+                flt.update(*A, *P, *l, dx, Q);
+                bench_keep(dx(1));
+            }
+            return n;
+        });
+        // the same kernel without the newmat <-> Eigen conversions (covariance kept in Eigen)
+        bench.add("micro", "kalman_eigen_inplace_" + size, 2000 / (k * 9 + 1), [=](long long n) {
+            Eigen::MatrixXd Ae, Qe0, Re = Eigen::MatrixXd::Zero(nobs, nobs);
+            Eigen::VectorXd le, dx;
+            Matrix2Eigen(*A, Ae);
+            Matrix2Eigen(*Q0, Qe0);
+            Vector2Eigen(*l, le);
+            for (int i = 0; i < nobs; i++)
+                Re(i, i) = 1.0 / (*P)(i + 1);
+            for (long long i = 0; i < n; i++)
+            {
+                Eigen::MatrixXd Q = Qe0;
+                t_kalman_eigen::update_eigen(Ae, Re, le, dx, Q);
+                bench_keep(dx(0));
+            }
+            return n;
+        });
+    }
+
+    for (int namb : {10, 30})
+    {
+        auto Q = make_shared<vector<double>>();
+        auto a = make_shared<vector<double>>();
+        lambda_problem(gen, namb, *Q, *a);
+        bench.add("micro", "lambda4_n" + int2str(namb), 200, [=](long long n) {
+            vector<double> cands(namb * 2), disall(2), QQ, aa;
+            for (long long i = 0; i < n; i++)
+            {
+                QQ = *Q;
+                aa = *a;
+                int ncan = 0, ipos = 0;
+                double boot = 0.0;
+                t_glambda lambda;
+                lambda.LAMBDA4(2, namb, QQ.data(), aa.data(), &ncan, &ipos, cands.data(), disall.data(), &boot);
+                bench_keep(disall[0]);
+            }
+            return n;
+        });
+        bench.add("micro", "mlambda_n" + int2str(namb), 200, [=](long long n) {
+            vector<double> cands(namb * 2), disall(2);
+            t_gmlambda mlambda(2);
+            for (long long i = 0; i < n; i++)
+            {
+                mlambda.solve(namb, Q->data(), a->data(), cands.data(), disall.data());
+                bench_keep(disall[0]);
+            }
+            return n;
+        });
+    }
+
+    bench.add("micro", "ins_mechanisation", 20000, [&](long long n) {
+        t_gtriple ell;
+        xyz2ell(gen.site_crd(0), ell, false);
+        t_gsins sins(t_gquat(), Eigen::Vector3d::Zero(), Eigen::Vector3d(ell[0], ell[1], ell[2]), 0.0);
+        t_scheme scm;
+        scm.ts = 0.005;
+        scm.nSamples = 1;
+        vector<Eigen::Vector3d> wm(1), vm(1);
+        gen.imu(0, scm.ts, wm[0], vm[0]);
+        for (long long i = 0; i < n; i++)
+        {
+            scm.t = i * scm.ts;
+            sins.Update(wm, vm, scm);
+        }
+        bench_keep(sins.pos(0));
+        return n;
+    });
+
+    // ---------------------------------------------------------------- end-to-end
+    // float ionosphere-free PPP of t_gpvtflt: precise models, preprocessing and filter of GREAT_PVT
+    t_gcfg_ppp ppp_set;
+    t_gtime ppp_end = gen.beg();
+    ppp_end.add_dsec((nepo - 1) * intv);
+    {
+        ostringstream os;
+        os << "<config>"
+           << " <gen> <beg> " << gen.beg().str_ymdhms("", false) << " </beg> <end> " << ppp_end.str_ymdhms("", false) << " </end>"
+           << " <sys> GPS </sys> <rec>";
+        for (int ista = 0; ista < nsta; ista++)
+            os << " " << gen.site(ista);
+        os << " </rec> <int> " << intv << " </int> </gen>"
+           << " <outputs> <log type=\"BASIC\" level=\"ERROR\" name=\"" << ppp_log << "\" />"
+           << " <ratio> " << dir << "/great_bench_ratio-$(rec) </ratio> </outputs>"
+           << " <filter method_flt=\"kalman\" noise_clk=\"1000\" noise_crd=\"100\" rndwk_ztd=\"3\" />"
+           << " <process phase=\"1\" tropo=\"1\" iono=\"1\" obs_combination=\"IONO_FREE\" obs_weight=\"SINEL2\""
+           << " minimum_elev=\"10\" sig_init_crd=\"100\" sig_init_ztd=\"0.1\" pos_kin=\"false\" />"
+           << " <ambiguity> <upd_mode> upd </upd_mode> <fix_mode> SEARCH </fix_mode> <ratio> 3.0 </ratio> </ambiguity>"
+           << " <gps> <band> 1 2 </band> </gps> <gal> <band> 1 5 </band> </gal> <bds> <band> 2 6 </band> </bds>"
+           << " <glo> <band> 1 2 </band> </glo> <qzs> <band> 1 2 </band> </qzs>"
+           << "</config>";
+        istringstream is(os.str());
+        ppp_set.read_istream(is);
+    }
+
+    t_gallpcv pcv;
+    pcv.spdlog(my_logger);
+    t_gpoleut1 erp;
+    t_gnavde de;
+    t_gupd upd;
+    if (!list)
+    {
+        string path = dir + "/great_bench.atx";
+        ofstream f(path.c_str(), ios::out | ios::binary | ios::trunc);
+        f << gen.atx();
+        f.close();
+        t_atx coder(&ppp_set, "", 4096);
+        decode_file(my_logger, coder, path, &pcv);
+        remove(path.c_str());
+    }
+    gen.eop(erp, 2);
+    gen.de(de, 2);
+    gen.upd(upd, nepo, intv);
+    orb.use_clksp3(true);
+
+    string ppp_note;
+    bench.add("e2e", "gnss_decode_ppp_epoch", nsta, [&](long long n) {
+        long long items = 0;
+        ostringstream os;
+        for (long long i = 0; i < n; i++)
+        {
+            int ista = int(i % nsta);
+            t_gallobs obs(my_logger, &ppp_set);
+            t_gallobj obj(my_logger, &pcv, nullptr);
+            decode_rinexo(my_logger, &ppp_set, rnx[ista], obs, &obj);
+            t_gtime beg = gen.beg();
+            obj.read_satinfo(beg);
+            obj.sync_pcvs();
+
+            t_gallproc data;
+            data.Add_Data(t_gdata::type2str(obs.id_type()), &obs);
+            data.Add_Data(t_gdata::type2str(orb.id_type()), &orb);
+            data.Add_Data(t_gdata::type2str(obj.id_type()), &obj);
+            data.Add_Data(t_gdata::type2str(de.id_type()), &de);
+            data.Add_Data(t_gdata::type2str(erp.id_type()), &erp);
+            data.Add_Data(t_gdata::type2str(upd.id_type()), &upd);
+
+            t_gallprod prod;
+            t_gpvtflt pvt(gen.site(ista), "", &ppp_set, my_logger, &data);
+            pvt.Add_UPD(&upd);
+            pvt.setOUT(&prod);
+            pvt.processBatch(beg, ppp_end, true);
+            items += nepo;
+
+            if (i == n - 1)
+            {
+                set<t_gtime> epochs = prod.prod_epochs(gen.site(ista), t_gdata::POS);
+                shared_ptr<t_gprodcrd> crd = epochs.empty() ? nullptr : dynamic_pointer_cast<t_gprodcrd>(prod.get(gen.site(ista), t_gdata::POS, *epochs.rbegin()));
+                if (crd)
+                    os << gen.site(ista) << " 3D error after " << epochs.size() << " epochs: " << fixed << setprecision(4) << (crd->xyz() - gen.site_crd(ista)).norm() << " m";
+                else
+                    os << gen.site(ista) << " no solution";
+            }
+        }
+        ppp_note = os.str();
+        return items;
+    }, [&]() { return ppp_note; });
+
+    // 1 h at 200 Hz, generated by the warm-up run: the timed runs only integrate
+    vector<Eigen::Vector3d> imu_wm, imu_vm;
+    string ins_note;
+    bench.add("e2e", "ins_static_1h_sample", 1, [&](long long n) {
+        const double ts = 0.005;
+        if (imu_wm.empty())
+        {
+            t_gbenchdata imu_gen(seed);
+            imu_wm.resize(720000);
+            imu_vm.resize(720000);
+            for (size_t k = 0; k < imu_wm.size(); k++)
+                imu_gen.imu(0, ts, imu_wm[k], imu_vm[k]);
+        }
+
+        long long items = 0;
+        ostringstream os;
+        for (long long i = 0; i < n; i++)
+        {
+            t_gtriple ell;
+            xyz2ell(gen.site_crd(0), ell, false);
+            t_gsins sins(t_gquat(), Eigen::Vector3d::Zero(), Eigen::Vector3d(ell[0], ell[1], ell[2]), 0.0);
+            t_scheme scm;
+            scm.ts = ts;
+            scm.nSamples = 1;
+            vector<Eigen::Vector3d> wm(1), vm(1);
+            for (size_t k = 0; k < imu_wm.size(); k++)
+            {
+                wm[0] = imu_wm[k];
+                vm[0] = imu_vm[k];
+                scm.t = (k + 1) * scm.ts;
+                sins.Update(wm, vm, scm);
+                items++;
+            }
+            // the vertical channel of a free inertial solution diverges, report it apart
+            double dn = (sins.pos(0) - ell[0]) * A_WGS;
+            double de = (sins.pos(1) - ell[1]) * A_WGS * cos(ell[0]);
+            os << "free inertial drift after 1 h: horizontal " << fixed << setprecision(1) << sqrt(dn * dn + de * de)
+               << " m, vertical " << sins.pos(2) - ell[2] << " m";
+        }
+        ins_note = os.str();
+        return items;
+    }, [&]() { return ins_note; });
+
+    if (list)
+    {
+        bench.list(cout);
+        return 0;
+    }
+
+    ofstream csv;
+    if (!csv_file.empty())
+    {
+        csv.open(csv_file.c_str(), ios::out | ios::trunc);
+        if (!csv.is_open())
+        {
+            cerr << "Cannot create " << csv_file << endl;
+            cleanup();
+            return 1;
+        }
+    }
+
+    cout << "# GREAT_Bench seed " << seed << ", " << nsta << " station(s), " << nepo << " epochs of " << intv << " s" << endl;
+    bench.run(cout, csv.is_open() ? &csv : nullptr);
+
+    cleanup();
+    return 0;
+}
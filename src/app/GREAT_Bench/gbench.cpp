@@ -0,0 +1,97 @@
+/**
+ * @file         gbench.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        benchmark registry and timing
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+#include "gbench.h"
+
+using namespace std::chrono;
+
+static volatile double bench_sink = 0.0;
+
+void bench_keep(double v)
+{
+    bench_sink = bench_sink + v;
+}
+
+t_gbench::t_gbench()
+    : _repeat(5),
+      _scale(1.0)
+{
+}
+
+t_gbench::~t_gbench()
+{
+}
+
+void t_gbench::add(const string &group, const string &name, long long iters, function<long long(long long)> run,
+                   function<string()> note)
+{
+    t_gbenchcase c;
+    c.group = group;
+    c.name = name;
+    c.iters = iters > 0 ? iters : 1;
+    c.run = run;
+    c.note = note;
+    _cases.push_back(c);
+}
+
+void t_gbench::list(ostream &os) const
+{
+    for (const auto &c : _cases)
+        os << setw(6) << c.group << "  " << c.name << "\n";
+}
+
+bool t_gbench::_selected(const t_gbenchcase &c) const
+{
+    return _filter.empty() || (c.group + "/" + c.name).find(_filter) != string::npos;
+}
+
+int t_gbench::run(ostream &os, ostream *csv)
+{
+    os << "# group  case                            items/run    min[ns/item] median[ns/item]\n";
+    if (csv)
+        *csv << "group,name,items,min_ns,median_ns\n";
+
+    int nrun = 0;
+    for (auto &c : _cases)
+    {
+        if (!_selected(c))
+            continue;
+
+        long long n = max(1LL, (long long)(c.iters * _scale));
+        c.run(n); // warm up: caches, first allocations
+
+        vector<double> ns;
+        long long items = 0;
+        for (int i = 0; i < _repeat; i++)
+        {
+            auto beg = steady_clock::now();
+            items = c.run(n);
+            auto end = steady_clock::now();
+            ns.push_back(duration_cast<nanoseconds>(end - beg).count() / double(max(1LL, items)));
+        }
+        sort(ns.begin(), ns.end());
+        double med = ns[ns.size() / 2];
+
+        os << setw(7) << c.group << "  " << left << setw(30) << c.name << right
+           << setw(12) << items
+           << fixed << setprecision(1) << setw(16) << ns.front() << setw(16) << med << "\n";
+        if (c.note)
+            os << "#        " << c.note() << "\n";
+        if (csv)
+            *csv << c.group << "," << c.name << "," << items << "," << fixed << setprecision(1) << ns.front() << "," << med << "\n";
+        os.flush();
+        nrun++;
+    }
+    return nrun;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file         gbench.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        benchmark registry and timing
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   A case runs n iterations and returns the number of items it processed
+ *   (epochs, calls, ...). Each case runs once to warm up, then repeat times,
+ *   the report gives ns per item of the fastest and of the median run.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GBENCH_H
+#define GBENCH_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <functional>
+
+using namespace std;
+
+/** @brief keep a result alive, the compiler may not remove the computation. */
+void bench_keep(double v);
+
+/** @brief one benchmark. */
+struct t_gbenchcase
+{
+    string group;                           ///< micro or e2e
+    string name;                            ///< case name
+    long long iters;                        ///< iterations of one run
+    function<long long(long long)> run;     ///< runs n iterations, returns the items
+    function<string()> note;                ///< result check printed after the case, may be empty
+};
+
+/** @brief benchmark registry. */
+class t_gbench
+{
+public:
+    /** @brief default constructor. */
+    t_gbench();
+
+    /** @brief default destructor. */
+    virtual ~t_gbench();
+
+    /** @brief add a case. */
+    void add(const string &group, const string &name, long long iters, function<long long(long long)> run,
+             function<string()> note = function<string()>());
+
+    /** @brief run only the cases containing pattern in group/name. */
+    void filter(const string &pattern) { _filter = pattern; }
+
+    /** @brief timed runs per case. */
+    void repeat(int n) { _repeat = n > 0 ? n : 1; }
+
+    /** @brief iterations of all cases multiplied by f. */
+    void scale(double f) { _scale = f > 0.0 ? f : 1.0; }
+
+    /** @brief list the cases. */
+    void list(ostream &os) const;
+
+    /**
+    * @brief run the selected cases
+    * @param[out] os     table
+    * @param[out] csv    group,name,items,min_ns,median_ns per case, may be NULL
+    * @return number of cases run
+    */
+    int run(ostream &os, ostream *csv = nullptr);
+
+protected:
+    /** @brief case selected by the filter. */
+    bool _selected(const t_gbenchcase &c) const;
+
+    vector<t_gbenchcase> _cases;    ///< registered cases
+    string _filter;                 ///< name filter
+    int _repeat;                    ///< timed runs
+    double _scale;                  ///< iteration scale
+};
+
+#endif
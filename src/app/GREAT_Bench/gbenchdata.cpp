@@ -0,0 +1,310 @@
+/**
+ * @file         gbenchdata.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        deterministic synthetic GNSS/IMU data for the benchmarks
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include "gbenchdata.h"
+#include "gutils/gconst.h"
+#include "gutils/gsysconv.h"
+#include "gutils/gfmtline.h"
+#include "gutils/grinexout.h"
+#include "gins/gearth.h"
+
+using namespace great;
+
+static const double BENCH_GM = 3.986004418e14;     // [m^3/s^2]
+static const double BENCH_SMA = 26559.7e3;         // [m]
+static const double BENCH_INC = 55.0 * D2R;        // [rad]
+static const double BENCH_F1 = 1575.42e6;          // [Hz]
+static const double BENCH_F2 = 1227.60e6;          // [Hz]
+static const double BENCH_MASK = 10.0 * D2R;       // [rad]
+static const double BENCH_SUN[3] = {1.2e8, -8.0e7, -3.5e7};   // [km], J2000
+static const double BENCH_MOON[3] = {2.5e5, 2.6e5, 1.1e5};    // [km], J2000
+
+t_gbenchdata::t_gbenchdata(unsigned int seed, int nsat)
+    : _beg(2026, 10, 18, 0, 0, 0, 0.0, t_gtime::GPS),
+      _nsat(max(1, min(nsat, 32))),
+      _seed(seed),
+      _rng(seed)
+{
+}
+
+t_gbenchdata::~t_gbenchdata()
+{
+}
+
+string t_gbenchdata::sat(int isat) const
+{
+    char tmp[8];
+    snprintf(tmp, sizeof(tmp), "G%02d", isat + 1);
+    return tmp;
+}
+
+t_gtriple t_gbenchdata::sat_crd(int isat, double sec) const
+{
+    // 6 planes, satellites of a plane equally spaced, planes shifted by 15 deg
+    int plane = isat % 6, slot = isat / 6;
+    int nslot = (_nsat + 5) / 6;
+    double raan = plane * 60.0 * D2R;
+    double u = slot * 2.0 * G_PI / nslot + plane * 15.0 * D2R + sqrt(BENCH_GM / pow(BENCH_SMA, 3)) * sec;
+
+    // inertial position, then earth rotation
+    double xp = BENCH_SMA * cos(u), yp = BENCH_SMA * sin(u);
+    double x = xp * cos(raan) - yp * cos(BENCH_INC) * sin(raan);
+    double y = xp * sin(raan) + yp * cos(BENCH_INC) * cos(raan);
+    double z = yp * sin(BENCH_INC);
+    double theta = OMEGA * sec;
+    return t_gtriple(x * cos(theta) + y * sin(theta), -x * sin(theta) + y * cos(theta), z);
+}
+
+double t_gbenchdata::sat_clk(int isat, double sec) const
+{
+    return 1.0e-5 * ((isat % 7) - 3) + 2.0e-12 * ((isat % 5) - 2) * sec + 1.0e-9 * sin(2.0 * G_PI * sec / 43082.0 + isat);
+}
+
+double t_gbenchdata::rec_clk(int ista, double sec) const
+{
+    return 1.0e-7 * ((ista % 11) - 5) + 1.0e-10 * sec;
+}
+
+string t_gbenchdata::site(int ista) const
+{
+    char tmp[8];
+    snprintf(tmp, sizeof(tmp), "S%03d", ista % 1000);
+    return tmp;
+}
+
+t_gtriple t_gbenchdata::site_crd(int ista) const
+{
+    // golden angle spiral, latitudes within +-60 deg
+    double lat = asin(sin(60.0 * D2R) * (1.0 - 2.0 * ((ista % 97) + 0.5) / 97.0));
+    double lon = fmod(ista * 137.50776 * D2R, 2.0 * G_PI) - G_PI;
+    t_gtriple ell(lat, lon, 100.0 + 10.0 * (ista % 50)), xyz;
+    ell2xyz(ell, xyz, false);
+    return xyz;
+}
+
+double t_gbenchdata::tropo(double ele)
+{
+    return 2.3 / sin(ele);
+}
+
+double t_gbenchdata::_amb(int ista, int isat, int freq) const
+{
+    // integer, fixed by station, satellite and frequency
+    unsigned int h = _seed * 2654435761u ^ (ista * 40503u + isat * 977u + freq * 131u);
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return double(int(h % 2000001u) - 1000000);
+}
+
+double t_gbenchdata::gauss()
+{
+    return _rng.gauss();
+}
+
+vector<t_gbenchobs> t_gbenchdata::obs(int ista, double sec)
+{
+    vector<t_gbenchobs> all;
+    t_gtriple xyz_r = site_crd(ista), ell;
+    xyz2ell(xyz_r, ell, false);
+    t_gtriple up(cos(ell[0]) * cos(ell[1]), cos(ell[0]) * sin(ell[1]), sin(ell[0]));
+
+    const double lam1 = CLIGHT / BENCH_F1, lam2 = CLIGHT / BENCH_F2;
+    const double k2 = (BENCH_F1 / BENCH_F2) * (BENCH_F1 / BENCH_F2);
+    double dtr = rec_clk(ista, sec);
+
+    for (int isat = 0; isat < _nsat; isat++)
+    {
+        // light time, the earth rotates during the signal travel
+        double tau = 0.075, rho = 0.0;
+        t_gtriple xyz_s;
+        for (int it = 0; it < 3; it++)
+        {
+            t_gtriple xs = sat_crd(isat, sec - tau);
+            double a = OMEGA * tau;
+            xyz_s = t_gtriple(xs[0] * cos(a) + xs[1] * sin(a), -xs[0] * sin(a) + xs[1] * cos(a), xs[2]);
+            rho = (xyz_s - xyz_r).norm();
+            tau = rho / CLIGHT;
+        }
+
+        t_gtriple los = (xyz_s - xyz_r) / rho;
+        double ele = asin(los[0] * up[0] + los[1] * up[1] + los[2] * up[2]);
+        if (ele < BENCH_MASK)
+            continue;
+
+        double dts = sat_clk(isat, sec - tau);
+        double geo = rho + CLIGHT * (dtr - dts) + tropo(ele);
+        double ion = 5.0 / sin(ele);
+
+        t_gbenchobs o;
+        o.sat = sat(isat);
+        o.ele = ele;
+        o.obs[0] = geo + ion + 0.3 * gauss();
+        o.obs[1] = (geo - ion + 0.003 * gauss()) / lam1 + _amb(ista, isat, 1);
+        o.obs[2] = geo + k2 * ion + 0.3 * gauss();
+        o.obs[3] = (geo - k2 * ion + 0.003 * gauss()) / lam2 + _amb(ista, isat, 2);
+        all.push_back(o);
+    }
+    return all;
+}
+
+string t_gbenchdata::rinexo(int ista, int nepo, double intv)
+{
+    t_grinexout rnx;
+    rnx.program("GREAT_Bench");
+    rnx.marker(site(ista));
+    rnx.observer("SYNTHETIC");
+    rnx.receiver("SYNTHETIC");
+    rnx.antenna("SYNTHETIC       NONE");
+    rnx.position(site_crd(ista));
+    rnx.obstypes(GPS, {"C1C", "L1C", "C2W", "L2W"});
+    rnx.interval(intv);
+    string out = rnx.header(_beg);
+
+    t_gfmtline line;
+    for (int iepo = 0; iepo < nepo; iepo++)
+    {
+        double sec = iepo * intv;
+        t_gtime t = _beg;
+        t.add_dsec(sec);
+        vector<t_gbenchobs> all = obs(ista, sec);
+
+        out += t_grinexout::epoch(t, int(all.size()));
+        line.clear();
+        for (const auto &o : all)
+            t_grinexout::satellite(line, o.sat, o.obs, 4);
+        out += line.data();
+    }
+    return out;
+}
+
+void t_gbenchdata::prec(t_gallprec &orb, double span, double intv) const
+{
+    for (double sec = 0.0; sec <= span + 1e-6; sec += intv)
+    {
+        t_gtime t = _beg;
+        t.add_dsec(sec);
+        for (int isat = 0; isat < _nsat; isat++)
+            orb.addpos(sat(isat), t, sat_crd(isat, sec), sat_clk(isat, sec), t_gtriple(0.01, 0.01, 0.01), 1e-10);
+    }
+}
+
+string t_gbenchdata::atx() const
+{
+    char tmp[256];
+    string out;
+    out += t_grinexout::hline("     1.4            M", "ANTEX VERSION / SYST");
+    out += t_grinexout::hline("A", "PCV TYPE / REFANT");
+    out += t_grinexout::hline("", "END OF HEADER");
+    for (int isat = 0; isat < _nsat; isat++)
+    {
+        out += t_grinexout::hline("", "START OF ANTENNA");
+        snprintf(tmp, sizeof(tmp), "%-20s%-20sX%02d", "SYNTHETIC", sat(isat).c_str(), isat + 1);
+        out += t_grinexout::hline(tmp, "TYPE / SERIAL NO");
+        out += t_grinexout::hline("     0.0", "DAZI");
+        out += t_grinexout::hline("     0.0  17.0   1.0", "ZEN1 / ZEN2 / DZEN");
+        out += t_grinexout::hline("     2", "# OF FREQUENCIES");
+        out += t_grinexout::hline("  2000     1     1     0     0    0.0000000", "VALID FROM");
+        for (const char *freq : {"G01", "G02"})
+        {
+            snprintf(tmp, sizeof(tmp), "   %s", freq);
+            out += t_grinexout::hline(tmp, "START OF FREQUENCY");
+            out += t_grinexout::hline("      0.00      0.00      0.00", "NORTH / EAST / UP");
+            string noazi = "   NOAZI";
+            for (int i = 0; i < 18; i++)
+                noazi += "    0.00";
+            out += noazi + "\n";
+            out += t_grinexout::hline(tmp, "END OF FREQUENCY");
+        }
+        out += t_grinexout::hline("", "END OF ANTENNA");
+    }
+    return out;
+}
+
+void t_gbenchdata::eop(t_gpoleut1 &erp, int ndays) const
+{
+    int mjd = _beg.mjd();
+    erp.setBegEndTime(mjd - 1, mjd + ndays + 1);
+    for (int d = -1; d <= ndays + 1; d++)
+    {
+        t_gtime t;
+        t.from_mjd(mjd + d, 0, 0.0);
+        map<string, double> data;
+        data["XPOLE"] = 0.0;
+        data["YPOLE"] = 0.0;
+        data["UT1-TAI"] = -double(t.leapsec());
+        data["DPSI"] = 0.0;
+        data["DEPSI"] = 0.0;
+        erp.setEopData(t, data, "UT1R", 1.0);
+    }
+}
+
+void t_gbenchdata::de(t_gnavde &de, int ndays) const
+{
+    // one record of constant Chebyshev series: earth-moon barycenter, moon (geocentric) and sun
+    const double emrat = 81.30056907419062;
+    double SS[3] = {_beg.mjd() - 1 + 2400000.5, _beg.mjd() + ndays + 1 + 2400000.5, 0.0};
+    SS[2] = SS[1] - SS[0];
+    int ipt[3][13] = {{0}};
+    for (int body : {2, 9, 10})
+    {
+        ipt[0][body] = body == 2 ? 1 : (body == 9 ? 7 : 13);
+        ipt[1][body] = 2;
+        ipt[2][body] = 1;
+    }
+    de.add_head(SS, 149597870.7, emrat, ipt, vector<string>(), vector<double>());
+
+    vector<double> coeff(18, 0.0);
+    for (int i = 0; i < 3; i++)
+    {
+        coeff[2 * i] = -BENCH_SUN[i] + BENCH_MOON[i] / (1.0 + emrat);
+        coeff[6 + 2 * i] = BENCH_MOON[i];
+    }
+    de.add_data(0, coeff);
+}
+
+void t_gbenchdata::upd(t_gupd &upd, int nepo, double intv) const
+{
+    t_updrec rec;
+    rec.npoint = 10;
+    rec.ratio = 1.0;
+    rec.value = 0.0;
+    rec.sigma = 0.01;
+    for (int isat = 0; isat < _nsat; isat++)
+        upd.add_sat_upd(UPDTYPE::WL, t_gtime(WL_IDENTIFY), sat(isat), rec);
+    for (int iepo = 0; iepo < nepo; iepo++)
+    {
+        t_gtime t = _beg;
+        t.add_dsec(iepo * intv);
+        for (int isat = 0; isat < _nsat; isat++)
+            upd.add_sat_upd(UPDTYPE::NL, t, sat(isat), rec);
+    }
+}
+
+void t_gbenchdata::imu(int ista, double ts, Eigen::Vector3d &wm, Eigen::Vector3d &vm)
+{
+    t_gtriple ell;
+    xyz2ell(site_crd(ista), ell, false);
+
+    t_gearth eth;
+    eth.Update(Eigen::Vector3d(ell[0], ell[1], ell[2]), Eigen::Vector3d::Zero());
+
+    // body = local ENU: the gyros see the earth rotation, the accelerometers the gravity
+    wm = eth.wnie * ts;
+    vm = Eigen::Vector3d(0.0, 0.0, -eth.gn(2)) * ts;
+    for (int i = 0; i < 3; i++)
+    {
+        wm(i) += 1.0e-8 * gauss();
+        vm(i) += 1.0e-5 * gauss();
+    }
+}
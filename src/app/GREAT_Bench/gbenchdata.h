@@ -0,0 +1,130 @@
+/**
+ * @file         gbenchdata.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        deterministic synthetic GNSS/IMU data for the benchmarks
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   GPS-like constellation   circular orbits, 6 planes, 55 deg, 26560 km
+ *   observations             C1C L1C C2W L2W = range + clocks + 2.3 m/sin(el)
+ *                            troposphere + L1 iono 5 m/sin(el) + noise, integer
+ *                            ambiguities, elevation mask 10 deg
+ *   models for t_gpvtflt     ANTEX with zero offsets and variations, zero pole
+ *                            and UT1 = UTC, sun and moon fixed in J2000, zero
+ *                            wide-lane and narrow-lane UPDs (no hardware biases)
+ *   IMU                      static platform, level, north aligned, increments
+ *                            of the earth rotation and gravity + white noise
+ *                            (0.0005 deg/sqrt(h), 0.008 m/s/sqrt(h) at 200 Hz)
+ *
+ *   The same seed gives the same data on every platform (t_grandom). The
+ *   models are simple on purpose, the data exercise the processing, not its
+ *   accuracy.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GBENCHDATA_H
+#define GBENCHDATA_H
+
+#include <string>
+#include <vector>
+#include "gutils/gtime.h"
+#include "gutils/gtriple.h"
+#include "gutils/grandom.h"
+#include "gall/gallprec.h"
+#include "gdata/gpoleut1.h"
+#include "gdata/gnavde.h"
+#include "gdata/gupd.h"
+#include <Eigen/Dense>
+
+using namespace std;
+using namespace gnut;
+using namespace great;
+
+/** @brief observations of one satellite. */
+struct t_gbenchobs
+{
+    string sat;         ///< satellite
+    double ele;         ///< elevation [rad]
+    double obs[4];      ///< C1C [m], L1C [cycle], C2W [m], L2W [cycle]
+};
+
+/** @brief synthetic data generator. */
+class t_gbenchdata
+{
+public:
+    /**
+    * @brief constructor
+    * @param[in] seed   random seed
+    * @param[in] nsat   number of satellites (at most 32)
+    */
+    explicit t_gbenchdata(unsigned int seed = 1, int nsat = 32);
+
+    /** @brief default destructor. */
+    virtual ~t_gbenchdata();
+
+    /** @brief reference epoch (2026-10-18 00:00:00 GPS) and satellites. */
+    const t_gtime &beg() const { return _beg; }
+    int nsat() const { return _nsat; }
+    string sat(int isat) const;
+
+    /** @brief ECEF satellite position [m] and clock [s], sec after beg(). */
+    t_gtriple sat_crd(int isat, double sec) const;
+    double sat_clk(int isat, double sec) const;
+
+    /** @brief receiver clock [s] of station ista. */
+    double rec_clk(int ista, double sec) const;
+
+    /** @brief station ista, deterministic places on the earth. */
+    string site(int ista) const;
+    t_gtriple site_crd(int ista) const;
+
+    /** @brief troposphere delay [m] of the synthetic model. */
+    static double tropo(double ele);
+
+    /** @brief observations of station ista at sec after beg(). */
+    vector<t_gbenchobs> obs(int ista, double sec);
+
+    /**
+    * @brief RINEX 3.04 observation file of station ista
+    * @param[in] ista    station
+    * @param[in] nepo    number of epochs
+    * @param[in] intv    sampling [s]
+    * @return file content
+    */
+    string rinexo(int ista, int nepo, double intv);
+
+    /** @brief satellite positions and clocks every intv [s] over span [s] from beg(). */
+    void prec(t_gallprec &orb, double span, double intv) const;
+
+    /** @brief ANTEX file of the satellites, zero offsets and variations. */
+    string atx() const;
+
+    /** @brief daily pole and UT1 records over ndays from beg(), zero pole and UT1 = UTC. */
+    void eop(t_gpoleut1 &erp, int ndays) const;
+
+    /** @brief planetary ephemeris over ndays from beg(), sun and moon fixed in J2000. */
+    void de(t_gnavde &de, int ndays) const;
+
+    /** @brief zero wide-lane UPDs and narrow-lane UPDs of nepo epochs every intv [s] from beg(). */
+    void upd(t_gupd &upd, int nepo, double intv) const;
+
+    /** @brief angle [rad] and velocity [m/s] increments of one IMU sample, static platform at ista. */
+    void imu(int ista, double ts, Eigen::Vector3d &wm, Eigen::Vector3d &vm);
+
+    /** @brief normal random number, zero mean and unit sigma. */
+    double gauss();
+
+protected:
+    /** @brief ambiguities of station ista and satellite isat [cycle]. */
+    double _amb(int ista, int isat, int freq) const;
+
+    t_gtime _beg;       ///< reference epoch
+    int _nsat;          ///< number of satellites
+    unsigned int _seed; ///< random seed
+    t_grandom _rng;     ///< random generator
+};
+
+#endif
@@ -0,0 +1,52 @@
+/**
+ * @file         GREAT_Bin2Txt.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Main Function printing binary result records (format="bin") as the text output
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include "gutils/gfmtline.h"
+
+using namespace std;
+using namespace gnut;
+
+// MAIN
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        cerr << "Usage: " << argv[0] << " <binary result file> [text file, default stdout]" << endl;
+        return 1;
+    }
+
+    ifstream in(argv[1], ios::in | ios::binary);
+    if (!in.is_open())
+    {
+        cerr << "Cannot open " << argv[1] << endl;
+        return 1;
+    }
+
+    ofstream out;
+    if (argc == 3)
+    {
+        out.open(argv[2], ios::out | ios::binary | ios::trunc);
+        if (!out.is_open())
+        {
+            cerr << "Cannot create " << argv[2] << endl;
+            return 1;
+        }
+    }
+
+    if (!t_gfmtline::to_text(in, argc == 3 ? static_cast<ostream&>(out) : cout))
+    {
+        cerr << "Corrupted or unsupported records in " << argv[1] << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -10,8 +10,10 @@
  */
 
 #include "gcfg_ign.h"
+#include "gutils/gprofiler.h"
 #include <chrono>
 #include <thread>
+#include <functional>
 
 using namespace std;
 using namespace std::chrono;
@@ -36,12 +38,17 @@ int main(int argc, char** argv)
     auto log_level = dynamic_cast<t_gsetout*>(&gset)->log_level();
     auto log_name = dynamic_cast<t_gsetout*>(&gset)->log_name();
     auto log_pattern = dynamic_cast<t_gsetout*>(&gset)->log_pattern();
+    auto log_async = dynamic_cast<t_gsetout*>(&gset)->log_async();
     spdlog::set_level(log_level);
     spdlog::set_pattern(log_pattern);
     spdlog::flush_on(spdlog::level::err);
-    t_grtlog great_log = t_grtlog(log_type, log_level, log_name);
+    t_grtlog great_log = t_grtlog(log_type, log_level, log_name, log_async);
     auto my_logger = great_log.spdlog();
 
+    // Per-stage timers, only with <prof> in the outputs
+    string prof_file = dynamic_cast<t_gsetout*>(&gset)->outputs("prof");
+    t_gprofiler::enable(!prof_file.empty());
+
     bool isBase = false;
     if (dynamic_cast<t_gsetgen*>(&gset)->list_base().size()) isBase = true;
 
@@ -87,6 +94,9 @@ int main(int argc, char** argv)
     // added by zhshen
     t_gimudata* gimu = new t_gimudata(); gimu->spdlog(my_logger);
     t_gododata* godo = new t_gododata(); godo->spdlog(my_logger);
+    // text imu converted to the binary imu file: decoded into its own container, mapped back after the reading
+    std::string imubin_out = dynamic_cast<t_gsetout*>(&gset)->outputs("imubin");
+    t_gimudata* gimu_txt = nullptr;
     vector<t_gintegration*> vgmsf;
 
     // runepoch for the time costed each epoch (i guess)
@@ -115,6 +125,30 @@ int main(int argc, char** argv)
     t_gio* tgio = 0;
     t_gcoder* tgcoder = 0;
 
+    // streaming: imu/odo inputs are parsed ahead by bounded producer threads during the processing
+    int stream_capacity = dynamic_cast<t_gsetins*>(&gset)->stream_capacity();
+    if (stream_capacity > 0 && dynamic_cast<t_gsetins*>(&gset)->resampled_freq() >= 10)
+    {
+        SPDLOG_LOGGER_WARN(my_logger, std::string("main:  ") + "imu resampling needs the whole data, streaming disabled");
+        stream_capacity = 0;
+    }
+    if (stream_capacity > 0 && !imubin_out.empty())
+    {
+        SPDLOG_LOGGER_WARN(my_logger, std::string("main:  ") + "imu conversion needs the whole data, streaming disabled");
+        stream_capacity = 0;
+    }
+    // the streamed samples are consumed once, a second site would find the buffer already drained
+    size_t stream_nsite = isBase ? gset.list_rover().size() : sites.size();
+    if (stream_capacity > 0 && stream_nsite > 1)
+    {
+        SPDLOG_LOGGER_WARN(my_logger, std::string("main:  ") + "imu streaming supports a single site, streaming disabled");
+        stream_capacity = 0;
+    }
+    vector<function<void()>> imu_jobs, odo_jobs;
+    vector<t_gio*> stream_gio;
+    vector<t_gcoder*> stream_coder;
+    vector<t_imubin*> stream_imubin;
+
 
     if (!isBase)
     {
@@ -137,8 +171,34 @@ int main(int argc, char** argv)
         std::string path(itINP->second);
         std::string id("ID" + int2str(i));
 
+        // binary imu file is mapped directly, no decoder needed
+        if (ifmt == IFMT::IMUBIN_INP)
+        {
+            t_imubin* imubin = new t_imubin(my_logger);
+            if (!imubin->open(path)) { delete imubin; continue; }
+            double ins_beg = dynamic_cast<t_gsetins*>(&gset)->start();
+            double ins_end = dynamic_cast<t_gsetins*>(&gset)->end();
+            if (stream_capacity > 0)
+            {
+                stream_imubin.push_back(imubin);
+                imu_jobs.push_back([imubin, gimu, ins_beg, ins_end] { imubin->read(gimu, ins_beg, ins_end); });
+                continue;
+            }
+            runepoch = t_gtime::current_time(t_gtime::GPS);
+            imubin->read(gimu, ins_beg, ins_end);
+            lstepoch = t_gtime::current_time(t_gtime::GPS);
+            SPDLOG_LOGGER_INFO(my_logger, std::string("main:  ") + "READ: " + path + " time: "
+                + dbl2str(lstepoch.diff(runepoch)) + " sec");
+            delete imubin;
+            continue;
+        }
+
         // For different file format, we prepare different data container and decoder for them.
-        if (ifmt == IFMT::IMU_INP) { gdata = gimu; tgcoder = new t_imufile(&gset, "", 40960); }
+        if (ifmt == IFMT::IMU_INP) {
+            if (!imubin_out.empty() && !gimu_txt) { gimu_txt = new t_gimudata(); gimu_txt->spdlog(my_logger); }
+            gdata = gimu_txt ? gimu_txt : gimu;
+            tgcoder = new t_imufile(&gset, "", 40960);
+        }
         else if (ifmt == IFMT::ODO_INP) { gdata = godo; tgcoder = new t_odofile(&gset, "", 40960); }
         else if (ifmt == IFMT::SP3_INP) { gdata = gorb; tgcoder = new t_sp3(&gset, "", 8172); }
         else if (ifmt == IFMT::RINEXO_INP) { gdata = gobs; tgcoder = new t_rinexo(&gset, "", 4096); }
@@ -181,6 +241,15 @@ int main(int argc, char** argv)
             // Put the gcoder into the gio. Note, gcoder contain the gdata and gio contain the gcoder
             tgio->coder(tgcoder);
 
+            if (stream_capacity > 0 && (ifmt == IFMT::IMU_INP || ifmt == IFMT::ODO_INP))
+            {
+                t_gio* sgio = tgio;
+                stream_gio.push_back(tgio);
+                stream_coder.push_back(tgcoder);
+                (ifmt == IFMT::IMU_INP ? imu_jobs : odo_jobs).push_back([sgio] { sgio->run_read(); });
+                continue;
+            }
+
             runepoch = t_gtime::current_time(t_gtime::GPS);
             // Read the data from file here
             tgio->run_read();
@@ -193,6 +262,22 @@ int main(int argc, char** argv)
             delete tgcoder;
         }
     }
+    if (gimu_txt)
+    {
+        runepoch = t_gtime::current_time(t_gtime::GPS);
+        long nrec = t_imubin::write(imubin_out, gimu_txt, my_logger);
+        delete gimu_txt;
+        t_imubin imubin(my_logger);
+        if (nrec < 0 || !imubin.open(imubin_out))
+        {
+            SPDLOG_LOGGER_ERROR(my_logger, std::string("main:  ") + "Error: imu conversion failed " + imubin_out);
+            return -1;
+        }
+        imubin.read(gimu, dynamic_cast<t_gsetins*>(&gset)->start(), dynamic_cast<t_gsetins*>(&gset)->end());
+        lstepoch = t_gtime::current_time(t_gtime::GPS);
+        SPDLOG_LOGGER_INFO(my_logger, std::string("main:  ") + "WRITE: " + imubin_out + " " + int2str(nrec) + " records time: "
+            + dbl2str(lstepoch.diff(runepoch)) + " sec");
+    }
     gobj->read_satinfo(beg);
 
     // assigning PCV pointers to objects
@@ -218,6 +303,22 @@ int main(int argc, char** argv)
         data->Add_Data(t_gdata::type2str(gifcb->id_type()), gifcb);
     }
 
+    // start the producers, the data are finished when all of their inputs were read
+    vector<thread> producers;
+    if (!imu_jobs.empty())
+    {
+        gimu->streaming(stream_capacity);
+        gimu->retention(dynamic_cast<t_gsetgen*>(&gset)->retention());
+        producers.push_back(thread([&imu_jobs, gimu] { for (auto& job : imu_jobs) job(); gimu->finish(); }));
+    }
+    if (!odo_jobs.empty())
+    {
+        godo->streaming(stream_capacity);
+        producers.push_back(thread([&odo_jobs, godo] { for (auto& job : odo_jobs) job(); godo->finish(); }));
+    }
+    if (!producers.empty())
+        SPDLOG_LOGGER_INFO(my_logger, std::string("main:  ") + "imu/odo streamed, buffer " + int2str(stream_capacity) + " samples");
+
     auto tic_start = system_clock::now();
 
     // MSF PROCESSING - loop over sites from settings
@@ -272,6 +373,18 @@ int main(int argc, char** argv)
         i++;
     }
 
+    // processing may end before the data, release the producers
+    if (!producers.empty())
+    {
+        gimu->abort();
+        godo->abort();
+        for (auto sgio : stream_gio) sgio->stop();
+        for (auto& th : producers) th.join();
+    }
+    for (auto sgio : stream_gio) delete sgio;
+    for (auto scoder : stream_coder) delete scoder;
+    for (auto imubin : stream_imubin) delete imubin;
+
     for (unsigned int i = 0; i < vgmsf.size(); ++i) { if (vgmsf[i])  delete vgmsf[i]; }
 
     if (gobs) delete gobs;
@@ -288,6 +401,15 @@ int main(int argc, char** argv)
     if (gimu) delete gimu;
     if (godo) delete godo;
 
+    // Per-stage timing report
+    if (!prof_file.empty())
+    {
+        ostringstream os;
+        t_gprofiler::report(os);
+        t_giof prof(prof_file);
+        prof.write(os.str().c_str(), os.str().size());
+    }
+
     auto tic_end = system_clock::now();
     auto duration = duration_cast<microseconds>(tic_end - tic_start);
     cout << "Spent" << double(duration.count()) * microseconds::period::num / microseconds::period::den << " seconds." << endl;
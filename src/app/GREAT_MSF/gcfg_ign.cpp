@@ -6,8 +6,14 @@ t_gcfg_ign::t_gcfg_ign() :
     t_gsetign()
 {
     _IFMT_supported.insert(IFMT::IMU_INP);
+    _IFMT_supported.insert(IFMT::IMUBIN_INP);
     _IFMT_supported.insert(IFMT::ODO_INP);
     _OFMT_supported.insert(INS_OUT);
+    _OFMT_supported.insert(SMT_OUT);
+    _OFMT_supported.insert(CKP_OUT);
+    _OFMT_supported.insert(OUTAGE_OUT);
+    _OFMT_supported.insert(IMUBIN_OUT);
+    _OFMT_supported.insert(RATIO_OUT);
 }
 
 t_gcfg_ign::~t_gcfg_ign()
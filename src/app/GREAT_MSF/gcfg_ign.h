@@ -18,6 +18,7 @@
 #include "gcoders/ifcb.h"
 #include "gcoders/imufile.h"
 #include "gcoders/odofile.h"
+#include "gcoders/imubin.h"
 #include "gset/gsetins.h"
 #include "gset/gsetign.h"
 #include "gset/gcfg_ppp.h"
@@ -1,12 +1,18 @@
 
 #include "gcfg_ppp.h"
+#include "gutils/gprofiler.h"
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <csignal>
 
 using namespace std;
 using namespace std::chrono;
 
-void catch_signal(int) { cout << "Program interrupted by Ctrl-C [SIGINT,2]\n"; }
+// Real-time processing is stopped by Ctrl-C
+volatile sig_atomic_t stop_request = 0;
+
+void catch_signal(int) { cout << "Program interrupted by Ctrl-C [SIGINT,2]\n"; stop_request = 1; }
 
 // MAIN
 // ----------
@@ -27,12 +33,17 @@ int main(int argc, char** argv)
     auto log_level = dynamic_cast<t_gsetout *>(&gset)->log_level();
     auto log_name = dynamic_cast<t_gsetout *>(&gset)->log_name();
     auto log_pattern = dynamic_cast<t_gsetout *>(&gset)->log_pattern();
+    auto log_async = dynamic_cast<t_gsetout *>(&gset)->log_async();
     spdlog::set_level(log_level);
     spdlog::set_pattern(log_pattern);
     spdlog::flush_on(spdlog::level::err);
-    t_grtlog great_log = t_grtlog(log_type, log_level, log_name);
+    t_grtlog great_log = t_grtlog(log_type, log_level, log_name, log_async);
     auto my_logger = great_log.spdlog();
 
+    // Per-stage timers, only with <prof> in the outputs
+    string prof_file = dynamic_cast<t_gsetout *>(&gset)->outputs("prof");
+    t_gprofiler::enable(!prof_file.empty());
+
     // Check the base station
     bool isBase = dynamic_cast<t_gsetgen*>(&gset)->list_base().size();
 
@@ -101,12 +112,16 @@ int main(int argc, char** argv)
     t_gio* tgio = 0;
     t_gcoder* tgcoder = 0;
 
+    // RTCM stream decoders, notifying the real-time drivers
+    vector<t_rtcm3*> grtcm;
+
     if (!isBase)
     {
         // CHECK INPUTS, sp3+rinexc+rinexo, Necessary data
         if (gset.input_size("sp3") == 0 &&
             gset.input_size("rinexc") == 0 &&
-            gset.input_size("rinexo") == 0
+            gset.input_size("rinexo") == 0 &&
+            gset.input_size("rtcm") == 0
             ) 
         {
             SPDLOG_LOGGER_INFO(my_logger, "Error: incomplete input: rinexo + rinexc + sp3");
@@ -136,6 +151,7 @@ int main(int argc, char** argv)
         else if (ifmt == IFMT::DE_INP) { gdata = gde; tgcoder = new t_dvpteph405(&gset, "", 4096); }
         else if (ifmt == IFMT::EOP_INP) { gdata = gerp; tgcoder = new t_poleut1(&gset, "", 4096); }
         else if (ifmt == IFMT::IFCB_INP) { gdata = gifcb; tgcoder = new t_ifcb(&gset, "", 4096); }
+        else if (ifmt == IFMT::RTCM_INP) { gdata = gobs; tgcoder = new t_rtcm3(&gset, "", 4096); }
         else 
         {
             SPDLOG_LOGGER_INFO(my_logger, "Error: unrecognized format " + int2str(int(ifmt)));
@@ -150,6 +166,20 @@ int main(int argc, char** argv)
             tgio->spdlog(my_logger);
             tgio->path(path);
         }
+        else if (path.substr(0, 6) == "tcp://")
+        {
+            SPDLOG_LOGGER_INFO(my_logger, "path is tcp stream!");
+            tgio = new t_gtcp(my_logger);
+            tgio->spdlog(my_logger);
+            tgio->path(path);
+        }
+        else if (path.substr(0, 8) == "ntrip://")
+        {
+            SPDLOG_LOGGER_INFO(my_logger, "path is ntrip stream!");
+            tgio = new t_gntrip(my_logger);
+            tgio->spdlog(my_logger);
+            tgio->path(path);
+        }
 
         // READ DATA FROM FILE
         if (tgcoder) 
@@ -163,10 +193,22 @@ int main(int argc, char** argv)
             tgcoder->add_data(id, gdata);
             tgcoder->add_data("OBJ", gobj); 
 
+            // RTCM streams carry the broadcast ephemerides too
+            if (ifmt == IFMT::RTCM_INP) tgcoder->add_data(id + "NAV", gorb);
+
             // Put the gcoder into the gio
             // Note, gcoder contain the gdata and gio contain the gcoder
             tgio->coder(tgcoder);
 
+            // Streams are received in their own thread (started with the real-time processing)
+            if (path.substr(0, 7) != "file://")
+            {
+                gio.push_back(tgio);
+                gcoder.push_back(tgcoder);
+                if (ifmt == IFMT::RTCM_INP) grtcm.push_back(dynamic_cast<t_rtcm3*>(tgcoder));
+                continue;
+            }
+
             runepoch = t_gtime::current_time(t_gtime::GPS);
 
             // Read the data from file here
@@ -212,6 +254,57 @@ int main(int argc, char** argv)
     // Record current time
     auto tic_start = system_clock::now();
 
+    // REAL-TIME PROCESSING - epochs are processed as soon as the streams complete them
+    if (!gio.empty())
+    {
+        vector<string> list_base = isBase ? gset.list_base() : vector<string>();
+        vector<string> list_rover = isBase ? gset.list_rover() : vector<string>(sites.begin(), sites.end());
+
+        vector<t_grtpvt*> vrtpvt;
+        for (size_t k = 0; k < list_rover.size(); ++k)
+        {
+            string site = list_rover[k];
+            string site_base = isBase ? list_base[k] : "";
+            t_gpvtflt* pvt = new t_gpvtflt(site, site_base, &gset, my_logger, data);
+            if (dynamic_cast<t_gsetamb*>(&gset)->fix_mode() != FIX_MODE::NO && !isBase) pvt->Add_UPD(gupd);
+            vgpvt.push_back(pvt);
+            vrtpvt.push_back(new t_grtpvt(pvt, site, site_base, my_logger));
+            vrtpvt.back()->budget(dynamic_cast<t_gsetproc*>(&gset)->latency_budget());
+        }
+
+        for (size_t k = 0; k < grtcm.size(); ++k)
+        {
+            grtcm[k]->epoch_notify([&vrtpvt](const string& site, const t_gtime& epo)
+            {
+                for (size_t j = 0; j < vrtpvt.size(); ++j) vrtpvt[j]->push(site, epo);
+            });
+        }
+
+        for (size_t k = 0; k < gio.size(); ++k) gthread.push_back(thread(&t_gio::run_read, gio[k]));
+
+        t_gtime beg = dynamic_cast<t_gsetgen*>(&gset)->beg();
+        t_gtime end = dynamic_cast<t_gsetgen*>(&gset)->end();
+        SPDLOG_LOGGER_INFO(my_logger, "Real-time PVT processing started ");
+
+        atomic<int> nrunning(static_cast<int>(vrtpvt.size()));
+        vector<thread> rtthread;
+        for (size_t k = 0; k < vrtpvt.size(); ++k)
+        {
+            rtthread.push_back(thread([&nrunning, &vrtpvt, k, beg, end]() { vrtpvt[k]->run(beg, end); nrunning--; }));
+        }
+
+        while (nrunning > 0 && !stop_request) t_gtime::gmsleep(100);
+
+        for (size_t k = 0; k < vrtpvt.size(); ++k) vrtpvt[k]->stop();
+        for (size_t k = 0; k < rtthread.size(); ++k) rtthread[k].join();
+        for (size_t k = 0; k < gio.size(); ++k) gio[k]->stop();
+        for (size_t k = 0; k < gthread.size(); ++k) { if (gthread[k].joinable()) gthread[k].join(); }; gthread.clear();
+        for (size_t k = 0; k < grtcm.size(); ++k) grtcm[k]->epoch_notify(nullptr);
+        for (size_t k = 0; k < vrtpvt.size(); ++k) delete vrtpvt[k];
+
+        SPDLOG_LOGGER_INFO(my_logger, "Real-time PVT processing finished");
+    }
+
     // PVT PROCESSING - loop over sites from settings
     int i = 0;
     if (isBase)
@@ -219,7 +312,7 @@ int main(int argc, char** argv)
         vector<string> list_rover = gset.list_rover();  
         sites = set<string>(list_rover.begin(), list_rover.end());
     }
-    int nsite = sites.size();
+    int nsite = gio.empty() ? sites.size() : 0;
     set<string>::iterator it = sites.begin();
     while (i < nsite)
     {
@@ -263,8 +356,11 @@ int main(int argc, char** argv)
 
         runepoch = t_gtime::current_time(t_gtime::GPS);
 
-        // The main processing code : processBatch
-        vgpvt[idx]->processBatch(beg, end, true);
+        // The main processing code : processBatch (forward/backward combination if smoothing)
+        if (dynamic_cast<t_gsetflt*>(&gset)->smooth() == "fbs")
+            vgpvt[idx]->processBatchFBS(beg, end);
+        else
+            vgpvt[idx]->processBatch(beg, end, true);
 
         // The time when process ends
         lstepoch = t_gtime::current_time(t_gtime::GPS);
@@ -276,6 +372,10 @@ int main(int argc, char** argv)
         i++;
     }
 
+    // Stop receiving streams
+    for (size_t i = 0; i < gio.size(); ++i) { gio[i]->stop(); }
+    for (size_t i = 0; i < gthread.size(); ++i) { if (gthread[i].joinable()) gthread[i].join(); }; gthread.clear();
+
     //Delete pointer
     for (size_t i = 0; i < gio.size(); ++i) { delete gio[i]; }; gio.clear();
     for (size_t i = 0; i < gcoder.size(); ++i) { delete gcoder[i]; }; gcoder.clear();
@@ -292,6 +392,15 @@ int main(int argc, char** argv)
     if (gifcb)  delete gifcb;
     if (data)  delete data;
 
+    // Per-stage timing report
+    if (!prof_file.empty())
+    {
+        ostringstream os;
+        t_gprofiler::report(os);
+        t_giof prof(prof_file);
+        prof.write(os.str().c_str(), os.str().size());
+    }
+
     // Record the current time and the time spent
     auto tic_end = system_clock::now();
     auto duration = duration_cast<microseconds>(tic_end - tic_start);
@@ -32,10 +32,15 @@ namespace gnut
     _IFMT_supported.insert(IFMT::LEAPSECOND_INP);
     _IFMT_supported.insert(IFMT::UPD_INP);
     _IFMT_supported.insert(IFMT::IFCB_INP);
+    _IFMT_supported.insert(IFMT::RTCM_INP);
 
     _OFMT_supported.insert(LOG_OUT);
     _OFMT_supported.insert(PPP_OUT);
     _OFMT_supported.insert(FLT_OUT);
+    _OFMT_supported.insert(SMT_OUT);
+    _OFMT_supported.insert(CKP_OUT);
+    _OFMT_supported.insert(PROF_OUT);
+    _OFMT_supported.insert(RATIO_OUT);
 
     
   }
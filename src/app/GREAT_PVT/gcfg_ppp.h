@@ -38,7 +38,10 @@
 #include "gset/gsetflt.h"
 #include "gset/gsetrec.h"
 #include "gproc/gpvtflt.h"
+#include "gproc/grtpvt.h"
 #include "gio/gfile.h"
+#include "gio/gtcp.h"
+#include "gio/gntrip.h"
 #include "gdata/gifcb.h"
 #include "gcoders/upd.h"
 #include "gcoders/sp3.h"
@@ -53,6 +56,7 @@
 #include "gcoders/biasinex.h"
 #include "gcoders/biabernese.h"
 #include "gcoders/atx.h"
+#include "gcoders/rtcm3.h"
 #include "gdata/gnavde.h"
 
 using namespace std;
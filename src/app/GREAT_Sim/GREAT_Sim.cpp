@@ -0,0 +1,306 @@
+/**
+ * @file         GREAT_Sim.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Main Function of the GNSS/IMU data simulation from precise products
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include "gcfg_sim.h"
+#include "gsimgnss.h"
+#include "gsimtraj.h"
+#include "gutils/gconst.h"
+#include "gutils/gthreadpool.h"
+#include "gutils/gsysconv.h"
+#include "gutils/gtypeconv.h"
+#include "gutils/gfileconv.h"
+
+using namespace std;
+using namespace std::chrono;
+using namespace gnut;
+using namespace great;
+
+// 4-char name: prefix + 3 base-36 digits
+static string sim_name(char prefix, int i)
+{
+    const char *digits = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    string name(4, prefix);
+    for (int k = 3; k > 0; k--)
+    {
+        name[k] = digits[i % 36];
+        i /= 36;
+    }
+    return name;
+}
+
+// point i of n on a Fibonacci lattice (latitudes within +-maxlat), 100 m above the ellipsoid
+static t_gtriple sim_site(int i, int n, double maxlat)
+{
+    const double golden = (3.0 - sqrt(5.0)) * G_PI;
+    double z = 1.0 - (2.0 * i + 1.0) / n;
+    t_gtriple ell(asin(z * sin(maxlat)), fmod(golden * i, 2.0 * G_PI) - G_PI, 100.0);
+    t_gtriple xyz;
+    ell2xyz(ell, xyz, false);
+    return xyz;
+}
+
+// output file of a receiver: mask with $(rec) or directory + name
+static string sim_path(string out, const string &rec, const string &name)
+{
+    substitute(out, GFILE_PREFIX, "");
+    if (out.find("$(rec)") != string::npos)
+    {
+        substitute(out, "$(rec)", rec, false);
+        return out;
+    }
+    if (!out.empty() && out.back() != '/' && out.back() != '\\')
+        out += "/";
+    return out + name;
+}
+
+// MAIN
+// ----------
+int main(int argc, char **argv)
+{
+    // Construct the gset class and init some values in the class
+    t_gcfg_sim gset;
+    gset.app("GREAT-Sim", "$Ver: 1.0 $", "$Rev:  $", "(https://github.com/GREAT-WHU)", __DATE__, __TIME__);
+
+    // Get the arguments from the command line
+    gset.arg(argc, argv, true, false);
+
+    // Creat and set the log file
+    auto log_type = dynamic_cast<t_gsetout *>(&gset)->log_type();
+    auto log_level = dynamic_cast<t_gsetout *>(&gset)->log_level();
+    auto log_name = dynamic_cast<t_gsetout *>(&gset)->log_name();
+    auto log_pattern = dynamic_cast<t_gsetout *>(&gset)->log_pattern();
+    auto log_async = dynamic_cast<t_gsetout *>(&gset)->log_async();
+    spdlog::set_level(log_level);
+    spdlog::set_pattern(log_pattern);
+    spdlog::flush_on(spdlog::level::err);
+    t_grtlog great_log = t_grtlog(log_type, log_level, log_name, log_async);
+    auto my_logger = great_log.spdlog();
+
+    t_gsetgen *gen = dynamic_cast<t_gsetgen *>(&gset);
+    t_gsetsim *sim = dynamic_cast<t_gsetsim *>(&gset);
+    t_gtime beg = gen->beg();
+    t_gtime end = gen->end();
+
+    // CHECK INPUTS, sp3 (+rinexc) necessary
+    if (gset.input_size("sp3") == 0)
+    {
+        SPDLOG_LOGGER_INFO(my_logger, "Error: incomplete input: sp3 (+ rinexc)");
+        gset.usage();
+    }
+    string out_obs = dynamic_cast<t_gsetout *>(&gset)->outputs("rinexo");
+    string out_imu = dynamic_cast<t_gsetout *>(&gset)->outputs("imu");
+    if (out_obs.empty())
+    {
+        SPDLOG_LOGGER_INFO(my_logger, "Error: missing output: rinexo");
+        gset.usage();
+    }
+
+    //--- INITIALIZATIONS ---
+    t_gdata *gdata = nullptr;
+    t_gallprec *gorb = new t_gallprec(); gorb->spdlog(my_logger);
+    t_gallpcv *gpcv = nullptr; if (gset.input_size("atx") > 0) { gpcv = new t_gallpcv; gpcv->spdlog(my_logger); }
+    t_gallotl *gotl = nullptr; if (gset.input_size("blq") > 0) { gotl = new t_gallotl; gotl->spdlog(my_logger); }
+    t_gallobj *gobj = new t_gallobj(my_logger, gpcv, gotl); gobj->spdlog(my_logger);
+    if (gset.input_size("rinexc") == 0)
+        gorb->use_clksp3(true);
+
+    // SET OBJECTS
+    set<string> obj = dynamic_cast<t_gsetrec *>(&gset)->objects();
+    for (auto it = obj.begin(); it != obj.end(); ++it)
+    {
+        shared_ptr<t_grec> rec = dynamic_cast<t_gsetrec *>(&gset)->grec(*it, my_logger);
+        gobj->add(rec);
+    }
+
+    // synthetic stations and vehicles
+    int nsta = sim->nsta();
+    int ntraj = sim->ntraj();
+    string antenna = sim->antenna();
+    set<string> vehicles;
+    for (int i = 0; i < nsta + ntraj; i++)
+    {
+        bool veh = i >= nsta;
+        shared_ptr<t_grec> rec = make_shared<t_grec>(my_logger);
+        rec->id(veh ? sim_name('V', i - nsta) : sim_name('S', i));
+        if (veh)
+            vehicles.insert(rec->id());
+        rec->crd(veh ? sim_site(i - nsta, ntraj, 60.0 * D2R) : sim_site(i, nsta, 80.0 * D2R),
+                 t_gtriple(10.0, 10.0, 10.0), FIRST_TIME, LAST_TIME);
+        rec->eccneu(t_gtriple(0.0, 0.0, 0.0), FIRST_TIME, LAST_TIME);
+        rec->ant(antenna, FIRST_TIME, LAST_TIME);
+        gobj->add(rec);
+    }
+
+    // DATA READING
+    multimap<IFMT, string> inp = gset.inputs_all();
+    multimap<IFMT, string>::const_iterator itINP = inp.begin();
+    for (size_t i = 0; i < inp.size() && itINP != inp.end(); ++i, ++itINP)
+    {
+        IFMT ifmt(itINP->first);
+        string path(itINP->second);
+        string id("ID" + int2str(i));
+
+        t_gcoder *tgcoder = nullptr;
+        if (ifmt == IFMT::SP3_INP) { gdata = gorb; tgcoder = new t_sp3(&gset, "", 8172); }
+        else if (ifmt == IFMT::RINEXC_INP) { gdata = gorb; tgcoder = new t_rinexc(&gset, "", 4096); }
+        else if (ifmt == IFMT::ATX_INP) { gdata = gpcv; tgcoder = new t_atx(&gset, "", 4096); }
+        else if (ifmt == IFMT::BLQ_INP) { gdata = gotl; tgcoder = new t_blq(&gset, "", 4096); }
+        else
+        {
+            SPDLOG_LOGGER_INFO(my_logger, "Error: unrecognized format " + int2str(int(ifmt)));
+            continue;
+        }
+
+        t_gio *tgio = new t_gfile(my_logger);
+        tgio->spdlog(my_logger);
+        tgio->path(path);
+
+        tgcoder->clear();
+        tgcoder->path(path);
+        tgcoder->spdlog(my_logger);
+        tgcoder->add_data(id, gdata);
+        tgcoder->add_data("OBJ", gobj);
+        tgio->coder(tgcoder);
+
+        auto tic = system_clock::now();
+        tgio->run_read();
+        SPDLOG_LOGGER_INFO(my_logger, "READ: " + path + " time: " +
+                           dbl2str(duration_cast<milliseconds>(system_clock::now() - tic).count() / 1000.0) + " sec");
+
+        delete tgio;
+        delete tgcoder;
+    }
+
+    // set antennas for satllites (must be before PCV assigning)
+    if (gpcv)
+        gobj->read_satinfo(beg);
+
+    // assigning PCV pointers to objects
+    gobj->sync_pcvs();
+
+    t_gsimgnss gnss(&gset, my_logger, gorb, gobj, gotl);
+
+    // RECEIVERS, the noise sequence of each one depends on the seed and its name only
+    unsigned int seed = sim->seed();
+    vector<t_gsimrec> recs;
+    set<string> names = gen->recs();
+    for (int i = 0; i < nsta + ntraj; i++)
+        names.insert(i < nsta ? sim_name('S', i) : sim_name('V', i - nsta));
+
+    for (auto it = names.begin(); it != names.end(); ++it)
+    {
+        shared_ptr<t_gobj> one = gobj->obj(*it);
+        if (!one || one->crd(beg).zero())
+        {
+            SPDLOG_LOGGER_WARN(my_logger, "Receiver " + *it + " without coordinates, skipped");
+            continue;
+        }
+
+        unsigned int hash = seed;
+        for (char c : *it)
+            hash = hash * 31u + (unsigned char)c;
+
+        t_gsimrec rec;
+        rec.name = *it;
+        rec.xyz = one->crd(beg);
+        rec.ecc = one->eccneu(beg);
+        rec.ant = one->ant(beg);
+        rec.pcv = one->pcv(beg);
+        rec.rng = t_grandom(hash);
+
+        string site = it->substr(0, 4);
+        transform(site.begin(), site.end(), site.begin(), ::tolower);
+        char name[32];
+        snprintf(name, sizeof(name), "%s%03d0.%02do", site.c_str(), beg.doy(), beg.yr());
+        rec.obs = make_shared<t_giof>();
+        rec.obs->tsys(t_gtime::GPS);
+        rec.obs->mask(sim_path(out_obs, *it, name));
+
+        if (vehicles.count(*it))
+        {
+            rec.traj = make_shared<t_gsimtraj>(rec.xyz, 2.0 * G_PI * rec.rng.uniform(), beg, sim->imu_freq(), hash);
+            rec.traj->profile(sim->speed(), sim->static_time(), sim->turn_period());
+            rec.traj->errors(sim->gyro_noise(), sim->acce_noise(), sim->gyro_bias(), sim->acce_bias());
+            if (!out_imu.empty())
+            {
+                rec.imu = make_shared<t_giof>();
+                rec.imu->mask(sim_path(out_imu, *it + "_imu", *it + "_imu.txt"));
+                rec.ref = make_shared<t_giof>();
+                rec.ref->mask(sim_path(out_imu, *it + "_ref", *it + "_ref.txt"));
+            }
+        }
+        recs.push_back(rec);
+    }
+
+    if (recs.empty())
+    {
+        SPDLOG_LOGGER_INFO(my_logger, "Error: no receiver to simulate");
+        gset.usage();
+    }
+
+    int nthread = sim->threads();
+    if (nthread <= 0)
+        nthread = max(1, (int)thread::hardware_concurrency());
+    nthread = min(nthread, (int)recs.size());
+
+    SPDLOG_LOGGER_INFO(my_logger, "Simulation of " + int2str(recs.size()) + " receiver(s) with " + int2str(nthread) + " thread(s)");
+
+    // SIMULATION, block by block: satellites tabulated serially, receivers in parallel
+    auto tic_start = system_clock::now();
+    double block = sim->block();
+    double intv = gnss.intv();
+    long long nepo = 0;
+    t_gthreadpool pool(nthread);
+    for (t_gtime b0 = beg; b0 <= end;)
+    {
+        t_gtime b1 = b0;
+        b1.add_dsec(block);
+        bool last = !(b1 < end);
+        t_gtime tend = last ? end : b1;
+        t_gtime tab = tend;
+        if (last)
+            tab.add_dsec(intv / 2.0);
+
+        int n = gnss.epochs(b0, tab);
+        nepo += n;
+
+        pool.parallel_for(int(recs.size()), [&](int j) {
+            t_gsimrec &rec = recs[j];
+            if (rec.traj)
+                rec.traj->run(tend, intv, rec.imu.get(), rec.ref.get());
+            gnss.run(rec);
+        });
+
+        SPDLOG_LOGGER_INFO(my_logger, "Simulated " + b0.str_ymdhms() + " - " + tend.str_ymdhms() + ", " + int2str(n) + " epochs");
+        if (last)
+            break;
+        b0 = b1;
+    }
+
+    auto tic_end = system_clock::now();
+    auto duration = duration_cast<microseconds>(tic_end - tic_start);
+    double sec = double(duration.count()) * microseconds::period::num / microseconds::period::den;
+    SPDLOG_LOGGER_INFO(my_logger, "Spent " + dbl2str(sec) + " seconds");
+    cout << "Simulated " << recs.size() << " receiver(s), " << nepo << " epochs in " << sec << " seconds" << endl;
+
+    recs.clear();
+    delete gobj;
+    delete gorb;
+    if (gpcv) delete gpcv;
+    if (gotl) delete gotl;
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file         gcfg_sim.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        settings of the GNSS/IMU data simulation
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gcfg_sim.h"
+
+using namespace std;
+using namespace pugi;
+
+namespace gnut
+{
+    t_gcfg_sim::t_gcfg_sim()
+        : t_gsetbase(),
+          t_gsetgen(),
+          t_gsetinp(),
+          t_gsetgnss(),
+          t_gsetout(),
+          t_gsetrec(),
+          t_gsetsim()
+    {
+        _IFMT_supported.insert(IFMT::SP3_INP);
+        _IFMT_supported.insert(IFMT::RINEXC_INP);
+        _IFMT_supported.insert(IFMT::ATX_INP);
+        _IFMT_supported.insert(IFMT::BLQ_INP);
+
+        _OFMT_supported.insert(LOG_OUT);
+        _OFMT_supported.insert(RINEXO_OUT);
+        _OFMT_supported.insert(IMU_OUT);
+    }
+
+    t_gcfg_sim::~t_gcfg_sim()
+    {
+    }
+
+    void t_gcfg_sim::check()
+    {
+        t_gsetgen::check();
+        t_gsetinp::check();
+        t_gsetgnss::check();
+        t_gsetout::check();
+        t_gsetrec::check();
+        t_gsetsim::check();
+    }
+
+    void t_gcfg_sim::help()
+    {
+        t_gsetbase::help_header();
+        t_gsetgen::help();
+        t_gsetinp::help();
+        t_gsetgnss::help();
+        t_gsetout::help();
+        t_gsetrec::help();
+        t_gsetsim::help();
+        t_gsetbase::help_footer();
+    }
+
+} // namespace
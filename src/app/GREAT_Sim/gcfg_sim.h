@@ -0,0 +1,65 @@
+/**
+ * @file         gcfg_sim.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        settings of the GNSS/IMU data simulation
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GCFG_SIM_H
+#define GCFG_SIM_H
+
+#include <string>
+#include <iostream>
+
+#include "gall/gallprec.h"
+#include "gall/gallpcv.h"
+#include "gall/gallotl.h"
+#include "gall/gallobj.h"
+#include "gio/gfile.h"
+#include "gio/grtlog.h"
+#include "gcoders/sp3.h"
+#include "gcoders/rinexc.h"
+#include "gcoders/atx.h"
+#include "gcoders/blq.h"
+#include "gset/gsetgen.h"
+#include "gset/gsetinp.h"
+#include "gset/gsetgnss.h"
+#include "gset/gsetout.h"
+#include "gset/gsetrec.h"
+#include "gset/gsetsim.h"
+
+using namespace std;
+using namespace pugi;
+
+namespace gnut
+{
+
+    class t_gcfg_sim : public t_gsetgen,
+                       public t_gsetinp,
+                       public t_gsetgnss,
+                       public t_gsetout,
+                       public t_gsetrec,
+                       public t_gsetsim
+    {
+
+    public:
+        /** @brief default constructor. */
+        t_gcfg_sim();
+
+        /** @brief default destructor. */
+        ~t_gcfg_sim();
+
+        /** @brief settings check. */
+        void check();
+
+        /** @brief settings help. */
+        void help();
+    };
+
+} // namespace
+
+#endif
@@ -0,0 +1,416 @@
+/**
+ * @file         gsimgnss.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        GNSS observations simulated with the models of the processing
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include "gsimgnss.h"
+#include "gdata/gsatdata.h"
+#include "gmodels/gtropo.h"
+#include "gmodels/ggmf.h"
+#include "gmodels/gtideIERS.h"
+#include "gset/gsetgen.h"
+#include "gset/gsetsim.h"
+#include "gutils/gconst.h"
+#include "gutils/gsysconv.h"
+#include "gutils/gfmtline.h"
+#include "gutils/grinexout.h"
+
+using namespace Eigen;
+
+#define SIM_TAU0   0.075        ///< nominal signal travel time [s], the satellites are tabulated at epoch - SIM_TAU0
+#define SIM_GM     3.986004418e14
+#define SIM_RE     6371000.0    ///< mean radius for the ionosphere [m]
+#define SIM_HION   450000.0     ///< height of the ionosphere shell [m]
+
+const vector<t_gsimsig> &t_gsimgnss::signals(GSYS gsys)
+{
+    static const vector<t_gsimsig> gps = {{BAND_1, "C1C", "L1C", G01_F}, {BAND_2, "C2W", "L2W", G02_F}};
+    static const vector<t_gsimsig> gal = {{BAND_1, "C1C", "L1C", E01_F}, {BAND_5, "C5Q", "L5Q", E05_F}};
+    static const vector<t_gsimsig> bds = {{BAND_2, "C2I", "L2I", C02_F}, {BAND_6, "C6I", "L6I", C06_F}};
+    static const vector<t_gsimsig> qzs = {{BAND_1, "C1C", "L1C", J01_F}, {BAND_2, "C2L", "L2L", J02_F}};
+    static const vector<t_gsimsig> none;
+
+    switch (gsys)
+    {
+    case GPS:
+        return gps;
+    case GAL:
+        return gal;
+    case BDS:
+        return bds;
+    case QZS:
+        return qzs;
+    default:
+        return none;
+    }
+}
+
+t_gsimgnss::t_gsimgnss(t_gsetbase *set, t_spdlog spdlog, t_gallprec *orb, t_gallobj *obj, t_gallotl *otl)
+    : _spdlog(spdlog),
+      _orb(orb),
+      _obj(obj),
+      _otl(otl)
+{
+    t_gsetgen *gen = dynamic_cast<t_gsetgen *>(set);
+    t_gsetsim *sim = dynamic_cast<t_gsetsim *>(set);
+
+    std::set<string> sys = gen->sys();
+    for (const auto &s : sys)
+    {
+        GSYS gsys = t_gsys::str2gsys(s);
+        if (!signals(gsys).empty())
+            _sys.insert(gsys);
+        else
+            SPDLOG_LOGGER_WARN(_spdlog, "GNSS simulation: system " + s + " not supported, skipped");
+    }
+
+    _beg = gen->beg();
+    _intv = gen->sampling();
+    if (_intv <= 0.0)
+        _intv = 30.0;
+
+    _code_noise = sim->code_noise();
+    _phase_noise = sim->phase_noise();
+    _mask = sim->elev_mask() * D2R;
+    _vtec = sim->vtec();
+    _ztd_rw = sim->ztd_rw() / 60.0;
+    _clk_offset = sim->clk_offset();
+    _clk_rw = sim->clk_rw();
+}
+
+t_gsimgnss::~t_gsimgnss()
+{
+}
+
+int t_gsimgnss::epochs(const t_gtime &beg, const t_gtime &end)
+{
+    _table.clear();
+    _info.clear();
+
+    // satellites and antennas of the block
+    map<string, int> index;
+    set<string> sats = _orb->satellites();
+    for (const auto &sat : sats)
+    {
+        GSYS gsys = t_gsys::char2gsys(sat[0]);
+        if (_sys.find(gsys) == _sys.end())
+            continue;
+
+        t_gsimsatinfo info;
+        info.sat = sat;
+        info.gsys = gsys;
+        info.iir = false;
+        shared_ptr<t_gobj> obj = _obj ? _obj->obj(sat) : nullptr;
+        info.pcv = obj ? obj->pcv(beg) : nullptr;
+        if (info.pcv)
+        {
+            t_gsatdata satdata(_spdlog, "", sat, beg);
+            const vector<t_gsimsig> &sig = signals(gsys);
+            for (int b = 0; b < 2; b++)
+            {
+                GOBSBAND band = sig[b].band;
+                if (info.pcv->pcoS_raw(satdata, info.pco[b], band) < 0)
+                    info.pco[b] = t_gtriple(0.0, 0.0, 0.0);
+            }
+            info.iir = info.pcv->anten().find("BLOCK IIR") != string::npos;
+        }
+        index[sat] = int(_info.size());
+        _info.push_back(info);
+    }
+
+    long long n0 = (long long)ceil(beg.diff(_beg) / _intv - 1e-6);
+    for (long long n = n0;; n++)
+    {
+        t_gtime t = _beg;
+        t.add_dsec(n * _intv);
+        if (t.diff(end) > -1e-6)
+            break;
+
+        t_gtime ts = t;
+        ts.add_dsec(-SIM_TAU0);
+
+        t_gsimepoch epo;
+        epo.t = t;
+        epo.idx = n;
+        epo.sun = _eph.sunPos(ts.dmjd());
+        epo.moon = _eph.moonPos(ts.dmjd());
+
+        ColumnVector xsun = epo.sun.crd_cvect();
+        for (const auto &info : _info)
+        {
+            t_gsimsat s;
+            double var[3] = {0.0, 0.0, 0.0}, cvar = 0.0;
+            if (_orb->pos(info.sat, ts, s.xyz, var, s.vel) < 0)
+                continue;
+            if (_orb->clk(info.sat, ts, &s.clk, &cvar, &s.dclk) < 0)
+                continue;
+            if (Vector3d(s.xyz).norm() < 1.0 || Vector3d(s.vel).norm() < 1e-3)
+                continue;
+
+            ColumnVector xs(3), vs(3), ii(3), jj(3), kk(3);
+            xs << s.xyz;
+            vs << s.vel;
+            string antype = info.pcv ? info.pcv->anten() : "";
+            if (_att.attitude(antype, info.sat, xs, vs, xsun, ii, jj, kk) < 0)
+                continue;
+            for (int m = 0; m < 3; m++)
+            {
+                s.i[m] = ii(m + 1);
+                s.j[m] = jj(m + 1);
+                s.k[m] = kk(m + 1);
+            }
+            s.info = index[info.sat];
+            epo.sats.push_back(s);
+        }
+        _table.push_back(epo);
+    }
+
+    return int(_table.size());
+}
+
+double t_gsimgnss::_windup(const t_gsimsat &s, bool iir, const Vector3d &rho, const t_gtriple &ell, double prev) const
+{
+    Vector3d i(s.i), j(s.j);
+    if (iir)
+    {
+        i = -i;
+        j = -j;
+    }
+    Vector3d dipSat = i - rho.dot(i) * rho - rho.cross(j);
+
+    double recEll[3] = {ell[0], ell[1], ell[2]};
+    double neu[3] = {1.0, 0.0, 0.0};
+    Vector3d rx, ry;
+    neu2xyz(recEll, neu, rx.data());
+    neu[0] = 0.0;
+    neu[1] = -1.0;
+    neu2xyz(recEll, neu, ry.data());
+    Vector3d dipRec = rx - rho.dot(rx) * rho + rho.cross(ry);
+
+    double alpha = dipSat.dot(dipRec) / (dipSat.norm() * dipRec.norm());
+    alpha = max(-1.0, min(1.0, alpha));
+    double dphi = acos(alpha) / 2.0 / G_PI;
+    if (rho.dot(dipSat.cross(dipRec)) < 0.0)
+        dphi = -dphi;
+
+    return floor(prev - dphi + 0.5) + dphi;
+}
+
+void t_gsimgnss::run(t_gsimrec &rec)
+{
+    if (_table.empty() || !rec.obs)
+        return;
+
+    t_gtideIERS tide(_spdlog, _otl);
+    t_saast trop;
+    t_gmf gmf;
+    ::Matrix rot(3, 3);
+    rot = 0.0;
+    rot(1, 1) = rot(2, 2) = rot(3, 3) = 1.0; // sun and moon are tabulated in ECEF already
+
+    map<string, shared_ptr<t_gsatdata>> satdata;
+    string out;
+    t_gfmtline line;
+
+    for (const auto &epo : _table)
+    {
+        // receiver clock and wet delay
+        if (!rec.init)
+        {
+            rec.clk = _clk_offset * (2.0 * rec.rng.uniform() - 1.0);
+            rec.zwd = -1.0;
+        }
+        else
+        {
+            rec.clk += _clk_rw * sqrt(_intv) * rec.rng.gauss();
+        }
+
+        // marker at the epoch
+        t_gtriple xr, vr;
+        if (rec.traj)
+        {
+            if (!rec.traj->state(epo.t, xr, vr))
+                continue;
+        }
+        else
+        {
+            xr = rec.xyz;
+            ColumnVector sun = (epo.sun / 1000.0).crd_cvect();
+            ColumnVector moon = (epo.moon / 1000.0).crd_cvect();
+            t_gtriple dx = tide.tide_solid(epo.t, xr, rot, sun, moon);
+            if (_otl)
+                dx = dx + tide.load_ocean(epo.t, rec.name, xr);
+            xr = xr + dx * 1.e3;
+        }
+
+        t_gtriple ell;
+        xyz2ell(xr, ell, false);
+        t_gtriple decc;
+        neu2xyz(ell, rec.ecc, decc);
+
+        // antenna reference point at the true reception time
+        Vector3d xa = (xr + decc).crd_cvect_Eigen() - vr.crd_cvect_Eigen() * rec.clk;
+
+        double zhd = trop.getZHD(ell, epo.t);
+        if (!rec.init || rec.zwd < 0.0)
+            rec.zwd = trop.getZWD(ell, epo.t);
+        else
+            rec.zwd = max(0.0, rec.zwd + _ztd_rw * sqrt(_intv) * rec.rng.gauss());
+        rec.init = true;
+
+        double lt = fmod((epo.t.sod() + epo.t.dsec()) / 3600.0 + ell[1] * R2D / 15.0 + 48.0, 24.0);
+        double vtec = _vtec * (0.2 + 0.8 * max(0.0, cos(2.0 * G_PI * (lt - 14.0) / 24.0))) * (0.3 + 0.7 * cos(ell[0]));
+
+        string body;
+        int nsat = 0;
+        for (const auto &s : epo.sats)
+        {
+            const t_gsimsatinfo &info = _info[s.info];
+            const vector<t_gsimsig> &sig = signals(info.gsys);
+            Vector3d x0(s.xyz), v0(s.vel);
+
+            // light time, earth rotation during the travel
+            Vector3d xs = x0;
+            double tau = SIM_TAU0, dt = 0.0, rho = 0.0;
+            for (int it = 0; it < 3; it++)
+            {
+                dt = SIM_TAU0 - rec.clk - tau;
+                Vector3d x = x0 + v0 * dt;
+                double a = OMEGA * tau;
+                xs = Vector3d(x(0) * cos(a) + x(1) * sin(a), -x(0) * sin(a) + x(1) * cos(a), x(2));
+                rho = (xs - xa).norm();
+                tau = rho / CLIGHT;
+            }
+            Vector3d u = (xs - xa) / rho;
+
+            t_gtriple neu;
+            t_gtriple du(u);
+            xyz2neu(ell, du, neu);
+            double ele = asin(neu[2]);
+            if (ele < _mask)
+                continue;
+            double azi = atan2(neu[1], neu[0]);
+            if (azi < 0.0)
+                azi += 2.0 * G_PI;
+
+            // clocks, relativity, Shapiro
+            double dts = s.clk + s.dclk * dt - 2.0 * x0.dot(v0) / CLIGHT / CLIGHT;
+            double rs = xs.norm(), rr = xa.norm();
+            double shapiro = 2.0 * SIM_GM / CLIGHT / CLIGHT * log((rs + rr + rho) / (rs + rr - rho));
+
+            // troposphere
+            double mfh = 0.0, mfw = 0.0, dmfh = 0.0, dmfw = 0.0;
+            gmf.gmf(epo.t.dmjd(), ell[0], ell[1], ell[2], G_PI / 2.0 - ele, mfh, mfw, dmfh, dmfw);
+            double trp = zhd * mfh + rec.zwd * mfw;
+
+            // ionosphere [TECU]
+            double sinz = SIM_RE / (SIM_RE + SIM_HION) * cos(ele);
+            double stec = vtec / sqrt(1.0 - sinz * sinz);
+
+            double common = rho + CLIGHT * (rec.clk - dts) + shapiro + trp;
+
+            // arc: new ambiguities and wind-up after a gap
+            t_gsimarc &arc = rec.arcs[info.sat];
+            if (arc.last != epo.idx - 1)
+            {
+                arc.amb[0] = floor(2e4 * rec.rng.uniform()) - 1e4;
+                arc.amb[1] = floor(2e4 * rec.rng.uniform()) - 1e4;
+                arc.wind = 0.0;
+            }
+            arc.last = epo.idx;
+            arc.wind = _windup(s, info.iir, -u, ell, arc.wind);
+
+            // antennas
+            shared_ptr<t_gsatdata> &psd = satdata[info.sat];
+            if (!psd)
+                psd = make_shared<t_gsatdata>(_spdlog, rec.name, info.sat, epo.t);
+            t_gsatdata &sd = *psd;
+            Vector3d e = -u;
+            double azs = atan2(e.dot(Vector3d(s.j)), e.dot(Vector3d(s.i)));
+            if (azs < 0.0)
+                azs += 2.0 * G_PI;
+            sd.addele(ele);
+            sd.addazi_rec(azi);
+            sd.addazi_sat(azs);
+            sd.addcrd(t_gtriple(xs));
+            t_gtriple xat(xa);
+
+            double sig_c = _code_noise / sin(ele), sig_p = _phase_noise / sin(ele);
+            double val[4];
+            for (int b = 0; b < 2; b++)
+            {
+                GOBSBAND band = sig[b].band;
+                double lam = CLIGHT / sig[b].freq;
+                double ion = 40.3e16 * stec / sig[b].freq / sig[b].freq;
+
+                double pco = 0.0, pcv = 0.0;
+                if (rec.pcv)
+                {
+                    t_gtriple off, dx;
+                    if (rec.pcv->pcoR_raw(sd, off, band) > 0)
+                    {
+                        neu2xyz(ell, off, dx);
+                        pco -= u.dot(dx.crd_cvect_Eigen());
+                    }
+                    double corr = 0.0;
+                    if (rec.pcv->pcvR_raw(corr, sd, band) > 0)
+                        pcv += corr;
+                }
+                if (info.pcv)
+                {
+                    const t_gtriple &off = info.pco[b];
+                    Vector3d dx = off[0] * Vector3d(s.i) + off[1] * Vector3d(s.j) + off[2] * Vector3d(s.k);
+                    pco += u.dot(dx);
+                    double corr = 0.0;
+                    if (info.pcv->pcvS_raw(corr, sd, band, xat) > 0)
+                        pcv += corr;
+                }
+
+                double code = common + pco + ion + sig_c * rec.rng.gauss();
+                double phase = (common + pco + pcv - ion + arc.wind * lam + sig_p * rec.rng.gauss()) / lam + arc.amb[b];
+                val[2 * b] = code;
+                val[2 * b + 1] = phase;
+            }
+            line.clear();
+            t_grinexout::satellite(line, info.sat, val, 4);
+            body += line.data();
+            nsat++;
+        }
+
+        if (!rec.header)
+        {
+            t_grinexout rnx;
+            rnx.program("GREAT_Sim");
+            rnx.marker(rec.name, rec.traj ? "NON_GEODETIC" : "GEODETIC");
+            rnx.receiver("GREAT_SIM");
+            rnx.antenna(rec.ant.empty() ? "SIMULATED" : rec.ant);
+            rnx.position(rec.xyz);
+            rnx.delta_hen(t_gtriple(rec.ecc[2], rec.ecc[1], rec.ecc[0]));
+            for (const auto &gsys : _sys)
+            {
+                vector<string> types;
+                for (const auto &sig : signals(gsys))
+                {
+                    types.push_back(sig.code);
+                    types.push_back(sig.phase);
+                }
+                rnx.obstypes(gsys, types);
+            }
+            rnx.interval(_intv);
+            out += rnx.header(epo.t);
+            rec.header = true;
+        }
+        out += t_grinexout::epoch(epo.t, nsat);
+        out += body;
+    }
+
+    if (!out.empty())
+        rec.obs->write(out.c_str(), out.size());
+}
@@ -0,0 +1,167 @@
+/**
+ * @file         gsimgnss.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        GNSS observations simulated with the models of the processing
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   orbits/clocks  t_gallprec (sp3, clk), relativity -2 r.v/c^2, light time
+ *                  with Earth rotation, Shapiro delay
+ *   attitude       t_gattitude_model, phase wind-up as in t_gprecisebias
+ *   troposphere    GPT + Saastamoinen ZHD, GMF mapping, ZWD random walk
+ *   ionosphere     thin shell (450 km), diurnal VTEC, code +, phase -
+ *   site           solid tide (t_gtideIERS) and ocean loading (blq)
+ *   antennas       receiver and satellite PCO (code, phase), PCV (phase)
+ *   receiver       clock offset + random walk, integer ambiguities per arc,
+ *                  white noise sigma/sin(elevation)
+ *   signals        G C1C L1C C2W L2W, E C1C L1C C5Q L5Q,
+ *                  C C2I L2I C6I L6I, J C1C L1C C2L L2L (no FDMA GLONASS)
+ *
+ *   Satellite states are tabulated once per block (serial, the products and
+ *   the planetary ephemerides are not thread safe), the receivers are then
+ *   simulated independently from the read-only table.
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GSIMGNSS_H
+#define GSIMGNSS_H
+
+#include <map>
+#include <memory>
+#include "gsimtraj.h"
+#include "gall/gallprec.h"
+#include "gall/gallobj.h"
+#include "gall/gallotl.h"
+#include "gmodels/gpcv.h"
+#include "gmodels/gephplan.h"
+#include "gmodels/gattitudemodel.h"
+#include "gset/gsetbase.h"
+#include "gutils/gsys.h"
+
+/** @brief signal simulated for a system. */
+struct t_gsimsig
+{
+    GOBSBAND band;      ///< band
+    string code;        ///< code observation type
+    string phase;       ///< phase observation type
+    double freq;        ///< frequency [Hz]
+};
+
+/** @brief satellite of a block: antenna and attitude type. */
+struct t_gsimsatinfo
+{
+    string sat;                 ///< satellite
+    GSYS gsys;                  ///< system
+    shared_ptr<t_gpcv> pcv;     ///< antenna, may be NULL
+    t_gtriple pco[2];           ///< PCO of the two signals, body frame [m]
+    bool iir;                   ///< GPS IIR, wind-up with flipped x/y axes
+};
+
+/** @brief satellite state at an epoch, 75 ms before the epoch. */
+struct t_gsimsat
+{
+    int info;               ///< index of t_gsimsatinfo
+    double xyz[3];          ///< position, ECEF [m]
+    double vel[3];          ///< velocity, ECEF [m/s]
+    double clk;             ///< clock [s]
+    double dclk;            ///< clock drift [s/s]
+    double i[3], j[3], k[3];///< body axes, ECEF
+};
+
+/** @brief epoch of a block. */
+struct t_gsimepoch
+{
+    t_gtime t;              ///< epoch
+    long long idx;          ///< epoch number since the beginning
+    t_gtriple sun;          ///< sun, ECEF [m]
+    t_gtriple moon;         ///< moon, ECEF [m]
+    vector<t_gsimsat> sats; ///< satellites
+};
+
+/** @brief continuous tracking of a satellite. */
+struct t_gsimarc
+{
+    long long last = -2;    ///< last epoch observed
+    double amb[2] = {0, 0}; ///< integer ambiguities [cycle]
+    double wind = 0.0;      ///< phase wind-up [cycle]
+};
+
+/** @brief simulated receiver, the state is kept from block to block. */
+struct t_gsimrec
+{
+    string name;                    ///< 4-char name
+    t_gtriple xyz;                  ///< marker, ECEF [m] (static receivers)
+    t_gtriple ecc;                  ///< antenna eccentricity NEU [m]
+    string ant;                     ///< antenna type
+    shared_ptr<t_gpcv> pcv;         ///< antenna, may be NULL
+    shared_ptr<t_gsimtraj> traj;    ///< vehicle, NULL for static receivers
+    t_grandom rng;                  ///< observation noise
+    bool init = false;              ///< clock and troposphere initialized
+    double clk = 0.0;               ///< receiver clock [s]
+    double zwd = 0.0;               ///< zenith wet delay [m]
+    map<string, t_gsimarc> arcs;    ///< tracked satellites
+    shared_ptr<t_giof> obs;         ///< RINEX observation file
+    shared_ptr<t_giof> imu;         ///< IMU file (vehicles)
+    shared_ptr<t_giof> ref;         ///< reference trajectory (vehicles)
+    bool header = false;            ///< RINEX header written
+};
+
+/** @brief GNSS observation simulator. */
+class t_gsimgnss
+{
+public:
+    /**
+    * @brief constructor
+    * @param[in] set        settings (gen, sim)
+    * @param[in] spdlog     logger
+    * @param[in] orb        precise orbits and clocks
+    * @param[in] obj        receiver and satellite antennas
+    * @param[in] otl        ocean loading, may be NULL
+    */
+    t_gsimgnss(t_gsetbase *set, t_spdlog spdlog, t_gallprec *orb, t_gallobj *obj, t_gallotl *otl);
+
+    /** @brief default destructor. */
+    virtual ~t_gsimgnss();
+
+    /** @brief tabulate the satellites of the epochs in [beg, end), not thread safe. */
+    int epochs(const t_gtime &beg, const t_gtime &end);
+
+    /** @brief simulate and write the observations of the tabulated epochs, thread safe for different receivers. */
+    void run(t_gsimrec &rec);
+
+    /** @brief sampling [s]. */
+    double intv() const { return _intv; }
+
+    /** @brief signals of a system, empty if not simulated. */
+    static const vector<t_gsimsig> &signals(GSYS gsys);
+
+protected:
+    /** @brief phase wind-up [cycle], continuous with the previous value. */
+    double _windup(const t_gsimsat &s, bool iir, const Eigen::Vector3d &rho, const t_gtriple &ell, double prev) const;
+
+    t_spdlog _spdlog;               ///< logger
+    t_gallprec *_orb;               ///< orbits and clocks
+    t_gallobj *_obj;                ///< antennas
+    t_gallotl *_otl;                ///< ocean loading
+
+    set<GSYS> _sys;                 ///< simulated systems
+    t_gtime _beg;                   ///< first epoch
+    double _intv;                   ///< sampling [s]
+    double _code_noise;             ///< zenith code noise [m]
+    double _phase_noise;            ///< zenith phase noise [m]
+    double _mask;                   ///< elevation mask [rad]
+    double _vtec;                   ///< VTEC maximum [TECU]
+    double _ztd_rw;                 ///< ZWD random walk [m/sqrt(s)]
+    double _clk_offset;             ///< clock offset bound [s]
+    double _clk_rw;                 ///< clock random walk [s/sqrt(s)]
+
+    vector<t_gsimsatinfo> _info;    ///< satellites of the block
+    vector<t_gsimepoch> _table;     ///< epochs of the block
+    t_gephplan _eph;                ///< sun and moon
+    t_gattitude_model _att;         ///< satellite attitude
+};
+
+#endif
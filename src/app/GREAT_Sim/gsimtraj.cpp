@@ -0,0 +1,204 @@
+/**
+ * @file         gsimtraj.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        vehicle trajectory and IMU samples by inverting the strapdown mechanisation
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include "gsimtraj.h"
+#include "gins/gbase.h"
+#include "gins/gutility.h"
+#include "gutils/gconst.h"
+#include "gutils/gsysconv.h"
+#include "gutils/gfmtline.h"
+
+using namespace Eigen;
+
+// rotation vector of a quaternion, atan2 keeps the precision of the small
+// rotations of one sample (acos of q0 near 1 loses about half of the digits)
+static Vector3d _q2rv(const t_gquat &q)
+{
+    Vector3d v(q.q1, q.q2, q.q3);
+    double s = q.q0 < 0 ? -1.0 : 1.0;
+    double n = v.norm();
+    if (n < 1e-300)
+        return Vector3d::Zero();
+    return (2.0 * atan2(n, s * q.q0) / n * s) * v;
+}
+
+t_gsimtraj::t_gsimtraj(const t_gtriple &xyz0, double yaw0, const t_gtime &beg, int freq, unsigned int seed)
+    : _beg(beg),
+      _ts(1.0 / freq),
+      _k(0),
+      _nepo(0),
+      _speed(10.0),
+      _static(300.0),
+      _turn(120.0),
+      _yaw0(yaw0),
+      _rng(seed),
+      _arw(0.0),
+      _vrw(0.0),
+      _eb(Vector3d::Zero()),
+      _db(Vector3d::Zero())
+{
+    t_gtriple ell;
+    xyz2ell(xyz0, ell, false);
+    _pos = Vector3d(ell[0], ell[1], ell[2]);
+    _vn = Vector3d::Zero();
+    _an = Vector3d::Zero();
+    _qnb = t_gbase::a2qua(Vector3d(0.0, 0.0, yaw0));
+    _eth.Update(_pos, _vn);
+}
+
+t_gsimtraj::~t_gsimtraj()
+{
+}
+
+void t_gsimtraj::profile(double speed, double static_time, double turn_period)
+{
+    _speed = speed;
+    _static = static_time > 0.0 ? static_time : 0.0;
+    _turn = turn_period > 0.0 ? turn_period : 120.0;
+}
+
+void t_gsimtraj::errors(double gyro_noise, double acce_noise, double gyro_bias, double acce_bias)
+{
+    _arw = gyro_noise * D2R / 60.0 * sqrt(_ts);
+    _vrw = acce_noise / 60.0 * sqrt(_ts);
+    for (int i = 0; i < 3; i++)
+    {
+        _eb(i) = gyro_bias * D2R / 3600.0 * _rng.gauss();
+        _db(i) = acce_bias * 1e-3 * G_EQUA * _rng.gauss();
+    }
+}
+
+void t_gsimtraj::_profile(double t, double &speed, double &yaw) const
+{
+    const double ramp = 10.0;
+    const double amp = 30.0 * D2R;
+
+    yaw = _yaw0;
+    speed = 0.0;
+    if (t <= _static)
+        return;
+
+    double dt = t - _static;
+    speed = dt < ramp ? _speed * dt / ramp : _speed;
+    yaw = _yaw0 + amp * sin(2.0 * G_PI * dt / _turn);
+}
+
+void t_gsimtraj::_ref_line(const t_gtime &t, string &buf) const
+{
+    Vector3d xyz = Geod2Cart(_pos, false);
+    Vector3d ve = _eth.Cen * _vn;
+    Vector3d att = t_gbase::q2att(_qnb) * R2D;
+
+    t_gfmtline line;
+    line.fix(t.sow() + t.dsec(), 12, 4)
+        .fix(xyz(0), 16, 4).fix(xyz(1), 16, 4).fix(xyz(2), 16, 4)
+        .fix(ve(0), 10, 4).fix(ve(1), 10, 4).fix(ve(2), 10, 4)
+        .fix(att(0), 12, 6).fix(att(1), 12, 6).fix(att(2), 12, 6)
+        .eol();
+    buf += line.data();
+}
+
+void t_gsimtraj::run(const t_gtime &end, double intv, t_giof *imu, t_giof *ref)
+{
+    const size_t chunk = 1 << 20;
+    _nepo = intv > 0.0 ? (long long)floor(intv / _ts + 0.5) : 0;
+    long long nref = (long long)floor(1.0 / _ts + 0.5);
+    long long kend = (long long)floor(end.diff(_beg) / _ts + 1e-6);
+
+    string bimu, bref;
+    t_gfmtline line;
+    _epochs.clear();
+
+    if (_k == 0 && ref)
+        _ref_line(_beg, bref);
+    if (_nepo > 0 && _k % _nepo == 0)
+        _epochs[_k / _nepo] = make_pair(t_gtriple(Geod2Cart(_pos, false)), t_gtriple(_eth.Cen * _vn));
+
+    while (_k < kend)
+    {
+        double t1 = (_k + 1) * _ts;
+        double speed = 0.0, yaw = 0.0;
+        _profile(t1, speed, yaw);
+        t_gquat qnb1 = t_gbase::a2qua(Vector3d(0.0, 0.0, yaw));
+        Vector3d vn1 = qnb1 * Vector3d(0.0, speed, 0.0);
+
+        // the steps of t_gsins::Update solved for the increments
+        double ts2 = _ts / 2.0;
+        Vector3d vn1_2 = _vn + _an * ts2, pos1_2 = _pos + _eth.v2dp(vn1_2, ts2);
+        _eth.Update(pos1_2, vn1_2);
+        Vector3d an = (vn1 - _vn) / _ts;
+        Vector3d fn = t_gbase::rv2q(_eth.wnin * ts2) * (an - _eth.gcc);
+        Vector3d dvbm = (t_gquat::conj(_qnb) * fn) * _ts;
+        Vector3d wm = _q2rv(t_gquat::conj(_qnb) * t_gbase::rv2q(_eth.wnin * _ts) * qnb1);
+        Vector3d vm = (Matrix3d::Identity() + 0.5 * t_gbase::askew(wm)).inverse() * dvbm;
+
+        _pos = _pos + _eth.v2dp(_vn + vn1, ts2);
+        _vn = vn1;
+        _an = an;
+        _qnb = qnb1;
+        _eth.Update(_pos, _vn);
+        _k++;
+
+        t_gtime t = _beg;
+        t.add_dsec(_k * _ts);
+
+        if (imu)
+        {
+            Vector3d g = (wm + _eb * _ts) / _ts * R2D;
+            Vector3d a = (vm + _db * _ts) / _ts;
+            for (int i = 0; i < 3; i++)
+            {
+                g(i) += _arw * _rng.gauss() / _ts * R2D;
+                a(i) += _vrw * _rng.gauss() / _ts;
+            }
+            line.clear();
+            line.fix(t.sow() + t.dsec(), 12, 4)
+                .fix(g(0), 16, 9).fix(g(1), 16, 9).fix(g(2), 16, 9)
+                .fix(a(0), 15, 8).fix(a(1), 15, 8).fix(a(2), 15, 8)
+                .eol();
+            bimu += line.data();
+            if (bimu.size() > chunk)
+            {
+                imu->write(bimu.c_str(), bimu.size());
+                bimu.clear();
+            }
+        }
+        if (ref && _k % nref == 0)
+            _ref_line(t, bref);
+        if (_nepo > 0 && _k % _nepo == 0)
+            _epochs[_k / _nepo] = make_pair(t_gtriple(Geod2Cart(_pos, false)), t_gtriple(_eth.Cen * _vn));
+    }
+
+    if (imu && !bimu.empty())
+        imu->write(bimu.c_str(), bimu.size());
+    if (ref && !bref.empty())
+        ref->write(bref.c_str(), bref.size());
+}
+
+bool t_gsimtraj::state(const t_gtime &t, t_gtriple &xyz, t_gtriple &vel) const
+{
+    if (_nepo <= 0)
+        return false;
+
+    double intv = _nepo * _ts;
+    double dt = t.diff(_beg);
+    long long idx = (long long)floor(dt / intv + 0.5);
+    if (fabs(dt - idx * intv) > 1e-6)
+        return false;
+
+    auto it = _epochs.find(idx);
+    if (it == _epochs.end())
+        return false;
+    xyz = it->second.first;
+    vel = it->second.second;
+    return true;
+}
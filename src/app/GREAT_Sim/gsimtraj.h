@@ -0,0 +1,110 @@
+/**
+ * @file         gsimtraj.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        vehicle trajectory and IMU samples by inverting the strapdown mechanisation
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   profile        static for <static> s, speed ramp of 10 s, then S-turns
+ *                  yaw = yaw0 + 30 deg * sin(2 pi t / <turn>), level attitude,
+ *                  velocity along the body forward axis (right-forward-up)
+ *   IMU            for every sample the increments are solved from the
+ *                  t_gsins::Update equations (one sample, no coning/sculling
+ *                  terms), a forward mechanisation of the error-free samples
+ *                  reproduces the reference trajectory
+ *   sensor errors  constant bias (drawn once) + white noise
+ *   files          <name>_imu.txt  sow gx gy gz [deg/s] ax ay az [m/s^2]
+ *                  <name>_ref.txt  sow X Y Z VX VY VZ [ECEF] pitch roll yaw [deg], 1 Hz
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GSIMTRAJ_H
+#define GSIMTRAJ_H
+
+#include <map>
+#include <string>
+#include "gutils/gtime.h"
+#include "gutils/gtriple.h"
+#include "gio/giof.h"
+#include "gutils/grandom.h"
+#include "gins/gquat.h"
+#include "gins/gearth.h"
+#include <Eigen/Dense>
+
+using namespace std;
+using namespace gnut;
+using namespace great;
+
+/** @brief simulated vehicle with an IMU. */
+class t_gsimtraj
+{
+public:
+    /**
+    * @brief constructor
+    * @param[in] xyz0       start position, ECEF [m]
+    * @param[in] yaw0       start yaw [rad]
+    * @param[in] beg        start time
+    * @param[in] freq       IMU rate [Hz]
+    * @param[in] seed       random seed of the sensor errors
+    */
+    t_gsimtraj(const t_gtriple &xyz0, double yaw0, const t_gtime &beg, int freq, unsigned int seed);
+
+    /** @brief default destructor. */
+    virtual ~t_gsimtraj();
+
+    /** @brief profile: speed [m/s], static time [s], S-turn period [s]. */
+    void profile(double speed, double static_time, double turn_period);
+
+    /** @brief sensor errors: ARW [deg/sqrt(h)], VRW [m/s/sqrt(h)], bias sigma [deg/h], [mg]. */
+    void errors(double gyro_noise, double acce_noise, double gyro_bias, double acce_bias);
+
+    /**
+    * @brief propagate to end, write the samples
+    * @param[in] end        last sample
+    * @param[in] intv       GNSS sampling [s], states at these epochs are kept for state()
+    * @param[in] imu        IMU file, may be NULL
+    * @param[in] ref        reference trajectory file, may be NULL
+    */
+    void run(const t_gtime &end, double intv, t_giof *imu, t_giof *ref);
+
+    /**
+    * @brief state at a GNSS epoch of the last run
+    * @return false if t is not a kept epoch
+    */
+    bool state(const t_gtime &t, t_gtriple &xyz, t_gtriple &vel) const;
+
+protected:
+    /** @brief nominal speed [m/s] and yaw [rad] at t [s] since start. */
+    void _profile(double t, double &speed, double &yaw) const;
+
+    /** @brief line of the reference file. */
+    void _ref_line(const t_gtime &t, string &buf) const;
+
+    t_gtime _beg;               ///< start time
+    double _ts;                 ///< IMU interval [s]
+    long long _k;               ///< samples done
+    long long _nepo;            ///< samples per GNSS epoch
+    double _speed;              ///< cruise speed [m/s]
+    double _static;             ///< static time [s]
+    double _turn;               ///< S-turn period [s]
+    double _yaw0;               ///< start yaw [rad]
+
+    t_grandom _rng;             ///< sensor noise
+    double _arw;                ///< gyro noise per sample [rad]
+    double _vrw;                ///< accelerometer noise per sample [m/s]
+    Eigen::Vector3d _eb;        ///< gyro bias [rad/s]
+    Eigen::Vector3d _db;        ///< accelerometer bias [m/s^2]
+
+    t_gearth _eth;              ///< earth parameters, updated as in t_gsins
+    Eigen::Vector3d _pos;       ///< lat, lon [rad], h [m]
+    Eigen::Vector3d _vn;        ///< ENU velocity [m/s]
+    Eigen::Vector3d _an;        ///< ENU acceleration of the last sample [m/s^2]
+    t_gquat _qnb;               ///< attitude
+
+    map<long long, pair<t_gtriple, t_gtriple>> _epochs; ///< ECEF position/velocity at the GNSS epochs
+};
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * @file         gcheck.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        checks of the unit tests
+ * @version      1.0
+ * @date         2026-10-18
+ * @verbatim
+ *   Every test_*.cpp is one executable and one ctest case. A failed check is
+ *   printed with its file and line and counted, check_result() returns the
+ *   exit code (0 = all checks passed).
+ * @endverbatim
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GCHECK_H
+#define GCHECK_H
+
+#include <cmath>
+#include <random>
+#include <iostream>
+#include <Eigen/Dense>
+
+using namespace std;
+
+/** @brief number of failed checks. */
+static int check_nfail = 0;
+
+/** @brief condition is true. */
+#define CHECK(cond)                                                                     \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(cond))                                                                    \
+        {                                                                               \
+            cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond << endl;    \
+            check_nfail++;                                                              \
+        }                                                                               \
+    } while (0)
+
+/** @brief |a - b| <= tol. */
+#define CHECK_NEAR(a, b, tol)                                                           \
+    do                                                                                  \
+    {                                                                                   \
+        double check_a = (a), check_b = (b);                                            \
+        if (!(fabs(check_a - check_b) <= (tol)))                                        \
+        {                                                                               \
+            cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #a " = " << check_a \
+                 << ", " #b " = " << check_b << " (tol " << (tol) << ")" << endl;       \
+            check_nfail++;                                                              \
+        }                                                                               \
+    } while (0)
+
+/** @brief largest element difference of two matrices of the same size. */
+template <class A, class B>
+double check_maxdiff(const Eigen::MatrixBase<A> &a, const Eigen::MatrixBase<B> &b)
+{
+    if (a.rows() != b.rows() || a.cols() != b.cols())
+        return INFINITY;
+    return a.size() ? (a - b).cwiseAbs().maxCoeff() : 0.0;
+}
+
+/** @brief random symmetric positive definite matrix, condition controlled by the diagonal shift. */
+inline Eigen::MatrixXd check_spd(mt19937 &gen, int n, double shift = 0.1)
+{
+    normal_distribution<double> nd;
+    Eigen::MatrixXd B(n, n);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            B(i, j) = nd(gen);
+    return B * B.transpose() + shift * Eigen::MatrixXd::Identity(n, n);
+}
+
+/** @brief report and exit code of the test. */
+inline int check_result(const char *name)
+{
+    if (check_nfail)
+        cerr << name << ": " << check_nfail << " check(s) failed" << endl;
+    else
+        cout << name << ": passed" << endl;
+    return check_nfail ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/**
+ * @file         test_ambcmn.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        one view of the float solution across the stages of the ambiguity cascade
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gcheck.h"
+#include "gambfix/gambiguity.h"
+#include "gutils/gmatrixconv.h"
+
+using namespace great;
+
+int main()
+{
+    mt19937 gen(33);
+    const int npar = 12;
+    SymmetricMatrix Qx;
+    Eigen2Matrix(check_spd(gen, npar), Qx);
+    ColumnVector dx(npar);
+    for (int i = 1; i <= npar; i++)
+        dx(i) = 0.1 * i;
+
+    t_kalman flt;
+    flt.add_data(t_gallpar(), dx, Qx, 1.0, Qx);
+    t_gamb_cmn amb_cmn(t_gtime(), &flt);
+
+    // a view, not a copy
+    CHECK(&amb_cmn.Qx() == &flt.Qx());
+    CHECK(&amb_cmn.dx() == &flt.dx());
+    CHECK(&amb_cmn.param() == &flt.param());
+
+    // the fixing constraints of a stage are seen by the next one
+    flt.change_Qx(3, 2, 0.125);
+    flt.change_dx(4, -2.5);
+    CHECK(amb_cmn.Qx()(3, 2) == 0.125);
+    CHECK(amb_cmn.dx()(4) == -2.5);
+    ColumnVector stdx = amb_cmn.stdx();
+    CHECK(stdx.Nrows() == npar);
+    for (int i = 1; i <= npar; i++)
+        CHECK_NEAR(stdx(i), sqrt(flt.Qx()(i, i)), 1e-12);
+
+    // a new stage starts without the results of the previous one
+    amb_cmn.set_ratio(5.0);
+    amb_cmn.set_boot(0.99);
+    amb_cmn.amb_fixed(true);
+    amb_cmn.reset(AMB_MODE::WL);
+    CHECK(amb_cmn.amb_mode() == AMB_MODE::WL);
+    CHECK(amb_cmn.get_mode() == "WL");
+    CHECK(amb_cmn.get_ratio() == 0.0);
+    CHECK(amb_cmn.get_boot() == 0.0);
+    CHECK(!amb_cmn.amb_fixed());
+
+    for (AMB_MODE mode : {AMB_MODE::EWL, AMB_MODE::EWL24, AMB_MODE::EWL25, AMB_MODE::WL, AMB_MODE::NL})
+        CHECK(str2ambmode(ambmode2str(mode)) == mode);
+    CHECK(str2ambmode("unknown") == AMB_MODE::NL);
+    amb_cmn.set_mode("EWL24");
+    CHECK(amb_cmn.amb_mode() == AMB_MODE::EWL24 && amb_cmn.get_mode() == "EWL24");
+
+    return check_result("test_ambcmn");
+}
@@ -0,0 +1,232 @@
+/**
+ * @file         test_checkpoint.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        checkpoint save/restore round trip, rejected and interrupted checkpoints
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include "gcheck.h"
+#include "gutils/gcheckpoint.h"
+
+using namespace great;
+
+static const string ckp_file = "test_checkpoint.ckp";
+
+static bool exists(const string &file)
+{
+    ifstream f(file.c_str());
+    return f.good();
+}
+
+int main()
+{
+    remove(ckp_file.c_str());
+    remove((ckp_file + ".tmp").c_str());
+
+    // values of every supported type
+    t_gtime epoch(2024, 3, 15, 12, 30, 45, 0.25);
+    t_gtriple crd(-2267749.0, 5009154.3, 3221290.7);
+    t_gquat quat(0.5, 0.5, -0.5, 0.5);
+    Eigen::MatrixXd E = Eigen::MatrixXd::Random(3, 4);
+    Eigen::Vector3d v3(1.0, -2.0, 3.5);
+    Matrix M(2, 3);
+    SymmetricMatrix S(3);
+    ColumnVector C(4);
+    DiagonalMatrix D(2);
+    for (int i = 1; i <= 2; i++)
+        for (int j = 1; j <= 3; j++)
+            M(i, j) = 10 * i + j;
+    for (int i = 1; i <= 3; i++)
+        for (int j = 1; j <= i; j++)
+            S(i, j) = 0.1 * i + j;
+    for (int i = 1; i <= 4; i++)
+        C(i) = -1.5 * i;
+    D(1) = 2.0;
+    D(2) = 3.0;
+
+    t_gallpar pars;
+    for (int i = 0; i < 3; i++)
+    {
+        t_gpar par("WUH2", (par_type)((int)par_type::CRD_X + i), i + 1, "");
+        par.setTime(epoch, epoch + 3600.0);
+        par.value(crd[i]);
+        pars.addParam(par);
+    }
+    t_gpar clk("WUH2", par_type::CLK, 4, "");
+    clk.value(12.5);
+    clk.apriori(3.0e5);
+    pars.addParam(clk);
+
+    t_gobsgnss obs;
+    obs.site("WUH2");
+    obs.sat("G05");
+    obs.epo(epoch);
+    obs.channel(3);
+    obs.addele(0.75);
+    obs.addobs(C1C, 21345678.125);
+    obs.addobs(L1C, 112233445.5);
+    obs.addlli(L1C, 1);
+
+    map<string, pair<int, double>> slips = {{"G05", {1, 0.5}}, {"C20", {0, -2.0}}};
+    set<string> sats = {"G05", "E11", "C20"};
+    vector<double> series = {1.0, 2.0, 3.0};
+
+    {
+        t_gcheckpoint ckp;
+        CHECK(ckp.open_write(ckp_file, "test"));
+        ckp.section("values");
+        ckp.put(42);
+        ckp.put(true);
+        ckp.put(-7L);
+        ckp.put(0.1);
+        ckp.put(par_type::CLK);
+        ckp.put(string("filter state"));
+        ckp.put(epoch);
+        ckp.put(crd);
+        ckp.put(quat);
+        ckp.section("matrices");
+        ckp.put(M);
+        ckp.put(S);
+        ckp.put(C);
+        ckp.put(D);
+        ckp.put(E);
+        ckp.put(v3);
+        ckp.section("objects");
+        ckp.put(pars);
+        ckp.put(obs);
+        ckp.put(slips);
+        ckp.put(sats);
+        ckp.put(series);
+        CHECK(ckp.good());
+        // nothing replaces the checkpoint before close
+        CHECK(!exists(ckp_file));
+        CHECK(ckp.close());
+    }
+    CHECK(exists(ckp_file) && !exists(ckp_file + ".tmp"));
+
+    {
+        t_gcheckpoint ckp;
+        CHECK(ckp.open_read(ckp_file, "test"));
+        int i = 0;
+        bool b = false;
+        long l = 0;
+        double d = 0.0;
+        par_type type = par_type::CRD_X;
+        string str;
+        t_gtime epoch_r;
+        t_gtriple crd_r;
+        t_gquat quat_r;
+        ckp.section("values");
+        ckp.get(i);
+        ckp.get(b);
+        ckp.get(l);
+        ckp.get(d);
+        ckp.get(type);
+        ckp.get(str);
+        ckp.get(epoch_r);
+        ckp.get(crd_r);
+        ckp.get(quat_r);
+        CHECK(i == 42 && b && l == -7L && d == 0.1 && type == par_type::CLK && str == "filter state");
+        CHECK(epoch_r == epoch && epoch_r.dsec() == epoch.dsec());
+        CHECK(crd_r == crd);
+        CHECK(quat_r.q0 == quat.q0 && quat_r.q1 == quat.q1 && quat_r.q2 == quat.q2 && quat_r.q3 == quat.q3);
+
+        Matrix M_r;
+        SymmetricMatrix S_r;
+        ColumnVector C_r;
+        DiagonalMatrix D_r;
+        Eigen::MatrixXd E_r;
+        Eigen::Vector3d v3_r;
+        ckp.section("matrices");
+        ckp.get(M_r);
+        ckp.get(S_r);
+        ckp.get(C_r);
+        ckp.get(D_r);
+        ckp.get(E_r);
+        ckp.get(v3_r);
+        CHECK(M_r.Nrows() == 2 && M_r.Ncols() == 3 && (M_r - M).MaximumAbsoluteValue() == 0.0);
+        CHECK(S_r.Nrows() == 3 && (S_r - S).MaximumAbsoluteValue() == 0.0);
+        CHECK(C_r.Nrows() == 4 && (C_r - C).MaximumAbsoluteValue() == 0.0);
+        CHECK(D_r.Nrows() == 2 && (D_r - D).MaximumAbsoluteValue() == 0.0);
+        CHECK(check_maxdiff(E_r, E) == 0.0);
+        CHECK(check_maxdiff(v3_r, v3) == 0.0);
+
+        t_gallpar pars_r;
+        t_gobsgnss obs_r;
+        map<string, pair<int, double>> slips_r;
+        set<string> sats_r;
+        vector<double> series_r;
+        ckp.section("objects");
+        ckp.get(pars_r);
+        ckp.get(obs_r);
+        ckp.get(slips_r);
+        ckp.get(sats_r);
+        ckp.get(series_r);
+        CHECK(pars_r.parNumber() == pars.parNumber());
+        for (unsigned k = 0; k < pars.parNumber(); k++)
+        {
+            CHECK(pars_r.getPar(k) == pars.getPar(k));
+            CHECK(pars_r.getPar(k).value() == pars.getPar(k).value());
+            CHECK(pars_r.getPar(k).apriori() == pars.getPar(k).apriori());
+            CHECK(pars_r.getPar(k).index == pars.getPar(k).index);
+        }
+        CHECK(obs_r.site() == "WUH2" && obs_r.sat() == "G05" && obs_r.epoch() == epoch);
+        CHECK(obs_r.channel() == 3 && obs_r.getele() == 0.75);
+        CHECK(obs_r.getobs(C1C) == 21345678.125 && obs_r.getobs(L1C) == 112233445.5);
+        CHECK(obs_r.getlli(L1C) == 1);
+        CHECK(slips_r == slips && sats_r == sats && series_r == series);
+        CHECK(ckp.good());
+        CHECK(ckp.close());
+    }
+
+    // another kind, another section order: rejected instead of misread
+    {
+        t_gcheckpoint ckp;
+        CHECK(!ckp.open_read(ckp_file, "other"));
+    }
+    {
+        t_gcheckpoint ckp;
+        CHECK(ckp.open_read(ckp_file, "test"));
+        ckp.section("matrices");
+        CHECK(!ckp.good());
+        CHECK(!ckp.close());
+    }
+    {
+        t_gcheckpoint ckp;
+        CHECK(!ckp.open_read(ckp_file + ".missing", "test"));
+    }
+
+    // an interrupted or failed write leaves the previous checkpoint
+    {
+        t_gcheckpoint ckp;
+        CHECK(ckp.open_write(ckp_file, "test"));
+        ckp.section("values");
+        ckp.put(43);
+    }
+    {
+        t_gcheckpoint ckp;
+        CHECK(ckp.open_write(ckp_file, "test"));
+        ckp.section("values");
+        ckp.put(44);
+        ckp.fail();
+        CHECK(!ckp.close());
+    }
+    CHECK(!exists(ckp_file + ".tmp"));
+    {
+        t_gcheckpoint ckp;
+        int i = 0;
+        CHECK(ckp.open_read(ckp_file, "test"));
+        ckp.section("values");
+        ckp.get(i);
+        CHECK(i == 42 && ckp.good());
+        ckp.close();
+    }
+
+    remove(ckp_file.c_str());
+    return check_result("test_checkpoint");
+}
@@ -0,0 +1,75 @@
+/**
+ * @file         test_ddcov.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        DD covariance of the ambiguity resolution against D * Qx * D'
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gcheck.h"
+#include "gambfix/gambiguity.h"
+#include "gutils/gmatrixconv.h"
+
+using namespace great;
+
+/** @brief access to the covariance assembly. */
+class t_test_ambiguity : public t_gambiguity
+{
+public:
+    using t_gambiguity::_prepareCovariance;
+};
+
+int main()
+{
+    mt19937 gen(32);
+    uniform_int_distribution<int> pick;
+
+    for (int trial = 0; trial < 10; trial++)
+    {
+        // parameters: a few non-ambiguity ones first, as in the filter
+        const int npar = 20 + trial, nDD = 3 + trial;
+        Eigen::MatrixXd Qe = check_spd(gen, npar, 0.5);
+        SymmetricMatrix Qx;
+        Eigen2Matrix(Qe, Qx);
+        ColumnVector dx(npar);
+        dx = 0.0;
+
+        t_kalman flt;
+        flt.add_data(t_gallpar(), dx, Qx, 1.0, Qx);
+        t_gamb_cmn amb_cmn(t_gtime(), &flt);
+
+        // DDs over random pairs of ambiguities (1-based indices of Qx), shared satellites included
+        t_test_ambiguity amb;
+        Eigen::MatrixXd D = Eigen::MatrixXd::Zero(nDD, npar);
+        for (int k = 0; k < nDD; k++)
+        {
+            int i1 = 5 + pick(gen) % (npar - 5), i2 = i1;
+            while (i2 == i1)
+                i2 = 5 + pick(gen) % (npar - 5);
+            t_dd_ambiguity dd;
+            dd.ddSats.push_back(make_tuple("G01", i1 + 1, 0));
+            dd.ddSats.push_back(make_tuple("G02", i2 + 1, 0));
+            dd.factor = (k % 2) ? 1.0 : 0.5;
+            dd.rnl = 0.1 * k;
+            amb.getDD().push_back(dd);
+            D(k, i1) = 1.0 / dd.factor;
+            D(k, i2) = -1.0 / dd.factor;
+        }
+
+        SymmetricMatrix cov;
+        vector<double> value;
+        CHECK(amb._prepareCovariance(&amb_cmn, cov, value));
+        CHECK((int)value.size() == nDD);
+        for (int k = 0; k < (int)value.size(); k++)
+            CHECK(value[k] == 0.1 * k);
+
+        Eigen::MatrixXd cov_e, ref = D * Qe * D.transpose();
+        Matrix2Eigen(cov, cov_e);
+        CHECK(check_maxdiff(cov_e, ref) <= 1e-12 * ref.cwiseAbs().maxCoeff());
+    }
+
+    return check_result("test_ddcov");
+}
@@ -0,0 +1,140 @@
+/**
+ * @file         test_fbscombine.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        forward/backward combination of t_gpvtflt: covariance weighting and preference of the fixed solution
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <sstream>
+#include "gcheck.h"
+#include "gset/gcfg_ppp.h"
+#include "gall/gallproc.h"
+#include "gio/grtlog.h"
+#include "gproc/gpvtflt.h"
+
+using namespace great;
+
+// the combination of one epoch, without the passes
+class t_gpvtflt_fbs : public t_gpvtflt
+{
+public:
+    t_gpvtflt_fbs(t_gsetbase *set, t_spdlog spdlog, t_gallproc *data) : t_gspp("SITE", set, spdlog), t_gpvtflt("SITE", "", set, spdlog, data) {}
+
+    t_gfbsol combine(const t_gfbsol &fwd, const t_gfbsol &bwd) { return _fbs_combine(fwd, bwd); }
+};
+
+static t_gfbsol solution(mt19937 &gen, const t_gtime &t, const Eigen::Matrix3d &Q, bool fixed)
+{
+    uniform_real_distribution<double> ud(-0.5, 0.5);
+    t_gfbsol sol;
+    sol.epoch = t;
+    sol.xyz = t_gtriple(-2267750.0 + ud(gen), 5009154.0 + ud(gen), 3221290.0 + ud(gen));
+    sol.vel = t_gtriple(ud(gen), ud(gen), ud(gen));
+    sol.vrms = t_gtriple(0.01 + fabs(ud(gen)), 0.01 + fabs(ud(gen)), 0.01 + fabs(ud(gen)));
+    sol.Qxyz[0] = Q(0, 0);
+    sol.Qxyz[1] = Q(1, 1);
+    sol.Qxyz[2] = Q(2, 2);
+    sol.Qxyz[3] = Q(0, 1);
+    sol.Qxyz[4] = Q(0, 2);
+    sol.Qxyz[5] = Q(1, 2);
+    sol.fixed = fixed;
+    sol.ratio = fixed ? 3.0 + fabs(ud(gen)) : 0.0;
+    return sol;
+}
+
+static bool equal(const t_gfbsol &a, const t_gfbsol &b)
+{
+    bool eq = a.epoch == b.epoch && a.xyz == b.xyz && a.vel == b.vel && a.vrms == b.vrms && a.fixed == b.fixed && a.ratio == b.ratio;
+    for (int i = 0; i < 6; i++)
+        eq = eq && a.Qxyz[i] == b.Qxyz[i];
+    return eq;
+}
+
+int main()
+{
+    t_gcfg_ppp set;
+    {
+        istringstream is("<config> <gen> <sys> GPS </sys> <rec> SITE </rec> </gen> <gps> <band> 1 2 </band> </gps> <gal> <band> 1 5 </band> </gal>"
+                         " <bds> <band> 2 6 </band> </bds> <glo> <band> 1 2 </band> </glo> <qzs> <band> 1 2 </band> </qzs> </config>");
+        set.read_istream(is);
+    }
+    t_grtlog log("CONSOLE", spdlog::level::err, "test_fbscombine");
+    t_gallproc data;
+    t_gpvtflt_fbs pvt(&set, log.spdlog(), &data);
+
+    mt19937 gen(42);
+    const t_gtime t(2026, 10, 18, 0, 0, 0);
+    for (int k = 0; k < 200; k++)
+    {
+        Eigen::Matrix3d Qf = 1e-4 * check_spd(gen, 3), Qb = 1e-4 * check_spd(gen, 3);
+        t_gfbsol fwd = solution(gen, t, Qf, false), bwd = solution(gen, t, Qb, false);
+
+        // float + float: the information of both passes is added
+        t_gfbsol sol = pvt.combine(fwd, bwd);
+        Eigen::Matrix3d Wf = Qf.inverse(), Wb = Qb.inverse(), Q = (Wf + Wb).inverse();
+        Eigen::Vector3d xf(fwd.xyz[0], fwd.xyz[1], fwd.xyz[2]), xb(bwd.xyz[0], bwd.xyz[1], bwd.xyz[2]);
+        Eigen::Vector3d x = Q * (Wf * xf + Wb * xb);
+        for (int i = 0; i < 3; i++)
+            CHECK_NEAR(sol.xyz[i], x(i), 1e-6);
+        CHECK_NEAR(sol.Qxyz[0], Q(0, 0), 1e-12);
+        CHECK_NEAR(sol.Qxyz[1], Q(1, 1), 1e-12);
+        CHECK_NEAR(sol.Qxyz[2], Q(2, 2), 1e-12);
+        CHECK_NEAR(sol.Qxyz[3], Q(0, 1), 1e-12);
+        CHECK_NEAR(sol.Qxyz[4], Q(0, 2), 1e-12);
+        CHECK_NEAR(sol.Qxyz[5], Q(1, 2), 1e-12);
+        // never worse than either pass
+        CHECK(sol.Qxyz[0] <= min(Qf(0, 0), Qb(0, 0)) && sol.Qxyz[1] <= min(Qf(1, 1), Qb(1, 1)) && sol.Qxyz[2] <= min(Qf(2, 2), Qb(2, 2)));
+        for (int i = 0; i < 3; i++)
+        {
+            double wf = 1.0 / (fwd.vrms[i] * fwd.vrms[i]), wb = 1.0 / (bwd.vrms[i] * bwd.vrms[i]);
+            CHECK_NEAR(sol.vel[i], (wf * fwd.vel[i] + wb * bwd.vel[i]) / (wf + wb), 1e-12);
+            CHECK_NEAR(sol.vrms[i], 1.0 / sqrt(wf + wb), 1e-12);
+        }
+        CHECK(sol.epoch == t && !sol.fixed);
+
+        // the order of the passes does not matter
+        t_gfbsol rev = pvt.combine(bwd, fwd);
+        for (int i = 0; i < 3; i++)
+            CHECK_NEAR(rev.xyz[i], sol.xyz[i], 1e-6);
+
+        // a fixed solution is kept as it is, even if the float one is more precise
+        t_gfbsol fix = solution(gen, t, 1e2 * Qf, true);
+        CHECK(equal(pvt.combine(fix, bwd), fix));
+        CHECK(equal(pvt.combine(fwd, fix), fix));
+
+        // fixed + fixed: weighted as well, the larger ratio
+        t_gfbsol fix2 = solution(gen, t, Qb, true);
+        sol = pvt.combine(fix, fix2);
+        CHECK(sol.fixed && sol.ratio == max(fix.ratio, fix2.ratio));
+        CHECK(sol.Qxyz[0] < min(fix.Qxyz[0], fix2.Qxyz[0]));
+    }
+
+    // one pass without covariance: the other one
+    Eigen::Matrix3d Q = 1e-4 * Eigen::Matrix3d::Identity();
+    t_gfbsol fwd = solution(gen, t, Q, false), bwd = solution(gen, t, Q, false);
+    t_gfbsol none = bwd;
+    none.Qxyz[0] = -1.0;
+    CHECK(equal(pvt.combine(fwd, none), fwd));
+    CHECK(equal(pvt.combine(none, fwd), fwd));
+
+    // equal covariances: the mean
+    t_gfbsol sol = pvt.combine(fwd, bwd);
+    for (int i = 0; i < 3; i++)
+        CHECK_NEAR(sol.xyz[i], 0.5 * (fwd.xyz[i] + bwd.xyz[i]), 1e-6);
+    CHECK_NEAR(sol.Qxyz[0], 0.5e-4, 1e-15);
+
+    // a covariance not positive definite: the pass with the smaller trace
+    t_gfbsol npd = bwd;
+    npd.Qxyz[3] = 2e-4;
+    CHECK(equal(pvt.combine(fwd, npd), fwd));
+    t_gfbsol big = fwd;
+    big.Qxyz[0] = big.Qxyz[1] = big.Qxyz[2] = 1.0;
+    big.Qxyz[3] = 2.0;
+    CHECK(equal(pvt.combine(big, bwd), bwd));
+
+    return check_result("test_fbscombine");
+}
@@ -0,0 +1,117 @@
+/**
+ * @file         test_fltmatrix.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        filter equations: moving append against copying append, newmat export against a dense reference
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <vector>
+#include "gcheck.h"
+#include "gproc/gfltmatrix.h"
+
+using namespace great;
+
+// random sparse equations of one satellite
+static t_gfltEquationMatrix sat_equ(mt19937 &gen, const string &sat, int nequ, int npar)
+{
+    normal_distribution<double> nd;
+    uniform_int_distribution<int> pick(1, npar);
+    t_gfltEquationMatrix equ;
+    for (int k = 0; k < nequ; k++)
+    {
+        vector<pair<int, double>> B;
+        for (int j = 0; j < 4; j++)
+            B.push_back(make_pair(pick(gen), nd(gen)));
+        t_gobscombtype type(k % 2 ? TYPE_L : TYPE_C, BAND_1, OBSCOMBIN::IONO_FREE);
+        equ.add_equ(B, 1.0 + k, nd(gen), "SITE", sat, type, false);
+    }
+    return equ;
+}
+
+int main()
+{
+    mt19937 gen(39);
+    const int npar = 30;
+
+    for (int trial = 0; trial < 10; trial++)
+    {
+        t_gfltEquationMatrix copied, moved;
+        moved.reserve(40);
+        for (int s = 0; s < 8; s++)
+        {
+            string sat = "G" + to_string(10 + s);
+            t_gfltEquationMatrix one = sat_equ(gen, sat, 1 + (s + trial) % 4, npar);
+            copied.add_equ(one);
+            moved.add_equ(std::move(one));
+            CHECK(one.num_equ() == 0);
+            CHECK(one.B.empty() && one.P.empty() && one.l.empty());
+        }
+
+        // the same equations in the same order
+        CHECK(moved.num_equ() == copied.num_equ());
+        for (int i = 0; i < copied.num_equ(); i++)
+        {
+            CHECK(moved.B[i] == copied.B[i]);
+            CHECK(moved.P[i] == copied.P[i]);
+            CHECK(moved.l[i] == copied.l[i]);
+            CHECK(moved.get_satname(i) == copied.get_satname(i));
+            CHECK(moved.get_obscombtype(i) == copied.get_obscombtype(i));
+        }
+        CHECK(moved.res_equ() == copied.res_equ());
+
+        // newmat export against a dense reference, repeated coefficients of one row keep the last value
+        Matrix B;
+        SymmetricMatrix P;
+        ColumnVector l;
+        moved.chageNewMat(B, P, l, npar);
+        int nobs = moved.num_equ();
+        CHECK(B.Nrows() == nobs && B.Ncols() == npar);
+        CHECK(P.Nrows() == nobs && l.Nrows() == nobs);
+        for (int i = 0; i < nobs; i++)
+        {
+            vector<double> row(npar, 0.0);
+            for (const auto &item : moved.B[i])
+                row[item.first - 1] = item.second;
+            for (int j = 0; j < npar; j++)
+                CHECK(B(i + 1, j + 1) == row[j]);
+            for (int j = 0; j < nobs; j++)
+                CHECK(P(i + 1, j + 1) == (i == j ? moved.P[i] : 0.0));
+            CHECK(l(i + 1) == moved.l[i]);
+        }
+    }
+
+    // no equations
+    {
+        t_gfltEquationMatrix empty;
+        Matrix B;
+        SymmetricMatrix P;
+        ColumnVector l;
+        empty.chageNewMat(B, P, l, npar);
+        CHECK(B.Nrows() == 0 && P.Nrows() == 0 && l.Nrows() == 0);
+    }
+
+    // a parameter index out of range is reported
+    {
+        t_gfltEquationMatrix bad;
+        bad.add_equ(vector<pair<int, double>>(1, make_pair(npar + 1, 1.0)), 1.0, 0.0, "SITE", "G01", t_gobscombtype(), false);
+        Matrix B;
+        SymmetricMatrix P;
+        ColumnVector l;
+        bool thrown = false;
+        try
+        {
+            bad.chageNewMat(B, P, l, npar);
+        }
+        catch (...)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    return check_result("test_fltmatrix");
+}
@@ -0,0 +1,127 @@
+/**
+ * @file         test_fmtline.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        result line formatting against snprintf, binary records, asynchronous file writes
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <iomanip>
+#include <fstream>
+#include <vector>
+#include "gcheck.h"
+#include "gutils/gfmtline.h"
+#include "gio/giofasync.h"
+
+using namespace gnut;
+
+static string ref_fix(double v, int w, int p)
+{
+    char tmp[512];
+    snprintf(tmp, sizeof(tmp), "%*.*f", w, p, v);
+    return tmp;
+}
+
+int main()
+{
+    mt19937 gen(46);
+    uniform_real_distribution<double> mant(-10.0, 10.0);
+    uniform_int_distribution<int> expo(-8, 16), width(0, 20), prec(0, 14);
+
+    // fast path and the cases left to snprintf print the same
+    int nfail = 0;
+    for (int i = 0; i < 200000; i++)
+    {
+        double v = mant(gen) * pow(10.0, expo(gen));
+        int w = width(gen), p = prec(gen);
+        string out;
+        t_gfmtline::append_fix(out, v, w, p);
+        if (out != ref_fix(v, w, p) && nfail++ < 10)
+            cerr << "fix(" << ref_fix(v, 0, 17) << ", " << w << ", " << p << ") = \"" << out << "\" expected \"" << ref_fix(v, w, p) << "\"" << endl;
+    }
+    CHECK(nfail == 0);
+
+    // ties, signed zeros, values rounding up to the next power of ten, not finite values
+    vector<double> special = {0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, -0.0001, 0.0004999, 9.9995, 99.9999999,
+                              999999.5, 1e15, -1e15, 1e20, 1.0 / 3.0, 1e-300, INFINITY, -INFINITY, NAN};
+    for (double v : special)
+        for (int p = 0; p <= 13; p++)
+            for (int w : {0, 1, 8, 25})
+            {
+                string out;
+                t_gfmtline::append_fix(out, v, w, p);
+                CHECK(out == ref_fix(v, w, p));
+            }
+
+    // the line as the iostream output was written
+    t_gfmtline text, bin(true);
+    for (t_gfmtline *line : {&text, &bin})
+    {
+        line->lit("# epoch").str("site", 6).eol();
+        line->num(2024, 6).lit(" ").num(-17).num(123456789012LL, 4).str("WUH2", 8).str("", 3).fix(-2267749.123456, 16, 4).fix(0.0, 8, 3).eol();
+    }
+    ostringstream ref;
+    ref << "# epoch" << setw(6) << "site" << "\n"
+        << setw(6) << 2024 << " " << -17 << setw(4) << 123456789012LL << setw(8) << "WUH2" << setw(3) << ""
+        << fixed << setprecision(4) << setw(16) << -2267749.123456 << setprecision(3) << setw(8) << 0.0 << "\n";
+    CHECK(text.data() == ref.str());
+
+    // binary records print as the text output, also when files are appended
+    {
+        istringstream is(t_gfmtline::magic() + bin.data() + t_gfmtline::magic() + bin.data());
+        ostringstream os;
+        CHECK(t_gfmtline::to_text(is, os));
+        CHECK(os.str() == text.data() + text.data());
+    }
+    {
+        string damaged = t_gfmtline::magic() + bin.data();
+        damaged.resize(damaged.size() - 5);
+        istringstream is(damaged);
+        ostringstream os;
+        CHECK(!t_gfmtline::to_text(is, os));
+    }
+    {
+        string version = t_gfmtline::magic();
+        version.back() = FMTLINE_VERSION + 1;
+        istringstream is(version + bin.data());
+        ostringstream os;
+        CHECK(!t_gfmtline::to_text(is, os));
+    }
+    size_t cap = text.data().capacity();
+    text.clear();
+    CHECK(text.empty() && text.data().capacity() == cap);
+
+    // asynchronous writes: everything in order, in the file after sync and after the destructor
+    const string file = "test_fmtline.txt";
+    string all;
+    {
+        t_giofasync out(file, 1000);
+        for (int i = 0; i < 5000; i++)
+        {
+            t_gfmtline line;
+            line.num(i, 6).fix(i * 0.001, 12, 3).eol();
+            all += line.data();
+            CHECK(out.write(line.data().c_str(), line.size()) == (int)line.size());
+            if (i == 2500)
+            {
+                CHECK(out.sync() == 0);
+                ifstream in(file.c_str(), ios::binary);
+                string got((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+                CHECK(got == all);
+            }
+        }
+    }
+    {
+        ifstream in(file.c_str(), ios::binary);
+        string got((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        CHECK(got == all);
+    }
+    remove(file.c_str());
+
+    return check_result("test_fmtline");
+}
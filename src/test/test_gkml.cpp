@@ -0,0 +1,123 @@
+/**
+ * @file         test_gkml.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        streaming KML writer: placemark interval forward and backward, escaped name and CDATA descriptions
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <vector>
+#include <sstream>
+#include "gcheck.h"
+#include "gio/gkml.h"
+#include "pugixml/src/pugixml.hpp"
+
+using namespace gnut;
+using namespace pugi;
+
+// text of a node, its CDATA sections joined
+static string text(const xml_node &node)
+{
+    string s;
+    for (xml_node n = node.first_child(); n; n = n.next_sibling())
+        s += n.value();
+    return s;
+}
+
+// document of the file, the placemarks of the epochs and the points of the line
+static bool read(const string &path, xml_document &doc, vector<xml_node> &pts, int &nline)
+{
+    pts.clear();
+    nline = 0;
+    if (!doc.load_file(path.c_str(), parse_default | parse_cdata))
+        return false;
+    for (xml_node pm : doc.child("kml").child("Document").children("Placemark"))
+    {
+        if (pm.child("Point"))
+            pts.push_back(pm);
+        else
+        {
+            istringstream is(text(pm.child("LineString").child("coordinates")));
+            string crd;
+            while (is >> crd)
+                nline++;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    const string path = "test_gkml.kml";
+    const t_gtime beg(2026, 10, 18, 0, 0, 0);
+    const int nepo = 100;
+    xml_document doc;
+    vector<xml_node> pts;
+    int nline = 0;
+
+    // one epoch per second, written every 5 s, forward and backward
+    for (int dir : {1, -1})
+    {
+        {
+            t_gkml kml(path, "WUH2", 5.0);
+            int nadd = 0;
+            for (int k = 0; k < nepo; k++)
+            {
+                t_gtime t = beg;
+                t.add_dsec(dir > 0 ? k : nepo - 1 - k);
+                if (kml.placemark(t, 114.357 + 1e-5 * k, 30.531, "1", "epoch"))
+                    nadd++;
+            }
+            CHECK(nadd == nepo / 5);
+            CHECK(kml.size() == nepo / 5);
+        }
+        CHECK(read(path, doc, pts, nline));
+        CHECK(pts.size() == static_cast<size_t>(nepo / 5));
+        CHECK(nline == nepo / 5);
+        long sow = beg.sow() + (dir > 0 ? 0 : nepo - 1);
+        bool step = true;
+        for (size_t i = 0; i < pts.size(); i++)
+            step = step && pts[i].child("time").text().as_llong() == sow + dir * 5 * static_cast<long>(i);
+        CHECK(step);
+        CHECK(string(pts[0].child("styleUrl").text().get()) == "#P1");
+    }
+
+    // all epochs without an interval
+    {
+        t_gkml kml(path, "WUH2");
+        for (int k = 0; k < nepo; k++)
+        {
+            t_gtime t = beg;
+            t.add_dsec(0.1 * k);
+            kml.placemark(t, 114.357, 30.531, "2", "");
+        }
+    }
+    CHECK(read(path, doc, pts, nline));
+    CHECK(pts.size() == static_cast<size_t>(nepo) && nline == nepo);
+
+    // markup of the description kept as it is, "]]>" split over two sections, the name escaped
+    const string desc = "<b>a & b</b><br/> x]]>y ]]]]> <![CDATA[z]]>";
+    {
+        t_gkml kml(path, "A<B>&C");
+        kml.placemark(beg, 114.357, 30.531, "6", desc);
+    }
+    CHECK(read(path, doc, pts, nline));
+    CHECK(pts.size() == 1);
+    CHECK(text(pts[0].child("description")) == desc);
+    CHECK(string(doc.child("kml").child("Document").child("name").text().get()) == "A<B>&C");
+    CHECK(doc.child("kml").child("Document").find_child_by_attribute("Style", "id", "P6"));
+
+    // no epoch: an empty but complete document
+    {
+        t_gkml kml(path, "WUH2");
+    }
+    CHECK(read(path, doc, pts, nline));
+    CHECK(pts.empty() && nline == 0);
+    remove(path.c_str());
+
+    return check_result("test_gkml");
+}
@@ -0,0 +1,94 @@
+/**
+ * @file         test_gmutex.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        lock semantics of t_gmutex: owner re-lock, foreign unlock, waiting threads
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "gcheck.h"
+#include "gutils/gmutex.h"
+
+using namespace gnut;
+
+int main()
+{
+    // lock() by the owner is ignored, one unlock() releases
+    {
+        t_gmutex m;
+        m.lock();
+        m.lock();
+        CHECK(m.isLock);
+        m.unlock();
+        CHECK(!m.isLock);
+        m.unlock();
+        CHECK(!m.isLock);
+    }
+
+    // unlock() by another thread is ignored, lock() by another thread waits for the owner
+    {
+        t_gmutex m;
+        atomic<bool> got(false);
+        m.lock();
+        thread other([&]() {
+            m.unlock();
+            m.lock();
+            got = true;
+            m.unlock();
+        });
+        this_thread::sleep_for(chrono::milliseconds(100));
+        CHECK(!got);
+        CHECK(m.isLock);
+        m.unlock();
+        other.join();
+        CHECK(got);
+        CHECK(!m.isLock);
+    }
+
+    // mutual exclusion of the interpolation buffers on the pool workers
+    {
+        t_gmutex m;
+        long counter = 0;
+        vector<thread> workers;
+        for (int t = 0; t < 4; t++)
+            workers.push_back(thread([&]() {
+                for (int k = 0; k < 20000; k++)
+                {
+                    m.lock();
+                    long c = counter;
+                    this_thread::yield();
+                    counter = c + 1;
+                    m.unlock();
+                }
+            }));
+        for (auto &w : workers)
+            w.join();
+        CHECK(counter == 4 * 20000);
+    }
+
+    // a copy is a new unlocked mutex
+    {
+        t_gmutex m;
+        m.lock();
+        t_gmutex c(m);
+        CHECK(!c.isLock);
+        atomic<bool> got(false);
+        thread other([&]() {
+            c.lock();
+            got = true;
+            c.unlock();
+        });
+        other.join();
+        CHECK(got);
+        m.unlock();
+    }
+
+    return check_result("test_gmutex");
+}
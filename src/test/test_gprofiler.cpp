@@ -0,0 +1,108 @@
+/**
+ * @file         test_gprofiler.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        profiler report with the satellite pool: worker timers counted for the site of the caller
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <map>
+#include <sstream>
+#include <chrono>
+#include <cctype>
+#include "gcheck.h"
+#include "gutils/gprofiler.h"
+#include "gutils/gthreadpool.h"
+
+using namespace gnut;
+using namespace great;
+
+// calls per site and stage of the report
+static map<pair<string, string>, long> calls(const string &report)
+{
+    map<pair<string, string>, long> res;
+    istringstream is(report);
+    string line;
+    while (getline(is, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+        istringstream ls(line);
+        string site, stage;
+        long n = 0;
+        if (ls >> site >> stage >> n && isalpha(stage[0]))
+            res[make_pair(site, stage)] = n;
+    }
+    return res;
+}
+
+// some work to time
+static void spin(int us)
+{
+    auto end = chrono::steady_clock::now() + chrono::microseconds(us);
+    while (chrono::steady_clock::now() < end)
+        ;
+}
+
+int main()
+{
+    t_gthreadpool pool(4);
+    const int nsat = 40, nepo = 3;
+
+    // as t_gpvtflt::_cmp_equ: the caller's site is passed into each task
+    t_gprofiler::enable(true);
+    for (const string site : {"WUH2", "JFNG"})
+    {
+        t_gprofiler::site(site);
+        for (int epo = 0; epo < nepo; epo++)
+        {
+            GPROF_SCOPE(PROF_EPOCH);
+            GPROF_SCOPE(PROF_EQUATION);
+            pool.parallel_for(nsat, [&](int i) {
+                t_gprofiler::site(site);
+                GPROF_SCOPE(PROF_MODEL);
+                spin(50);
+            });
+        }
+    }
+
+    ostringstream os;
+    t_gprofiler::report(os);
+    map<pair<string, string>, long> n = calls(os.str());
+    for (const string site : {"WUH2", "JFNG"})
+    {
+        CHECK(n[make_pair(site, "EPOCH")] == nepo);
+        CHECK(n[make_pair(site, "EQUATION")] == nepo);
+        CHECK(n[make_pair(site, "MODEL")] == nepo * nsat);
+    }
+    // nothing of the workers without a site
+    CHECK(n.count(make_pair(string("-"), string("MODEL"))) == 0);
+
+    // a worker task without the site: its timers land in the no-site block
+    t_gprofiler::reset();
+    pool.parallel_for(nsat, [&](int i) {
+        t_gprofiler::site("");
+        GPROF_SCOPE(PROF_MODEL);
+    });
+    ostringstream os2;
+    t_gprofiler::report(os2);
+    n = calls(os2.str());
+    CHECK(n[make_pair(string("-"), string("MODEL"))] == nsat);
+    CHECK(n.count(make_pair(string("WUH2"), string("MODEL"))) == 0);
+
+    // disabled: nothing collected
+    t_gprofiler::reset();
+    t_gprofiler::enable(false);
+    pool.parallel_for(nsat, [&](int i) {
+        t_gprofiler::site("WUH2");
+        GPROF_SCOPE(PROF_MODEL);
+    });
+    ostringstream os3;
+    t_gprofiler::report(os3);
+    CHECK(calls(os3.str()).empty());
+
+    return check_result("test_gprofiler");
+}
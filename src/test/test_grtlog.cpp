@@ -0,0 +1,92 @@
+/**
+ * @file         test_grtlog.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        asynchronous logger: creation, level checked before formatting, flush on errors and at the end
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include "gcheck.h"
+#include "gio/grtlog.h"
+#include "spdlog/async_logger.h"
+#include "gutils/gtime.h"
+
+using namespace gnut;
+
+static int nformat = 0;
+
+// argument of a message, counts its evaluations
+static string epoch_str(const t_gtime &t)
+{
+    nformat++;
+    return t.str_ymdhms();
+}
+
+// lines of the file and whether one of them contains str
+static int lines(const string &path, const string &str, bool &found)
+{
+    ifstream f(path.c_str());
+    string line;
+    int n = 0;
+    found = false;
+    while (getline(f, line))
+    {
+        n++;
+        found = found || line.find(str) != string::npos;
+    }
+    return n;
+}
+
+int main()
+{
+    const string path = "test_grtlog_async.log";
+    const t_gtime t(2026, 10, 18, 0, 0, 0);
+    const int nmsg = 5000;
+    bool found = false;
+    {
+        t_grtlog log("BASIC", spdlog::level::info, path, true);
+        t_spdlog spdlog = log.spdlog();
+        CHECK(spdlog != nullptr);
+        CHECK(dynamic_pointer_cast<spdlog::async_logger>(spdlog) != nullptr);
+        CHECK(log.name() == path);
+
+        // below the level: the arguments are not evaluated
+        for (int i = 0; i < nmsg; i++)
+            GLOGGER_DEBUG(spdlog, "epoch {} sat G{:02d}", epoch_str(t), i % 32 + 1);
+        CHECK(nformat == 0);
+        for (int i = 0; i < nmsg; i++)
+            GLOGGER_INFO(spdlog, "epoch {} sat G{:02d}", epoch_str(t), i % 32 + 1);
+        CHECK(nformat == nmsg);
+
+        // an error is flushed by the worker without waiting for the end
+        GLOGGER_WARN(spdlog, "{} last message before the error", nmsg);
+        SPDLOG_LOGGER_ERROR(spdlog, "error at epoch {}", t.str_ymdhms());
+        for (int k = 0; k < 5000 && !found; k++)
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+            lines(path, "error at epoch " + t.str_ymdhms(), found);
+        }
+        CHECK(found);
+
+        // not checked when there is no logger
+        t_spdlog none;
+        GLOGGER_INFO(none, "epoch {}", epoch_str(t));
+        CHECK(nformat == nmsg);
+    }
+
+    // the queue is written completely when the logs end
+    spdlog::shutdown();
+    int n = lines(path, "epoch " + t.str_ymdhms() + " sat G32", found);
+    CHECK(found);
+    CHECK(n == nmsg + 2);
+    remove(path.c_str());
+
+    return check_result("test_grtlog");
+}
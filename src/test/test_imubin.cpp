@@ -0,0 +1,174 @@
+/**
+ * @file         test_imubin.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        binary imu file round trip, imu and odometer data streamed from a producer thread
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include "gcheck.h"
+#include "gcoders/imubin.h"
+#include "gdata/gododata.h"
+
+using namespace great;
+
+static const string file = "test_imubin.bin";
+static const double TS = 0.01, SOW0 = 345600.0;
+
+static double tt(int i) { return SOW0 + i * TS; }
+static Eigen::Vector3d wm(int i) { return Eigen::Vector3d(1e-4 * sin(0.01 * i), -2e-5 * i, 3e-6); }
+static Eigen::Vector3d vm(int i) { return Eigen::Vector3d(0.01, 1e-3 * cos(0.02 * i), -0.098 + 1e-7 * i); }
+
+static string read_file(const string &name)
+{
+    ifstream f(name.c_str(), ios::binary);
+    return string((istreambuf_iterator<char>(f)), istreambuf_iterator<char>());
+}
+
+static void write_file(const string &name, const string &data)
+{
+    ofstream f(name.c_str(), ios::out | ios::binary | ios::trunc);
+    f << data;
+}
+
+int main()
+{
+    const int n = 3000;
+
+    // samples preloaded, written to the binary file
+    {
+        t_gimudata imu;
+        imu.set_ts(TS);
+        for (int i = 0; i < n; i++)
+            CHECK(imu.add_IMU(tt(i), wm(i), vm(i)) == 0);
+        CHECK(t_imubin::write(file, &imu) == n);
+        CHECK(imu.size() == 0);
+    }
+
+    t_imubin bin;
+    CHECK(bin.open("file://" + file));
+    CHECK(bin.is_open() && bin.size() == (size_t)n && bin.ts() == TS);
+    if (bin.size() == (size_t)n)
+    {
+        bool same = true;
+        for (int i = 0; i < n; i++)
+        {
+            const t_imubin_rec &rec = bin.data()[i];
+            same = same && rec.t == tt(i);
+            for (int j = 0; j < 3; j++)
+                same = same && rec.wm[j] == wm(i)(j) && rec.vm[j] == vm(i)(j);
+        }
+        CHECK(same);
+    }
+    CHECK(bin.lower_bound(tt(1000) - 0.001) == 1000);
+    CHECK(bin.lower_bound(tt(1000)) == 1000);
+    CHECK(bin.lower_bound(0.0) == 0 && bin.lower_bound(tt(n)) == (size_t)n);
+
+    // streamed: the producer maps the file and parses ahead at most the capacity,
+    // the consumer gets every sample from the start to the first one after the end, in order
+    {
+        const int cap = 50, first = 100, last = 2000;
+        t_gimudata imu;
+        imu.streaming(cap);
+        long nread = -2;
+        thread producer([&]() {
+            nread = bin.read(&imu, tt(first), tt(last));
+            imu.finish();
+        });
+
+        vector<Eigen::Vector3d> w, v;
+        double t = 0.0, ts = 0.0;
+        int k = first, maxsize = 0;
+        bool same = true;
+        while (imu.load(w, v, t, ts, 2))
+        {
+            maxsize = max(maxsize, imu.size());
+            for (int j = 0; j < 2; j++, k++)
+                same = same && w[j] == wm(k) && v[j] == vm(k);
+            same = same && t == tt(k - 1);
+        }
+        producer.join();
+        CHECK(same);
+        CHECK(nread == last + 2 - first);
+        CHECK(k == last + 2);
+        CHECK(maxsize <= cap);
+        CHECK(imu.ts() == TS);
+    }
+
+    // the consumer stops early: the producer is released instead of waiting for free space
+    {
+        t_gimudata imu;
+        imu.streaming(10);
+        long nread = -2;
+        thread producer([&]() {
+            nread = bin.read(&imu, 0.0, tt(n));
+            imu.finish();
+        });
+        vector<Eigen::Vector3d> w, v;
+        double t = 0.0, ts = 0.0;
+        for (int i = 0; i < 5; i++)
+            CHECK(imu.load(w, v, t, ts, 1));
+        imu.abort();
+        producer.join();
+        CHECK(nread >= 5 && nread < n);
+    }
+
+    // damaged files are not mapped
+    {
+        string data = read_file(file);
+        const string bad = "test_imubin_bad.bin";
+        write_file(bad, data.substr(0, data.size() - 10));
+        t_imubin b;
+        CHECK(!b.open(bad));
+        CHECK(!b.is_open() && b.size() == 0);
+        string magic = data;
+        magic[0] = 'X';
+        write_file(bad, magic);
+        CHECK(!b.open(bad));
+        write_file(bad, data.substr(0, 10));
+        CHECK(!b.open(bad));
+        remove(bad.c_str());
+        CHECK(!b.open(bad));
+
+        t_gimudata imu;
+        CHECK(b.read(&imu, 0.0, tt(n)) == -1);
+    }
+
+    bin.close();
+    CHECK(!bin.is_open());
+    remove(file.c_str());
+
+    // odometer: at most the capacity buffered ahead, every epoch found
+    {
+        const int cap = 8, nodo = 200;
+        t_gododata odo;
+        odo.streaming(cap);
+        thread producer([&]() {
+            for (int i = 0; i < nodo; i++)
+                odo.add_odo(SOW0 + 0.5 * i, 10.0 + 0.01 * i);
+            odo.finish();
+        });
+        t_gtime t0(t_gtime::GPS);
+        t0.from_gws(2300, SOW0);
+        bool found = true, bounded = true;
+        for (int k = 0; k < nodo / 2; k++)
+        {
+            t_gtime crt = t0 + (double)k;
+            double val = 0.0;
+            found = found && odo.avaliable(crt, 0.01) && odo.load(crt, val, 0.01) && val == 10.0 + 0.01 * (2 * k);
+            bounded = bounded && odo.end_obs() - odo.beg_obs() <= 0.5 * cap;
+        }
+        producer.join();
+        CHECK(found);
+        CHECK(bounded);
+    }
+
+    return check_result("test_imubin");
+}
@@ -0,0 +1,152 @@
+/**
+ * @file         test_kalman_eigen.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Eigen Kalman update kernel against the newmat Kalman filter, packed conversions
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gcheck.h"
+#include "gproc/gflt.h"
+#include "gutils/gmatrixconv.h"
+
+using namespace gnut;
+
+static Matrix to_newmat(const Eigen::MatrixXd &E)
+{
+    Matrix M(E.rows(), E.cols());
+    for (int i = 0; i < E.rows(); i++)
+        for (int j = 0; j < E.cols(); j++)
+            M(i + 1, j + 1) = E(i, j);
+    return M;
+}
+
+int main()
+{
+    mt19937 gen(36);
+    normal_distribution<double> nd;
+
+    // packed newmat <-> Eigen conversions
+    {
+        Eigen::MatrixXd E = check_spd(gen, 7), Eb;
+        SymmetricMatrix S;
+        Eigen2Matrix(E, S);
+        Matrix2Eigen(S, Eb);
+        CHECK(check_maxdiff(E, Eb) == 0.0);
+
+        Eigen::MatrixXd M = Eigen::MatrixXd::Random(4, 6), Mb;
+        Matrix2Eigen(to_newmat(M), Mb);
+        CHECK(check_maxdiff(M, Mb) == 0.0);
+
+        Eigen::VectorXd v = Eigen::VectorXd::Random(5), vb;
+        ColumnVector c;
+        Eigen2Vector(v, c);
+        Vector2Eigen(c, vb);
+        CHECK(check_maxdiff(v, vb) == 0.0);
+    }
+
+    for (int trial = 0; trial < 20; trial++)
+    {
+        const int n = 4 + trial, m = 2 + trial % 7;
+        Eigen::MatrixXd Qe = check_spd(gen, n), Ae(m, n), Re = check_spd(gen, m, 0.5);
+        Eigen::VectorXd le(m);
+        for (int i = 0; i < m; i++)
+        {
+            le(i) = nd(gen);
+            for (int j = 0; j < n; j++)
+                Ae(i, j) = nd(gen);
+        }
+        Matrix A = to_newmat(Ae);
+        ColumnVector l;
+        Eigen2Vector(le, l);
+        SymmetricMatrix Q0;
+        Eigen2Matrix(Qe, Q0);
+
+        // textbook reference with explicit inverses, for the full weight matrix below
+        Eigen::MatrixXd Sref = Ae * Qe * Ae.transpose() + Re;
+        Eigen::MatrixXd Kref = Qe * Ae.transpose() * Sref.inverse();
+        Eigen::VectorXd dx_ref = Kref * le;
+        Eigen::MatrixXd Q_ref = Qe - Kref * Ae * Qe;
+
+        // diagonal weights
+        DiagonalMatrix Pd(m);
+        for (int i = 1; i <= m; i++)
+            Pd(i) = 1.0 / Re(i - 1, i - 1);
+        SymmetricMatrix Qk = Q0, Qe_ = Q0;
+        ColumnVector dxk, dxe;
+        t_kalman kalman;
+        t_kalman_eigen keigen;
+        CHECK(kalman.update(A, Pd, l, dxk, Qk) == 1);
+        CHECK(keigen.update(A, Pd, l, dxe, Qe_) == 1);
+        Eigen::MatrixXd Qk_e, Qe_e;
+        Eigen::VectorXd dxk_e, dxe_e;
+        Matrix2Eigen(Qk, Qk_e);
+        Matrix2Eigen(Qe_, Qe_e);
+        Vector2Eigen(dxk, dxk_e);
+        Vector2Eigen(dxe, dxe_e);
+        CHECK(check_maxdiff(dxk_e, dxe_e) <= 1e-9 * max(1.0, dxk_e.cwiseAbs().maxCoeff()));
+        CHECK(check_maxdiff(Qk_e, Qe_e) <= 1e-9 * Qk_e.cwiseAbs().maxCoeff());
+
+        // full weight matrix
+        SymmetricMatrix Ps;
+        Eigen2Matrix(Eigen::MatrixXd(Re.inverse()), Ps);
+        Qk = Q0;
+        Qe_ = Q0;
+        CHECK(kalman.update(A, Ps, l, dxk, Qk) == 1);
+        CHECK(keigen.update(A, Ps, l, dxe, Qe_) == 1);
+        Matrix2Eigen(Qk, Qk_e);
+        Matrix2Eigen(Qe_, Qe_e);
+        Vector2Eigen(dxk, dxk_e);
+        Vector2Eigen(dxe, dxe_e);
+        CHECK(check_maxdiff(dxk_e, dxe_e) <= 1e-9 * max(1.0, dxk_e.cwiseAbs().maxCoeff()));
+        CHECK(check_maxdiff(Qk_e, Qe_e) <= 1e-9 * Qk_e.cwiseAbs().maxCoeff());
+        CHECK(check_maxdiff(dxk_e, dx_ref) <= 1e-8 * max(1.0, dx_ref.cwiseAbs().maxCoeff()));
+        CHECK(check_maxdiff(Qk_e, Q_ref) <= 1e-8 * Q_ref.cwiseAbs().maxCoeff());
+
+        // Eigen interface in place, the covariance of observations given directly
+        Eigen::VectorXd dx;
+        Eigen::MatrixXd Q = Qe;
+        CHECK(t_kalman_eigen::update_eigen(Ae, Re, le, dx, Q));
+        CHECK(check_maxdiff(dx, dxk_e) <= 1e-9 * max(1.0, dxk_e.cwiseAbs().maxCoeff()));
+        CHECK(check_maxdiff(Q, Qk_e) <= 1e-9 * Qk_e.cwiseAbs().maxCoeff());
+        CHECK(check_maxdiff(Q, Q.transpose()) == 0.0);
+    }
+
+    // not positive definite: reported, dx and Q unchanged
+    {
+        Matrix A(2, 2);
+        A = 0.0;
+        A(1, 1) = A(2, 2) = 1.0;
+        ColumnVector l(2), dx(2);
+        l = 1.0;
+        dx = 0.0;
+        SymmetricMatrix Q(2), Q0;
+        Q = 0.0;
+        Q(1, 1) = Q(2, 2) = 1.0;
+        Q0 = Q;
+        DiagonalMatrix Pd(2);
+        Pd = -0.1;
+        SymmetricMatrix Ps(2);
+        Ps = 0.0;
+        Ps(1, 1) = 1.0;
+        Ps(2, 2) = -1.0;
+        t_kalman kalman;
+        CHECK(kalman.update(A, Pd, l, dx, Q) == -1);
+        CHECK(kalman.update(A, Ps, l, dx, Q) == -1);
+        CHECK(dx(1) == 0.0 && dx(2) == 0.0 && Q(1, 1) == Q0(1, 1) && Q(1, 2) == Q0(1, 2) && Q(2, 2) == Q0(2, 2));
+    }
+
+    // innovation covariance not positive definite: Q unchanged
+    {
+        Eigen::MatrixXd A = Eigen::MatrixXd::Identity(2, 2), R = -Eigen::MatrixXd::Identity(2, 2) * 10.0;
+        Eigen::MatrixXd Q = Eigen::MatrixXd::Identity(2, 2), Q0 = Q;
+        Eigen::VectorXd l = Eigen::VectorXd::Ones(2), dx;
+        CHECK(!t_kalman_eigen::update_eigen(A, R, l, dx, Q));
+        CHECK(check_maxdiff(Q, Q0) == 0.0);
+    }
+
+    return check_result("test_kalman_eigen");
+}
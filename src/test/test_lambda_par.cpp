@@ -0,0 +1,119 @@
+/**
+ * @file         test_lambda_par.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        partial ambiguity fixing: subsets of one factorisation against a new LAMBDA/MLAMBDA of the subset
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <vector>
+#include "gcheck.h"
+#include "gambfix/glambda.h"
+#include "gambfix/gmlambda.h"
+
+using namespace great;
+
+// trailing block of Q (full, row by row) and of a, the subset of PARsearch(ndrop)
+static void subset(const Eigen::MatrixXd &Q, const Eigen::VectorXd &a, int ndrop, vector<double> &Qs, vector<double> &as)
+{
+    int n = Q.rows() - ndrop;
+    Qs.resize(n * n);
+    as.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        as[i] = a(ndrop + i);
+        for (int j = 0; j < n; j++)
+            Qs[i * n + j] = Q(ndrop + i, ndrop + j);
+    }
+}
+
+int main()
+{
+    const int maxcan = 2;
+    mt19937 gen(31);
+    normal_distribution<double> nd;
+
+    for (int trial = 0; trial < 20; trial++)
+    {
+        const int n = 6 + trial % 5;
+        Eigen::MatrixXd Q = check_spd(gen, n, 0.2) * 0.02;
+        Eigen::VectorXd a(n);
+        for (int i = 0; i < n; i++)
+            a(i) = 0.6 * nd(gen);
+
+        vector<double> Qall(Q.data(), Q.data() + n * n);
+        t_glambda lambda;
+        t_gmlambda mlambda(maxcan);
+        CHECK(lambda.PARinit(n, Qall.data()) == 0);
+        CHECK(mlambda.factorize(n, Qall.data()) == 0);
+
+        for (int ndrop = 0; ndrop <= n - 2; ndrop++)
+        {
+            int m = n - ndrop;
+            vector<double> Qs, as;
+            subset(Q, a, ndrop, Qs, as);
+
+            // LAMBDA: PARsearch on the trailing block against a new LAMBDA4 of the subset
+            int ncan = 0, ipos = 0;
+            double boot_par = 0.0, boot_new = 0.0;
+            vector<double> a_par(as), a_new(as), Qnew(Qs);
+            vector<double> c_par(m * maxcan, 0.0), c_new(m * maxcan, 0.0), s_par(maxcan, 0.0), s_new(maxcan, 0.0);
+            try
+            {
+                lambda.PARsearch(ndrop, maxcan, a_par.data(), &ncan, &ipos, c_par.data(), s_par.data(), &boot_par);
+                t_glambda fresh;
+                fresh.LAMBDA4(maxcan, m, Qnew.data(), a_new.data(), &ncan, &ipos, c_new.data(), s_new.data(), &boot_new);
+            }
+            catch (...)
+            {
+                CHECK(!"LAMBDA failed");
+                continue;
+            }
+            for (int i = 0; i < m; i++)
+                CHECK(c_par[i * maxcan] == c_new[i * maxcan]);
+            for (int k = 0; k < maxcan; k++)
+                CHECK_NEAR(s_par[k], s_new[k], 1e-8 * max(1.0, s_new[k]));
+
+            // MLAMBDA: search(ndrop) against solve() of the subset
+            vector<double> f_par(m * maxcan, 0.0), f_new(m * maxcan, 0.0), S_par(maxcan, 0.0), S_new(maxcan, 0.0);
+            t_gmlambda fresh(maxcan);
+            CHECK(mlambda.search(ndrop, as.data(), f_par.data(), S_par.data()) == 0);
+            CHECK(fresh.solve(m, Qs.data(), as.data(), f_new.data(), S_new.data()) == 0);
+            for (int i = 0; i < m; i++)
+                CHECK(f_par[i * maxcan] == f_new[i * maxcan]);
+            for (int k = 0; k < maxcan; k++)
+                CHECK_NEAR(S_par[k], S_new[k], 1e-8 * max(1.0, S_new[k]));
+
+            // both methods find the same best candidate and norms, LAMBDA rounded, relative to the truncated float values
+            for (int i = 0; i < m; i++)
+                CHECK(f_par[i * maxcan] == round(c_par[i * maxcan + ipos - 1]) + trunc(as[i]));
+            CHECK_NEAR(S_par[0], s_par[0], 1e-8 * max(1.0, s_par[0]));
+        }
+    }
+
+    // a subset needs the factorisation
+    {
+        t_glambda lambda;
+        int ncan = 0, ipos = 0;
+        double a[2] = {0.1, 0.2}, c[4], s[2], boot = 0.0;
+        bool thrown = false;
+        try
+        {
+            lambda.PARsearch(0, maxcan, a, &ncan, &ipos, c, s, &boot);
+        }
+        catch (...)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+
+        t_gmlambda mlambda(maxcan);
+        double f[4], S[2];
+        CHECK(mlambda.search(0, a, f, S) < 0);
+    }
+
+    return check_result("test_lambda_par");
+}
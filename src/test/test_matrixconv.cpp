@@ -0,0 +1,135 @@
+/**
+ * @file         test_matrixconv.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        covariance row/column add and remove against an element by element reference
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include "gcheck.h"
+#include "gutils/gmatrixconv.h"
+
+using namespace gnut;
+
+// Q without the 0-based rows/cols in del
+static Eigen::MatrixXd ref_rem(const Eigen::MatrixXd &Q, const vector<int> &del)
+{
+    vector<int> keep;
+    for (int i = 0; i < Q.rows(); i++)
+        if (find(del.begin(), del.end(), i) == del.end())
+            keep.push_back(i);
+    Eigen::MatrixXd R(keep.size(), keep.size());
+    for (size_t i = 0; i < keep.size(); i++)
+        for (size_t j = 0; j < keep.size(); j++)
+            R(i, j) = Q(keep[i], keep[j]);
+    return R;
+}
+
+// Q with a zero row/col inserted at the 0-based position r
+static Eigen::MatrixXd ref_add(const Eigen::MatrixXd &Q, int r)
+{
+    int n = Q.rows();
+    Eigen::MatrixXd R = Eigen::MatrixXd::Zero(n + 1, n + 1);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            R(i < r ? i : i + 1, j < r ? j : j + 1) = Q(i, j);
+    return R;
+}
+
+int main()
+{
+    mt19937 gen(35);
+    uniform_int_distribution<int> pick;
+
+    for (int trial = 0; trial < 50; trial++)
+    {
+        const int n = 1 + trial % 40;
+        Eigen::MatrixXd Qe = check_spd(gen, n);
+        SymmetricMatrix Q;
+        Eigen2Matrix(Qe, Q);
+
+        // add at every position, the first and after the last included
+        int r = pick(gen) % (n + 1);
+        SymmetricMatrix Qa = Q;
+        Matrix_addRC(Qa, r + 1, r + 1);
+        Eigen::MatrixXd Qa_e;
+        Matrix2Eigen(Qa, Qa_e);
+        CHECK(check_maxdiff(Qa_e, ref_add(Qe, r)) == 0.0);
+
+        // append several at once, as the new parameters of an epoch, against one by one
+        int nadd = pick(gen) % 4;
+        vector<double> var;
+        SymmetricMatrix Qm = Q, Q1 = Q;
+        for (int k = 0; k < nadd; k++)
+        {
+            var.push_back(1.0 + k);
+            Matrix_addRC(Q1, Q1.Nrows() + 1, Q1.Nrows() + 1);
+            Q1(Q1.Nrows(), Q1.Nrows()) = 1.0 + k;
+        }
+        Matrix_add(Qm, var);
+        Eigen::MatrixXd Qm_e, Q1_e;
+        Matrix2Eigen(Qm, Qm_e);
+        Matrix2Eigen(Q1, Q1_e);
+        CHECK(Qm.Nrows() == n + nadd);
+        CHECK(check_maxdiff(Qm_e, Q1_e) == 0.0);
+
+        // remove a random set
+        int ndel = pick(gen) % n;
+        vector<int> cur(n), del, ind;
+        for (int i = 0; i < n; i++)
+            cur[i] = i;
+        for (int k = 0; k < ndel; k++)
+        {
+            int p = pick(gen) % cur.size();
+            del.push_back(cur[p]);
+            cur.erase(cur.begin() + p);
+        }
+        // 1-based positions of the original matrix in ascending order, as the filters pass them
+        // (Matrix_rem removes them one after another and shifts the following ones itself)
+        vector<int> sorted_del(del);
+        sort(sorted_del.begin(), sorted_del.end());
+        for (int d : sorted_del)
+            ind.push_back(d + 1);
+        SymmetricMatrix Qr = Q;
+        Matrix_rem(Qr, ind);
+        Eigen::MatrixXd Qr_e;
+        Matrix2Eigen(Qr, Qr_e);
+        CHECK(Qr.Nrows() == n - ndel);
+        CHECK(check_maxdiff(Qr_e, ref_rem(Qe, del)) == 0.0);
+
+        // a single row/column
+        if (n > 1)
+        {
+            int p = pick(gen) % n;
+            SymmetricMatrix Q1 = Q;
+            Matrix_remRC(Q1, p + 1, p + 1);
+            Eigen::MatrixXd Q1_e;
+            Matrix2Eigen(Q1, Q1_e);
+            CHECK(check_maxdiff(Q1_e, ref_rem(Qe, vector<int>(1, p))) == 0.0);
+        }
+    }
+
+    // out of range positions are reported as before
+    {
+        SymmetricMatrix Q(3);
+        Q = 1.0;
+        vector<int> ind(1, 4);
+        bool thrown = false;
+        try
+        {
+            Matrix_rem(Q, ind);
+        }
+        catch (...)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    return check_result("test_matrixconv");
+}
@@ -0,0 +1,136 @@
+/**
+ * @file         test_mlambda.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        MLAMBDA against LAMBDA4 and against an exhaustive search of small problems
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+#include "gcheck.h"
+#include "gambfix/glambda.h"
+#include "gambfix/gmlambda.h"
+
+using namespace great;
+
+// two smallest (a - z)' Q^-1 (a - z) of the integers within +-3 of round(a)
+static void exhaustive(const Eigen::MatrixXd &Q, const Eigen::VectorXd &a, Eigen::VectorXd &zbest, double S[2])
+{
+    int n = a.size();
+    Eigen::MatrixXd Qi = Q.inverse();
+    Eigen::VectorXd z(n);
+    vector<int> k(n, -3);
+    S[0] = S[1] = INFINITY;
+    while (true)
+    {
+        for (int i = 0; i < n; i++)
+            z(i) = round(a(i)) + k[i];
+        double s = (a - z).dot(Qi * (a - z));
+        if (s < S[0])
+        {
+            S[1] = S[0];
+            S[0] = s;
+            zbest = z;
+        }
+        else if (s < S[1])
+            S[1] = s;
+
+        int i = 0;
+        while (i < n && ++k[i] > 3)
+            k[i++] = -3;
+        if (i == n)
+            break;
+    }
+}
+
+int main()
+{
+    const int maxcan = 2;
+    mt19937 gen(34);
+    normal_distribution<double> nd;
+
+    // small problems: both methods find the integer least-squares solution
+    for (int trial = 0; trial < 30; trial++)
+    {
+        const int n = 2 + trial % 3;
+        Eigen::MatrixXd Q = check_spd(gen, n, 0.05) * 0.05;
+        Eigen::VectorXd a(n);
+        for (int i = 0; i < n; i++)
+            a(i) = 2.0 * nd(gen);
+
+        Eigen::VectorXd zref;
+        double Sref[2];
+        exhaustive(Q, a, zref, Sref);
+
+        vector<double> Qv(Q.data(), Q.data() + n * n), av(a.data(), a.data() + n);
+        vector<double> F(n * maxcan), S(maxcan);
+        t_gmlambda_stat stat;
+        t_gmlambda mlambda(maxcan);
+        CHECK(mlambda.solve(n, Qv.data(), av.data(), F.data(), S.data(), &stat) == 0);
+        CHECK(stat.ncan == maxcan);
+        CHECK(stat.boot > 0.0 && stat.boot <= 1.0);
+        CHECK_NEAR(stat.ratio, S[1] / S[0], 1e-12 * stat.ratio);
+        for (int i = 0; i < n; i++)
+            CHECK(F[i * maxcan] == zref(i));
+        CHECK_NEAR(S[0], Sref[0], 1e-9 * max(1.0, Sref[0]));
+        CHECK_NEAR(S[1], Sref[1], 1e-9 * max(1.0, Sref[1]));
+
+        int ncan = 0, ipos = 0;
+        double boot = 0.0;
+        vector<double> C(n * maxcan), Sl(maxcan);
+        t_glambda lambda;
+        lambda.LAMBDA4(maxcan, n, Qv.data(), av.data(), &ncan, &ipos, C.data(), Sl.data(), &boot);
+        // the best candidate of LAMBDA4 is at ipos, rounded as the callers do, relative to the truncated float values
+        for (int i = 0; i < n; i++)
+            CHECK(round(C[i * maxcan + ipos - 1]) + trunc(a(i)) == zref(i));
+        CHECK_NEAR(Sl[0], Sref[0], 1e-9 * max(1.0, Sref[0]));
+        CHECK_NEAR(Sl[1], Sref[1], 1e-9 * max(1.0, Sref[1]));
+    }
+
+    // larger problems, one workspace reused for all sizes: same result as LAMBDA4
+    // (float ambiguities as the filter gives them, integers plus noise of Q, sizes within the
+    // 10000 candidates LAMBDA4 searches at most)
+    t_gmlambda reused(maxcan);
+    for (int trial = 0; trial < 20; trial++)
+    {
+        const int n = 6 + 5 * (trial % 3);
+        Eigen::MatrixXd Q = check_spd(gen, n, 0.2) * (0.05 / n);
+        Eigen::MatrixXd L = Q.llt().matrixL();
+        Eigen::VectorXd a(n), e(n);
+        for (int i = 0; i < n; i++)
+        {
+            a(i) = round(20.0 * nd(gen));
+            e(i) = nd(gen);
+        }
+        a += L * e;
+
+        vector<double> Qv(Q.data(), Q.data() + n * n), av(a.data(), a.data() + n);
+        vector<double> F(n * maxcan), S(maxcan);
+        CHECK(reused.solve(n, Qv.data(), av.data(), F.data(), S.data()) == 0);
+        CHECK(S[0] <= S[1]);
+
+        int ncan = 0, ipos = 0;
+        double boot = 0.0;
+        vector<double> C(n * maxcan), Sl(maxcan);
+        t_glambda lambda;
+        lambda.LAMBDA4(maxcan, n, Qv.data(), av.data(), &ncan, &ipos, C.data(), Sl.data(), &boot);
+        for (int i = 0; i < n; i++)
+            CHECK(F[i * maxcan] == round(C[i * maxcan + ipos - 1]) + trunc(a(i)));
+        CHECK_NEAR(S[0], Sl[0], 1e-8 * max(1.0, Sl[0]));
+        CHECK_NEAR(S[1], Sl[1], 1e-8 * max(1.0, Sl[1]));
+    }
+
+    // not positive definite
+    {
+        double Q[4] = {1.0, 2.0, 2.0, 1.0}, a[2] = {0.2, 0.3}, F[4], S[2];
+        t_gmlambda mlambda(maxcan);
+        CHECK(mlambda.factorize(2, Q) < 0);
+        CHECK(mlambda.solve(2, Q, a, F, S) < 0);
+    }
+
+    return check_result("test_mlambda");
+}
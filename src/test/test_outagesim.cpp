@@ -0,0 +1,137 @@
+/**
+ * @file         test_outagesim.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        simulated GNSS outages: windows run as they close, bounded log, same drift on 1 and N threads
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <sstream>
+#include "gcheck.h"
+#include "gbenchdata.h"
+#include "gset/gcfg_ppp.h"
+#include "gset/gsetins.h"
+#include "gset/gsetign.h"
+#include "gmsf/goutagesim.h"
+
+using namespace great;
+
+// settings of the integration, as t_gcfg_ign of GREAT_MSF
+class t_gcfg_outage : public virtual t_gcfg_ppp,
+                      public virtual t_gsetins,
+                      public virtual t_gsetign
+{
+public:
+    t_gcfg_outage() : t_gcfg_ppp(), t_gsetins(), t_gsetign()
+    {
+        _OFMT_supported.insert(INS_OUT);
+    }
+
+    void check() override
+    {
+        t_gcfg_ppp::check();
+        t_gsetins::check();
+        t_gsetign::check();
+    }
+
+    void help() override
+    {
+        t_gcfg_ppp::help();
+        t_gsetins::help();
+        t_gsetign::help();
+    }
+};
+
+// reference run of a static platform at 100 Hz, the outages of the run
+static vector<t_goutagestat> simulate(t_gsetbase *gset, const map<double, int> &outages, int nthreads, size_t &logged, size_t &buffered)
+{
+    t_gbenchdata gen(44);
+    t_gtriple ell;
+    xyz2ell(gen.site_crd(0), ell, false);
+
+    t_gsinskf kf(gset, nullptr, "SIM1");
+    kf.sins = t_gsins(t_gquat(), Eigen::Vector3d::Zero(), Eigen::Vector3d(ell[0], ell[1], ell[2]), 0.0);
+    t_goutagesim sim(outages, nthreads);
+
+    t_scheme scm;
+    scm.ts = 0.01;
+    scm.nSamples = 1;
+    vector<Eigen::Vector3d> wm(1), vm(1);
+    buffered = 0;
+    for (int k = 1; k <= 20000; k++)
+    {
+        gen.imu(0, scm.ts, wm[0], vm[0]);
+        scm.t = k * scm.ts;
+        kf.sins.Update(wm, vm, scm);
+        sim.add(kf, wm, vm, scm, set<MEAS_TYPE>(), 0.0);
+        buffered = max(buffered, sim.buffered());
+    }
+    logged = sim.logged();
+    return sim.run();
+}
+
+int main()
+{
+    const string ins = "test_outagesim.ins";
+    t_gcfg_outage set;
+    {
+        istringstream is("<config> <outputs> <ins> " + ins + " </ins> </outputs> <integration /> </config>");
+        set.read_istream(is);
+        set.check(); // defaults of the integration (nq, nr, ...)
+    }
+
+    // 5 s windows every 20 s, one overlapping a 30 s window, one open at the end, one after the data
+    map<double, int> outages;
+    for (int i = 0; i < 9; i++)
+        outages[10.0 + 20.0 * i] = 5;
+    outages[55.0] = 30;
+    outages[195.0] = 10;
+    outages[300.0] = 5;
+
+    vector<vector<t_goutagestat>> runs;
+    for (int nthreads : {1, 4})
+    {
+        size_t logged = 0, buffered = 0;
+        runs.push_back(simulate(&set, outages, nthreads, logged, buffered));
+
+        // the windows only are logged; the log holds about one window per thread, not the run
+        CHECK(logged == 8 * 500 + 3000 + 500);
+        CHECK(buffered <= static_cast<size_t>(nthreads + 2) * 3000);
+        CHECK(buffered < logged);
+    }
+    remove(ins.c_str());
+
+    const vector<t_goutagestat> &st = runs[0];
+    CHECK(st.size() == outages.size());
+    bool same = runs[0].size() == runs[1].size();
+    for (size_t i = 0; same && i < st.size(); i++)
+    {
+        const t_goutagestat &a = runs[0][i], &b = runs[1][i];
+        same = a.beg == b.beg && a.started == b.started && a.nepo == b.nepo && a.hor_end == b.hor_end && a.ver_end == b.ver_end &&
+               a.hor_max == b.hor_max && a.hor_rms == b.hor_rms && a.vel_end == b.vel_end && a.yaw_end == b.yaw_end;
+    }
+    CHECK(same);
+
+    // the forks integrate the same increments as the reference: no drift
+    for (const auto &s : st)
+    {
+        if (s.beg == 300.0)
+        {
+            CHECK(!s.started && s.nepo == 0);
+            continue;
+        }
+        CHECK(s.started);
+        CHECK(s.nepo == (s.beg == 195.0 ? 500 : s.length * 100));
+        CHECK(s.hor_max == 0.0 && s.ver_max == 0.0 && s.vel_end == 0.0);
+    }
+
+    ostringstream os;
+    t_goutagesim::write(st, os);
+    CHECK(os.str().find("not reached") != string::npos);
+
+    return check_result("test_outagesim");
+}
@@ -0,0 +1,113 @@
+/**
+ * @file         test_predict.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        one-pass time update from the process model list against the element by element prediction
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <vector>
+#include "gcheck.h"
+#include "gutils/gmatrixconv.h"
+
+using namespace gnut;
+
+// the prediction as the _predict* helpers of t_gpvtflt did it before, through operator()
+static void predict_old(SymmetricMatrix &Q, const vector<t_gprocnoise> &proc)
+{
+    for (size_t k = 0; k < proc.size(); k++)
+    {
+        int i = proc[k].idx;
+        switch (proc[k].model)
+        {
+        case PROC_MODEL::RANDOM_WALK:
+            Q(i, i) += proc[k].q;
+            break;
+        case PROC_MODEL::WHITE_NOISE:
+            for (int jj = 1; jj <= Q.Nrows(); jj++)
+                Q(i, jj) = 0.0;
+            Q(i, i) = proc[k].q;
+            break;
+        case PROC_MODEL::RESET:
+            Q(i, i) = proc[k].q;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+int main()
+{
+    mt19937 gen(38);
+    uniform_int_distribution<int> pick;
+    uniform_real_distribution<double> ud(0.0, 10.0);
+
+    for (int trial = 0; trial < 100; trial++)
+    {
+        const int n = 1 + trial % 60;
+        SymmetricMatrix Q0;
+        Eigen2Matrix(check_spd(gen, n), Q0);
+
+        // PPP order: crd (reset or random walk), clk (white noise), biases, ztd, amb; some indices repeated
+        vector<t_gprocnoise> proc;
+        const int nproc = pick(gen) % (2 * n + 1);
+        for (int k = 0; k < nproc; k++)
+        {
+            PROC_MODEL m = (PROC_MODEL)(pick(gen) % 4);
+            proc.push_back(t_gprocnoise(1 + pick(gen) % n, m, ud(gen)));
+        }
+        if (n >= 4)
+            proc.push_back(t_gprocnoise(4, PROC_MODEL::WHITE_NOISE, 9e6));
+
+        SymmetricMatrix Qo = Q0, Qn = Q0;
+        predict_old(Qo, proc);
+        Matrix_predict(Qn, proc);
+        bool same = true;
+        for (int i = 1; i <= n; i++)
+            for (int j = 1; j <= i; j++)
+                same = same && Qo(i, j) == Qn(i, j);
+        CHECK(same);
+
+        // the white noise row is decoupled
+        if (n >= 4)
+        {
+            bool cleared = Qn(4, 4) == 9e6;
+            for (int j = 1; j <= n; j++)
+                cleared = cleared && (j == 4 || Qn(4, j) == 0.0);
+            CHECK(cleared);
+        }
+    }
+
+    // empty list: unchanged, index out of range: reported as by operator()
+    {
+        SymmetricMatrix Q0;
+        Eigen2Matrix(check_spd(gen, 5), Q0);
+        SymmetricMatrix Q = Q0;
+        Matrix_predict(Q, vector<t_gprocnoise>());
+        bool same = true;
+        for (int i = 1; i <= 5; i++)
+            for (int j = 1; j <= i; j++)
+                same = same && Q(i, j) == Q0(i, j);
+        CHECK(same);
+
+        for (int idx : {0, 6})
+        {
+            bool thrown = false;
+            try
+            {
+                Matrix_predict(Q, vector<t_gprocnoise>(1, t_gprocnoise(idx, PROC_MODEL::RANDOM_WALK, 1.0)));
+            }
+            catch (...)
+            {
+                thrown = true;
+            }
+            CHECK(thrown);
+        }
+    }
+
+    return check_result("test_predict");
+}
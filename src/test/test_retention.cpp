@@ -0,0 +1,126 @@
+/**
+ * @file         test_retention.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        retention window of consumed observations in a batch run, forward and backward
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <fstream>
+#include "gcheck.h"
+#include "gutils/grinexout.h"
+#include "gset/gcfg_ppp.h"
+#include "gall/gallobs.h"
+#include "gcoders/rinexo.h"
+#include "gio/gfile.h"
+#include "gio/grtlog.h"
+
+using namespace great;
+
+static const string file = "test_retention.24o";
+
+// all epochs read upfront, as in a batch run
+static void read_all(t_gallobs &obs, t_gcfg_ppp &gset, t_spdlog spdlog)
+{
+    t_rinexo coder(&gset, "", 4096);
+    coder.spdlog(spdlog);
+    t_gfile gio(spdlog);
+    gio.path("file://" + file);
+    coder.path("file://" + file);
+    coder.add_data("ID0", &obs);
+    gio.coder(&coder);
+    gio.run_read();
+}
+
+int main()
+{
+    const int nepo = 600;
+    const double window = 60.0;
+    const t_gtime t0(2024, 3, 15, 0, 0, 0);
+    {
+        t_grinexout rnx;
+        rnx.program("test_retention");
+        rnx.marker("TEST");
+        rnx.position(t_gtriple(-2267749.0, 5009154.3, 3221290.7));
+        rnx.obstypes(GPS, {"C1C"});
+        rnx.interval(1.0);
+        ofstream f(file.c_str(), ios::out | ios::binary | ios::trunc);
+        f << rnx.header(t0);
+        for (int k = 0; k < nepo; k++)
+        {
+            f << t_grinexout::epoch(t0 + (double)k, 2);
+            f << "G05" << "  21345678.125  \n";
+            f << "G12" << "  23456789.250  \n";
+        }
+    }
+
+    t_grtlog log("CONSOLE", spdlog::level::err, "test_retention");
+    t_gcfg_ppp gset;
+    istringstream xml("<config><gen><int> 1 </int><retention> 60 </retention></gen></config>");
+    gset.read_istream(xml);
+    CHECK(gset.retention() == window);
+
+    for (int beg_end = 1; beg_end >= 0; beg_end--)
+    {
+        // the window is taken from the settings as the batch apps set up the observations
+        t_gallobs obs;
+        obs.spdlog(log.spdlog());
+        obs.gset(&gset);
+        CHECK(obs.retention() == window);
+        read_all(obs, gset, log.spdlog());
+
+        vector<t_gtime> all = obs.epochs("TEST");
+        CHECK(all.size() == (size_t)nepo);
+        if (all.size() != (size_t)nepo)
+            continue;
+        if (!beg_end)
+            reverse(all.begin(), all.end());
+
+        // the filter consumes the epochs one by one: the buffer never holds more than the window
+        // (plus the epoch processed) behind the epoch, the epochs ahead are untouched
+        size_t maxkept = 0;
+        int nerase = 0;
+        bool window_kept = true;
+        for (int k = 0; k < nepo; k++)
+        {
+            const t_gtime &t = all[k];
+            nerase += obs.consumed("TEST", t, beg_end == 1);
+            vector<t_gtime> kept = obs.epochs("TEST");
+            size_t behind = beg_end ? (size_t)count_if(kept.begin(), kept.end(), [&](const t_gtime &e) { return e <= t; })
+                                    : (size_t)count_if(kept.begin(), kept.end(), [&](const t_gtime &e) { return e >= t; });
+            maxkept = max(maxkept, behind);
+            CHECK(kept.size() - behind == (size_t)(nepo - 1 - k));
+            // the window behind t and the previous epoch are kept
+            size_t expect = (size_t)min(k, (int)window) + 1;
+            if (behind != expect)
+                window_kept = false;
+            CHECK(obs.obs_pt("TEST", t).size() == 2);
+        }
+        CHECK(window_kept);
+        CHECK(maxkept == (size_t)window + 1);
+        CHECK(nerase == nepo - (int)window - 1);
+        CHECK(obs.epochs("TEST").size() == (size_t)window + 1);
+    }
+
+    // no window: everything kept
+    {
+        t_gcfg_ppp gset0;
+        t_gallobs obs;
+        obs.spdlog(log.spdlog());
+        obs.gset(&gset0);
+        CHECK(obs.retention() == 0.0);
+        read_all(obs, gset0, log.spdlog());
+        vector<t_gtime> all = obs.epochs("TEST");
+        for (const auto &t : all)
+            CHECK(obs.consumed("TEST", t) == 0);
+        CHECK(obs.epochs("TEST").size() == (size_t)nepo);
+    }
+
+    remove(file.c_str());
+    return check_result("test_retention");
+}
@@ -0,0 +1,168 @@
+/**
+ * @file         test_rinexo3.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        fixed-column field conversion against strtod, RINEX 3 observation records decoded by t_rinexo
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include "gcheck.h"
+#include "gutils/gtypeconv.h"
+#include "gutils/grinexout.h"
+#include "gset/gcfg_ppp.h"
+#include "gall/gallobs.h"
+#include "gcoders/rinexo.h"
+#include "gio/gfile.h"
+#include "gio/grtlog.h"
+
+using namespace great;
+
+// one F14.3 field with LLI and signal strength
+static string rec(const string &value, char lli, char ssi)
+{
+    char tmp[32];
+    snprintf(tmp, sizeof(tmp), "%14s%c%c", value.c_str(), lli, ssi);
+    return tmp;
+}
+
+// the field as str2fix must read it: strtod of the bounded field
+static double ref_field(const char *p, int width)
+{
+    string field(p, width);
+    return strtod(field.c_str(), NULL);
+}
+
+int main()
+{
+    mt19937 gen(26);
+
+    // plain F14.3 fields: identical to strtod
+    {
+        uniform_real_distribution<double> mant(-1.0, 1.0);
+        uniform_int_distribution<int> expo(0, 9);
+        int nfail = 0;
+        for (int i = 0; i < 100000; i++)
+        {
+            char field[64];
+            double v = mant(gen) * pow(10.0, expo(gen));
+            snprintf(field, sizeof(field), "%14.3f", v);
+            double val = -1.0;
+            bool ok = str2fix(field, 14, 3, val);
+            if ((!ok || val != ref_field(field, 14)) && nfail++ < 10)
+                cerr << "str2fix(\"" << field << "\") = " << val << endl;
+        }
+        CHECK(nfail == 0);
+    }
+
+    // other widths and decimals, explicit plus sign, leading zeros
+    {
+        double val = 0.0;
+        CHECK(str2fix("  -0.0012345", 12, 7, val) && val == ref_field("  -0.0012345", 12));
+        CHECK(str2fix("+123.45", 7, 2, val) && val == 123.45);
+        CHECK(str2fix("00012.500", 9, 3, val) && val == 12.5);
+        CHECK(str2fix("999999999999.999", 16, 3, val) && val == ref_field("999999999999.999", 16));
+    }
+
+    // blank field is 0, other layouts are left to the general conversion
+    {
+        double val = -1.0;
+        CHECK(str2fix("              ", 14, 3, val) && val == 0.0);
+        for (const char *field : {"  2.134567E+07", "   21345678.12", "  21345678.1 5", "  2134-678.125", " 21345678,125 ", "  --345678.125"})
+        {
+            CHECK(!str2fix(field, 14, 3, val));
+        }
+        CHECK(!str2fix("1.5", 3, 3, val));
+        CHECK(!str2fix("1.5", 3, 10, val));
+    }
+
+    // observation records: plain fields, a field in another layout, a blank field, a short line,
+    // LLI and signal strength, two systems with own descriptors
+    const string file = "test_rinexo3.24o";
+    t_gtime t0(2024, 3, 15, 0, 0, 0);
+    {
+        t_grinexout rnx;
+        rnx.program("test_rinexo3");
+        rnx.marker("TEST");
+        rnx.position(t_gtriple(-2267749.0, 5009154.3, 3221290.7));
+        rnx.obstypes(GPS, {"C1C", "L1C", "C2W"});
+        rnx.obstypes(GAL, {"C1X", "L1X"});
+        rnx.interval(30.0);
+        ofstream f(file.c_str(), ios::out | ios::binary | ios::trunc);
+        f << rnx.header(t0);
+        f << t_grinexout::epoch(t0, 5);
+        f << "G05" << rec("21345678.125", ' ', ' ') << rec("112233445.500", '1', '7') << rec("21345680.250", ' ', ' ') << "\n";
+        f << "G09" << rec("2.134567E+07", ' ', ' ') << rec("112233445.500", ' ', ' ') << "\n";
+        f << "G12" << rec("22000000.000", ' ', ' ') << rec("", ' ', ' ') << rec("22000001.500", ' ', ' ') << "\n";
+        f << "G15" << rec("23000000.000", ' ', ' ') << "\n";
+        f << "E11" << rec("24000000.125", '4', ' ') << rec("-12345678.250", ' ', '3') << "\n";
+        f << t_grinexout::epoch(t0 + 30.0, 1);
+        f << "G05" << rec("21345708.125", ' ', ' ') << rec("112233545.500", '5', '8') << "\n";
+    }
+
+    t_grtlog log("CONSOLE", spdlog::level::err, "test_rinexo3");
+    t_gcfg_ppp gset;
+    t_gallobs obs(log.spdlog(), &gset);
+    {
+        t_rinexo coder(&gset, "", 4096);
+        coder.spdlog(log.spdlog());
+        t_gfile gio(log.spdlog());
+        gio.path("file://" + file);
+        coder.path("file://" + file);
+        coder.add_data("ID0", &obs);
+        gio.coder(&coder);
+        gio.run_read();
+    }
+    remove(file.c_str());
+
+    set<string> sites = obs.stations();
+    CHECK(sites.size() == 1);
+    string site = sites.empty() ? "" : *sites.begin();
+    vector<t_gtime> epochs = obs.epochs(site);
+    CHECK(epochs.size() == 2);
+    if (epochs.size() == 2)
+    {
+        map<string, t_spt_gobs> sat;
+        for (const auto &o : obs.obs_pt(site, epochs[0]))
+            sat[o->sat()] = o;
+        CHECK(sat.size() == 5);
+        CHECK(sat.count("G05") && sat.count("G09") && sat.count("G12") && sat.count("G15") && sat.count("E11"));
+        if (sat.size() == 5)
+        {
+            CHECK(sat["G05"]->getobs(C1C) == 21345678.125);
+            CHECK(sat["G05"]->getobs(L1C) == 112233445.5);
+            CHECK(sat["G05"]->getlli(L1C) == 1);
+            CHECK(sat["G05"]->getobs(S1C) == 45.0);
+            CHECK(sat["G05"]->getobs(C2W) == 21345680.25);
+            CHECK(sat["G09"]->getobs(C1C) == 2.134567e7);
+            CHECK(sat["G09"]->getlli(L1C) == 0);
+            CHECK(sat["G09"]->getobs(S1C) == 0.0);
+            CHECK(sat["G12"]->getobs(C1C) == 22.0e6);
+            CHECK(sat["G12"]->getobs(C2W) == 22000001.5);
+            vector<GOBS> g12 = sat["G12"]->obs();
+            CHECK(find(g12.begin(), g12.end(), L1C) == g12.end());
+            CHECK(sat["G15"]->getobs(C1C) == 23.0e6);
+            CHECK(sat["E11"]->getobs(C1X) == 24000000.125);
+            CHECK(sat["E11"]->getlli(C1X) == 0);
+            CHECK(sat["E11"]->getobs(L1X) == -12345678.25);
+            CHECK(sat["E11"]->getobs(S1X) == 20.0);
+        }
+
+        vector<t_spt_gobs> second = obs.obs_pt(site, epochs[1]);
+        CHECK(second.size() == 1);
+        if (second.size() == 1)
+        {
+            CHECK(second[0]->getobs(L1C) == 112233545.5);
+            CHECK(second[0]->getlli(L1C) == 1);
+            CHECK(second[0]->getobs(S1C) == 50.0);
+        }
+    }
+
+    return check_result("test_rinexo3");
+}
@@ -0,0 +1,196 @@
+/**
+ * @file         test_rtpvt.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        real-time epoch driver: latency budget, bounded queue, rover/base completion, latency histograms
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <set>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "gcheck.h"
+#include "gproc/grtpvt.h"
+
+using namespace great;
+
+// the driver with a filter that takes a set time per epoch
+class t_grtpvt_stub : public t_grtpvt
+{
+public:
+    t_grtpvt_stub(const string &site, const string &site_base) : t_grtpvt(nullptr, site, site_base, nullptr) {}
+
+    vector<t_gtime> processed;   // read after run() returned
+    set<t_gtime> fail;           // epochs without solution
+    int proc_ms = 1;             // processing time
+    atomic<bool> hold{false};    // the next epoch waits for release
+    atomic<bool> started{false}; // an epoch is being processed
+    atomic<bool> release{false};
+
+protected:
+    int _init(const t_gtime &beg, const t_gtime &end) override { return 1; }
+
+    int _process(const t_gtime &epo) override
+    {
+        processed.push_back(epo);
+        started = true;
+        while (hold && !release)
+            this_thread::sleep_for(chrono::milliseconds(1));
+        hold = false;
+        this_thread::sleep_for(chrono::milliseconds(proc_ms));
+        return fail.count(epo) ? -1 : 1;
+    }
+};
+
+static void wait_until(const function<bool()> &cond, int ms = 10000)
+{
+    for (int t = 0; t < ms && !cond(); t++)
+        this_thread::sleep_for(chrono::milliseconds(1));
+}
+
+int main()
+{
+    const t_gtime t0(2024, 3, 15, 0, 0, 0);
+    const t_gtime beg = t0, end = t0 + 3600.0;
+
+    // histogram: bins up to 10 ms, two values in the overflow bin
+    {
+        t_glatency lat(1.0, 10);
+        for (int i = 0; i < 10; i++)
+            lat.add(i + 0.5);
+        lat.add(25.0);
+        lat.add(40.0);
+        CHECK(lat.count() == 12);
+        CHECK_NEAR(lat.mean(), 115.0 / 12.0, 1e-12);
+        CHECK(lat.max() == 40.0);
+        CHECK(lat.percentile(50) == 6.0);
+        CHECK(lat.percentile(0) == 1.0);
+        CHECK(lat.percentile(90) == 25.0);
+        CHECK(lat.percentile(100) == 40.0);
+        CHECK(lat.above(5.0) == 7);
+        CHECK(lat.above(30.0) == 1);
+        vector<long> bins = lat.bins();
+        CHECK(bins.size() == 11 && bins[0] == 1 && bins[9] == 1 && bins[10] == 2);
+        lat.add(-3.0);
+        CHECK(lat.bins()[0] == 2 && lat.count() == 13);
+        lat.reset();
+        CHECK(lat.count() == 0 && lat.max() == 0.0 && lat.percentile(50) == 0.0);
+    }
+
+    // in time: every epoch processed in order, failures counted, latencies of every epoch
+    {
+        t_grtpvt_stub rt("ROVR", "");
+        rt.proc_ms = 2;
+        rt.fail.insert(t0 + 7.0);
+        rt.report(0);
+        int nret = -2;
+        thread run([&]() { nret = rt.run(beg, end); });
+        const int n = 30;
+        for (int i = 0; i < n; i++)
+        {
+            rt.push("ROVR", t0 + (double)i);
+            rt.push("BASE", t0 + (double)i); // not a site of the driver
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+        wait_until([&]() { return rt.nproc() + rt.nfail() == n; });
+        rt.stop();
+        run.join();
+
+        CHECK(nret == n - 1);
+        CHECK(rt.nproc() == n - 1 && rt.nfail() == 1 && rt.nskip() == 0);
+        CHECK(rt.processed.size() == (size_t)n);
+        for (size_t i = 0; i < rt.processed.size(); i++)
+            CHECK(rt.processed[i] == t0 + (double)i);
+        CHECK(rt.latency_total().count() == n && rt.latency_wait().count() == n && rt.latency_proc().count() == n);
+        CHECK(rt.latency_proc().mean() >= 2.0);
+        CHECK(rt.latency_total().mean() >= rt.latency_proc().mean());
+        CHECK(rt.nover() == rt.latency_total().above(rt.budget()));
+        CHECK(rt.report_str().find("epochs 29 (failed 1, skipped 0") != string::npos);
+    }
+
+    // behind real time: the queue is bounded, epochs out of budget are skipped in favour of the newest,
+    // older epochs than the last solution are skipped, an epoch after the end stops the driver
+    {
+        t_grtpvt_stub rt("ROVR", "");
+        rt.budget(20.0);
+        rt.max_queue(5);
+        rt.report(0);
+        rt.hold = true;
+        int nret = -2;
+        thread run([&]() { nret = rt.run(beg, end); });
+
+        rt.push("ROVR", t0);
+        wait_until([&]() { return rt.started.load(); });
+        for (int i = 1; i <= 8; i++)
+            rt.push("ROVR", t0 + (double)i);
+        CHECK(rt.nskip() == 3); // e1..e3 out of the queue
+        this_thread::sleep_for(chrono::milliseconds(60));
+        rt.push("ROVR", t0 + 9.0);
+        CHECK(rt.nskip() == 4); // e4
+        rt.release = true;
+        wait_until([&]() { return rt.nproc() == 2; });
+        CHECK(rt.nskip() == 8); // e5..e8 out of budget
+
+        rt.push("ROVR", t0 + 3.0);
+        wait_until([&]() { return rt.nskip() == 9; });
+        rt.push("ROVR", end + 1.0);
+        run.join();
+
+        CHECK(nret == 2);
+        CHECK(rt.processed.size() == 2 && rt.processed[0] == t0 && rt.processed[1] == t0 + 9.0);
+        CHECK(rt.nskip() == 9 && rt.nfail() == 0);
+        CHECK(rt.latency_total().count() == 2);
+        // the epoch kept was the newest one, it waited for the first epoch only
+        CHECK(rt.latency_total().max() >= 60.0 && rt.nover() >= 1);
+    }
+
+    // RTK: an epoch is queued once rover and base completed it, epochs left incomplete are skipped
+    {
+        t_grtpvt_stub rt("ROVR", "BASE");
+        rt.report(0);
+        int nret = -2;
+        thread run([&]() { nret = rt.run(beg, end); });
+
+        rt.push("ROVR", t0);
+        rt.push("BASE", t0);
+        rt.push("ROVR", t0 + 1.0);
+        rt.push("OTHR", t0 + 1.0);
+        rt.push("BASE", t0 + 2.0);
+        rt.push("BASE", t0 + 3.0);
+        rt.push("ROVR", t0 + 2.0);
+        wait_until([&]() { return rt.nproc() == 2; });
+        CHECK(rt.nskip() == 1); // e1 without base
+
+        // rover without base: the pending epochs are bounded
+        const int nmax = 5 * RTPVT_MAXQUEUE;
+        for (int i = 10; i < 10 + nmax + 3; i++)
+            rt.push("ROVR", t0 + (double)i);
+        CHECK(rt.nskip() == 1 + 3 + 1); // + e3 base only
+        rt.push("BASE", t0 + 10.0 + nmax + 2);
+        wait_until([&]() { return rt.nproc() == 3; });
+        rt.stop();
+        run.join();
+
+        CHECK(nret == 3);
+        CHECK(rt.processed.size() == 3);
+        if (rt.processed.size() == 3)
+        {
+            CHECK(rt.processed[0] == t0 && rt.processed[1] == t0 + 2.0);
+            CHECK(rt.processed[2] == t0 + 10.0 + nmax + 2);
+        }
+        CHECK(rt.nskip() == 1 + 4 + nmax - 1);
+    }
+
+    // no filter
+    {
+        t_grtpvt rt(nullptr, "ROVR", "", nullptr);
+        CHECK(rt.run(beg, end) == -1);
+    }
+
+    return check_result("test_rtpvt");
+}
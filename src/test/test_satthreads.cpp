@@ -0,0 +1,192 @@
+/**
+ * @file         test_satthreads.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        float PPP of t_gpvtflt with sat_threads 1 and N: identical equations of every epoch
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "gcheck.h"
+#include "gbenchdata.h"
+#include "gset/gcfg_ppp.h"
+#include "gall/gallobs.h"
+#include "gall/gallobj.h"
+#include "gall/gallpcv.h"
+#include "gall/gallprod.h"
+#include "gcoders/atx.h"
+#include "gcoders/rinexo.h"
+#include "gio/gfile.h"
+#include "gio/grtlog.h"
+#include "gproc/gflt.h"
+#include "gproc/gpvtflt.h"
+
+using namespace great;
+
+// equations of all filter updates
+struct t_equ
+{
+    Matrix A, P;
+    ColumnVector l;
+};
+
+// the Kalman filter, recording its input
+class t_kalman_rec : public t_kalman
+{
+public:
+    vector<t_equ> equ;
+
+    int update(const Matrix &A, const DiagonalMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q) override
+    {
+        _add(A, P, l);
+        return t_kalman::update(A, P, l, dx, Q);
+    }
+
+    int update(const Matrix &A, const SymmetricMatrix &P, const ColumnVector &l, ColumnVector &dx, SymmetricMatrix &Q) override
+    {
+        _add(A, P, l);
+        return t_kalman::update(A, P, l, dx, Q);
+    }
+
+protected:
+    void _add(const Matrix &A, const GeneralMatrix &P, const ColumnVector &l)
+    {
+        t_equ e;
+        e.A = A;
+        e.P = P;
+        e.l = l;
+        equ.push_back(e);
+    }
+};
+
+class t_gpvtflt_rec : public t_gpvtflt
+{
+public:
+    t_gpvtflt_rec(string site, t_gsetbase *set, t_spdlog spdlog, t_gallproc *data) : t_gspp(site, set, spdlog), t_gpvtflt(site, "", set, spdlog, data)
+    {
+        delete _filter;
+        _filter = rec = new t_kalman_rec;
+    }
+
+    t_kalman_rec *rec;
+};
+
+static void decode_file(t_spdlog spdlog, t_gcoder &coder, const string &path, t_gdata *data, t_gdata *obj = nullptr)
+{
+    coder.spdlog(spdlog);
+    t_gfile gio(spdlog);
+    gio.path("file://" + path);
+    coder.clear();
+    coder.path("file://" + path);
+    coder.add_data("ID0", data);
+    if (obj)
+        coder.add_data("OBJ", obj);
+    gio.coder(&coder);
+    gio.run_read();
+}
+
+static bool same(const Matrix &a, const Matrix &b)
+{
+    if (a.Nrows() != b.Nrows() || a.Ncols() != b.Ncols())
+        return false;
+    for (int i = 1; i <= a.Nrows(); i++)
+        for (int j = 1; j <= a.Ncols(); j++)
+            if (a(i, j) != b(i, j))
+                return false;
+    return true;
+}
+
+int main()
+{
+    const int nepo = 40;
+    const double intv = 30.0;
+    t_gbenchdata gen(40);
+    t_grtlog log("CONSOLE", spdlog::level::err, "test_satthreads");
+    t_spdlog spdlog = log.spdlog();
+
+    char name[64];
+    snprintf(name, sizeof(name), "s%s%03d0.%02do", gen.site(0).substr(1).c_str(), gen.beg().doy(), gen.beg().year() % 100);
+    string rnx = name, atx = "test_satthreads.atx";
+    {
+        ofstream f(rnx.c_str(), ios::out | ios::binary | ios::trunc);
+        f << gen.rinexo(0, nepo, intv);
+        ofstream g(atx.c_str(), ios::out | ios::binary | ios::trunc);
+        g << gen.atx();
+    }
+    t_gtime end = gen.beg();
+    end.add_dsec((nepo - 1) * intv);
+
+    t_gallprec orb(spdlog);
+    gen.prec(orb, 86400.0 + 900.0, 900.0);
+    orb.use_clksp3(true);
+    t_gpoleut1 erp;
+    t_gnavde de;
+    t_gupd upd;
+    gen.eop(erp, 2);
+    gen.de(de, 2);
+    gen.upd(upd, nepo, intv);
+
+    // the same run with the satellites of an epoch combined sequentially and on the pool
+    vector<vector<t_equ>> runs;
+    for (int threads : {1, 4})
+    {
+        t_gcfg_ppp set;
+        ostringstream os;
+        os << "<config>"
+           << " <gen> <beg> " << gen.beg().str_ymdhms("", false) << " </beg> <end> " << end.str_ymdhms("", false) << " </end>"
+           << " <sys> GPS </sys> <rec> " << gen.site(0) << " </rec> <int> " << intv << " </int> </gen>"
+           << " <filter method_flt=\"kalman\" noise_clk=\"1000\" noise_crd=\"100\" rndwk_ztd=\"3\" />"
+           << " <process phase=\"1\" tropo=\"1\" iono=\"1\" obs_combination=\"IONO_FREE\" obs_weight=\"SINEL2\""
+           << " minimum_elev=\"10\" sig_init_crd=\"100\" sig_init_ztd=\"0.1\" pos_kin=\"false\">"
+           << " <sat_threads> " << threads << " </sat_threads> </process>"
+           << " <gps> <band> 1 2 </band> </gps> <gal> <band> 1 5 </band> </gal> <bds> <band> 2 6 </band> </bds>"
+           << " <glo> <band> 1 2 </band> </glo> <qzs> <band> 1 2 </band> </qzs>"
+           << "</config>";
+        istringstream is(os.str());
+        set.read_istream(is);
+
+        t_gallpcv pcv;
+        pcv.spdlog(spdlog);
+        t_atx atx_coder(&set, "", 4096);
+        decode_file(spdlog, atx_coder, atx, &pcv);
+        t_gallobs obs(spdlog, &set);
+        t_gallobj obj(spdlog, &pcv, nullptr);
+        t_rinexo rinexo_coder(&set, "", 4096);
+        decode_file(spdlog, rinexo_coder, rnx, &obs, &obj);
+        t_gtime beg = gen.beg();
+        obj.read_satinfo(beg);
+        obj.sync_pcvs();
+
+        t_gallproc data;
+        data.Add_Data(t_gdata::type2str(obs.id_type()), &obs);
+        data.Add_Data(t_gdata::type2str(orb.id_type()), &orb);
+        data.Add_Data(t_gdata::type2str(obj.id_type()), &obj);
+        data.Add_Data(t_gdata::type2str(de.id_type()), &de);
+        data.Add_Data(t_gdata::type2str(erp.id_type()), &erp);
+        data.Add_Data(t_gdata::type2str(upd.id_type()), &upd);
+
+        t_gallprod prod;
+        t_gpvtflt_rec pvt(gen.site(0), &set, spdlog, &data);
+        pvt.Add_UPD(&upd);
+        pvt.setOUT(&prod);
+        pvt.processBatch(beg, end, false);
+        runs.push_back(pvt.rec->equ);
+    }
+    remove(rnx.c_str());
+    remove(atx.c_str());
+
+    // every epoch solved, bit for bit the same equations in the same order
+    CHECK(runs[0].size() >= (size_t)nepo);
+    CHECK(runs[0].size() == runs[1].size());
+    bool equal = runs[0].size() == runs[1].size();
+    for (size_t k = 0; equal && k < runs[0].size(); k++)
+        equal = same(runs[0][k].A, runs[1][k].A) && same(runs[0][k].P, runs[1][k].P) && same(runs[0][k].l, runs[1][k].l);
+    CHECK(equal);
+
+    return check_result("test_satthreads");
+}
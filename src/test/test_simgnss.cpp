@@ -0,0 +1,191 @@
+/**
+ * @file         test_simgnss.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        observations of GREAT_Sim decoded by t_rinexo: epochs, header, values and their geometry
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "gcheck.h"
+#include "gbenchdata.h"
+#include "gcfg_sim.h"
+#include "gsimgnss.h"
+#include "gall/gallobs.h"
+#include "gall/gallobj.h"
+#include "gcoders/rinexo.h"
+#include "gio/gfile.h"
+#include "gio/grtlog.h"
+#include "gutils/gconst.h"
+#include "gutils/gsysconv.h"
+
+using namespace gnut;
+using namespace great;
+
+// values of the file, satellite lines read by the columns of RINEX 3
+static map<string, vector<map<string, double>>> parse(const string &path, int &nepo)
+{
+    map<string, vector<map<string, double>>> res;
+    ifstream f(path.c_str());
+    string line;
+    nepo = 0;
+    while (getline(f, line) && line.find("END OF HEADER") == string::npos)
+        ;
+    while (getline(f, line))
+    {
+        if (line[0] == '>')
+        {
+            nepo++;
+            continue;
+        }
+        map<string, double> val;
+        for (size_t k = 0; 3 + 16 * k + 14 <= line.size(); k++)
+            val[k % 2 ? "L" + to_string(k / 2 + 1) : "C" + to_string(k / 2 + 1)] = str2dbl(line.substr(3 + 16 * k, 14));
+        res[line.substr(0, 3)].resize(nepo);
+        res[line.substr(0, 3)][nepo - 1] = val;
+    }
+    return res;
+}
+
+int main()
+{
+    const int nepo = 60;
+    const double intv = 30.0;
+    t_gbenchdata gen(50);
+    t_grtlog log("CONSOLE", spdlog::level::err, "test_simgnss");
+    t_spdlog spdlog = log.spdlog();
+
+    t_gtime end = gen.beg();
+    end.add_dsec(nepo * intv);
+    t_gcfg_sim gset;
+    {
+        // without noise, receiver clock and troposphere variation: the model is checked below
+        ostringstream os;
+        os << "<config>"
+           << " <gen> <beg> " << gen.beg().str_ymdhms("", false) << " </beg> <end> " << end.str_ymdhms("", false) << " </end>"
+           << " <sys> GPS </sys> <int> " << intv << " </int> </gen>"
+           << " <sim> <gnss code_noise=\"0\" phase_noise=\"0\" elev_mask=\"10\" vtec=\"20\" ztd_rw=\"0\" clk_offset=\"0\" clk_rw=\"0\" /> </sim>"
+           << "</config>";
+        istringstream is(os.str());
+        gset.read_istream(is);
+        gset.check();
+    }
+
+    t_gallprec orb(spdlog);
+    gen.prec(orb, 86400.0 + 900.0, 900.0);
+    orb.use_clksp3(true);
+
+    // one static receiver, as GREAT_Sim
+    const string site = "SIM1", path = "sim10010.26o";
+    t_gsimgnss gnss(&gset, spdlog, &orb, nullptr, nullptr);
+    t_gsimrec rec;
+    rec.name = site;
+    rec.xyz = gen.site_crd(0);
+    rec.rng = t_grandom(1);
+    rec.obs = make_shared<t_giof>();
+    rec.obs->tsys(t_gtime::GPS);
+    rec.obs->mask(path);
+    t_gtime half = gen.beg();
+    half.add_dsec(nepo / 2 * intv);
+    CHECK(gnss.epochs(gen.beg(), half) == nepo / 2);
+    gnss.run(rec);
+    CHECK(gnss.epochs(half, end) == nepo / 2);
+    gnss.run(rec);
+    rec.obs.reset();
+
+    int ntext = 0;
+    map<string, vector<map<string, double>>> text = parse(path, ntext);
+    CHECK(ntext == nepo);
+
+    t_gallobs obs(spdlog, &gset);
+    t_gallobj obj(spdlog, nullptr, nullptr);
+    {
+        t_rinexo coder(&gset, "", 4096);
+        coder.spdlog(spdlog);
+        t_gfile gio(spdlog);
+        gio.path("file://" + path);
+        coder.clear();
+        coder.path("file://" + path);
+        coder.add_data("ID0", &obs);
+        coder.add_data("OBJ", &obj);
+        gio.coder(&coder);
+        gio.run_read();
+    }
+    remove(path.c_str());
+
+    // header: marker and position
+    CHECK(obs.stations().count(site) == 1);
+    CHECK(obj.obj(site) != nullptr);
+    if (obj.obj(site))
+        CHECK((obj.obj(site)->crd(gen.beg()) - rec.xyz).norm() < 1e-3);
+
+    // every epoch and value as written
+    vector<t_gtime> epochs = obs.epochs(site);
+    CHECK(epochs.size() == static_cast<size_t>(nepo));
+    const double f1 = G01_F, f2 = G02_F, lam1 = CLIGHT / f1, lam2 = CLIGHT / f2;
+    int nval = 0, nwrong = 0, ngeom = 0, narc = 0;
+    map<string, double> gf_prev;
+    for (size_t i = 0; i < epochs.size(); i++)
+    {
+        double sec = epochs[i].diff(gen.beg());
+        CHECK_NEAR(sec, i * intv, 1e-6);
+        vector<t_gsatdata> sats = obs.obs(site, epochs[i]);
+        CHECK(sats.size() >= 4);
+        set<string> seen;
+        for (auto &sd : sats)
+        {
+            const string sat = sd.sat();
+            seen.insert(sat);
+            double C1 = sd.getobs("C1C"), L1 = sd.getobs("L1C"), C2 = sd.getobs("C2W"), L2 = sd.getobs("L2W");
+            const map<string, double> &val = text[sat][i];
+            for (auto &it : {make_pair("C1", C1), make_pair("L1", L1), make_pair("C2", C2), make_pair("L2", L2)})
+            {
+                nval++;
+                auto v = val.find(it.first);
+                if (v == val.end() || fabs(v->second - it.second) > 5e-4)
+                    nwrong++;
+            }
+
+            // ionosphere: code delayed and phase advanced by the same amount, ambiguities constant over the arc
+            CHECK(C2 - C1 > 0.0);
+            double gf = (C2 - C1) + (L2 * lam2 - L1 * lam1);
+            if (gf_prev.count(sat) && fabs(gf - gf_prev[sat]) > 0.05)
+                narc++;
+            gf_prev[sat] = gf;
+
+            // ionosphere-free code: geometry, satellite clock and the troposphere only
+            int isat = str2int(sat.substr(1)) - 1;
+            double pif = (f1 * f1 * C1 - f2 * f2 * C2) / (f1 * f1 - f2 * f2);
+            double tau = pif / CLIGHT;
+            t_gtriple xs = gen.sat_crd(isat, sec - tau);
+            double a = OMEGA * tau;
+            Eigen::Vector3d x(xs[0] * cos(a) + xs[1] * sin(a), -xs[0] * sin(a) + xs[1] * cos(a), xs[2]);
+            Eigen::Vector3d d = x - rec.xyz.crd_cvect_Eigen();
+            t_gtriple ell;
+            xyz2ell(rec.xyz, ell, false);
+            t_gtriple neu;
+            t_gtriple du(d / d.norm());
+            xyz2neu(ell, du, neu);
+            double ztd = (pif - d.norm() + CLIGHT * gen.sat_clk(isat, sec - tau)) * neu[2];
+            if (ztd > 2.0 && ztd < 2.8)
+                ngeom++;
+        }
+        // the same satellites as in the file
+        size_t nfile = 0;
+        for (auto &it : text)
+            if (it.second.size() > i && !it.second[i].empty())
+                nfile++;
+        CHECK(seen.size() == nfile);
+    }
+    CHECK(nval > 4 * 4 * nepo);
+    CHECK(nwrong == 0);
+    CHECK(narc == 0);
+    CHECK(ngeom == nval / 4);
+
+    return check_result("test_simgnss");
+}
@@ -0,0 +1,173 @@
+/**
+ * @file         test_smoother.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        RTS smoother of the feedback filter against the standard RTS smoother and a backward information filter
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <vector>
+#include "gcheck.h"
+#include "gmsf/gsmoother.h"
+
+using namespace great;
+
+int main()
+{
+    // constant velocity, position measured
+    const int n = 2, N = 60;
+    const double q = 0.01, R = 0.25;
+    Eigen::MatrixXd F(n, n), Q(n, n), I = Eigen::MatrixXd::Identity(n, n);
+    F << 1, 1, 0, 1;
+    Q << q / 3, q / 2, q / 2, q;
+    Eigen::RowVectorXd H(n);
+    H << 1, 0;
+
+    mt19937 gen(41);
+    normal_distribution<double> nd;
+    vector<double> z(N);
+    Eigen::VectorXd xt(n);
+    xt << 0, 1;
+    for (int k = 0; k < N; k++)
+    {
+        if (k)
+            xt = F * xt;
+        z[k] = xt(0) + sqrt(R) * nd(gen);
+    }
+
+    // forward filter with feedback: the nominal state takes the correction, the error state restarts at zero;
+    // the small block spills most of the nodes to the temporary file
+    t_gsmoother smt(n, n, 1, false, 256), smt_mem(n, n, 1, false);
+    vector<Eigen::VectorXd> xf(N), xp(N);
+    vector<Eigen::MatrixXd> Pf(N), Pp(N);
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+    Eigen::MatrixXd P = I * 100.0;
+    for (int k = 0; k < N; k++)
+    {
+        Eigen::MatrixXd Phi = I;
+        if (k)
+        {
+            x = F * x;
+            P = F * P * F.transpose() + Q;
+            Phi = F;
+        }
+        xp[k] = x;
+        Pp[k] = P;
+        double S = (H * P * H.transpose())(0) + R;
+        Eigen::VectorXd K = P * H.transpose() / S;
+        Eigen::VectorXd dx = K * (z[k] - (H * x)(0));
+        x += dx;
+        P = (I - K * H) * P;
+        xf[k] = x;
+        Pf[k] = P;
+
+        double extra = k;
+        bool out = (k % 3 != 1);
+        CHECK(smt.add(k, out, x.data(), &extra, Pp[k], P, Phi, dx));
+        CHECK(smt_mem.add(k, out, x.data(), &extra, Pp[k], P, Phi, dx));
+    }
+    CHECK(smt.size() == (size_t)N);
+
+    // standard RTS smoother of the same filter
+    vector<Eigen::VectorXd> xs(N);
+    vector<Eigen::MatrixXd> Ps(N);
+    xs[N - 1] = xf[N - 1];
+    Ps[N - 1] = Pf[N - 1];
+    for (int k = N - 2; k >= 0; k--)
+    {
+        Eigen::MatrixXd A = Pf[k] * F.transpose() * Pp[k + 1].inverse();
+        xs[k] = xf[k] + A * (xs[k + 1] - xp[k + 1]);
+        Ps[k] = Pf[k] + A * (Ps[k + 1] - Pp[k + 1]) * A.transpose();
+    }
+
+    vector<Eigen::VectorXd> s_mem(N);
+    vector<Eigen::MatrixXd> P_mem(N);
+    long nout = smt_mem.smooth([&](double t, const double *nav, const double *extra, const Eigen::VectorXd &s, const Eigen::MatrixXd &Psmt) {
+        int k = (int)t;
+        s_mem[k] = s;
+        P_mem[k] = Psmt;
+    });
+    CHECK(nout == N - N / 3);
+
+    int last = N, count = 0;
+    double maxd = 0.0;
+    long nout_spill = smt.smooth([&](double t, const double *nav, const double *extra, const Eigen::VectorXd &s, const Eigen::MatrixXd &Psmt) {
+        int k = (int)t;
+        CHECK(k < last && k % 3 != 1);
+        CHECK(extra[0] == t);
+        last = k;
+        count++;
+        Eigen::Map<const Eigen::VectorXd> nv(nav, n);
+        CHECK(check_maxdiff(nv, xf[k]) == 0.0);
+        maxd = max(maxd, check_maxdiff(Eigen::VectorXd(nv + s), xs[k]));
+        maxd = max(maxd, check_maxdiff(Psmt, Ps[k]));
+
+        // the nodes read back from the file are the ones kept in memory
+        CHECK(check_maxdiff(s, s_mem[k]) == 0.0);
+        CHECK(check_maxdiff(Psmt, P_mem[k]) == 0.0);
+    });
+    CHECK(nout_spill == nout && count == nout);
+    CHECK(maxd <= 1e-9);
+
+    // backward filter against an information filter run backward over the measurements
+    vector<Eigen::VectorXd> xb(N);
+    vector<Eigen::MatrixXd> Pb(N);
+    Eigen::MatrixXd Y = Eigen::MatrixXd::Zero(n, n), Qi = Q.inverse();
+    Eigen::VectorXd y = Eigen::VectorXd::Zero(n);
+    for (int k = N - 1; k >= 0; k--)
+    {
+        if (k < N - 1)
+        {
+            Eigen::MatrixXd G = Y * (Y + Qi).inverse();
+            Eigen::MatrixXd Yn = F.transpose() * (Y - G * Y) * F;
+            Eigen::VectorXd yn = F.transpose() * (I - G) * y;
+            Y = Yn;
+            y = yn;
+        }
+        Y += H.transpose() * H / R;
+        y += H.transpose() * z[k] / R;
+        if (k < N - 2)
+        {
+            Pb[k] = Y.inverse();
+            xb[k] = Pb[k] * y;
+        }
+    }
+    maxd = 0.0;
+    count = 0;
+    smt.smooth([&](double t, const double *nav, const double *extra, const Eigen::VectorXd &s, const Eigen::MatrixXd &Pback) {
+        int k = (int)t;
+        if (k >= N - 2)
+            return;
+        count++;
+        Eigen::Map<const Eigen::VectorXd> nv(nav, n);
+        maxd = max(maxd, check_maxdiff(Eigen::VectorXd(nv + s), xb[k]) / max(1.0, xb[k].cwiseAbs().maxCoeff()));
+        maxd = max(maxd, check_maxdiff(Pback, Pb[k]) / Pb[k].cwiseAbs().maxCoeff());
+    },
+               true);
+    CHECK(count > N / 2);
+    CHECK(maxd <= 1e-6);
+
+    // the log alone: records read backward across the file and the memory block
+    {
+        t_gspill spill(3, 5 * 3 * sizeof(double));
+        for (int i = 0; i < 23; i++)
+        {
+            double rec[3] = {(double)i, 2.0 * i, -1.0 * i};
+            CHECK(spill.push(rec));
+        }
+        CHECK(spill.size() == 23 && spill.spilled() > 0 && spill.spilled() < 23);
+        for (int i = 22; i >= 0; i--)
+        {
+            const double *rec = spill.at(i);
+            CHECK(rec && rec[0] == i && rec[1] == 2.0 * i && rec[2] == -1.0 * i);
+        }
+        CHECK(spill.at(23) == nullptr);
+        spill.clear();
+        CHECK(spill.size() == 0 && spill.spilled() == 0);
+    }
+
+    return check_result("test_smoother");
+}
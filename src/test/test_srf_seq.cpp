@@ -0,0 +1,229 @@
+/**
+ * @file         test_srf_seq.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        sequential square root covariance filter against the standard Kalman update
+ * @version      1.0
+ * @date         2026-10-18
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gcheck.h"
+#include "gproc/gflt.h"
+#include "gutils/gmatrixconv.h"
+
+using namespace gnut;
+
+static Matrix to_newmat(const Eigen::MatrixXd &E)
+{
+    Matrix M(E.rows(), E.cols());
+    for (int i = 0; i < E.rows(); i++)
+        for (int j = 0; j < E.cols(); j++)
+            M(i + 1, j + 1) = E(i, j);
+    return M;
+}
+
+// largest difference of the state corrections and covariances of the two filters
+static double diff(const ColumnVector &dx1, const SymmetricMatrix &Q1, const ColumnVector &dx2, const SymmetricMatrix &Q2)
+{
+    Eigen::VectorXd v1, v2;
+    Eigen::MatrixXd M1, M2;
+    Vector2Eigen(dx1, v1);
+    Vector2Eigen(dx2, v2);
+    Matrix2Eigen(Q1, M1);
+    Matrix2Eigen(Q2, M2);
+    return max(check_maxdiff(v1, v2) / max(1.0, v1.cwiseAbs().maxCoeff()), check_maxdiff(M1, M2) / M1.cwiseAbs().maxCoeff());
+}
+
+int main()
+{
+    mt19937 gen(37);
+    normal_distribution<double> nd;
+
+    // several epochs: diagonal process noise keeps the factor, a change of the correlations refactorises
+    for (int run = 0; run < 4; run++)
+    {
+        const int n = 6 + 5 * run;
+        SymmetricMatrix Qk, Qs;
+        Eigen2Matrix(check_spd(gen, n), Qk);
+        Qs = Qk;
+        t_kalman kalman;
+        t_SRF_seq srf;
+
+        for (int epo = 0; epo < 8; epo++)
+        {
+            // sparse design matrix as in the GNSS filters
+            const int m = 3 + (epo + run) % 6;
+            Eigen::MatrixXd Ae = Eigen::MatrixXd::Zero(m, n);
+            Eigen::VectorXd le(m);
+            for (int i = 0; i < m; i++)
+            {
+                le(i) = nd(gen);
+                for (int j = 0; j < n; j++)
+                    if ((i + j) % 3 == 0)
+                        Ae(i, j) = nd(gen);
+            }
+            Matrix A = to_newmat(Ae);
+            ColumnVector l, dxk, dxs;
+            Eigen2Vector(le, l);
+
+            long nfactor = srf.nfactor();
+            if (epo % 2)
+            {
+                DiagonalMatrix P(m);
+                for (int i = 1; i <= m; i++)
+                    P(i) = 1.0 / (0.1 + i % 3);
+                CHECK(kalman.update(A, P, l, dxk, Qk) == 1);
+                CHECK(srf.update(A, P, l, dxs, Qs) == 1);
+            }
+            else
+            {
+                // correlated observations are whitened
+                SymmetricMatrix P;
+                Eigen2Matrix(Eigen::MatrixXd(check_spd(gen, m, 0.5).inverse()), P);
+                CHECK(kalman.update(A, P, l, dxk, Qk) == 1);
+                CHECK(srf.update(A, P, l, dxs, Qs) == 1);
+            }
+            CHECK(diff(dxk, Qk, dxs, Qs) <= 1e-9);
+            if (epo > 0 && epo != 5)
+                CHECK(srf.nfactor() == nfactor);
+
+            // factor of the last update
+            Eigen::MatrixXd Q, U = srf.factor();
+            Matrix2Eigen(Qs, Q);
+            CHECK(check_maxdiff(Eigen::MatrixXd(U * U.transpose()), Q) <= 1e-9 * Q.cwiseAbs().maxCoeff());
+            CHECK(check_maxdiff(Eigen::MatrixXd(U.triangularView<Eigen::StrictlyLower>()), Eigen::MatrixXd::Zero(n, n)) == 0.0);
+
+            // time update of the next epoch
+            for (int i = 1; i <= n; i++)
+            {
+                double q = (i % 2) ? 0.01 * i : 0.0;
+                Qk(i, i) += q;
+                Qs(i, i) += q;
+            }
+            if (epo == 4)
+            {
+                Qk(2, 1) *= 0.5;
+                Qs(2, 1) *= 0.5;
+            }
+        }
+    }
+
+    // PPP-like epochs: white noise clock and kinematic position, random walk ZTD, ambiguities
+    // removed and appended by the owner; the factor follows without a new factorisation and
+    // gives the update of a fresh factorisation, the standard update within the conditioning
+    {
+        int n = 14;
+        SymmetricMatrix Qk, Qs;
+        Eigen2Matrix(check_spd(gen, n), Qk);
+        Qs = Qk;
+        t_kalman kalman;
+        t_SRF_seq srf;
+        bool same = true, close = true, bounded = true;
+        for (int epo = 0; epo < 30; epo++)
+        {
+            if (epo > 0)
+            {
+                vector<t_gprocnoise> proc;
+                for (int i = 1; i <= 4; i++)
+                    proc.push_back(t_gprocnoise(i, PROC_MODEL::WHITE_NOISE, 1e4 * i));
+                proc.push_back(t_gprocnoise(5, PROC_MODEL::RANDOM_WALK, 1e-4));
+                Matrix_predict(Qk, proc);
+                Matrix_predict(Qs, proc);
+
+                // satellite set / cycle slips: some ambiguities removed, new ones appended
+                if (epo % 3 == 0)
+                {
+                    vector<int> ind = {6 + epo % 4, n - 1};
+                    vector<int> ind_k(ind), ind_s(ind);
+                    srf.rem_states(ind);
+                    Matrix_rem(Qk, ind_k);
+                    Matrix_rem(Qs, ind_s);
+                    n -= 2;
+                }
+                if (epo % 4 == 1)
+                {
+                    vector<double> var = {900.0, 900.0, 400.0};
+                    srf.add_states(var);
+                    Matrix_add(Qk, var);
+                    Matrix_add(Qs, var);
+                    n += 3;
+                }
+            }
+
+            const int m = n + 4;
+            Eigen::MatrixXd Ae = Eigen::MatrixXd::Zero(m, n);
+            Eigen::VectorXd le(m);
+            for (int i = 0; i < m; i++)
+            {
+                le(i) = nd(gen);
+                for (int j = 0; j < 5; j++)
+                    Ae(i, j) = nd(gen);
+                if (i >= 4)
+                    Ae(i, 5 + (i - 4) % (n - 5)) = 1.0;
+            }
+            Matrix A = to_newmat(Ae);
+            ColumnVector l, dxk, dxs;
+            Eigen2Vector(le, l);
+            DiagonalMatrix P(m);
+            for (int i = 1; i <= m; i++)
+                P(i) = i % 2 ? 1.0 : 1e4;
+
+            // a filter factorised from scratch on the same covariance
+            SymmetricMatrix Qf = Qs;
+            ColumnVector dxf;
+            t_SRF_seq fresh;
+            CHECK(fresh.update(A, P, l, dxf, Qf) == 1);
+            CHECK(kalman.update(A, P, l, dxk, Qk) == 1);
+            CHECK(srf.update(A, P, l, dxs, Qs) == 1);
+            same = same && diff(dxf, Qf, dxs, Qs) <= 1e-12;
+            close = close && diff(dxk, Qk, dxs, Qs) <= 1e-6;
+            bounded = bounded && srf.factor().rows() == n;
+        }
+        CHECK(same);
+        CHECK(close);
+        CHECK(bounded);
+        CHECK(srf.nfactor() == 1);
+
+        // the owner changed the correlations: factorised again
+        Qs(7, 6) *= 0.5;
+        Qk(7, 6) *= 0.5;
+        Matrix A(1, n);
+        A = 0.0;
+        A(1, 1) = 1.0;
+        DiagonalMatrix P(1);
+        P(1) = 1.0;
+        ColumnVector l(1), dxk, dxs;
+        l(1) = 0.5;
+        CHECK(kalman.update(A, P, l, dxk, Qk) == 1);
+        CHECK(srf.update(A, P, l, dxs, Qs) == 1);
+        CHECK(diff(dxk, Qk, dxs, Qs) <= 1e-8);
+        CHECK(srf.nfactor() == 2);
+    }
+
+    // not positive definite: dx and Q unchanged
+    {
+        SymmetricMatrix Q(2);
+        Q(1, 1) = 1.0;
+        Q(2, 1) = 2.0;
+        Q(2, 2) = 1.0;
+        SymmetricMatrix Q0 = Q;
+        Matrix A(1, 2);
+        A(1, 1) = 1.0;
+        A(1, 2) = 0.0;
+        DiagonalMatrix P(1);
+        P(1) = 1.0;
+        ColumnVector l(1), dx(2);
+        l(1) = 1.0;
+        dx = 7.0;
+        t_SRF_seq srf;
+        CHECK(srf.update(A, P, l, dx, Q) == -1);
+        CHECK(dx(1) == 7.0 && dx(2) == 7.0);
+        for (int i = 1; i <= 2; i++)
+            for (int j = 1; j <= i; j++)
+                CHECK(Q(i, j) == Q0(i, j));
+    }
+
+    return check_result("test_srf_seq");
+}